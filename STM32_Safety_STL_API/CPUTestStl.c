@@ -4,69 +4,40 @@
 
 
 // Headerdateien einbinden -----------------------------------------------------
+#include <string.h>
+
 #include "config/version.h"
 
 #include "SafetyStl.h"
 
-#ifndef FEATURE_SAFETYCHECK_ARTIFICIAL_TEST_CPU_STL
-#define FEATURE_SAFETYCHECK_ARTIFICIAL_TEST_CPU_STL    (0)
-#endif
-
-#if FEATURE_SAFETYCHECK_ARTIFICIAL_TEST_CPU_STL
-#include "CPUTestStl_ArtificialFailing.h"
-#endif
+#include "FaultInjectionStl.h"
+#include "safety_trace.h"
 
 #include "CPUTestStl.h"
 // Allgemeine Definitionen -----------------------------------------------------
 
-typedef STL_Status_t (*func_CpuTestStl)(STL_TmStatus_t * const pSingleTmStatus);
-
-/// Statuswerte des zyklischen CPU-Tests
-/// Zeigt an, ob der zyklische Test konfiguriert ist.
-typedef enum
-{
-    CPU_CYCLIC_IDLE,        ///< CPU_CYCLIC_IDLE Ausgangszustand
-    CPU_CYCLIC_CONFIGURED,  ///< CPU_CYCLIC_CONFIGURED konfiguriert, bereit zum Starten
-} CPU_CYCLIC_STATE;
-
-/// Struktur für einen CPU-Test
-typedef struct
-{
-    STL_TmStatus_t tmStatus;         ///< Testmodul-Status von STL
-    STL_TmEnable_t tmEnable;         ///< Aktivieren
-    func_CpuTestStl cpuTestFunction; ///< Funktion zum Aufruf des Tests
-} CPU_TEST;
-
-CPU_TEST cpuTest[STL_CPU_TM_MAX] = { { STL_ERROR, STL_TEST_DISABLE, STL_SCH_RunCpuTM1 },   //0  TM1
-                                     { STL_ERROR, STL_TEST_ENABLE, STL_SCH_RunCpuTM1L },   //1  TM1L
-                                     { STL_ERROR, STL_TEST_ENABLE, STL_SCH_RunCpuTM2 },    //2  TM2
-                                     { STL_ERROR, STL_TEST_ENABLE, STL_SCH_RunCpuTM3 },    //3  TM3
-                                     { STL_ERROR, STL_TEST_ENABLE, STL_SCH_RunCpuTM4 },    //4  TM4
-                                     { STL_ERROR, STL_TEST_ENABLE, STL_SCH_RunCpuTM5 },    //5  TM5
-                                     { STL_ERROR, STL_TEST_ENABLE, STL_SCH_RunCpuTM6 },    //6  TM6
-                                     { STL_ERROR, STL_TEST_ENABLE, STL_SCH_RunCpuTM7 },    //7  TM7
-                                     { STL_ERROR, STL_TEST_ENABLE, STL_SCH_RunCpuTM8 },    //8  TM8
-                                     { STL_ERROR, STL_TEST_ENABLE, STL_SCH_RunCpuTM9 },    //9  TM9
-                                     { STL_ERROR, STL_TEST_ENABLE, STL_SCH_RunCpuTM10 },   //10 TM10
-                                     { STL_ERROR, STL_TEST_ENABLE, STL_SCH_RunCpuTM11 } }; //11 TM11
-
-/// Struktur für den zyklischen CPU-Test, enthält den gerade ausgeführten Test
-typedef struct
-{
-    CPU_TEST * currentTest;         ///< Zeiger auf aktuellen CPU-Test
-    STL_CpuTmxIndex_t testIndex;    ///< Aktueller Testindex
-    CPU_CYCLIC_STATE cyclicState;   ///< Status des zyklischen CPU-Tests.
-} CPU_TEST_CYCLIC;
+/// Standardeinstellung der CPU-Tests, wird bei der Initialisierung einer Instanz übernommen
+static CPU_TEST const cpuTestDefaults[STL_CPU_TM_MAX] = { { STL_ERROR, STL_TEST_DISABLE, STL_SCH_RunCpuTM1 },   //0  TM1
+                                                          { STL_ERROR, STL_TEST_ENABLE, STL_SCH_RunCpuTM1L },   //1  TM1L
+                                                          { STL_ERROR, STL_TEST_ENABLE, STL_SCH_RunCpuTM2 },    //2  TM2
+                                                          { STL_ERROR, STL_TEST_ENABLE, STL_SCH_RunCpuTM3 },    //3  TM3
+                                                          { STL_ERROR, STL_TEST_ENABLE, STL_SCH_RunCpuTM4 },    //4  TM4
+                                                          { STL_ERROR, STL_TEST_ENABLE, STL_SCH_RunCpuTM5 },    //5  TM5
+                                                          { STL_ERROR, STL_TEST_ENABLE, STL_SCH_RunCpuTM6 },    //6  TM6
+                                                          { STL_ERROR, STL_TEST_ENABLE, STL_SCH_RunCpuTM7 },    //7  TM7
+                                                          { STL_ERROR, STL_TEST_ENABLE, STL_SCH_RunCpuTM8 },    //8  TM8
+                                                          { STL_ERROR, STL_TEST_ENABLE, STL_SCH_RunCpuTM9 },    //9  TM9
+                                                          { STL_ERROR, STL_TEST_ENABLE, STL_SCH_RunCpuTM10 },   //10 TM10
+                                                          { STL_ERROR, STL_TEST_ENABLE, STL_SCH_RunCpuTM11 } }; //11 TM11
 
 /// Maximum tick value to regard tick overflow
 #define TICKS_MAX_VALUE                  (0xFFFFFFFF)
 
-CPU_TEST_CYCLIC cpuTestCyclic = {NULL, CPU_CYCLIC_IDLE, STL_CPU_TM1_IDX};
+/// Standardinstanz der Funktionen ohne Instanz, initialisiert beim ersten Aufruf
+static CPU_TEST_CONTEXT cpuTestDefault;
 
-/// Last time in ticks at which the cyclic test passed
-static U32 lastTestpassTicks = 0;
-/// Process safety time in ticks set by the user
-static U32 processSafetyTimeTicksInt = 0;
+/// Gesetzt, sobald die Standardinstanz initialisiert ist
+static bool cpuTestDefaultInitialized = false;
 
 //------------------------------------------------------------------------------
 // Prototypen interne Funktionen -----------------------------------------------
@@ -87,19 +58,53 @@ static bool CPUTestStl_HandleExecution(CPU_TEST * const cpuTestHandle);
 static bool CPUTestStl_CheckStatusResult(CPU_TEST const * const cpuTestHandle);
 
 /// Setzt die Zustände der CPU-Tests zurück auf "nicht-getestet" (@ref STL_NOT_TESTED).
-static void CPUTestStl_ResetAll(void);
+/// \param context Instanz der CPU-Tests.
+static void CPUTestStl_ResetAll(CPU_TEST_CONTEXT * const context);
 //------------------------------------------------------------------------------
 // Funktionsbereich externe Funktionen -----------------------------------------
 //------------------------------------------------------------------------------
 
 /// @author k.ehlen @date 16.01.2023
 EN61508_TestResult CPUTestStl_RunAll(void)
+    {
+    return CPUTestStl_ContextRunAll(CPUTestStl_GetDefaultContext());
+    }
+//------------------------------------------------------------------------------
+
+bool CPUTestStl_ContextInit(CPU_TEST_CONTEXT * const context)
+    {
+    if(context == NULL)
+        {
+        return false;
+        }
+
+    memset(context, 0, sizeof(*context));
+    memcpy(context->cpuTest, cpuTestDefaults, sizeof(context->cpuTest));
+    context->cpuTestCyclic.testIndex = STL_CPU_TM1_IDX;
+    context->cpuTestCyclic.cyclicState = CPU_CYCLIC_IDLE;
+    context->firstTestStart = true;
+    return true;
+    }
+//------------------------------------------------------------------------------
+
+CPU_TEST_CONTEXT * CPUTestStl_GetDefaultContext(void)
+    {
+    if(!cpuTestDefaultInitialized)
+        {
+        cpuTestDefaultInitialized = CPUTestStl_ContextInit(&cpuTestDefault);
+        }
+
+    return &cpuTestDefault;
+    }
+//------------------------------------------------------------------------------
+
+EN61508_TestResult CPUTestStl_ContextRunAll(CPU_TEST_CONTEXT * const context)
     {
     EN61508_TestResult testResult;
     U8 i;
     CPU_TEST * cpuTestHandle;
 
-    if(!Stl_SchedulerIsStarted())
+    if((context == NULL) || !Stl_SchedulerIsStarted())
         {
         return EN61508_TestFail;
         }
@@ -107,17 +112,14 @@ EN61508_TestResult CPUTestStl_RunAll(void)
     testResult = EN61508_TestPass;
 
     // Teststati zurücksetzen
-    CPUTestStl_ResetAll();
+    CPUTestStl_ResetAll(context);
 
     for (i = 0; i < STL_CPU_TM_MAX; i++)
         {
-        cpuTestHandle = &cpuTest[i];
+        cpuTestHandle = &context->cpuTest[i];
 
-#if FEATURE_SAFETYCHECK_ARTIFICIAL_TEST_CPU_STL
-#if CPUTEST_ARTI_FAILING_RUN_ALL
-        CPUTEST_ARTI_FAILING_START
-#endif
-#endif
+        FAULTINJECTIONSTL_START(FAULTINJECTIONSTL_CPU_RUN_ALL);
+        SAFETY_TRACE_BEGIN(eSAFETY_TRACE_TRACK_TASK, "STL CPU");
 
         // Testausführung
         if(!CPUTestStl_HandleExecution(cpuTestHandle))
@@ -125,11 +127,8 @@ EN61508_TestResult CPUTestStl_RunAll(void)
             testResult = EN61508_TestFail;
             }
 
-#if FEATURE_SAFETYCHECK_ARTIFICIAL_TEST_CPU_STL
-#if CPUTEST_ARTI_FAILING_RUN_ALL
-        CPUTEST_ARTI_FAILING_STOP
-#endif
-#endif
+        SAFETY_TRACE_END(eSAFETY_TRACE_TRACK_TASK, "STL CPU");
+        FAULTINJECTIONSTL_STOP();
 
         // Status prüfen
         if(!CPUTestStl_CheckStatusResult(cpuTestHandle))
@@ -144,80 +143,82 @@ EN61508_TestResult CPUTestStl_RunAll(void)
 
 /// @author k.ehlen @date 23.01.2023
 EN61508_TestResult CPUTestStl_RunCyclic(U32 const currentTicks)
+    {
+    return CPUTestStl_ContextRunCyclic(CPUTestStl_GetDefaultContext(), currentTicks);
+    }
+//------------------------------------------------------------------------------
+
+EN61508_TestResult CPUTestStl_ContextRunCyclic(CPU_TEST_CONTEXT * const context, U32 const currentTicks)
     {
     EN61508_TestResult testResult;
     bool processSafetyTimeFailure;
-    static bool firstTestStart = true;
+    CPU_TEST_CYCLIC * cpuTestCyclic;
 
-    if(cpuTestCyclic.cyclicState != CPU_CYCLIC_CONFIGURED)
+    if((context == NULL) || (context->cpuTestCyclic.cyclicState != CPU_CYCLIC_CONFIGURED))
         {
         return EN61508_TestFail;
         }
 
+    cpuTestCyclic = &context->cpuTestCyclic;
     testResult = EN61508_TestPass;
     processSafetyTimeFailure = false;
 
     // Set time reference after bootup
-    if(firstTestStart)
+    if(context->firstTestStart)
         {
-        firstTestStart = false;
-        lastTestpassTicks = currentTicks;
+        context->firstTestStart = false;
+        context->lastTestpassTicks = currentTicks;
         }
 
     // Teststati zurücksetzen, sobald von Vorne gestartet wird
-    if(cpuTestCyclic.currentTest == &cpuTest[STL_CPU_TM1_IDX])
+    if(cpuTestCyclic->currentTest == &context->cpuTest[STL_CPU_TM1_IDX])
         {
-        CPUTestStl_ResetAll();
+        CPUTestStl_ResetAll(context);
         }
-#if FEATURE_SAFETYCHECK_ARTIFICIAL_TEST_CPU_STL
-#if CPUTEST_ARTI_FAILING_RUN_CYCLIC
-        CPUTEST_ARTI_FAILING_START
-#endif
-#endif
+    FAULTINJECTIONSTL_START(FAULTINJECTIONSTL_CPU_RUN_CYCLIC);
+    SAFETY_TRACE_BEGIN(eSAFETY_TRACE_TRACK_TASK, "STL CPU cyclic");
 
     // Testausführung
-    if(!CPUTestStl_HandleExecution(cpuTestCyclic.currentTest))
+    if(!CPUTestStl_HandleExecution(cpuTestCyclic->currentTest))
         {
         testResult = EN61508_TestFail;
-        cpuTestCyclic.cyclicState = CPU_CYCLIC_IDLE;
+        cpuTestCyclic->cyclicState = CPU_CYCLIC_IDLE;
         }
 
-#if FEATURE_SAFETYCHECK_ARTIFICIAL_TEST_CPU_STL
-#if CPUTEST_ARTI_FAILING_RUN_CYCLIC
-        CPUTEST_ARTI_FAILING_STOP
-#endif
-#endif
+    SAFETY_TRACE_END(eSAFETY_TRACE_TRACK_TASK, "STL CPU cyclic");
+    FAULTINJECTIONSTL_STOP();
 
     // Prüfung Teststati
-    if(!CPUTestStl_CheckStatusResult(cpuTestCyclic.currentTest))
+    if(!CPUTestStl_CheckStatusResult(cpuTestCyclic->currentTest))
         {
         testResult = EN61508_TestFail;
-        cpuTestCyclic.cyclicState = CPU_CYCLIC_IDLE;
+        cpuTestCyclic->cyclicState = CPU_CYCLIC_IDLE;
         }
 
     // Auswahl des nächsten CPU-Tests
     if(testResult == EN61508_TestPass)
         {
-        cpuTestCyclic.testIndex++;
+        cpuTestCyclic->testIndex++;
 
-        if(cpuTestCyclic.testIndex == STL_CPU_TM_MAX)
+        if(cpuTestCyclic->testIndex == STL_CPU_TM_MAX)
             {
-            lastTestpassTicks = currentTicks;
-            cpuTestCyclic.testIndex = STL_CPU_TM1_IDX;
+            context->lastTestpassTicks = currentTicks;
+            cpuTestCyclic->testIndex = STL_CPU_TM1_IDX;
             }
 
-        cpuTestCyclic.currentTest = &cpuTest[cpuTestCyclic.testIndex];
+        cpuTestCyclic->currentTest = &context->cpuTest[cpuTestCyclic->testIndex];
         }
 
     // Check process safety timeout
     // All CPU tests have to be executed at least once per Process Safety Time (SOFTQM-1040)
-    if(currentTicks >= lastTestpassTicks)
+    if(currentTicks >= context->lastTestpassTicks)
         {
-        processSafetyTimeFailure = ((currentTicks - lastTestpassTicks) > processSafetyTimeTicksInt);
+        processSafetyTimeFailure = ((currentTicks - context->lastTestpassTicks) > context->processSafetyTimeTicksInt);
         }
     else
         {
-        processSafetyTimeFailure = ((TICKS_MAX_VALUE - lastTestpassTicks + currentTicks) > processSafetyTimeTicksInt);
+        processSafetyTimeFailure = ((TICKS_MAX_VALUE - context->lastTestpassTicks + currentTicks)
+                                    > context->processSafetyTimeTicksInt);
         }
 
     if(processSafetyTimeFailure)
@@ -231,20 +232,31 @@ EN61508_TestResult CPUTestStl_RunCyclic(U32 const currentTicks)
 
 /// @author k.ehlen @date 23.01.2023
 bool CPUTestStl_SetupTestCyclic(U32 const processSafetyTimeTicks)
+    {
+    return CPUTestStl_ContextSetupTestCyclic(CPUTestStl_GetDefaultContext(), processSafetyTimeTicks);
+    }
+//------------------------------------------------------------------------------
+
+bool CPUTestStl_ContextSetupTestCyclic(CPU_TEST_CONTEXT * const context, U32 const processSafetyTimeTicks)
     {
     bool result;
 
+    if(context == NULL)
+        {
+        return false;
+        }
+
     if(Stl_SchedulerIsStarted())
         {
-        cpuTestCyclic.testIndex = STL_CPU_TM1_IDX;
-        cpuTestCyclic.currentTest = &cpuTest[cpuTestCyclic.testIndex];
-        cpuTestCyclic.cyclicState = CPU_CYCLIC_CONFIGURED;
+        context->cpuTestCyclic.testIndex = STL_CPU_TM1_IDX;
+        context->cpuTestCyclic.currentTest = &context->cpuTest[context->cpuTestCyclic.testIndex];
+        context->cpuTestCyclic.cyclicState = CPU_CYCLIC_CONFIGURED;
         result = true;
-        processSafetyTimeTicksInt = processSafetyTimeTicks;
+        context->processSafetyTimeTicksInt = processSafetyTimeTicks;
         }
     else
         {
-        cpuTestCyclic.cyclicState = CPU_CYCLIC_IDLE;
+        context->cpuTestCyclic.cyclicState = CPU_CYCLIC_IDLE;
         result = false;
         }
 
@@ -252,14 +264,39 @@ bool CPUTestStl_SetupTestCyclic(U32 const processSafetyTimeTicks)
     }
 //------------------------------------------------------------------------------
 
+U32 CPUTestStl_GetMaxCallIntervalTicks(void)
+    {
+    return CPUTestStl_ContextGetMaxCallIntervalTicks(CPUTestStl_GetDefaultContext());
+    }
+//------------------------------------------------------------------------------
+
+U32 CPUTestStl_ContextGetMaxCallIntervalTicks(CPU_TEST_CONTEXT const * const context)
+    {
+    if((context == NULL) || (context->cpuTestCyclic.cyclicState != CPU_CYCLIC_CONFIGURED))
+        {
+        return 0;
+        }
+
+    // Pro Aufruf wird ein Test ausgeführt, ein zusätzlicher Aufruf als Reserve
+    return context->processSafetyTimeTicksInt / ((U32) STL_CPU_TM_MAX + 1);
+    }
+//------------------------------------------------------------------------------
+
 /// @author k.ehlen @date 16.01.2023
 EN61508_TestResult CPUTestStl_RunSingle(STL_CpuTmxIndex_t const cpuIndex)
     {
+    return CPUTestStl_ContextRunSingle(CPUTestStl_GetDefaultContext(), cpuIndex);
+    }
+//------------------------------------------------------------------------------
+
+EN61508_TestResult CPUTestStl_ContextRunSingle(CPU_TEST_CONTEXT * const context,
+                                               STL_CpuTmxIndex_t const cpuIndex)
+    {
     EN61508_TestResult testResult;
 
     CPU_TEST * cpuTestHandle;
 
-    if(cpuIndex >= STL_CPU_TM_MAX)
+    if((context == NULL) || (cpuIndex >= STL_CPU_TM_MAX))
         {
         return EN61508_TestFail;
         }
@@ -269,14 +306,11 @@ EN61508_TestResult CPUTestStl_RunSingle(STL_CpuTmxIndex_t const cpuIndex)
         return EN61508_TestFail;
         }
 
-    cpuTestHandle = &cpuTest[cpuIndex];
+    cpuTestHandle = &context->cpuTest[cpuIndex];
     testResult = EN61508_TestPass;
 
-#if FEATURE_SAFETYCHECK_ARTIFICIAL_TEST_CPU_STL
-#if CPUTEST_ARTI_FAILING_RUN_SINGLE
-        CPUTEST_ARTI_FAILING_START
-#endif
-#endif
+    FAULTINJECTIONSTL_START(FAULTINJECTIONSTL_CPU_RUN_SINGLE);
+    SAFETY_TRACE_BEGIN(eSAFETY_TRACE_TRACK_TASK, "STL CPU single");
 
     // Testausführung
     if(!CPUTestStl_HandleExecution(cpuTestHandle))
@@ -284,11 +318,8 @@ EN61508_TestResult CPUTestStl_RunSingle(STL_CpuTmxIndex_t const cpuIndex)
         testResult = EN61508_TestFail;
         }
 
-#if FEATURE_SAFETYCHECK_ARTIFICIAL_TEST_CPU_STL
-#if CPUTEST_ARTI_FAILING_RUN_SINGLE
-        CPUTEST_ARTI_FAILING_STOP
-#endif
-#endif
+    SAFETY_TRACE_END(eSAFETY_TRACE_TRACK_TASK, "STL CPU single");
+    FAULTINJECTIONSTL_STOP();
 
     // Prüfen, ob Test bestanden wurde
     if(cpuTestHandle->tmStatus != STL_PASSED)
@@ -366,12 +397,12 @@ static bool CPUTestStl_CheckStatusResult(CPU_TEST const * const cpuTestHandle)
 //------------------------------------------------------------------------------
 
 /// @author k.ehlen @date 23.01.2023
-static void CPUTestStl_ResetAll(void)
+static void CPUTestStl_ResetAll(CPU_TEST_CONTEXT * const context)
     {
     U8 i;
     for (i = 0; i < STL_CPU_TM_MAX; i++)
         {
-        cpuTest[i].tmStatus = STL_NOT_TESTED;
+        context->cpuTest[i].tmStatus = STL_NOT_TESTED;
         }
     }
 //------------------------------------------------------------------------------
@@ -24,6 +24,11 @@
  *      Ein ausgewählter CPU-Test kann ausgeführt werden.
  *       (++) CPUTestStl_RunSingle()
  *
+ * Der Zustand der Tests liegt in einer Instanz @ref CPU_TEST_CONTEXT. Die
+ * Funktionen ohne Instanz arbeiten auf einer Standardinstanz, die Funktionen
+ * CPUTestStl_Context...() auf einer eigenen Instanz, z.B. für voneinander
+ * unabhängige Testabläufe in der Simulation.
+ *
  * @{
  */
 #ifndef STM32_SAFETY_STL_CPUTEST_CPU_TEST_STL_H
@@ -43,6 +48,43 @@ extern "C" {
 
 // Typdefinitionen--------------------------------------------------------------
 
+/// Testfunktion der STL für einen CPU-Test
+typedef STL_Status_t (*func_CpuTestStl)(STL_TmStatus_t * const pSingleTmStatus);
+
+/// Statuswerte des zyklischen CPU-Tests
+/// Zeigt an, ob der zyklische Test konfiguriert ist.
+typedef enum
+{
+    CPU_CYCLIC_IDLE,        ///< CPU_CYCLIC_IDLE Ausgangszustand
+    CPU_CYCLIC_CONFIGURED,  ///< CPU_CYCLIC_CONFIGURED konfiguriert, bereit zum Starten
+} CPU_CYCLIC_STATE;
+
+/// Struktur für einen CPU-Test
+typedef struct
+{
+    STL_TmStatus_t tmStatus;         ///< Testmodul-Status von STL
+    STL_TmEnable_t tmEnable;         ///< Aktivieren
+    func_CpuTestStl cpuTestFunction; ///< Funktion zum Aufruf des Tests
+} CPU_TEST;
+
+/// Struktur für den zyklischen CPU-Test, enthält den gerade ausgeführten Test
+typedef struct
+{
+    CPU_TEST * currentTest;         ///< Zeiger auf aktuellen CPU-Test
+    STL_CpuTmxIndex_t testIndex;    ///< Aktueller Testindex
+    CPU_CYCLIC_STATE cyclicState;   ///< Status des zyklischen CPU-Tests.
+} CPU_TEST_CYCLIC;
+
+/// Instanz der CPU-Tests
+typedef struct
+{
+    CPU_TEST cpuTest[STL_CPU_TM_MAX];   ///< CPU-Tests mit Aktivierung und Status
+    CPU_TEST_CYCLIC cpuTestCyclic;      ///< Zustand des zyklischen CPU-Tests
+    U32 lastTestpassTicks;              ///< Last time in ticks at which the cyclic test passed
+    U32 processSafetyTimeTicksInt;      ///< Process safety time in ticks set by the user
+    bool firstTestStart;                ///< Set until the time reference after bootup is taken
+} CPU_TEST_CONTEXT;
+
 // externe Variablen -----------------------------------------------------------
 
 // Prototypen ------------------------------------------------------------------
@@ -53,6 +95,23 @@ extern "C" {
 /// sonst EN61508_TestFail.
 extern EN61508_TestResult CPUTestStl_RunAll(void);
 
+/// Initialisierung einer Instanz der CPU-Tests mit den Standardeinstellungen
+/// der Aktivierung. Setzt den gesamten Zustand der Instanz zurück, z.B. zwischen
+/// zwei Tests in der Simulation.
+/// \param context Instanz der CPU-Tests.
+/// \return @c true bei Erfolg, sonst @c false.
+extern bool CPUTestStl_ContextInit(CPU_TEST_CONTEXT * const context);
+
+/// Liefert die Standardinstanz, auf der die Funktionen ohne Instanz arbeiten.
+/// \return Standardinstanz der CPU-Tests.
+extern CPU_TEST_CONTEXT * CPUTestStl_GetDefaultContext(void);
+
+/// Führt alle aktivierten CPU-Tests einer Instanz aus, siehe CPUTestStl_RunAll().
+/// \param context Instanz der CPU-Tests.
+/// \return EN61508_TestPass, wenn die durchgeführten Tests bestanden sind,
+/// sonst EN61508_TestFail.
+extern EN61508_TestResult CPUTestStl_ContextRunAll(CPU_TEST_CONTEXT * const context);
+
 /// Führt stückweise alle aktivierten CPU-Tests aus. Pro Aufruf wird ein Test ausgeführt.
 /// Deaktivierte Tests werden übersprungen.
 /// Es wird geprüft, ob der Test mindestens einmal innerhalb der Process Safety Time durchläuft.
@@ -61,18 +120,52 @@ extern EN61508_TestResult CPUTestStl_RunAll(void);
 /// sonst EN61508_TestFail.
 extern EN61508_TestResult CPUTestStl_RunCyclic(U32 const currentTicks);
 
+/// Zyklischer CPU-Test einer Instanz, siehe CPUTestStl_RunCyclic().
+/// \param context Instanz der CPU-Tests.
+/// \param currentTicks Aktuelle Zeit in Ticks.
+/// \return EN61508_TestPass, wenn die durchgeführten Tests bestanden sind,
+/// sonst EN61508_TestFail.
+extern EN61508_TestResult CPUTestStl_ContextRunCyclic(CPU_TEST_CONTEXT * const context, U32 const currentTicks);
+
 /// Initialisiert den zyklischen CPU-Test. Einmalig vor dem Test notwendig.
 /// Es wird geprüft, ob der Test mindestens einmal innerhalb der Process Safety Time durchläuft.
 /// \param processSafetyTimeTicks Process Safety Time (PST) in Ticks.
 /// \return @c true bei Erfolg, sonst @c false.
 extern bool CPUTestStl_SetupTestCyclic(U32 const processSafetyTimeTicks);
 
+/// Initialisiert den zyklischen CPU-Test einer Instanz, siehe CPUTestStl_SetupTestCyclic().
+/// \param context Instanz der CPU-Tests.
+/// \param processSafetyTimeTicks Process Safety Time (PST) in Ticks.
+/// \return @c true bei Erfolg, sonst @c false.
+extern bool CPUTestStl_ContextSetupTestCyclic(CPU_TEST_CONTEXT * const context, U32 const processSafetyTimeTicks);
+
+/// Maximaler Abstand zwischen zwei Aufrufen von CPUTestStl_RunCyclic(), damit
+/// alle CPU-Tests innerhalb der Process Safety Time durchlaufen.
+/// Wird für den ereignisgesteuerten Aufruf der Safety-Task benötigt.
+/// \return Maximaler Aufrufabstand in Ticks, 0 wenn der Test nicht konfiguriert
+/// ist oder die Process Safety Time nicht eingehalten werden kann.
+extern U32 CPUTestStl_GetMaxCallIntervalTicks(void);
+
+/// Maximaler Aufrufabstand des zyklischen CPU-Tests einer Instanz, siehe
+/// CPUTestStl_GetMaxCallIntervalTicks().
+/// \param context Instanz der CPU-Tests.
+/// \return Maximaler Aufrufabstand in Ticks, 0 wenn der Test nicht konfiguriert
+/// ist oder die Process Safety Time nicht eingehalten werden kann.
+extern U32 CPUTestStl_ContextGetMaxCallIntervalTicks(CPU_TEST_CONTEXT const * const context);
+
 /// Führt einen einzelnen CPU-Test aus. Wenn der Test deaktiviert ist oder nicht bestanden ist,
 /// wird ein Fehler zurückgegeben.
 /// \param cpuIndex Index für die Auswahl des Tests.
 /// \return EN61508_TestPass, wenn der Test erfolgreich durchgeführt wurde, sonst EN61508_TestFail.
 extern EN61508_TestResult CPUTestStl_RunSingle(STL_CpuTmxIndex_t const cpuIndex);
 
+/// Führt einen einzelnen CPU-Test einer Instanz aus, siehe CPUTestStl_RunSingle().
+/// \param context Instanz der CPU-Tests.
+/// \param cpuIndex Index für die Auswahl des Tests.
+/// \return EN61508_TestPass, wenn der Test erfolgreich durchgeführt wurde, sonst EN61508_TestFail.
+extern EN61508_TestResult CPUTestStl_ContextRunSingle(CPU_TEST_CONTEXT * const context,
+                                                      STL_CpuTmxIndex_t const cpuIndex);
+
 #ifdef __cplusplus
 }
 #endif
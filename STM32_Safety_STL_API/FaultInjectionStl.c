@@ -0,0 +1,289 @@
+/*******************************************************************************
+ * Copyright (c) 2026 TWK-ELEKTRONIK GmbH. All rights reserved.
+ ******************************************************************************/
+
+
+// Headerdateien einbinden -----------------------------------------------------
+#include "config/version.h"
+
+#include <string.h>
+
+#include "SafetyStl.h"
+#include "FaultInjectionStl.h"
+
+#if FEATURE_SAFETYCHECK_FAULT_INJECTION_STL
+// Allgemeine Definitionen -----------------------------------------------------
+
+/// Start value of the random numbers without a seed.
+#define FAULTINJECTIONSTL_SEED_DEFAULT      (0x2545F491u)
+
+/// Tested module of an injection point.
+typedef enum
+{
+    FAULTINJECTIONSTL_MODULE_CPU = 0,
+    FAULTINJECTIONSTL_MODULE_ROM,
+    FAULTINJECTIONSTL_MODULE_RAM,
+    FAULTINJECTIONSTL_MODULE_COUNT
+} FAULTINJECTIONSTL_MODULE;
+
+/// State of an injection point.
+typedef struct
+{
+    FAULTINJECTIONSTL_ARM arm;                  ///< Remaining skip and trigger count
+    FAULTINJECTIONSTL_STATISTICS statistics;    ///< Counters since the last arming
+} FAULTINJECTIONSTL_STATE;
+
+/// Names of the injection points, in the order of @ref FAULTINJECTIONSTL_POINT.
+static char const * const pointName[FAULTINJECTIONSTL_POINT_COUNT] =
+    {
+    "CPU_RUN_ALL",
+    "CPU_RUN_CYCLIC",
+    "CPU_RUN_SINGLE",
+    "ROM_INIT_ALL",
+    "ROM_INIT_CYCLIC",
+    "ROM_CONFIGURE_ALL",
+    "ROM_CONFIGURE_CYCLIC",
+    "ROM_RUN_ALL",
+    "ROM_RUN_CYCLIC",
+    "ROM_RESET_CYCLIC",
+    "RAM_INIT_ALL",
+    "RAM_INIT_CYCLIC",
+    "RAM_CONFIGURE_ALL",
+    "RAM_CONFIGURE_CYCLIC",
+    "RAM_RUN_ALL",
+    "RAM_RUN_CYCLIC",
+    "RAM_RESET_CYCLIC"
+    };
+
+/// Tested module of the injection points, in the order of @ref FAULTINJECTIONSTL_POINT.
+static FAULTINJECTIONSTL_MODULE const pointModule[FAULTINJECTIONSTL_POINT_COUNT] =
+    {
+    FAULTINJECTIONSTL_MODULE_CPU, FAULTINJECTIONSTL_MODULE_CPU, FAULTINJECTIONSTL_MODULE_CPU,
+    FAULTINJECTIONSTL_MODULE_ROM, FAULTINJECTIONSTL_MODULE_ROM, FAULTINJECTIONSTL_MODULE_ROM,
+    FAULTINJECTIONSTL_MODULE_ROM, FAULTINJECTIONSTL_MODULE_ROM, FAULTINJECTIONSTL_MODULE_ROM,
+    FAULTINJECTIONSTL_MODULE_ROM,
+    FAULTINJECTIONSTL_MODULE_RAM, FAULTINJECTIONSTL_MODULE_RAM, FAULTINJECTIONSTL_MODULE_RAM,
+    FAULTINJECTIONSTL_MODULE_RAM, FAULTINJECTIONSTL_MODULE_RAM, FAULTINJECTIONSTL_MODULE_RAM,
+    FAULTINJECTIONSTL_MODULE_RAM
+    };
+
+// externe Variablen -----------------------------------------------------------
+
+/// Testmodul-Statuswerte, die durch das Artificial-Failing erzwungen werden.
+/// CPU: Alle Testmodule ausser TM1 werden auf @ref STL_FAILED gesetzt.
+/// ROM und RAM: Der Test-Status wird auf @ref STL_FAILED gesetzt.
+static STL_ArtifFailingConfig_t const moduleFail[FAULTINJECTIONSTL_MODULE_COUNT] =
+    {
+        {
+            {STL_NOT_TESTED, STL_FAILED, STL_FAILED, STL_FAILED, STL_FAILED, STL_FAILED,
+             STL_FAILED, STL_FAILED, STL_FAILED, STL_FAILED, STL_FAILED, STL_FAILED},
+            STL_NOT_TESTED,
+            STL_NOT_TESTED
+        },
+        {
+            {STL_NOT_TESTED, STL_NOT_TESTED, STL_NOT_TESTED, STL_NOT_TESTED, STL_NOT_TESTED, STL_NOT_TESTED,
+             STL_NOT_TESTED, STL_NOT_TESTED, STL_NOT_TESTED, STL_NOT_TESTED, STL_NOT_TESTED, STL_NOT_TESTED},
+            STL_FAILED,
+            STL_NOT_TESTED
+        },
+        {
+            {STL_NOT_TESTED, STL_NOT_TESTED, STL_NOT_TESTED, STL_NOT_TESTED, STL_NOT_TESTED, STL_NOT_TESTED,
+             STL_NOT_TESTED, STL_NOT_TESTED, STL_NOT_TESTED, STL_NOT_TESTED, STL_NOT_TESTED, STL_NOT_TESTED},
+            STL_NOT_TESTED,
+            STL_FAILED
+        }
+    };
+
+/// State of the injection points, all disarmed after start.
+static FAULTINJECTIONSTL_STATE pointState[FAULTINJECTIONSTL_POINT_COUNT];
+
+/// State of the random numbers (xorshift32).
+static U32 randomState = FAULTINJECTIONSTL_SEED_DEFAULT;
+
+/// Set while an artificial failing of the STL is started.
+static bool injectionActive = false;
+
+// Prototypen ------------------------------------------------------------------
+
+/// Returns the next random number.
+/// \return Random number, never 0.
+static U32 FaultInjectionStl_Random(void);
+
+/// Decides whether an armed injection point triggers at this pass.
+/// \param state State of the injection point.
+/// \return true if a failure is injected.
+static bool FaultInjectionStl_Trigger(FAULTINJECTIONSTL_STATE * const state);
+
+//------------------------------------------------------------------------------
+// Funktionsbereich externe Funktionen -----------------------------------------
+//------------------------------------------------------------------------------
+
+char const * FaultInjectionStl_GetName(FAULTINJECTIONSTL_POINT const point)
+    {
+    if((U32) point >= (U32) FAULTINJECTIONSTL_POINT_COUNT)
+        {
+        return NULL;
+        }
+
+    return pointName[point];
+    }
+//------------------------------------------------------------------------------
+
+bool FaultInjectionStl_Find(char const * const name, FAULTINJECTIONSTL_POINT * const point)
+    {
+    U32 i;
+
+    if((name == NULL) || (point == NULL))
+        {
+        return false;
+        }
+
+    for(i = 0; i < (U32) FAULTINJECTIONSTL_POINT_COUNT; i++)
+        {
+        if(strcmp(name, pointName[i]) == 0)
+            {
+            *point = (FAULTINJECTIONSTL_POINT) i;
+            return true;
+            }
+        }
+
+    return false;
+    }
+//------------------------------------------------------------------------------
+
+bool FaultInjectionStl_Arm(char const * const name, FAULTINJECTIONSTL_ARM const * const arm)
+    {
+    FAULTINJECTIONSTL_POINT point;
+
+    if((arm == NULL) || (arm->probability > FAULTINJECTIONSTL_PROBABILITY_MAX))
+        {
+        return false;
+        }
+
+    if(!FaultInjectionStl_Find(name, &point))
+        {
+        return false;
+        }
+
+    pointState[point].arm = *arm;
+    memset(&pointState[point].statistics, 0, sizeof(pointState[point].statistics));
+    return true;
+    }
+//------------------------------------------------------------------------------
+
+void FaultInjectionStl_DisarmAll(void)
+    {
+    memset(pointState, 0, sizeof(pointState));
+    }
+//------------------------------------------------------------------------------
+
+void FaultInjectionStl_SetSeed(U32 const seed)
+    {
+    // xorshift32 bleibt bei 0 stehen
+    randomState = (seed != 0u) ? seed : FAULTINJECTIONSTL_SEED_DEFAULT;
+    }
+//------------------------------------------------------------------------------
+
+bool FaultInjectionStl_GetStatistics(char const * const name, FAULTINJECTIONSTL_STATISTICS * const statistics)
+    {
+    FAULTINJECTIONSTL_POINT point;
+
+    if((statistics == NULL) || !FaultInjectionStl_Find(name, &point))
+        {
+        return false;
+        }
+
+    *statistics = pointState[point].statistics;
+    return true;
+    }
+//------------------------------------------------------------------------------
+
+bool FaultInjectionStl_Start(FAULTINJECTIONSTL_POINT const point)
+    {
+    FAULTINJECTIONSTL_STATE * state;
+
+    if((U32) point >= (U32) FAULTINJECTIONSTL_POINT_COUNT)
+        {
+        return false;
+        }
+
+    state = &pointState[point];
+    state->statistics.passCount++;
+
+    if(!FaultInjectionStl_Trigger(state))
+        {
+        return false;
+        }
+
+    if(STL_SCH_StartArtifFailing(&moduleFail[pointModule[point]]) != STL_OK)
+        {
+        state->statistics.stlErrorCount++;
+        return false;
+        }
+
+    injectionActive = true;
+    state->statistics.injectCount++;
+    return true;
+    }
+//------------------------------------------------------------------------------
+
+void FaultInjectionStl_Stop(void)
+    {
+    if(injectionActive)
+        {
+        injectionActive = false;
+        (void) STL_SCH_StopArtifFailing();
+        }
+    }
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Funktionsbereich interne Funktionen -----------------------------------------
+//------------------------------------------------------------------------------
+
+static U32 FaultInjectionStl_Random(void)
+    {
+    U32 x = randomState;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    randomState = x;
+
+    return x;
+    }
+//------------------------------------------------------------------------------
+
+static bool FaultInjectionStl_Trigger(FAULTINJECTIONSTL_STATE * const state)
+    {
+    FAULTINJECTIONSTL_ARM * const arm = &state->arm;
+
+    if((arm->triggerCount == 0u) || (arm->probability == 0u))
+        {
+        return false;
+        }
+
+    if(arm->skipCount > 0u)
+        {
+        arm->skipCount--;
+        return false;
+        }
+
+    // Zufallszahl nur bei echter Wahrscheinlichkeit ziehen, damit deterministische
+    // Einbaustellen die Zufallsfolge der übrigen nicht verschieben
+    if((arm->probability < FAULTINJECTIONSTL_PROBABILITY_MAX)
+            && ((FaultInjectionStl_Random() % FAULTINJECTIONSTL_PROBABILITY_MAX) >= arm->probability))
+        {
+        return false;
+        }
+
+    if(arm->triggerCount != FAULTINJECTIONSTL_TRIGGER_UNLIMITED)
+        {
+        arm->triggerCount--;
+        }
+
+    return true;
+    }
+//------------------------------------------------------------------------------
+
+#endif /* FEATURE_SAFETYCHECK_FAULT_INJECTION_STL */
@@ -0,0 +1,191 @@
+/*******************************************************************************
+ * Copyright (c) 2026 TWK-ELEKTRONIK GmbH. All rights reserved.
+ ******************************************************************************/
+
+/**
+ * \defgroup FaultInjectionStl Fehlereinbau der Self-Test-Library
+ *
+ * Fehlereinbau zur Laufzeit zum Testen der CPU-, ROM- und RAM-Tests. An den
+ * Einbaustellen wird über das Artificial-Failing der Self-Test-Library ein
+ * Fehlschlag der jeweiligen STL-Funktion erzwungen.
+ *
+ * Es handelt sich hierbei nicht um Unittests. Ungültige Testkonfigurationen oder
+ * ungültige Funktionsargumente werden nicht getestet.
+ *
+ * Die Einbaustellen sind immer einkompiliert, wenn
+ * @ref FEATURE_SAFETYCHECK_FAULT_INJECTION_STL gesetzt ist, und werden zur
+ * Laufzeit über ihren Namen scharf geschaltet. Mehrere Einbaustellen können
+ * gleichzeitig aktiv sein, damit läuft die gesamte Fehlermatrix ohne Neubau
+ * in einem Testprogramm. FaultInjectionStl.c ist nicht Teil der Modulquellen
+ * (MODULE_SOURCE), Testbuilds mit dem Flag binden die Datei selbst ein.
+ *
+ *  |Einbaustelle          | Funktion         | Hard-Error              |
+ *  |---------------------:|:----------------:|:------------------------|
+ *  | CPU_RUN_ALL          | Ausführung       | HARD_ERR_CPU            |
+ *  | CPU_RUN_CYCLIC       | Ausführung       | HARD_ERR_CPU_CYCLIC     |
+ *  | CPU_RUN_SINGLE       | Ausführung       | Bisher nicht verwendet  |
+ *  | ROM_INIT_ALL         | Initialisierung  | HARD_ERR_MEM_ROM        |
+ *  | ROM_INIT_CYCLIC      | Initialisierung  | HARD_ERR_MEM_ROM_CYCLIC |
+ *  | ROM_CONFIGURE_ALL    | Konfiguration    | HARD_ERR_MEM_ROM        |
+ *  | ROM_CONFIGURE_CYCLIC | Konfiguration    | HARD_ERR_MEM_ROM_CYCLIC |
+ *  | ROM_RUN_ALL          | Ausführung       | HARD_ERR_MEM_ROM        |
+ *  | ROM_RUN_CYCLIC       | Ausführung       | HARD_ERR_MEM_ROM_CYCLIC |
+ *  | ROM_RESET_CYCLIC     | Reset (Neustart) | HARD_ERR_MEM_ROM_CYCLIC |
+ *  | RAM_INIT_ALL         | Initialisierung  | HARD_ERR_MEM_RAM        |
+ *  | RAM_INIT_CYCLIC      | Initialisierung  | HARD_ERR_MEM_RAM_CYCLIC |
+ *  | RAM_CONFIGURE_ALL    | Konfiguration    | HARD_ERR_MEM_RAM        |
+ *  | RAM_CONFIGURE_CYCLIC | Konfiguration    | HARD_ERR_MEM_RAM_CYCLIC |
+ *  | RAM_RUN_ALL          | Ausführung       | HARD_ERR_MEM_RAM        |
+ *  | RAM_RUN_CYCLIC       | Ausführung       | HARD_ERR_MEM_RAM_CYCLIC |
+ *  | RAM_RESET_CYCLIC     | Reset (Neustart) | HARD_ERR_MEM_RAM_CYCLIC |
+ *
+ * Beispiel: Der dritte Durchlauf des zyklischen RAM-Tests schlägt fehl.
+ *
+ *     FAULTINJECTIONSTL_ARM arm = { 2u, 1u, FAULTINJECTIONSTL_PROBABILITY_MAX };
+ *     FaultInjectionStl_Arm("RAM_RUN_CYCLIC", &arm);
+ *
+ * Die Funktionen sind nicht reentrant. Scharfschalten und Einbaustellen werden
+ * aus derselben Task (Safety-Task bzw. Testprogramm) ausgeführt.
+ *
+ * @{
+ */
+#ifndef STM32_SAFETY_STL_FAULT_INJECTION_STL_H
+#define STM32_SAFETY_STL_FAULT_INJECTION_STL_H
+
+// Headerdateien einbinden -----------------------------------------------------
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Allgemeine Definitionen -----------------------------------------------------
+
+#ifndef FEATURE_SAFETYCHECK_FAULT_INJECTION_STL
+/// \ingroup feature_flags
+/// Baut die Einbaustellen für den Fehlereinbau zur Laufzeit in die CPU-, ROM-
+/// und RAM-Tests ein. Nur für Testbuilds, per Default deaktiviert.
+#define FEATURE_SAFETYCHECK_FAULT_INJECTION_STL     (0)
+#endif
+
+#if (defined(FEATURE_SAFETYCHECK_ARTIFICIAL_TEST_CPU_STL) && FEATURE_SAFETYCHECK_ARTIFICIAL_TEST_CPU_STL) \
+    || (defined(FEATURE_SAFETYCHECK_ARTIFICIAL_TEST_ROM_STL) && FEATURE_SAFETYCHECK_ARTIFICIAL_TEST_ROM_STL) \
+    || (defined(FEATURE_SAFETYCHECK_ARTIFICIAL_TEST_RAM_STL) && FEATURE_SAFETYCHECK_ARTIFICIAL_TEST_RAM_STL)
+#error "Artificial-Failing Makros ersetzt durch FEATURE_SAFETYCHECK_FAULT_INJECTION_STL und FaultInjectionStl_Arm()."
+#endif
+
+// Makros ----------------------------------------------------------------------
+
+/// Probability of an injection in per mille, injects at every pass.
+#define FAULTINJECTIONSTL_PROBABILITY_MAX   (1000u)
+
+/// Trigger count of an injection point without limit.
+#define FAULTINJECTIONSTL_TRIGGER_UNLIMITED (0xFFFFFFFFu)
+
+#if FEATURE_SAFETYCHECK_FAULT_INJECTION_STL
+/// Starts the injection before the STL function at an injection point.
+#define FAULTINJECTIONSTL_START(point)      FaultInjectionStl_Start(point)
+/// Stops the injection after the STL function.
+#define FAULTINJECTIONSTL_STOP()            FaultInjectionStl_Stop()
+#else
+#define FAULTINJECTIONSTL_START(point)
+#define FAULTINJECTIONSTL_STOP()
+#endif
+
+// Typdefinitionen--------------------------------------------------------------
+
+/// Injection points, see the table of the module.
+typedef enum
+{
+    FAULTINJECTIONSTL_CPU_RUN_ALL = 0,
+    FAULTINJECTIONSTL_CPU_RUN_CYCLIC,
+    FAULTINJECTIONSTL_CPU_RUN_SINGLE,
+    FAULTINJECTIONSTL_ROM_INIT_ALL,
+    FAULTINJECTIONSTL_ROM_INIT_CYCLIC,
+    FAULTINJECTIONSTL_ROM_CONFIGURE_ALL,
+    FAULTINJECTIONSTL_ROM_CONFIGURE_CYCLIC,
+    FAULTINJECTIONSTL_ROM_RUN_ALL,
+    FAULTINJECTIONSTL_ROM_RUN_CYCLIC,
+    FAULTINJECTIONSTL_ROM_RESET_CYCLIC,
+    FAULTINJECTIONSTL_RAM_INIT_ALL,
+    FAULTINJECTIONSTL_RAM_INIT_CYCLIC,
+    FAULTINJECTIONSTL_RAM_CONFIGURE_ALL,
+    FAULTINJECTIONSTL_RAM_CONFIGURE_CYCLIC,
+    FAULTINJECTIONSTL_RAM_RUN_ALL,
+    FAULTINJECTIONSTL_RAM_RUN_CYCLIC,
+    FAULTINJECTIONSTL_RAM_RESET_CYCLIC,
+    FAULTINJECTIONSTL_POINT_COUNT       ///< Number of injection points
+} FAULTINJECTIONSTL_POINT;
+
+/// Arming of an injection point.
+typedef struct
+{
+    U32 skipCount;      ///< Number of passes before the first possible injection
+    U32 triggerCount;   ///< Number of injections, @ref FAULTINJECTIONSTL_TRIGGER_UNLIMITED without limit
+    U16 probability;    ///< Probability of an injection per pass in per mille
+} FAULTINJECTIONSTL_ARM;
+
+/// Counters of an injection point since the last arming.
+typedef struct
+{
+    U32 passCount;      ///< Number of passes of the injection point
+    U32 injectCount;    ///< Number of injected failures
+    U32 stlErrorCount;  ///< Number of rejected starts of the STL artificial failing
+} FAULTINJECTIONSTL_STATISTICS;
+
+// externe Variablen -----------------------------------------------------------
+
+// Prototypen ------------------------------------------------------------------
+
+#if FEATURE_SAFETYCHECK_FAULT_INJECTION_STL
+
+/// Returns the name of an injection point, e.g. for iterating over the failure matrix.
+/// \param point Injection point.
+/// \return Name of the injection point, NULL if the point is invalid.
+extern char const * FaultInjectionStl_GetName(FAULTINJECTIONSTL_POINT const point);
+
+/// Looks up an injection point by name.
+/// \param name Name of the injection point, e.g. "RAM_RUN_CYCLIC".
+/// \param point Returns the injection point.
+/// \return true if the name is known, otherwise false.
+extern bool FaultInjectionStl_Find(char const * const name, FAULTINJECTIONSTL_POINT * const point);
+
+/// Arms an injection point and resets its statistics.
+/// \param name Name of the injection point.
+/// \param arm Arming, a trigger count or probability of 0 disarms the point.
+/// \return true on success, false if the name or the arming is invalid.
+extern bool FaultInjectionStl_Arm(char const * const name, FAULTINJECTIONSTL_ARM const * const arm);
+
+/// Disarms all injection points and resets their statistics.
+extern void FaultInjectionStl_DisarmAll(void);
+
+/// Sets the seed of the random numbers for probabilistic injection.
+/// The same seed repeats the same sequence of injections.
+/// \param seed Seed, 0 is replaced by a fixed value.
+extern void FaultInjectionStl_SetSeed(U32 const seed);
+
+/// Returns the statistics of an injection point.
+/// \param name Name of the injection point.
+/// \param statistics Returns the statistics.
+/// \return true on success, false if the name is unknown.
+extern bool FaultInjectionStl_GetStatistics(char const * const name, FAULTINJECTIONSTL_STATISTICS * const statistics);
+
+/// Passes an injection point before the STL function and starts the
+/// artificial failing of the STL if the point triggers.
+/// Use @ref FAULTINJECTIONSTL_START.
+/// \param point Injection point.
+/// \return true if a failure is injected.
+extern bool FaultInjectionStl_Start(FAULTINJECTIONSTL_POINT const point);
+
+/// Stops an artificial failing started by @ref FaultInjectionStl_Start.
+/// Use @ref FAULTINJECTIONSTL_STOP.
+extern void FaultInjectionStl_Stop(void);
+
+#endif /* FEATURE_SAFETYCHECK_FAULT_INJECTION_STL */
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* STM32_SAFETY_STL_FAULT_INJECTION_STL_H */
+/**
+* @}
+*/
@@ -0,0 +1,920 @@
+/*******************************************************************************
+ * Copyright (c) 2026 TWK-ELEKTRONIK GmbH. All rights reserved.
+ ******************************************************************************/
+
+
+// Headerdateien einbinden -----------------------------------------------------
+#include <string.h>
+
+#include "config/version.h"
+
+#include "SafetyStl.h"
+
+#include "HostStl.h"
+
+#if FEATURE_SAFETYCHECK_HOST_STL
+// Allgemeine Definitionen -----------------------------------------------------
+
+/// Größe eines Flash-Sektors in Bytes, eine CRC pro Sektor
+#define HOSTSTL_FLASH_SECTION_SIZE      (STL_FLASH_SECTION_SIZE)
+
+/// Polynom der CRC-Einheit des STM32 in der Grundeinstellung
+#define HOSTSTL_CRC_POLYNOMIAL          (0x04C11DB7u)
+
+/// Startwert der CRC-Einheit des STM32 in der Grundeinstellung
+#define HOSTSTL_CRC_INIT                (0xFFFFFFFFu)
+
+/// Maximale Anzahl Worte eines RAM-Testdurchlaufs: Sektor und Block des vorherigen Sektors
+#define HOSTSTL_RAM_TEST_WORDS          ((HOSTSTL_RAM_SECTION_SIZE + HOSTSTL_RAM_BLOCK_SIZE) / sizeof(U32))
+
+/// Zustand eines Testmoduls der STL
+typedef enum
+{
+    HOSTSTL_MODULE_DEINIT = 0,      ///< Nicht initialisiert
+    HOSTSTL_MODULE_INIT,            ///< Initialisiert, noch nicht konfiguriert
+    HOSTSTL_MODULE_CONFIGURED,      ///< Konfiguriert, Test kann laufen
+} HOSTSTL_MODULE_STATE;
+
+/// Zustand eines Speichertests (RAM oder Flash)
+typedef struct
+{
+    HOSTSTL_MODULE_STATE state;         ///< Zustand des Testmoduls
+    STL_TmStatus_t status;              ///< Status des laufenden Testdurchlaufs
+    STL_MemConfig_t const * config;     ///< Konfiguration, vom Aufrufer gehalten
+    STL_MemSubset_t const * subset;     ///< Subset des nächsten Sektors, NULL nach dem letzten Sektor
+    U32 nextAddress;                    ///< Startadresse des nächsten Sektors
+} HOSTSTL_MEM_TEST;
+
+/// Eingeblendeter RAM-Bereich
+typedef struct
+{
+    U32 address;        ///< Zieladresse
+    U32 * buffer;       ///< Puffer des Testprogramms
+    U32 size;           ///< Größe in Bytes
+} HOSTSTL_RAM_AREA;
+
+/// Test eines Sektors
+/// \param startAddress Startadresse des Sektors.
+/// \param endAddress Letzte Adresse des Sektors.
+/// \param firstSection @c true für den ersten Sektor eines Subsets.
+/// \return @c true, wenn der Sektor fehlerfrei ist.
+typedef bool (*HOSTSTL_SECTION_TEST)(U32 const startAddress, U32 const endAddress, bool const firstSection);
+
+// externe Variablen -----------------------------------------------------------
+
+/// Gesetzt nach STL_SCH_Init()
+static bool schedulerStarted = false;
+
+/// Eingeblendete RAM-Bereiche
+static HOSTSTL_RAM_AREA ramAreas[HOSTSTL_RAM_AREAS_MAX];
+
+/// Anzahl der eingeblendeten RAM-Bereiche
+static U32 numRamAreas = 0;
+
+/// Eingeblendetes Flash-Image, NULL wenn keines
+static U8 * flashImage = NULL;
+
+/// Zieladresse des Flash-Images
+static U32 flashAddress = 0;
+
+/// Größe des Flash-Images in Bytes
+static U32 flashSize = 0;
+
+/// Zustand des RAM-Tests
+static HOSTSTL_MEM_TEST ramTest;
+
+/// Zustand des Flash-Tests
+static HOSTSTL_MEM_TEST flashTest;
+
+/// Wort mit Stuck-at-Fehler, NULL wenn kein Fehler eingebaut ist
+static U32 * faultWord = NULL;
+
+/// Bits des fehlerhaften Wortes, die immer 1 lesen
+static U32 faultStuckAtOne = 0;
+
+/// Bits des fehlerhaften Wortes, die immer 0 lesen
+static U32 faultStuckAtZero = 0;
+
+/// Erzwungene Statuswerte des Artificial-Failings
+static STL_ArtifFailingConfig_t artifFailing;
+
+/// Gesetzt, solange das Artificial-Failing gestartet ist
+static bool artifFailingActive = false;
+
+/// Zähler der Emulation
+static HOSTSTL_STATISTICS statistics;
+
+/// Tabelle der CRC für ein Byte, höchstwertiges Bit zuerst
+static U32 crcTable[256];
+
+/// Gesetzt, sobald die CRC-Tabelle berechnet ist
+static bool crcTableReady = false;
+
+//------------------------------------------------------------------------------
+// Prototypen interne Funktionen -----------------------------------------------
+//------------------------------------------------------------------------------
+
+/// Liefert den an den Aufrufer gemeldeten Status unter Berücksichtigung des
+/// Artificial-Failings.
+/// \param status Status des Tests.
+/// \param forced Erzwungener Status des Moduls, @ref STL_NOT_TESTED für keinen.
+/// \return Zu meldender Status.
+static STL_TmStatus_t HostStl_ArtifStatus(STL_TmStatus_t const status, STL_TmStatus_t const forced);
+
+/// Initialisiert einen Speichertest, siehe STL_SCH_InitRam().
+/// \param test Zustand des Speichertests.
+/// \param pSingleTmStatus Rückgabe des Status.
+/// \param forced Erzwungener Status des Moduls.
+/// \return @c STL_OK bei Erfolg, sonst @c STL_KO.
+static STL_Status_t HostStl_MemInit(HOSTSTL_MEM_TEST * const test, STL_TmStatus_t * const pSingleTmStatus,
+                                    STL_TmStatus_t const forced);
+
+/// Konfiguriert einen Speichertest, siehe STL_SCH_ConfigureRam().
+/// \param test Zustand des Speichertests.
+/// \param pSingleTmStatus Rückgabe des Status.
+/// \param config Konfiguration, muss gültig bleiben.
+/// \param checkSubset Prüfung eines Subsets.
+/// \param forced Erzwungener Status des Moduls.
+/// \return @c STL_OK bei Erfolg, sonst @c STL_KO.
+static STL_Status_t HostStl_MemConfigure(HOSTSTL_MEM_TEST * const test, STL_TmStatus_t * const pSingleTmStatus,
+                                         STL_MemConfig_t const * const config,
+                                         bool (*checkSubset)(STL_MemSubset_t const * const subset),
+                                         STL_TmStatus_t const forced);
+
+/// Führt die nächsten Sektoren eines Speichertests aus, siehe STL_SCH_RunRamTM().
+/// \param test Zustand des Speichertests.
+/// \param pSingleTmStatus Rückgabe des Status.
+/// \param sectionSize Größe eines Sektors in Bytes.
+/// \param sectionTest Test eines Sektors.
+/// \param forced Erzwungener Status des Moduls.
+/// \return @c STL_OK bei Erfolg, sonst @c STL_KO.
+static STL_Status_t HostStl_MemRun(HOSTSTL_MEM_TEST * const test, STL_TmStatus_t * const pSingleTmStatus,
+                                   U32 const sectionSize, HOSTSTL_SECTION_TEST const sectionTest,
+                                   STL_TmStatus_t const forced);
+
+/// Startet einen Speichertest neu, siehe STL_SCH_ResetRam().
+/// \param test Zustand des Speichertests.
+/// \param pSingleTmStatus Rückgabe des Status.
+/// \param forced Erzwungener Status des Moduls.
+/// \return @c STL_OK bei Erfolg, sonst @c STL_KO.
+static STL_Status_t HostStl_MemReset(HOSTSTL_MEM_TEST * const test, STL_TmStatus_t * const pSingleTmStatus,
+                                     STL_TmStatus_t const forced);
+
+/// Führt einen CPU-Test aus.
+/// \param index Index des CPU-Tests.
+/// \param pSingleTmStatus Rückgabe des Status.
+/// \return @c STL_OK bei Erfolg, sonst @c STL_KO.
+static STL_Status_t HostStl_RunCpu(STL_CpuTmxIndex_t const index, STL_TmStatus_t * const pSingleTmStatus);
+
+/// Liefert das Wort des eingeblendeten RAMs an einer Adresse.
+/// \param address Zieladresse, an 4 Byte ausgerichtet.
+/// \param size Anzahl Bytes ab der Adresse, die im selben Bereich liegen müssen.
+/// \return Zeiger auf das Wort, NULL wenn der Bereich nicht eingeblendet ist.
+static U32 * HostStl_RamWord(U32 const address, U32 const size);
+
+/// Liest ein Wort des RAM-Tests.
+/// \param word Wort.
+/// \return Gelesener Wert.
+static U32 HostStl_RamRead(U32 const * const word);
+
+/// Schreibt ein Wort des RAM-Tests, ein Stuck-at-Fehler verfälscht den Wert.
+/// \param word Wort.
+/// \param value Zu schreibender Wert.
+static void HostStl_RamWrite(U32 * const word, U32 value);
+
+/// March-C--Test über zusammenhängende Worte mit einem Hintergrund.
+/// \param words Erstes Wort.
+/// \param count Anzahl der Worte.
+/// \param background Hintergrund, die zweite Phase schreibt den invertierten Wert.
+/// \return @c true, wenn alle Lesezugriffe den erwarteten Wert liefern.
+static bool HostStl_MarchC(U32 * const words, U32 const count, U32 const background);
+
+/// Transparenter RAM-Test eines Sektors, siehe @ref HOSTSTL_SECTION_TEST.
+static bool HostStl_TestRamSection(U32 const startAddress, U32 const endAddress, bool const firstSection);
+
+/// Prüfung eines RAM-Subsets bei der Konfiguration.
+/// \param subset Subset.
+/// \return @c true, wenn das Subset gültig und vollständig eingeblendet ist.
+static bool HostStl_CheckRamSubset(STL_MemSubset_t const * const subset);
+
+/// CRC-Prüfung eines Flash-Sektors, siehe @ref HOSTSTL_SECTION_TEST.
+static bool HostStl_TestFlashSection(U32 const startAddress, U32 const endAddress, bool const firstSection);
+
+/// Prüfung eines Flash-Subsets bei der Konfiguration.
+/// \param subset Subset.
+/// \return @c true, wenn das Subset gültig ist und vor dem CRC-Bereich liegt.
+static bool HostStl_CheckFlashSubset(STL_MemSubset_t const * const subset);
+
+/// Offset des CRC-Bereichs im Flash-Image.
+/// \return Offset in Bytes.
+static U32 HostStl_FlashCrcOffset(void);
+
+/// Liest ein Wort des Flash-Images, Little-Endian wie im Gerät.
+/// \param offset Offset im Image, an 4 Byte ausgerichtet.
+/// \return Wort.
+static U32 HostStl_FlashWord(U32 const offset);
+
+/// Berechnet die CRC eines Flash-Sektors bis höchstens zum Beginn des CRC-Bereichs.
+/// \param section Index des Sektors.
+/// \return CRC des Sektors.
+static U32 HostStl_FlashSectionCrc(U32 const section);
+
+//------------------------------------------------------------------------------
+// Funktionsbereich externe Funktionen -----------------------------------------
+//------------------------------------------------------------------------------
+
+void HostStl_Reset(void)
+    {
+    schedulerStarted = false;
+    memset(ramAreas, 0, sizeof(ramAreas));
+    numRamAreas = 0;
+    flashImage = NULL;
+    flashAddress = 0;
+    flashSize = 0;
+    memset(&ramTest, 0, sizeof(ramTest));
+    memset(&flashTest, 0, sizeof(flashTest));
+    ramTest.status = STL_NOT_TESTED;
+    flashTest.status = STL_NOT_TESTED;
+    faultWord = NULL;
+    artifFailingActive = false;
+    memset(&statistics, 0, sizeof(statistics));
+    }
+//------------------------------------------------------------------------------
+
+bool HostStl_AttachRam(U32 const address, U32 * const buffer, U32 const size)
+    {
+    U32 i;
+
+    if((buffer == NULL) || (size == 0) || ((address % sizeof(U32)) != 0) || ((size % sizeof(U32)) != 0)
+       || ((address + (size - 1)) < address) || (numRamAreas >= HOSTSTL_RAM_AREAS_MAX))
+        {
+        return false;
+        }
+
+    // Bereiche dürfen nicht überlappen
+    for(i = 0; i < numRamAreas; i++)
+        {
+        if((address <= (ramAreas[i].address + (ramAreas[i].size - 1))) && (ramAreas[i].address <= (address + (size - 1))))
+            {
+            return false;
+            }
+        }
+
+    ramAreas[numRamAreas].address = address;
+    ramAreas[numRamAreas].buffer = buffer;
+    ramAreas[numRamAreas].size = size;
+    numRamAreas++;
+    return true;
+    }
+//------------------------------------------------------------------------------
+
+bool HostStl_AttachFlash(U32 const address, U8 * const image, U32 const size)
+    {
+    if((image == NULL) || (size == 0) || ((address % HOSTSTL_FLASH_SECTION_SIZE) != 0)
+       || ((size % HOSTSTL_FLASH_SECTION_SIZE) != 0) || ((address + (size - 1)) < address))
+        {
+        return false;
+        }
+
+    flashImage = image;
+    flashAddress = address;
+    flashSize = size;
+    return true;
+    }
+//------------------------------------------------------------------------------
+
+bool HostStl_UpdateFlashCrc(void)
+    {
+    U32 section;
+    U32 crc;
+    U32 offset;
+
+    if(flashImage == NULL)
+        {
+        return false;
+        }
+
+    for(section = 0; section < (flashSize / HOSTSTL_FLASH_SECTION_SIZE); section++)
+        {
+        crc = HostStl_FlashSectionCrc(section);
+        offset = HostStl_FlashCrcOffset() + (section * sizeof(U32));
+
+        flashImage[offset] = (U8) crc;
+        flashImage[offset + 1] = (U8) (crc >> 8);
+        flashImage[offset + 2] = (U8) (crc >> 16);
+        flashImage[offset + 3] = (U8) (crc >> 24);
+        }
+
+    return true;
+    }
+//------------------------------------------------------------------------------
+
+bool HostStl_InjectRamFault(U32 const address, U32 const stuckAtOne, U32 const stuckAtZero)
+    {
+    U32 * const word = HostStl_RamWord(address, sizeof(U32));
+
+    if(word == NULL)
+        {
+        return false;
+        }
+
+    faultWord = word;
+    faultStuckAtOne = stuckAtOne;
+    faultStuckAtZero = stuckAtZero;
+
+    // Der Fehler wirkt sofort auf den Inhalt
+    *faultWord = (*faultWord | faultStuckAtOne) & ~faultStuckAtZero;
+    return true;
+    }
+//------------------------------------------------------------------------------
+
+void HostStl_ClearRamFault(void)
+    {
+    faultWord = NULL;
+    }
+//------------------------------------------------------------------------------
+
+void HostStl_GetStatistics(HOSTSTL_STATISTICS * const statisticsOut)
+    {
+    if(statisticsOut != NULL)
+        {
+        *statisticsOut = statistics;
+        }
+    }
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Funktionsbereich Ersatz der STL ---------------------------------------------
+//------------------------------------------------------------------------------
+
+STL_Status_t STL_SCH_Init(void)
+    {
+    memset(&ramTest, 0, sizeof(ramTest));
+    memset(&flashTest, 0, sizeof(flashTest));
+    ramTest.status = STL_NOT_TESTED;
+    flashTest.status = STL_NOT_TESTED;
+    artifFailingActive = false;
+    schedulerStarted = true;
+    return STL_OK;
+    }
+//------------------------------------------------------------------------------
+
+STL_Status_t STL_SCH_InitRam(STL_TmStatus_t * const pSingleTmStatus)
+    {
+    return HostStl_MemInit(&ramTest, pSingleTmStatus, artifFailing.RamTmStatus);
+    }
+//------------------------------------------------------------------------------
+
+STL_Status_t STL_SCH_ConfigureRam(STL_TmStatus_t * const pSingleTmStatus, STL_MemConfig_t * const pRamConfig)
+    {
+    return HostStl_MemConfigure(&ramTest, pSingleTmStatus, pRamConfig, HostStl_CheckRamSubset,
+                                artifFailing.RamTmStatus);
+    }
+//------------------------------------------------------------------------------
+
+STL_Status_t STL_SCH_RunRamTM(STL_TmStatus_t * const pSingleTmStatus)
+    {
+    return HostStl_MemRun(&ramTest, pSingleTmStatus, HOSTSTL_RAM_SECTION_SIZE, HostStl_TestRamSection,
+                          artifFailing.RamTmStatus);
+    }
+//------------------------------------------------------------------------------
+
+STL_Status_t STL_SCH_ResetRam(STL_TmStatus_t * const pSingleTmStatus)
+    {
+    return HostStl_MemReset(&ramTest, pSingleTmStatus, artifFailing.RamTmStatus);
+    }
+//------------------------------------------------------------------------------
+
+STL_Status_t STL_SCH_InitFlash(STL_TmStatus_t * const pSingleTmStatus)
+    {
+    return HostStl_MemInit(&flashTest, pSingleTmStatus, artifFailing.FlashTmStatus);
+    }
+//------------------------------------------------------------------------------
+
+STL_Status_t STL_SCH_ConfigureFlash(STL_TmStatus_t * const pSingleTmStatus, STL_MemConfig_t * const pFlashConfig)
+    {
+    return HostStl_MemConfigure(&flashTest, pSingleTmStatus, pFlashConfig, HostStl_CheckFlashSubset,
+                                artifFailing.FlashTmStatus);
+    }
+//------------------------------------------------------------------------------
+
+STL_Status_t STL_SCH_RunFlashTM(STL_TmStatus_t * const pSingleTmStatus)
+    {
+    return HostStl_MemRun(&flashTest, pSingleTmStatus, HOSTSTL_FLASH_SECTION_SIZE, HostStl_TestFlashSection,
+                          artifFailing.FlashTmStatus);
+    }
+//------------------------------------------------------------------------------
+
+STL_Status_t STL_SCH_ResetFlash(STL_TmStatus_t * const pSingleTmStatus)
+    {
+    return HostStl_MemReset(&flashTest, pSingleTmStatus, artifFailing.FlashTmStatus);
+    }
+//------------------------------------------------------------------------------
+
+STL_Status_t STL_SCH_StartArtifFailing(STL_ArtifFailingConfig_t const * const pArtifFailingConfig)
+    {
+    if(pArtifFailingConfig == NULL)
+        {
+        return STL_KO;
+        }
+
+    artifFailing = *pArtifFailingConfig;
+    artifFailingActive = true;
+    return STL_OK;
+    }
+//------------------------------------------------------------------------------
+
+STL_Status_t STL_SCH_StopArtifFailing(void)
+    {
+    artifFailingActive = false;
+    return STL_OK;
+    }
+//------------------------------------------------------------------------------
+
+STL_Status_t STL_SCH_RunCpuTM1(STL_TmStatus_t * const pSingleTmStatus)
+    {
+    return HostStl_RunCpu(STL_CPU_TM1_IDX, pSingleTmStatus);
+    }
+//------------------------------------------------------------------------------
+
+STL_Status_t STL_SCH_RunCpuTM1L(STL_TmStatus_t * const pSingleTmStatus)
+    {
+    return HostStl_RunCpu(STL_CPU_TM1L_IDX, pSingleTmStatus);
+    }
+//------------------------------------------------------------------------------
+
+STL_Status_t STL_SCH_RunCpuTM2(STL_TmStatus_t * const pSingleTmStatus)
+    {
+    return HostStl_RunCpu(STL_CPU_TM2_IDX, pSingleTmStatus);
+    }
+//------------------------------------------------------------------------------
+
+STL_Status_t STL_SCH_RunCpuTM3(STL_TmStatus_t * const pSingleTmStatus)
+    {
+    return HostStl_RunCpu(STL_CPU_TM3_IDX, pSingleTmStatus);
+    }
+//------------------------------------------------------------------------------
+
+STL_Status_t STL_SCH_RunCpuTM4(STL_TmStatus_t * const pSingleTmStatus)
+    {
+    return HostStl_RunCpu(STL_CPU_TM4_IDX, pSingleTmStatus);
+    }
+//------------------------------------------------------------------------------
+
+STL_Status_t STL_SCH_RunCpuTM5(STL_TmStatus_t * const pSingleTmStatus)
+    {
+    return HostStl_RunCpu(STL_CPU_TM5_IDX, pSingleTmStatus);
+    }
+//------------------------------------------------------------------------------
+
+STL_Status_t STL_SCH_RunCpuTM6(STL_TmStatus_t * const pSingleTmStatus)
+    {
+    return HostStl_RunCpu(STL_CPU_TM6_IDX, pSingleTmStatus);
+    }
+//------------------------------------------------------------------------------
+
+STL_Status_t STL_SCH_RunCpuTM7(STL_TmStatus_t * const pSingleTmStatus)
+    {
+    return HostStl_RunCpu(STL_CPU_TM7_IDX, pSingleTmStatus);
+    }
+//------------------------------------------------------------------------------
+
+STL_Status_t STL_SCH_RunCpuTM8(STL_TmStatus_t * const pSingleTmStatus)
+    {
+    return HostStl_RunCpu(STL_CPU_TM8_IDX, pSingleTmStatus);
+    }
+//------------------------------------------------------------------------------
+
+STL_Status_t STL_SCH_RunCpuTM9(STL_TmStatus_t * const pSingleTmStatus)
+    {
+    return HostStl_RunCpu(STL_CPU_TM9_IDX, pSingleTmStatus);
+    }
+//------------------------------------------------------------------------------
+
+STL_Status_t STL_SCH_RunCpuTM10(STL_TmStatus_t * const pSingleTmStatus)
+    {
+    return HostStl_RunCpu(STL_CPU_TM10_IDX, pSingleTmStatus);
+    }
+//------------------------------------------------------------------------------
+
+STL_Status_t STL_SCH_RunCpuTM11(STL_TmStatus_t * const pSingleTmStatus)
+    {
+    return HostStl_RunCpu(STL_CPU_TM11_IDX, pSingleTmStatus);
+    }
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Funktionsbereich interne Funktionen -----------------------------------------
+//------------------------------------------------------------------------------
+
+static STL_TmStatus_t HostStl_ArtifStatus(STL_TmStatus_t const status, STL_TmStatus_t const forced)
+    {
+    if(artifFailingActive && (forced != STL_NOT_TESTED))
+        {
+        return forced;
+        }
+
+    return status;
+    }
+//------------------------------------------------------------------------------
+
+static STL_Status_t HostStl_MemInit(HOSTSTL_MEM_TEST * const test, STL_TmStatus_t * const pSingleTmStatus,
+                                    STL_TmStatus_t const forced)
+    {
+    if(pSingleTmStatus == NULL)
+        {
+        return STL_KO;
+        }
+
+    if(!schedulerStarted)
+        {
+        *pSingleTmStatus = STL_ERROR;
+        return STL_KO;
+        }
+
+    test->state = HOSTSTL_MODULE_INIT;
+    test->status = STL_NOT_TESTED;
+    test->config = NULL;
+    test->subset = NULL;
+
+    *pSingleTmStatus = HostStl_ArtifStatus(STL_NOT_TESTED, forced);
+    return STL_OK;
+    }
+//------------------------------------------------------------------------------
+
+static STL_Status_t HostStl_MemConfigure(HOSTSTL_MEM_TEST * const test, STL_TmStatus_t * const pSingleTmStatus,
+                                         STL_MemConfig_t const * const config,
+                                         bool (*checkSubset)(STL_MemSubset_t const * const subset),
+                                         STL_TmStatus_t const forced)
+    {
+    STL_MemSubset_t const * subset;
+    bool result;
+
+    if(pSingleTmStatus == NULL)
+        {
+        return STL_KO;
+        }
+
+    result = schedulerStarted && (test->state == HOSTSTL_MODULE_INIT) && (config != NULL)
+             && (config->pSubset != NULL) && (config->NumSectionsAtomic != 0);
+
+    subset = (config != NULL) ? config->pSubset : NULL;
+    while(result && (subset != NULL))
+        {
+        result = checkSubset(subset);
+        subset = subset->pNext;
+        }
+
+    if(!result)
+        {
+        *pSingleTmStatus = STL_ERROR;
+        return STL_KO;
+        }
+
+    test->state = HOSTSTL_MODULE_CONFIGURED;
+    test->status = STL_NOT_TESTED;
+    test->config = config;
+    test->subset = config->pSubset;
+    test->nextAddress = config->pSubset->StartAddr;
+
+    *pSingleTmStatus = HostStl_ArtifStatus(STL_NOT_TESTED, forced);
+    return STL_OK;
+    }
+//------------------------------------------------------------------------------
+
+static STL_Status_t HostStl_MemRun(HOSTSTL_MEM_TEST * const test, STL_TmStatus_t * const pSingleTmStatus,
+                                   U32 const sectionSize, HOSTSTL_SECTION_TEST const sectionTest,
+                                   STL_TmStatus_t const forced)
+    {
+    U32 numSections;
+    U32 sectionEnd;
+
+    if(pSingleTmStatus == NULL)
+        {
+        return STL_KO;
+        }
+
+    // Nach einem vollständigen Durchlauf ist ein Reset erforderlich
+    if(!schedulerStarted || (test->state != HOSTSTL_MODULE_CONFIGURED) || (test->status == STL_PASSED))
+        {
+        *pSingleTmStatus = STL_ERROR;
+        return STL_KO;
+        }
+
+    numSections = 0;
+    while((test->status != STL_FAILED) && (test->subset != NULL) && (numSections < test->config->NumSectionsAtomic))
+        {
+        sectionEnd = test->nextAddress + (sectionSize - 1);
+        if((sectionEnd > test->subset->EndAddr) || (sectionEnd < test->nextAddress))
+            {
+            sectionEnd = test->subset->EndAddr;
+            }
+
+        if(!sectionTest(test->nextAddress, sectionEnd, test->nextAddress == test->subset->StartAddr))
+            {
+            test->status = STL_FAILED;
+            }
+        else if(sectionEnd == test->subset->EndAddr)
+            {
+            test->subset = test->subset->pNext;
+            if(test->subset != NULL)
+                {
+                test->nextAddress = test->subset->StartAddr;
+                }
+            }
+        else
+            {
+            test->nextAddress = sectionEnd + 1;
+            }
+
+        numSections++;
+        }
+
+    if(test->status != STL_FAILED)
+        {
+        test->status = (test->subset == NULL) ? STL_PASSED : STL_PARTIAL_PASSED;
+        }
+
+    *pSingleTmStatus = HostStl_ArtifStatus(test->status, forced);
+    return STL_OK;
+    }
+//------------------------------------------------------------------------------
+
+static STL_Status_t HostStl_MemReset(HOSTSTL_MEM_TEST * const test, STL_TmStatus_t * const pSingleTmStatus,
+                                     STL_TmStatus_t const forced)
+    {
+    if(pSingleTmStatus == NULL)
+        {
+        return STL_KO;
+        }
+
+    if(!schedulerStarted || (test->state != HOSTSTL_MODULE_CONFIGURED))
+        {
+        *pSingleTmStatus = STL_ERROR;
+        return STL_KO;
+        }
+
+    test->status = STL_NOT_TESTED;
+    test->subset = test->config->pSubset;
+    test->nextAddress = test->subset->StartAddr;
+
+    *pSingleTmStatus = HostStl_ArtifStatus(STL_NOT_TESTED, forced);
+    return STL_OK;
+    }
+//------------------------------------------------------------------------------
+
+static STL_Status_t HostStl_RunCpu(STL_CpuTmxIndex_t const index, STL_TmStatus_t * const pSingleTmStatus)
+    {
+    if(pSingleTmStatus == NULL)
+        {
+        return STL_KO;
+        }
+
+    if(!schedulerStarted)
+        {
+        *pSingleTmStatus = STL_ERROR;
+        return STL_KO;
+        }
+
+    statistics.cpuTests++;
+    *pSingleTmStatus = HostStl_ArtifStatus(STL_PASSED, artifFailing.aCpuTmStatus[index]);
+    return STL_OK;
+    }
+//------------------------------------------------------------------------------
+
+static U32 * HostStl_RamWord(U32 const address, U32 const size)
+    {
+    U32 i;
+
+    if(((address % sizeof(U32)) != 0) || (size == 0))
+        {
+        return NULL;
+        }
+
+    for(i = 0; i < numRamAreas; i++)
+        {
+        if((address >= ramAreas[i].address) && ((address - ramAreas[i].address) < ramAreas[i].size)
+           && (size <= (ramAreas[i].size - (address - ramAreas[i].address))))
+            {
+            return &ramAreas[i].buffer[(address - ramAreas[i].address) / sizeof(U32)];
+            }
+        }
+
+    return NULL;
+    }
+//------------------------------------------------------------------------------
+
+static U32 HostStl_RamRead(U32 const * const word)
+    {
+    statistics.ramAccesses++;
+    return *word;
+    }
+//------------------------------------------------------------------------------
+
+static void HostStl_RamWrite(U32 * const word, U32 value)
+    {
+    if(word == faultWord)
+        {
+        value = (value | faultStuckAtOne) & ~faultStuckAtZero;
+        }
+
+    statistics.ramAccesses++;
+    *word = value;
+    }
+//------------------------------------------------------------------------------
+
+static bool HostStl_MarchC(U32 * const words, U32 const count, U32 const background)
+    {
+    U32 const inverse = ~background;
+    bool result;
+    U32 i;
+
+    result = true;
+
+    // Aufsteigend w0
+    for(i = 0; i < count; i++)
+        {
+        HostStl_RamWrite(&words[i], background);
+        }
+
+    // Aufsteigend r0, w1
+    for(i = 0; i < count; i++)
+        {
+        result = (HostStl_RamRead(&words[i]) == background) && result;
+        HostStl_RamWrite(&words[i], inverse);
+        }
+
+    // Aufsteigend r1, w0
+    for(i = 0; i < count; i++)
+        {
+        result = (HostStl_RamRead(&words[i]) == inverse) && result;
+        HostStl_RamWrite(&words[i], background);
+        }
+
+    // Absteigend r0, w1
+    for(i = count; i > 0; i--)
+        {
+        result = (HostStl_RamRead(&words[i - 1]) == background) && result;
+        HostStl_RamWrite(&words[i - 1], inverse);
+        }
+
+    // Absteigend r1, w0
+    for(i = count; i > 0; i--)
+        {
+        result = (HostStl_RamRead(&words[i - 1]) == inverse) && result;
+        HostStl_RamWrite(&words[i - 1], background);
+        }
+
+    // r0
+    for(i = 0; i < count; i++)
+        {
+        result = (HostStl_RamRead(&words[i]) == background) && result;
+        }
+
+    return result;
+    }
+//------------------------------------------------------------------------------
+
+static bool HostStl_TestRamSection(U32 const startAddress, U32 const endAddress, bool const firstSection)
+    {
+    U32 backup[HOSTSTL_RAM_TEST_WORDS];
+    U32 testStart;
+    U32 count;
+    U32 * words;
+    bool result;
+    U32 i;
+
+    // Ab dem zweiten Sektor überlappt der Test mit dem letzten Block des vorherigen Sektors
+    testStart = firstSection ? startAddress : (startAddress - HOSTSTL_RAM_BLOCK_SIZE);
+    count = ((endAddress + 1) - testStart) / sizeof(U32);
+    words = HostStl_RamWord(testStart, count * sizeof(U32));
+
+    if((words == NULL) || (count > HOSTSTL_RAM_TEST_WORDS))
+        {
+        return false;
+        }
+
+    for(i = 0; i < count; i++)
+        {
+        backup[i] = HostStl_RamRead(&words[i]);
+        }
+
+    result = HostStl_MarchC(words, count, 0x00000000u);
+    result = HostStl_MarchC(words, count, 0x55555555u) && result;
+
+    for(i = 0; i < count; i++)
+        {
+        HostStl_RamWrite(&words[i], backup[i]);
+        }
+
+    statistics.ramSections++;
+    return result;
+    }
+//------------------------------------------------------------------------------
+
+static bool HostStl_CheckRamSubset(STL_MemSubset_t const * const subset)
+    {
+    if((subset->EndAddr <= subset->StartAddr) || ((subset->StartAddr % sizeof(U32)) != 0))
+        {
+        return false;
+        }
+
+    if((((subset->EndAddr + 1) - subset->StartAddr) % (2 * HOSTSTL_RAM_BLOCK_SIZE)) != 0)
+        {
+        return false;
+        }
+
+    return HostStl_RamWord(subset->StartAddr, (subset->EndAddr + 1) - subset->StartAddr) != NULL;
+    }
+//------------------------------------------------------------------------------
+
+static bool HostStl_TestFlashSection(U32 const startAddress, U32 const endAddress, bool const firstSection)
+    {
+    U32 const section = (startAddress - flashAddress) / HOSTSTL_FLASH_SECTION_SIZE;
+
+    (void) endAddress;
+    (void) firstSection;
+
+    statistics.flashSections++;
+    return HostStl_FlashSectionCrc(section) == HostStl_FlashWord(HostStl_FlashCrcOffset() + (section * sizeof(U32)));
+    }
+//------------------------------------------------------------------------------
+
+static bool HostStl_CheckFlashSubset(STL_MemSubset_t const * const subset)
+    {
+    if(flashImage == NULL)
+        {
+        return false;
+        }
+
+    if((subset->EndAddr <= subset->StartAddr) || ((subset->StartAddr % HOSTSTL_FLASH_SECTION_SIZE) != 0)
+       || (((subset->EndAddr + 1) % sizeof(U32)) != 0))
+        {
+        return false;
+        }
+
+    // Testbereich muss vollständig vor dem CRC-Bereich liegen
+    return (subset->StartAddr >= flashAddress)
+           && ((subset->EndAddr - flashAddress) < HostStl_FlashCrcOffset());
+    }
+//------------------------------------------------------------------------------
+
+static U32 HostStl_FlashCrcOffset(void)
+    {
+    return flashSize - ((flashSize / HOSTSTL_FLASH_SECTION_SIZE) * sizeof(U32));
+    }
+//------------------------------------------------------------------------------
+
+static U32 HostStl_FlashWord(U32 const offset)
+    {
+    return (U32) flashImage[offset] | ((U32) flashImage[offset + 1] << 8)
+           | ((U32) flashImage[offset + 2] << 16) | ((U32) flashImage[offset + 3] << 24);
+    }
+//------------------------------------------------------------------------------
+
+static U32 HostStl_FlashSectionCrc(U32 const section)
+    {
+    U32 crc;
+    U32 word;
+    U32 offset;
+    U32 end;
+    U32 i;
+    U32 bit;
+
+    if(!crcTableReady)
+        {
+        for(i = 0; i < 256u; i++)
+            {
+            crc = i << 24;
+            for(bit = 0; bit < 8u; bit++)
+                {
+                crc = ((crc & 0x80000000u) != 0) ? ((crc << 1) ^ HOSTSTL_CRC_POLYNOMIAL) : (crc << 1);
+                }
+            crcTable[i] = crc;
+            }
+        crcTableReady = true;
+        }
+
+    offset = section * HOSTSTL_FLASH_SECTION_SIZE;
+    end = offset + HOSTSTL_FLASH_SECTION_SIZE;
+    if(end > HostStl_FlashCrcOffset())
+        {
+        end = HostStl_FlashCrcOffset();
+        }
+
+    // Worte wie die CRC-Einheit, höchstwertiges Byte zuerst
+    crc = HOSTSTL_CRC_INIT;
+    for(; offset < end; offset += sizeof(U32))
+        {
+        word = HostStl_FlashWord(offset);
+        crc = (crc << 8) ^ crcTable[((crc >> 24) ^ (word >> 24)) & 0xFFu];
+        crc = (crc << 8) ^ crcTable[((crc >> 24) ^ (word >> 16)) & 0xFFu];
+        crc = (crc << 8) ^ crcTable[((crc >> 24) ^ (word >> 8)) & 0xFFu];
+        crc = (crc << 8) ^ crcTable[((crc >> 24) ^ word) & 0xFFu];
+        }
+
+    return crc;
+    }
+//------------------------------------------------------------------------------
+
+#endif // FEATURE_SAFETYCHECK_HOST_STL
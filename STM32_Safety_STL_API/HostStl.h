@@ -0,0 +1,151 @@
+/*******************************************************************************
+ * Copyright (c) 2026 TWK-ELEKTRONIK GmbH. All rights reserved.
+ ******************************************************************************/
+
+/**
+ * \defgroup HostStl Host-Emulation der Self-Test-Library
+ *
+ * Ersatz der Scheduler-Funktionen STL_SCH_...() der Self-Test-Library von ST
+ * für Host-Builds. Damit laufen die Funktionen von @ref RAMTestStl,
+ * @ref ROMTestStl und @ref CPUTestStl unverändert unter Linux, z.B. in
+ * Unittests, Simulationen und Laufzeitmessungen. Nur für Testbuilds, statt der
+ * Bibliothek von ST gelinkt.
+ *
+ * Der Speicher des Geräts wird durch Puffer des Testprogramms nachgebildet, die
+ * unter ihren Zieladressen eingeblendet werden:
+ *
+ *  (#) RAM: HostStl_AttachRam(). Der RAM-Test ist ein transparenter
+ *      March-C--Test über echte Speicherzugriffe. Pro Sektor von 128 Bytes wird
+ *      der Inhalt gesichert, mit den Hintergründen 0x00000000/0xFFFFFFFF und
+ *      0x55555555/0xAAAAAAAA getestet und wiederhergestellt. Ab dem zweiten
+ *      Sektor eines Subsets wird der letzte Block (16 Bytes) des vorherigen
+ *      Sektors mitgetestet, damit Kopplungsfehler über die Sektorgrenze erkannt
+ *      werden. HostStl_InjectRamFault() baut einen Stuck-at-Fehler ein.
+ *
+ *  (#) Flash: HostStl_AttachFlash() mit einem Firmware-Image. Der CRC-Bereich
+ *      liegt wie im Gerät am Ende des Images, eine CRC pro Sektor von
+ *      1024 Bytes. Die CRC entspricht der CRC-Einheit des STM32 in der
+ *      Grundeinstellung (CRC-32, Polynom 0x04C11DB7, Startwert 0xFFFFFFFF,
+ *      32-Bit-Worte, ohne Spiegelung), wie sie der STM32CubeProgrammer
+ *      einfügt. HostStl_UpdateFlashCrc() berechnet die CRCs für ein Image ohne
+ *      CRC-Bereich. Es wird immer der gesamte Sektor geprüft, im letzten
+ *      Sektor vor dem CRC-Bereich bis zu dessen Beginn.
+ *
+ *  (#) CPU: Die Register-Tests sind auf dem Host nicht ausführbar. Jeder
+ *      aufgerufene CPU-Test meldet @ref STL_PASSED.
+ *
+ * Die Zustände folgen der STL: Init, Konfiguration, Ausführung mit
+ * @ref STL_PARTIAL_PASSED bis zum letzten Sektor und @ref STL_PASSED danach.
+ * Ein weiterer Aufruf nach @ref STL_PASSED erfordert einen Reset. Ein
+ * @ref STL_FAILED bleibt bis zum Reset bestehen. Das Artificial-Failing
+ * (STL_SCH_StartArtifFailing()) erzwingt die konfigurierten Statuswerte, damit
+ * läuft auch @ref FaultInjectionStl auf dem Host.
+ *
+ * Die Adressen der Linker-Symbole (z.B. __RAM_TESTREGION1_START) werden beim
+ * Linken auf die Zieladressen gesetzt, z.B. mit
+ * -no-pie -Wl,--defsym,__RAM_TESTREGION1_START=0x20000000. Alternativ werden
+ * die Makros RAMTEST_REGION1_START ... und ROMTEST_REGION_START ... direkt auf
+ * die Zieladressen gesetzt, wie in der Testumgebung der Unittests.
+ *
+ * Die Funktionen sind nicht reentrant.
+ * @{
+ */
+#ifndef STM32_SAFETY_STL_HOST_STL_H
+#define STM32_SAFETY_STL_HOST_STL_H
+
+// Headerdateien einbinden -----------------------------------------------------
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "SafetyStl.h"
+
+// Allgemeine Definitionen -----------------------------------------------------
+
+#ifndef FEATURE_SAFETYCHECK_HOST_STL
+/// \ingroup feature_flags
+/// Ersetzt die Self-Test-Library von ST durch die Host-Emulation. Nur für
+/// Host-Testbuilds, per Default deaktiviert.
+#define FEATURE_SAFETYCHECK_HOST_STL    (0)
+#endif
+
+// Makros ----------------------------------------------------------------------
+
+#ifndef HOSTSTL_RAM_AREAS_MAX
+/// Maximale Anzahl eingeblendeter RAM-Bereiche.
+#define HOSTSTL_RAM_AREAS_MAX           (4u)
+#endif
+
+/// Größe eines RAM-Sektors in Bytes (UM2590).
+#define HOSTSTL_RAM_SECTION_SIZE        (128u)
+
+/// Größe eines RAM-Blocks in Bytes (UM2590).
+#define HOSTSTL_RAM_BLOCK_SIZE          (16u)
+
+// Typdefinitionen--------------------------------------------------------------
+
+/// Zähler der Emulation, z.B. für Laufzeitmessungen
+typedef struct
+{
+    U32 ramSections;        ///< Getestete RAM-Sektoren
+    U32 ramAccesses;        ///< Lese- und Schreibzugriffe des RAM-Tests in Worten
+    U32 flashSections;      ///< Geprüfte Flash-Sektoren
+    U32 cpuTests;           ///< Ausgeführte CPU-Tests
+} HOSTSTL_STATISTICS;
+
+// externe Variablen -----------------------------------------------------------
+
+// Prototypen ------------------------------------------------------------------
+
+#if FEATURE_SAFETYCHECK_HOST_STL
+
+/// Setzt die Emulation vollständig zurück: Scheduler nicht gestartet, alle
+/// Speicherbereiche ausgeblendet, Fehler entfernt und Zähler gelöscht.
+extern void HostStl_Reset(void);
+
+/// Blendet einen Puffer als RAM unter seiner Zieladresse ein.
+/// \param address Zieladresse, an 4 Byte ausgerichtet.
+/// \param buffer Puffer, muss bis HostStl_Reset() gültig bleiben.
+/// \param size Größe in Bytes, Vielfaches von 4.
+/// \return @c true bei Erfolg, @c false bei ungültigen Parametern, Überlappung
+/// oder wenn bereits @ref HOSTSTL_RAM_AREAS_MAX Bereiche eingeblendet sind.
+extern bool HostStl_AttachRam(U32 const address, U32 * const buffer, U32 const size);
+
+/// Blendet ein Firmware-Image als Flash unter seiner Zieladresse ein. Der
+/// CRC-Bereich liegt am Ende des Images.
+/// \param address Zieladresse, z.B. FLASH_BASE, an 1024 Byte ausgerichtet.
+/// \param image Image, muss bis HostStl_Reset() gültig bleiben.
+/// \param size Größe in Bytes, Vielfaches von 1024.
+/// \return @c true bei Erfolg, sonst @c false.
+extern bool HostStl_AttachFlash(U32 const address, U8 * const image, U32 const size);
+
+/// Berechnet die CRCs aller Sektoren des eingeblendeten Images und schreibt sie
+/// in den CRC-Bereich, wie das Post-Build-Kommando des STM32CubeProgrammers.
+/// \return @c true bei Erfolg, @c false wenn kein Image eingeblendet ist.
+extern bool HostStl_UpdateFlashCrc(void);
+
+/// Baut einen Stuck-at-Fehler in ein Wort des eingeblendeten RAMs ein. Es ist
+/// höchstens ein Fehler aktiv, ein neuer Fehler ersetzt den vorherigen.
+/// \param address Adresse des Wortes, an 4 Byte ausgerichtet.
+/// \param stuckAtOne Bits, die immer 1 lesen.
+/// \param stuckAtZero Bits, die immer 0 lesen.
+/// \return @c true bei Erfolg, @c false wenn die Adresse nicht eingeblendet ist.
+extern bool HostStl_InjectRamFault(U32 const address, U32 const stuckAtOne, U32 const stuckAtZero);
+
+/// Entfernt einen eingebauten Stuck-at-Fehler. Der Inhalt des Wortes bleibt.
+extern void HostStl_ClearRamFault(void);
+
+/// Liefert die Zähler der Emulation.
+/// \param statistics Rückgabe der Zähler.
+extern void HostStl_GetStatistics(HOSTSTL_STATISTICS * const statistics);
+
+#endif // FEATURE_SAFETYCHECK_HOST_STL
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* STM32_SAFETY_STL_HOST_STL_H */
+/**
+* @}
+*/
@@ -4,19 +4,15 @@
 
 
 // Headerdateien einbinden -----------------------------------------------------
+#include <string.h>
+
 #include "config/version.h"
 
 
 #include "SafetyStl.h"
 
-/// Baut Artificial-Failing Funktionalitäten zum Testen des Moduls ein
-#ifndef FEATURE_SAFETYCHECK_ARTIFICIAL_TEST_RAM_STL
-#define FEATURE_SAFETYCHECK_ARTIFICIAL_TEST_RAM_STL              (0)
-#endif
-
-#if FEATURE_SAFETYCHECK_ARTIFICIAL_TEST_RAM_STL
-#include "RAMTestStl_ArtificialFailing.h"
-#endif
+#include "FaultInjectionStl.h"
+#include "safety_trace.h"
 
 #include "RAMTestStl.h"
 
@@ -43,6 +39,26 @@ extern U32 __RAM_TESTREGION3_SIZE;  ///< Size in bytes
 extern U32 __SRAM_RAMTEST_BACKUP_START; ///< Startadresse des RAM-Backup-Puffers, vom Linker bereitgestellt.
 extern U32 __SRAM_RAMTEST_BACKUP_SIZE;  ///< Größe des RAM-Backup-Puffers, vom Linker bereitgestellt.
 
+/// Adressen und Größen der Testbereiche und des RAM-Backup-Puffers, per Default
+/// aus den Linker-Symbolen. Host-Builds ohne die Symbole, z.B. die Modultests
+/// auf einem 64-Bit-Host, setzen die Zieladressen der Host-Emulation direkt.
+#ifndef RAMTEST_REGION1_START
+#define RAMTEST_REGION1_START   ((U8 *) &__RAM_TESTREGION1_START)
+#define RAMTEST_REGION1_SIZE    ((U32) &__RAM_TESTREGION1_SIZE)
+#endif
+#ifndef RAMTEST_REGION2_START
+#define RAMTEST_REGION2_START   ((U8 *) &__RAM_TESTREGION2_START)
+#define RAMTEST_REGION2_SIZE    ((U32) &__RAM_TESTREGION2_SIZE)
+#endif
+#ifndef RAMTEST_REGION3_START
+#define RAMTEST_REGION3_START   ((U8 *) &__RAM_TESTREGION3_START)
+#define RAMTEST_REGION3_SIZE    ((U32) &__RAM_TESTREGION3_SIZE)
+#endif
+#ifndef RAMTEST_BACKUP_START
+#define RAMTEST_BACKUP_START    ((U8 *) &__SRAM_RAMTEST_BACKUP_START)
+#define RAMTEST_BACKUP_SIZE     ((U32) &__SRAM_RAMTEST_BACKUP_SIZE)
+#endif
+
 #if FEATURE_SAFETYCHECK_USE_STL
 #if EN61508_RAMTEST_USE_TIMER
 #error "RAM-Test mit Timer unter Verwendung der Safety-Library von ST nicht umgesetzt. Option EN61508_RAMTEST_USE_TIMER = 0 setzen."
@@ -79,87 +95,52 @@ extern U32 __SRAM_RAMTEST_BACKUP_SIZE;  ///< Größe des RAM-Backup-Puffers, vom
 /// Maximum tick value to regard tick overflow
 #define TICKS_MAX_VALUE                  (RTOS_MAX_TIMEOUT)
 
-/// Enumeration für den Zustand des RAM-Tests
-/// Zeigt an, ob der Test konfiguriert ist.
-typedef enum
-{
-    RAM_IDLE = 0,         ///< RAM_IDLE Ausgangszustand
-    RAM_CONFIGURED = 1,   ///< RAM_CONFIGURED konfiguriert, bereit zum Starten
-} RAM_TEST_STATE;
-
-/// Struktur für den Teststatus zur Laufzeit
-typedef struct
-{
-    STL_TmStatus_t tmStatus;          ///< Testmodul-Status von STL
-    RAM_TEST_STATE ramTestState;      ///< Status des RAM-Tests
-    STL_MemConfig_t memoryConfig;     ///< Eingestellte Testkonfiguration
-#if FEAT_DEBUG
-    U32 testRoundCounter;             ///< Counts number of test executions
-#endif
-} RAM_TEST;
-
-/// Laufzeitwerte für kompletten RAM-Testdurclauf
-static RAM_TEST ramTestAll =
-                {
-                    STL_ERROR,
-                    RAM_IDLE,
-                    {NULL},
-                #if FEAT_DEBUG
-                    0,
-                #endif
-                };
-
-/// Laufzeitwerte für zyklischen RAM-Testdurchlauf
-static RAM_TEST ramTestCyclic =
-                {
-                    STL_ERROR,
-                    RAM_IDLE,
-                    {NULL},
-                #if FEAT_DEBUG
-                    0,
-                #endif
-                };
-
 /// Definition der Testbereiche im RAM
 static EN61508_MEM_REGION const ramRegions[] =
     {
-        { (U8*) &__RAM_TESTREGION1_START, (U32) &__RAM_TESTREGION1_SIZE },
+        { RAMTEST_REGION1_START, RAMTEST_REGION1_SIZE },
 #ifdef FEATURE_RAMTEST_INCLUDE_TESTREGION2
-        { (U8*) &__RAM_TESTREGION2_START, (U32) &__RAM_TESTREGION2_SIZE },
+        { RAMTEST_REGION2_START, RAMTEST_REGION2_SIZE },
 #endif
 #ifdef FEATURE_RAMTEST_INCLUDE_TESTREGION3
-        { (U8*) &__RAM_TESTREGION3_START, (U32) &__RAM_TESTREGION3_SIZE },
+        { RAMTEST_REGION3_START, RAMTEST_REGION3_SIZE },
 #endif
     };
 
 /// Anzahl der Testbereiche.
 #define NUM_RAM_REGIONS (sizeof(ramRegions) / sizeof(EN61508_MEM_REGION))
 
-static STL_MemSubset_t ramSubsets[NUM_RAM_REGIONS];
+/// Standardinstanz der Funktionen ohne Instanz, initialisiert beim ersten Aufruf
+static RAM_TEST_CONTEXT ramTestDefault;
 
-/// Last time in ticks at which the cyclic test passed
-static U32 lastTestpassTicks = 0;
-/// Process safety time in ticks set by the user
-static U32 processSafetyTimeTicksInt = 0;
+/// RAM-Test, der zuletzt in der STL konfiguriert wurde, NULL wenn keiner
+static RAM_TEST * ramTestConfigured = NULL;
 
 //------------------------------------------------------------------------------
 // Prototypen interne Funktionen -----------------------------------------------
 //------------------------------------------------------------------------------
 
 /// Initialisierung des kompletten RAM-Tests.
+/// \param context Instanz der RAM-Tests.
 /// \return @c true bei Erfolg, sonst @c false.
-static bool RAMTestStl_SetupTestAll(void);
+static bool RAMTestStl_SetupTestAll(RAM_TEST_CONTEXT * const context);
+
+/// Trägt die Testbereiche der Instanz in die Subsets für die STL ein.
+/// \param context Instanz der RAM-Tests.
+static void RAMTestStl_SetupSubsets(RAM_TEST_CONTEXT * const context);
 
 /// Initialisiert und konfiguriert den RAM-Test anhand der übergebenen
 /// Einstellungen.
+/// \param context Instanz der RAM-Tests.
 /// \param ramTest Handle des RAM-Tests mit den Konfigurationen für den Speicher.
 /// \return @c true bei Erfolg, sonst @c false.
-static bool RAMTestStl_SetupTest(RAM_TEST * const ramTest);
+static bool RAMTestStl_SetupTest(RAM_TEST_CONTEXT * const context, RAM_TEST * const ramTest);
 
 /// Intialisiert den RAM-Test.
+/// \param context Instanz der RAM-Tests.
 /// \param ramTest Handle des zugehörigen RAM-Tests.
 /// \return @c true bei Erfolg, sonst @c false.
-static bool RAMTestStl_Init(RAM_TEST * const ramTest);
+static bool RAMTestStl_Init(RAM_TEST_CONTEXT * const context, RAM_TEST * const ramTest);
 
 /// Setzt den RAM-Test zurück. Die Aktion ist erforderlich, wenn
 /// der RAM-Test einmal durchgelaufen ist und neu gestartet werden soll.
@@ -180,7 +161,8 @@ static bool RAMTestStl_CheckConfig(STL_MemConfig_t const * const config);
 /// @c false, wenn Backup-Puffer und Testbreich sich überschneiden.
 static bool RAMTestStl_CheckConfigRamBackup(U32 const testStartAddress, U32 const testEndAddress);
 
-/// Setzt die Zustände der RAM-Tests auf den Ausgangszustand @ref RAM_IDLE zurück.
+/// Setzt den Zustand des zuletzt in der STL konfigurierten RAM-Tests auf den
+/// Ausgangszustand @ref RAM_IDLE zurück.
 static void RAMTestStl_SetIdle(void);
 
 //------------------------------------------------------------------------------
@@ -189,6 +171,64 @@ static void RAMTestStl_SetIdle(void);
 
 /// @author k.ehlen @date 08.01.2023
 EN61508_TestResult RAMTestStl_RunAll(void)
+    {
+    return RAMTestStl_ContextRunAll(RAMTestStl_GetDefaultContext());
+    }
+//------------------------------------------------------------------------------
+
+bool RAMTestStl_ContextInit(RAM_TEST_CONTEXT * const context,
+                            EN61508_MEM_REGION const * const regions, U8 const numRegions)
+    {
+    EN61508_MEM_REGION const * testRegions;
+    U32 numTestRegions;
+
+    if(context == NULL)
+        {
+        return false;
+        }
+
+    // Die Konfiguration der STL gehört danach zu keinem Test dieser Instanz
+    if((ramTestConfigured == &context->ramTestAll) || (ramTestConfigured == &context->ramTestCyclic))
+        {
+        ramTestConfigured = NULL;
+        }
+
+    memset(context, 0, sizeof(*context));
+    context->ramTestAll.tmStatus = STL_ERROR;
+    context->ramTestCyclic.tmStatus = STL_ERROR;
+    context->firstTestStart = true;
+
+    testRegions = regions;
+    numTestRegions = numRegions;
+    if(testRegions == NULL)
+        {
+        testRegions = ramRegions;
+        numTestRegions = NUM_RAM_REGIONS;
+        }
+
+    if((numTestRegions == 0) || (numTestRegions > RAMTEST_REGIONS_MAX))
+        {
+        return false;
+        }
+
+    context->ramRegions = testRegions;
+    context->numRamRegions = (U8) numTestRegions;
+    return true;
+    }
+//------------------------------------------------------------------------------
+
+RAM_TEST_CONTEXT * RAMTestStl_GetDefaultContext(void)
+    {
+    if(ramTestDefault.ramRegions == NULL)
+        {
+        (void) RAMTestStl_ContextInit(&ramTestDefault, NULL, 0);
+        }
+
+    return &ramTestDefault;
+    }
+//------------------------------------------------------------------------------
+
+EN61508_TestResult RAMTestStl_ContextRunAll(RAM_TEST_CONTEXT * const context)
     {
     EN61508_TestResult testResult;
     STL_Status_t stlError;
@@ -196,45 +236,55 @@ EN61508_TestResult RAMTestStl_RunAll(void)
     stlError = STL_KO;
     testResult = EN61508_TestFail;
 
-    if(RAMTestStl_SetupTestAll())
+    if(RAMTestStl_SetupTestAll(context))
         {
-#if FEATURE_SAFETYCHECK_ARTIFICIAL_TEST_RAM_STL
-#if RAMTEST_ARTI_FAILING_RUN_ALL
-        RAMTEST_ARTI_FAILING_START
-#endif
-#endif
+        FAULTINJECTIONSTL_START(FAULTINJECTIONSTL_RAM_RUN_ALL);
 
-        stlError = STL_SCH_RunRamTM(&ramTestAll.tmStatus);
+        SAFETY_TRACE_BEGIN(eSAFETY_TRACE_TRACK_TASK, "STL RAM");
+        stlError = STL_SCH_RunRamTM(&context->ramTestAll.tmStatus);
+        SAFETY_TRACE_END(eSAFETY_TRACE_TRACK_TASK, "STL RAM");
 
-#if FEATURE_SAFETYCHECK_ARTIFICIAL_TEST_RAM_STL
-#if RAMTEST_ARTI_FAILING_RUN_ALL
-        RAMTEST_ARTI_FAILING_STOP
-#endif
-#endif
+        FAULTINJECTIONSTL_STOP();
 
 #if FEAT_DEBUG
         // Increase test execution counter
-        ramTestAll.testRoundCounter++;
+        context->ramTestAll.testRoundCounter++;
 #endif
         }
 
-    if((stlError == STL_OK) && (ramTestAll.tmStatus == STL_PASSED))
+    if((stlError == STL_OK) && (context->ramTestAll.tmStatus == STL_PASSED))
         {
         testResult = EN61508_TestPass;
         }
 
+    // Der komplette Test belegt das RAM-Testmodul der STL nur während des Durchlaufs
+    if(ramTestConfigured == &context->ramTestAll)
+        {
+        RAMTestStl_SetIdle();
+        }
+
     return testResult;
     }
 //------------------------------------------------------------------------------
 
 /// @author k.ehlen @date 08.01.2023
 EN61508_TestResult RAMTestStl_RunCyclic(U32 const currentTicks)
+    {
+    return RAMTestStl_ContextRunCyclic(RAMTestStl_GetDefaultContext(), currentTicks);
+    }
+//------------------------------------------------------------------------------
+
+EN61508_TestResult RAMTestStl_ContextRunCyclic(RAM_TEST_CONTEXT * const context, U32 const currentTicks)
     {
     EN61508_TestResult testResult;
     STL_Status_t stlError;
     bool runRam;
     bool processSafetyTimeFailure;
-    static bool firstTestStart = true;
+
+    if(context == NULL)
+        {
+        return EN61508_TestFail;
+        }
 
     runRam = true;
     stlError = STL_KO;
@@ -242,13 +292,13 @@ EN61508_TestResult RAMTestStl_RunCyclic(U32 const currentTicks)
     processSafetyTimeFailure = false;
 
     // Set time reference after bootup
-    if(firstTestStart)
+    if(context->firstTestStart)
         {
-        firstTestStart = false;
-        lastTestpassTicks = currentTicks;
+        context->firstTestStart = false;
+        context->lastTestpassTicks = currentTicks;
         }
 
-    if(ramTestCyclic.ramTestState != RAM_CONFIGURED)
+    if(context->ramTestCyclic.ramTestState != RAM_CONFIGURED)
         {
         runRam = false;
         }
@@ -256,40 +306,34 @@ EN61508_TestResult RAMTestStl_RunCyclic(U32 const currentTicks)
     // Testausführung
     if(runRam)
         {
-#if FEATURE_SAFETYCHECK_ARTIFICIAL_TEST_RAM_STL
-#if RAMTEST_ARTI_FAILING_RUN_CYCLIC
-        RAMTEST_ARTI_FAILING_START
-#endif
-#endif
+        FAULTINJECTIONSTL_START(FAULTINJECTIONSTL_RAM_RUN_CYCLIC);
 
-        stlError = STL_SCH_RunRamTM(&ramTestCyclic.tmStatus);
+        SAFETY_TRACE_BEGIN(eSAFETY_TRACE_TRACK_TASK, "STL RAM cyclic");
+        stlError = STL_SCH_RunRamTM(&context->ramTestCyclic.tmStatus);
+        SAFETY_TRACE_END(eSAFETY_TRACE_TRACK_TASK, "STL RAM cyclic");
 
-#if FEATURE_SAFETYCHECK_ARTIFICIAL_TEST_RAM_STL
-#if RAMTEST_ARTI_FAILING_RUN_CYCLIC
-        RAMTEST_ARTI_FAILING_STOP
-#endif
-#endif
+        FAULTINJECTIONSTL_STOP();
 
 #if FEAT_DEBUG
         // Increase test execution counter
-        ramTestCyclic.testRoundCounter++;
+        context->ramTestCyclic.testRoundCounter++;
 #endif
         }
 
     if(runRam && (stlError == STL_OK))
         {
         // Statusüberprüfung
-        switch(ramTestCyclic.tmStatus)
+        switch(context->ramTestCyclic.tmStatus)
             {
             case STL_PARTIAL_PASSED:
                 // Teilstück bestanden
                 testResult = EN61508_TestPass;
                 break;
             case STL_PASSED:
-                lastTestpassTicks = currentTicks;
+                context->lastTestpassTicks = currentTicks;
 
                 // Test completed successfully, reset test
-                if(RAMTestStl_Reset(&ramTestCyclic))
+                if(RAMTestStl_Reset(&context->ramTestCyclic))
                     {
                     testResult = EN61508_TestPass;
                     }
@@ -302,13 +346,14 @@ EN61508_TestResult RAMTestStl_RunCyclic(U32 const currentTicks)
 
     // Check process safety timeout
     // The Runtime RAM has to be completed at least once per Process Safety Time (SOFTQM-462)
-    if(currentTicks >= lastTestpassTicks)
+    if(currentTicks >= context->lastTestpassTicks)
         {
-        processSafetyTimeFailure = ((currentTicks - lastTestpassTicks) > processSafetyTimeTicksInt);
+        processSafetyTimeFailure = ((currentTicks - context->lastTestpassTicks) > context->processSafetyTimeTicksInt);
         }
     else
         {
-        processSafetyTimeFailure = ((TICKS_MAX_VALUE - lastTestpassTicks + currentTicks) > processSafetyTimeTicksInt);
+        processSafetyTimeFailure = ((TICKS_MAX_VALUE - context->lastTestpassTicks + currentTicks)
+                                    > context->processSafetyTimeTicksInt);
         }
 
     if(processSafetyTimeFailure)
@@ -323,79 +368,127 @@ EN61508_TestResult RAMTestStl_RunCyclic(U32 const currentTicks)
 /// @author k.ehlen @date 08.01.2023
 bool RAMTestStl_SetupTestCyclic(U32 const processSafetyTimeTicks)
     {
-    U8 i;
-
-    processSafetyTimeTicksInt = processSafetyTimeTicks;
+    // Number of tested RAM sections per test execution (SOFTQM-454)
+    return RAMTestStl_ContextSetupTestCyclic(RAMTestStl_GetDefaultContext(), processSafetyTimeTicks,
+                                             RAMTEST_CYCLIC_NUM_SECTIONS);
+    }
+//------------------------------------------------------------------------------
 
-    for(i = 0; i < NUM_RAM_REGIONS; i++)
+bool RAMTestStl_ContextSetupTestCyclic(RAM_TEST_CONTEXT * const context,
+                                       U32 const processSafetyTimeTicks, U32 const numSectionsAtomic)
+    {
+    if((context == NULL) || (context->ramRegions == NULL) || (numSectionsAtomic < RAMTEST_NUM_SECTIONS_ATOMIC_MIN))
         {
-        ramSubsets[i].StartAddr = (U32) ramRegions[i].start;
-        ramSubsets[i].EndAddr = (U32) ramRegions[i].start + ramRegions[i].length - 1;
-
-        if(i == (NUM_RAM_REGIONS - 1))
-            {
-            ramSubsets[i].pNext = NULL;
-            }
-        else
-            {
-            ramSubsets[i].pNext = &ramSubsets[i + 1];
-            }
+        return false;
         }
 
-    ramTestCyclic.memoryConfig.pSubset = ramSubsets;
+    context->processSafetyTimeTicksInt = processSafetyTimeTicks;
 
-    // Number of tested RAM sections per test execution (SOFTQM-454)
-    ramTestCyclic.memoryConfig.NumSectionsAtomic = RAMTEST_CYCLIC_NUM_SECTIONS;
+    RAMTestStl_SetupSubsets(context);
+    context->ramTestCyclic.memoryConfig.pSubset = context->ramSubsets;
+    context->ramTestCyclic.memoryConfig.NumSectionsAtomic = numSectionsAtomic;
 
 #if FEAT_DEBUG
     // Set test round counter to zero
-    ramTestCyclic.testRoundCounter = 0;
+    context->ramTestCyclic.testRoundCounter = 0;
 #endif
 
-    return RAMTestStl_SetupTest(&ramTestCyclic);
+    return RAMTestStl_SetupTest(context, &context->ramTestCyclic);
     }
 //------------------------------------------------------------------------------
 
-//------------------------------------------------------------------------------
-// Funktionsbereich interne Funktionen -----------------------------------------
+U32 RAMTestStl_GetMaxCallIntervalTicks(void)
+    {
+    return RAMTestStl_ContextGetMaxCallIntervalTicks(RAMTestStl_GetDefaultContext());
+    }
 //------------------------------------------------------------------------------
 
-/// @author k.ehlen @date 08.01.2023
-static bool RAMTestStl_SetupTestAll(void)
+U32 RAMTestStl_ContextGetMaxCallIntervalTicks(RAM_TEST_CONTEXT const * const context)
     {
+    U32 numSections;
+    U32 numCalls;
+    U32 numSectionsAtomic;
     U8 i;
 
-    for(i = 0; i < NUM_RAM_REGIONS; i++)
+    if(context == NULL)
         {
-        ramSubsets[i].StartAddr = (U32) ramRegions[i].start;
-        ramSubsets[i].EndAddr = (U32) ramRegions[i].start + ramRegions[i].length - 1;
+        return 0;
+        }
 
-        if(i == (NUM_RAM_REGIONS - 1))
-            {
-            ramSubsets[i].pNext = NULL;
-            }
-        else
-            {
-            ramSubsets[i].pNext = &ramSubsets[i + 1];
-            }
+    numSectionsAtomic = context->ramTestCyclic.memoryConfig.NumSectionsAtomic;
+    if((context->ramTestCyclic.ramTestState != RAM_CONFIGURED) || (numSectionsAtomic == 0))
+        {
+        return 0;
         }
 
-    ramTestAll.memoryConfig.pSubset = ramSubsets;
+    numSections = 0;
+    for(i = 0; i < context->numRamRegions; i++)
+        {
+        numSections += (context->ramRegions[i].length + STL_RAM_SECTION_SIZE - 1) / STL_RAM_SECTION_SIZE;
+        }
+
+    // Anzahl Aufrufe für einen kompletten Durchlauf, aufgerundet
+    numCalls = numSections / numSectionsAtomic;
+    if((numSections % numSectionsAtomic) != 0)
+        {
+        numCalls++;
+        }
+
+    // Ein zusätzlicher Aufruf als Reserve für den Neustart des Tests
+    return context->processSafetyTimeTicksInt / (numCalls + 1);
+    }
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Funktionsbereich interne Funktionen -----------------------------------------
+//------------------------------------------------------------------------------
+
+/// @author k.ehlen @date 08.01.2023
+static bool RAMTestStl_SetupTestAll(RAM_TEST_CONTEXT * const context)
+    {
+    if((context == NULL) || (context->ramRegions == NULL))
+        {
+        return false;
+        }
+
+    RAMTestStl_SetupSubsets(context);
+    context->ramTestAll.memoryConfig.pSubset = context->ramSubsets;
 
     // Number of tested RAM sections per test execution
-    ramTestAll.memoryConfig.NumSectionsAtomic = RAMTEST_NUM_SECTIONS_ATOMIC_MAX;
+    context->ramTestAll.memoryConfig.NumSectionsAtomic = RAMTEST_NUM_SECTIONS_ATOMIC_MAX;
 
 #if FEAT_DEBUG
     // Set test round counter to zero
-    ramTestAll.testRoundCounter = 0;
+    context->ramTestAll.testRoundCounter = 0;
 #endif
 
-    return RAMTestStl_SetupTest(&ramTestAll);
+    return RAMTestStl_SetupTest(context, &context->ramTestAll);
+    }
+//------------------------------------------------------------------------------
+
+static void RAMTestStl_SetupSubsets(RAM_TEST_CONTEXT * const context)
+    {
+    U8 i;
+
+    for(i = 0; i < context->numRamRegions; i++)
+        {
+        context->ramSubsets[i].StartAddr = (U32) context->ramRegions[i].start;
+        context->ramSubsets[i].EndAddr = (U32) context->ramRegions[i].start + context->ramRegions[i].length - 1;
+
+        if(i == (context->numRamRegions - 1))
+            {
+            context->ramSubsets[i].pNext = NULL;
+            }
+        else
+            {
+            context->ramSubsets[i].pNext = &context->ramSubsets[i + 1];
+            }
+        }
     }
 //------------------------------------------------------------------------------
 
 /// @author k.ehlen @date 08.01.2023
-static bool RAMTestStl_SetupTest(RAM_TEST * const ramTest)
+static bool RAMTestStl_SetupTest(RAM_TEST_CONTEXT * const context, RAM_TEST * const ramTest)
     {
     bool result;
     bool isInitialized;
@@ -406,6 +499,14 @@ static bool RAMTestStl_SetupTest(RAM_TEST * const ramTest)
         return false;
         }
 
+    // Das RAM-Testmodul der STL gehört dem zyklischen Test einer anderen
+    // Instanz, bis diese mit RAMTestStl_ContextInit() freigegeben wird
+    if((ramTestConfigured != NULL) && (ramTestConfigured != &context->ramTestAll)
+            && (ramTestConfigured != &context->ramTestCyclic))
+        {
+        return false;
+        }
+
     if(!RAMTestStl_CheckConfig(&ramTest->memoryConfig))
         {
         return false;
@@ -415,35 +516,25 @@ static bool RAMTestStl_SetupTest(RAM_TEST * const ramTest)
     result = false;
     stlError = STL_KO;
 
-    if(RAMTestStl_Init(ramTest))
+    if(RAMTestStl_Init(context, ramTest))
         {
         isInitialized = true;
         }
 
     if(isInitialized)
         {
-#if FEATURE_SAFETYCHECK_ARTIFICIAL_TEST_RAM_STL
-    #if RAMTEST_ARTI_FAILING_CONFIGURE_ALL
-            RAMTEST_ARTI_FAILING_START_ALL
-    #elif RAMTEST_ARTI_FAILING_CONFIGURE_CYCLIC
-            RAMTEST_ARTI_FAILING_START_CYCLIC
-    #endif
-#endif
+        FAULTINJECTIONSTL_START((ramTest == &context->ramTestAll) ? FAULTINJECTIONSTL_RAM_CONFIGURE_ALL
+                                : FAULTINJECTIONSTL_RAM_CONFIGURE_CYCLIC);
 
         stlError = STL_SCH_ConfigureRam(&ramTest->tmStatus, &ramTest->memoryConfig);
 
-#if FEATURE_SAFETYCHECK_ARTIFICIAL_TEST_RAM_STL
-    #if RAMTEST_ARTI_FAILING_CONFIGURE_ALL
-            RAMTEST_ARTI_FAILING_STOP_ALL
-    #elif RAMTEST_ARTI_FAILING_CONFIGURE_CYCLIC
-            RAMTEST_ARTI_FAILING_STOP_CYCLIC
-    #endif
-#endif
+        FAULTINJECTIONSTL_STOP();
 
         if((stlError == STL_OK) && (ramTest->tmStatus == STL_NOT_TESTED))
             {
             // Setup erfolgreich
             ramTest->ramTestState = RAM_CONFIGURED;
+            ramTestConfigured = ramTest;
             result = true;
             }
         }
@@ -452,7 +543,7 @@ static bool RAMTestStl_SetupTest(RAM_TEST * const ramTest)
 //------------------------------------------------------------------------------
 
 /// @author k.ehlen @date 08.01.2023
-static bool RAMTestStl_Init(RAM_TEST * const ramTest)
+static bool RAMTestStl_Init(RAM_TEST_CONTEXT * const context, RAM_TEST * const ramTest)
     {
     bool result;
     STL_Status_t stlError;
@@ -467,28 +558,17 @@ static bool RAMTestStl_Init(RAM_TEST * const ramTest)
 
     ramTest->tmStatus = STL_ERROR;
 
-    // Alle Konfigurationen löschen
+    // Konfiguration der STL löschen
     RAMTestStl_SetIdle();
 
     if(Stl_SchedulerIsStarted())
         {
-#if FEATURE_SAFETYCHECK_ARTIFICIAL_TEST_RAM_STL
-    #if RAMTEST_ARTI_FAILING_INIT_ALL
-            RAMTEST_ARTI_FAILING_START_ALL
-    #elif RAMTEST_ARTI_FAILING_INIT_CYCLIC
-            RAMTEST_ARTI_FAILING_START_CYCLIC
-    #endif
-#endif
+        FAULTINJECTIONSTL_START((ramTest == &context->ramTestAll) ? FAULTINJECTIONSTL_RAM_INIT_ALL
+                                : FAULTINJECTIONSTL_RAM_INIT_CYCLIC);
 
         stlError = STL_SCH_InitRam(&ramTest->tmStatus);
 
-#if FEATURE_SAFETYCHECK_ARTIFICIAL_TEST_RAM_STL
-    #if RAMTEST_ARTI_FAILING_INIT_ALL
-            RAMTEST_ARTI_FAILING_STOP_ALL
-    #elif RAMTEST_ARTI_FAILING_INIT_CYCLIC
-            RAMTEST_ARTI_FAILING_STOP_CYCLIC
-    #endif
-#endif
+        FAULTINJECTIONSTL_STOP();
         }
 
     if((stlError == STL_OK) && (ramTest->tmStatus == STL_NOT_TESTED))
@@ -522,19 +602,13 @@ static bool RAMTestStl_Reset(RAM_TEST * const ramTest)
         ramTest->testRoundCounter = 0;
 #endif
 
-#if FEATURE_SAFETYCHECK_ARTIFICIAL_TEST_RAM_STL
-#if RAMTEST_ARTI_FAILING_RESET_CYCLIC
-        RAMTEST_ARTI_FAILING_START
-#endif
-#endif
+        FAULTINJECTIONSTL_START(FAULTINJECTIONSTL_RAM_RESET_CYCLIC);
 
+        SAFETY_TRACE_BEGIN(eSAFETY_TRACE_TRACK_TASK, "STL RAM reset");
         stlError = STL_SCH_ResetRam(&ramTest->tmStatus);
+        SAFETY_TRACE_END(eSAFETY_TRACE_TRACK_TASK, "STL RAM reset");
 
-#if FEATURE_SAFETYCHECK_ARTIFICIAL_TEST_RAM_STL
-#if RAMTEST_ARTI_FAILING_RESET_CYCLIC
-        RAMTEST_ARTI_FAILING_STOP
-#endif
-#endif
+        FAULTINJECTIONSTL_STOP();
         }
 
     if((stlError == STL_OK) && (ramTest->tmStatus == STL_NOT_TESTED))
@@ -599,7 +673,7 @@ static bool RAMTestStl_CheckConfigRamBackup(U32 const testStartAddress, U32 cons
     {
     bool result;
     U32 backupEnd;
-    EN61508_MEM_REGION backupBuffer = {(U8*) &__SRAM_RAMTEST_BACKUP_START, (U32) &__SRAM_RAMTEST_BACKUP_SIZE};
+    EN61508_MEM_REGION backupBuffer = {RAMTEST_BACKUP_START, RAMTEST_BACKUP_SIZE};
 
     backupEnd = (U32) backupBuffer.start + backupBuffer.length - 1;
 
@@ -624,8 +698,11 @@ static bool RAMTestStl_CheckConfigRamBackup(U32 const testStartAddress, U32 cons
 /// @author k.ehlen @date 24.01.2023
 static void RAMTestStl_SetIdle(void)
     {
-    ramTestAll.ramTestState = RAM_IDLE;
-    ramTestCyclic.ramTestState = RAM_IDLE;
+    if(ramTestConfigured != NULL)
+        {
+        ramTestConfigured->ramTestState = RAM_IDLE;
+        ramTestConfigured = NULL;
+        }
     }
 //------------------------------------------------------------------------------
 
@@ -31,6 +31,21 @@
  *       (++) Zyklischer Testaufruf:
  *              (+++) RAMTestStl_RunCyclic()
  *
+ * Der Zustand der Tests liegt in einer Instanz @ref RAM_TEST_CONTEXT. Die
+ * Funktionen ohne Instanz arbeiten auf einer Standardinstanz über die im Linker
+ * definierten Testbereiche. Die Funktionen RAMTestStl_Context...() arbeiten auf
+ * einer eigenen Instanz, z.B. mit eigenen Testbereichen und eigener Anzahl
+ * Sektoren pro Aufruf oder für voneinander unabhängige Tests in der Simulation.
+ *
+ * Die STL hat nur ein RAM-Testmodul. Der zyklische Test einer Instanz belegt
+ * es ab RAMTestStl_ContextSetupTestCyclic() bis zum nächsten
+ * RAMTestStl_ContextInit() dieser Instanz. Solange lehnen
+ * RAMTestStl_ContextSetupTestCyclic() und RAMTestStl_ContextRunAll() anderer
+ * Instanzen mit einem Fehler ab. Der komplette Test belegt das Testmodul nur
+ * während des Durchlaufs. Innerhalb einer Instanz setzt der komplette Test den
+ * zyklischen Test auf nicht konfiguriert zurück, danach ist erneut
+ * RAMTestStl_ContextSetupTestCyclic() notwendig.
+ *
  * @{
  */
 #ifndef STM32_SAFETY_STL_RAMTEST_RAM_TEST_STL_H
@@ -42,6 +57,8 @@
 extern "C" {
 #endif
 
+#include "SafetyStl.h"
+
 // Allgemeine Definitionen -----------------------------------------------------
 
 // Makros ----------------------------------------------------------------------
@@ -58,8 +75,45 @@ extern "C" {
 /// test execution.
 #define RAMTEST_NUM_SECTIONS_ATOMIC_MIN  (0x1)
 
+#ifndef RAMTEST_REGIONS_MAX
+/// Maximale Anzahl Testbereiche einer Instanz.
+#define RAMTEST_REGIONS_MAX              (3u)
+#endif
+
 // Typdefinitionen--------------------------------------------------------------
 
+/// Enumeration für den Zustand des RAM-Tests
+/// Zeigt an, ob der Test konfiguriert ist.
+typedef enum
+{
+    RAM_IDLE = 0,         ///< RAM_IDLE Ausgangszustand
+    RAM_CONFIGURED = 1,   ///< RAM_CONFIGURED konfiguriert, bereit zum Starten
+} RAM_TEST_STATE;
+
+/// Struktur für den Teststatus zur Laufzeit
+typedef struct
+{
+    STL_TmStatus_t tmStatus;          ///< Testmodul-Status von STL
+    RAM_TEST_STATE ramTestState;      ///< Status des RAM-Tests
+    STL_MemConfig_t memoryConfig;     ///< Eingestellte Testkonfiguration
+#if FEAT_DEBUG
+    U32 testRoundCounter;             ///< Counts number of test executions
+#endif
+} RAM_TEST;
+
+/// Instanz der RAM-Tests
+typedef struct
+{
+    EN61508_MEM_REGION const * ramRegions;          ///< Testbereiche im RAM
+    U8 numRamRegions;                               ///< Anzahl der Testbereiche
+    STL_MemSubset_t ramSubsets[RAMTEST_REGIONS_MAX];///< Subset-Einstellung für STL
+    RAM_TEST ramTestAll;                            ///< Laufzeitwerte für kompletten RAM-Testdurchlauf
+    RAM_TEST ramTestCyclic;                         ///< Laufzeitwerte für zyklischen RAM-Testdurchlauf
+    U32 lastTestpassTicks;                          ///< Last time in ticks at which the cyclic test passed
+    U32 processSafetyTimeTicksInt;                  ///< Process safety time in ticks set by the user
+    bool firstTestStart;                            ///< Set until the time reference after bootup is taken
+} RAM_TEST_CONTEXT;
+
 // externe Variablen -----------------------------------------------------------
 
 // Prototypen ------------------------------------------------------------------
@@ -69,12 +123,41 @@ extern "C" {
 /// \return @c EN61508_TestPass bei Erfolg, sonst @c EN61508_TestFail.
 extern EN61508_TestResult RAMTestStl_RunAll(void);
 
+/// Initialisierung einer Instanz der RAM-Tests. Setzt den gesamten Zustand der
+/// Instanz zurück, z.B. zwischen zwei Tests in der Simulation.
+/// \param context Instanz der RAM-Tests.
+/// \param regions Testbereiche, müssen gültig bleiben. NULL für die im Linker
+/// definierten Testbereiche.
+/// \param numRegions Anzahl der Testbereiche, höchstens @ref RAMTEST_REGIONS_MAX.
+/// \return @c true bei Erfolg, sonst @c false.
+extern bool RAMTestStl_ContextInit(RAM_TEST_CONTEXT * const context,
+                                   EN61508_MEM_REGION const * const regions, U8 const numRegions);
+
+/// Liefert die Standardinstanz, auf der die Funktionen ohne Instanz arbeiten.
+/// \return Standardinstanz der RAM-Tests.
+extern RAM_TEST_CONTEXT * RAMTestStl_GetDefaultContext(void);
+
+/// Kompletter RAM-Test-Durchlauf über die Testbereiche einer Instanz, siehe RAMTestStl_RunAll().
+/// \param context Instanz der RAM-Tests.
+/// \return @c EN61508_TestPass bei Erfolg, sonst @c EN61508_TestFail.
+extern EN61508_TestResult RAMTestStl_ContextRunAll(RAM_TEST_CONTEXT * const context);
+
 /// Initialisierung des zyklischen RAM-Tests, einmalig vor dem Test notwendig.
 /// Es wird geprüft, ob der Test mindestens einmal innerhalb der Process Safety Time durchläuft.
 /// \param processSafetyTimeTicks Process Safety Time (PST) in Ticks.
 /// \return @c true bei Erfolg, sonst @c false.
 extern bool RAMTestStl_SetupTestCyclic(U32 const processSafetyTimeTicks);
 
+/// Initialisierung des zyklischen RAM-Tests einer Instanz, siehe RAMTestStl_SetupTestCyclic().
+/// \param context Instanz der RAM-Tests.
+/// \param processSafetyTimeTicks Process Safety Time (PST) in Ticks.
+/// \param numSectionsAtomic Anzahl getesteter Sektoren pro Aufruf, zwischen
+/// @ref RAMTEST_NUM_SECTIONS_ATOMIC_MIN und @ref RAMTEST_NUM_SECTIONS_ATOMIC_MAX.
+/// \return @c true bei Erfolg, sonst @c false, auch wenn der zyklische Test
+/// einer anderen Instanz das Testmodul der STL belegt.
+extern bool RAMTestStl_ContextSetupTestCyclic(RAM_TEST_CONTEXT * const context,
+                                              U32 const processSafetyTimeTicks, U32 const numSectionsAtomic);
+
 /// Zyklischer RAM-Test über die in @c ramRegions angegebenen Bereiche.
 /// Mit einem Aufruf wird ein Sektor von 128 Bytes getestet. Beim nächsten Aufruf
 /// wird der nächste Sektor überprüft.
@@ -83,6 +166,26 @@ extern bool RAMTestStl_SetupTestCyclic(U32 const processSafetyTimeTicks);
 /// \return @c EN61508_TestPass bei Erfolg, sonst @c EN61508_TestFail.
 extern EN61508_TestResult RAMTestStl_RunCyclic(U32 const currentTicks);
 
+/// Zyklischer RAM-Test einer Instanz, siehe RAMTestStl_RunCyclic().
+/// \param context Instanz der RAM-Tests.
+/// \param currentTicks Aktuelle Zeit in Ticks.
+/// \return @c EN61508_TestPass bei Erfolg, sonst @c EN61508_TestFail.
+extern EN61508_TestResult RAMTestStl_ContextRunCyclic(RAM_TEST_CONTEXT * const context, U32 const currentTicks);
+
+/// Maximaler Abstand zwischen zwei Aufrufen von RAMTestStl_RunCyclic(), damit
+/// der zyklische RAM-Test innerhalb der Process Safety Time vollständig durchläuft.
+/// Wird für den ereignisgesteuerten Aufruf der Safety-Task benötigt.
+/// \return Maximaler Aufrufabstand in Ticks, 0 wenn der Test nicht konfiguriert
+/// ist oder die Process Safety Time nicht eingehalten werden kann.
+extern U32 RAMTestStl_GetMaxCallIntervalTicks(void);
+
+/// Maximaler Aufrufabstand des zyklischen RAM-Tests einer Instanz, siehe
+/// RAMTestStl_GetMaxCallIntervalTicks().
+/// \param context Instanz der RAM-Tests.
+/// \return Maximaler Aufrufabstand in Ticks, 0 wenn der Test nicht konfiguriert
+/// ist oder die Process Safety Time nicht eingehalten werden kann.
+extern U32 RAMTestStl_ContextGetMaxCallIntervalTicks(RAM_TEST_CONTEXT const * const context);
+
 #ifdef __cplusplus
 }
 #endif
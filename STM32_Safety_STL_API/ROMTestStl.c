@@ -4,19 +4,15 @@
 
 
 // Headerdateien einbinden -----------------------------------------------------
+#include <string.h>
+
 #include "config/version.h"
 #include "stm32g4xx_hal.h"
 
 #include "SafetyStl.h"
 
-/// Baut Artificial-Failing Funktionalitäten zum Testen des Moduls ein
-#ifndef FEATURE_SAFETYCHECK_ARTIFICIAL_TEST_ROM_STL
-#define FEATURE_SAFETYCHECK_ARTIFICIAL_TEST_ROM_STL              (0)
-#endif
-
-#if FEATURE_SAFETYCHECK_ARTIFICIAL_TEST_ROM_STL
-#include "ROMTestStl_ArtificialFailing.h"
-#endif
+#include "FaultInjectionStl.h"
+#include "safety_trace.h"
 
 #include "ROMTestStl.h"
 // Allgemeine Definitionen -----------------------------------------------------
@@ -27,6 +23,17 @@ extern U32 __FLASH_TESTREGION_START;
 extern U32 __FLASH_TESTREGION_SIZE;
 extern U32 __FLASH_TEST_STL_CRC_START;
 
+/// Adresse und Größe des Testbereichs und Beginn des CRC-Bereichs, per Default
+/// aus den Linker-Symbolen. Host-Builds ohne die Symbole, z.B. die Modultests
+/// auf einem 64-Bit-Host, setzen die Zieladressen der Host-Emulation direkt.
+#ifndef ROMTEST_REGION_START
+#define ROMTEST_REGION_START    ((U8 *) &__FLASH_TESTREGION_START)
+#define ROMTEST_REGION_SIZE     ((U32) &__FLASH_TESTREGION_SIZE)
+#endif
+#ifndef ROMTEST_CRC_START
+#define ROMTEST_CRC_START       ((U32) &__FLASH_TEST_STL_CRC_START)
+#endif
+
 /// User configuration number of tested ROM sections
 /// per test execution for cyclic runtime ROM test (SOFTQM-1076)
 /**
@@ -48,82 +55,46 @@ extern U32 __FLASH_TEST_STL_CRC_START;
 /// Maximum tick value to regard tick overflow
 #define TICKS_MAX_VALUE                  (RTOS_MAX_TIMEOUT)
 
-/// Enumeration für den Zustand des ROM-Tests
-/// Zeigt an, ob der Test konfiguriert ist.
-typedef enum
-{
-    ROM_IDLE = 0,         ///< ROM_IDLE Ausgangszustand
-    ROM_CONFIGURED = 1,   ///< ROM_CONFIGURED konfiguriert, bereit zum Starten
-} ROM_TEST_STATE;
-
-/// Struktur für den Teststatus zur Laufzeit
-typedef struct
-{
-    STL_TmStatus_t tmStatus;          ///< Testmodul-Status von STL
-    ROM_TEST_STATE romTestState;      ///< Status des ROM-Tests
-    STL_MemConfig_t memoryConfig;     ///< Eingestellte Testkonfiguration
-#if FEAT_DEBUG
-    U32 testRoundCounter;             ///< Counts number of test executions
-#endif
-} ROM_TEST;
-
-/// Laufzeitwerte für kompletten ROM-Testdurclauf
-static ROM_TEST romTestAll =
-                {
-                    STL_ERROR,
-                    ROM_IDLE,
-                    {NULL},
-                #if FEAT_DEBUG
-                    0,
-                #endif
-                };
-
-/// Laufzeitwerte für zyklischen ROM-Testdurchlauf
-static ROM_TEST romTestCyclic =
-                {
-                    STL_ERROR,
-                    ROM_IDLE,
-                    {NULL},
-                #if FEAT_DEBUG
-                    0,
-                #endif
-                };
-
 /// Definition der Flash-Bereiche, die beim ROM-Test getestet werden
 static EN61508_MEM_REGION flashRegions[] =
                 {
-                    {(U8 *) &__FLASH_TESTREGION_START, (U32) &__FLASH_TESTREGION_SIZE }
+                    {ROMTEST_REGION_START, ROMTEST_REGION_SIZE }
                 };
 
 /// Anzahl der Flashbereiche, die getestet werden
 #define NUM_FLASH_REGIONS (sizeof(flashRegions)/sizeof(EN61508_MEM_REGION))
 
-/// Subset-Einstellung für STL
-static STL_MemSubset_t flashSubsets[NUM_FLASH_REGIONS];
+/// Standardinstanz der Funktionen ohne Instanz, initialisiert beim ersten Aufruf
+static ROM_TEST_CONTEXT romTestDefault;
 
-/// Last time in ticks at which the cyclic test passed
-static U32 lastTestpassTicks = 0;
-/// Process safety time in ticks set by the user
-static U32 processSafetyTimeTicksInt = 0;
+/// ROM-Test, der zuletzt in der STL konfiguriert wurde, NULL wenn keiner
+static ROM_TEST * romTestConfigured = NULL;
 
 //------------------------------------------------------------------------------
 // Prototypen interne Funktionen -----------------------------------------------
 //------------------------------------------------------------------------------
 
 /// Initialisierung des kompletten ROM-Tests.
+/// \param context Instanz der ROM-Tests.
 /// \return @c true bei Erfolg, sonst @c false.
-static bool ROMTestStl_SetupTestAll(void);
+static bool ROMTestStl_SetupTestAll(ROM_TEST_CONTEXT * const context);
+
+/// Trägt die Flash-Bereiche der Instanz in die Subsets für die STL ein.
+/// \param context Instanz der ROM-Tests.
+static void ROMTestStl_SetupSubsets(ROM_TEST_CONTEXT * const context);
 
 /// Initialisiert und konfiguriert den ROM-Test anhand der übergebenen
 /// Einstellungen.
+/// \param context Instanz der ROM-Tests.
 /// \param romTest Handle des ROM-Tests mit den zu testenden Speicherbereichen.
 /// \return @c true bei Erfolg, sonst @c false.
-static bool ROMTestStl_SetupTest(ROM_TEST * const romTest);
+static bool ROMTestStl_SetupTest(ROM_TEST_CONTEXT * const context, ROM_TEST * const romTest);
 
 /// Intialisiert den ROM-Test
+/// \param context Instanz der ROM-Tests.
 /// \param romTest Handle des ROM-Tests.
 /// \return @c true bei Erfolg, sonst @c false.
-static bool ROMTestStl_Init(ROM_TEST * const romTest);
+static bool ROMTestStl_Init(ROM_TEST_CONTEXT * const context, ROM_TEST * const romTest);
 
 /// Setzt den ROM-Test zurück. Die Aktion ist erforderlich, wenn
 /// der ROM-Test einmal durchgelaufen ist und neu gestartet werden soll.
@@ -137,7 +108,8 @@ static bool ROMTestStl_Reset(ROM_TEST * const romTest);
 /// \return @c true bei Erfolg, sonst @c false.
 static bool ROMTestStl_CheckMemConfig(STL_MemConfig_t const * const config);
 
-/// Setzt die Zustände der ROM-Tests auf den Ausgangszustand @ref ROM_IDLE zurück.
+/// Setzt den Zustand des zuletzt in der STL konfigurierten ROM-Tests auf den
+/// Ausgangszustand @ref ROM_IDLE zurück.
 static void ROMTestStl_SetIdle(void);
 //------------------------------------------------------------------------------
 // Funktionsbereich externe Funktionen -----------------------------------------
@@ -145,6 +117,64 @@ static void ROMTestStl_SetIdle(void);
 
 /// @author k.ehlen @date 08.01.2023
 EN61508_TestResult ROMTestStl_RunAll(void)
+    {
+    return ROMTestStl_ContextRunAll(ROMTestStl_GetDefaultContext());
+    }
+//------------------------------------------------------------------------------
+
+bool ROMTestStl_ContextInit(ROM_TEST_CONTEXT * const context,
+                            EN61508_MEM_REGION const * const regions, U8 const numRegions)
+    {
+    EN61508_MEM_REGION const * testRegions;
+    U32 numTestRegions;
+
+    if(context == NULL)
+        {
+        return false;
+        }
+
+    // Die Konfiguration der STL gehört danach zu keinem Test dieser Instanz
+    if((romTestConfigured == &context->romTestAll) || (romTestConfigured == &context->romTestCyclic))
+        {
+        romTestConfigured = NULL;
+        }
+
+    memset(context, 0, sizeof(*context));
+    context->romTestAll.tmStatus = STL_ERROR;
+    context->romTestCyclic.tmStatus = STL_ERROR;
+    context->firstTestStart = true;
+
+    testRegions = regions;
+    numTestRegions = numRegions;
+    if(testRegions == NULL)
+        {
+        testRegions = flashRegions;
+        numTestRegions = NUM_FLASH_REGIONS;
+        }
+
+    if((numTestRegions == 0) || (numTestRegions > ROMTEST_REGIONS_MAX))
+        {
+        return false;
+        }
+
+    context->flashRegions = testRegions;
+    context->numFlashRegions = (U8) numTestRegions;
+    return true;
+    }
+//------------------------------------------------------------------------------
+
+ROM_TEST_CONTEXT * ROMTestStl_GetDefaultContext(void)
+    {
+    if(romTestDefault.flashRegions == NULL)
+        {
+        (void) ROMTestStl_ContextInit(&romTestDefault, NULL, 0);
+        }
+
+    return &romTestDefault;
+    }
+//------------------------------------------------------------------------------
+
+EN61508_TestResult ROMTestStl_ContextRunAll(ROM_TEST_CONTEXT * const context)
     {
     EN61508_TestResult testResult;
     STL_Status_t stlError;
@@ -152,90 +182,94 @@ EN61508_TestResult ROMTestStl_RunAll(void)
     stlError = STL_KO;
     testResult = EN61508_TestFail;
 
-    if(ROMTestStl_SetupTestAll())
+    if(ROMTestStl_SetupTestAll(context))
         {
 
-#if FEATURE_SAFETYCHECK_ARTIFICIAL_TEST_ROM_STL
-#if ROMTEST_ARTI_FAILING_RUN_ALL
-        ROMTEST_ARTI_FAILING_START
-#endif
-#endif
-        stlError = STL_SCH_RunFlashTM(&romTestAll.tmStatus);
+        FAULTINJECTIONSTL_START(FAULTINJECTIONSTL_ROM_RUN_ALL);
+        SAFETY_TRACE_BEGIN(eSAFETY_TRACE_TRACK_TASK, "STL ROM");
+        stlError = STL_SCH_RunFlashTM(&context->romTestAll.tmStatus);
+        SAFETY_TRACE_END(eSAFETY_TRACE_TRACK_TASK, "STL ROM");
 
-#if FEATURE_SAFETYCHECK_ARTIFICIAL_TEST_ROM_STL
-#if ROMTEST_ARTI_FAILING_RUN_ALL
-        ROMTEST_ARTI_FAILING_STOP
-#endif
-#endif
+        FAULTINJECTIONSTL_STOP();
 #if FEAT_DEBUG
         // Increase test execution counter
-        romTestAll.testRoundCounter++;
+        context->romTestAll.testRoundCounter++;
 #endif
         }
 
-    if((stlError == STL_OK) && (romTestAll.tmStatus == STL_PASSED))
+    if((stlError == STL_OK) && (context->romTestAll.tmStatus == STL_PASSED))
         {
         testResult = EN61508_TestPass;
         }
 
+    // Der komplette Test belegt das ROM-Testmodul der STL nur während des Durchlaufs
+    if(romTestConfigured == &context->romTestAll)
+        {
+        ROMTestStl_SetIdle();
+        }
+
     return testResult;
     }
 //------------------------------------------------------------------------------
 
 /// @author k.ehlen @date 08.01.2023
 EN61508_TestResult ROMTestStl_RunCyclic(U32 const currentTicks)
+    {
+    return ROMTestStl_ContextRunCyclic(ROMTestStl_GetDefaultContext(), currentTicks);
+    }
+//------------------------------------------------------------------------------
+
+EN61508_TestResult ROMTestStl_ContextRunCyclic(ROM_TEST_CONTEXT * const context, U32 const currentTicks)
     {
     EN61508_TestResult testResult;
     STL_Status_t stlError;
     bool processSafetyTimeFailure;
-    static bool firstTestStart = true;
+
+    if(context == NULL)
+        {
+        return EN61508_TestFail;
+        }
 
     stlError = STL_KO;
     testResult = EN61508_TestFail;
     processSafetyTimeFailure = false;
 
     // Set time reference after bootup
-    if(firstTestStart)
+    if(context->firstTestStart)
         {
-        firstTestStart = false;
-        lastTestpassTicks = currentTicks;
+        context->firstTestStart = false;
+        context->lastTestpassTicks = currentTicks;
         }
 
     // Testausführung
-    if(romTestCyclic.romTestState == ROM_CONFIGURED)
+    if(context->romTestCyclic.romTestState == ROM_CONFIGURED)
         {
-#if FEATURE_SAFETYCHECK_ARTIFICIAL_TEST_ROM_STL
-#if ROMTEST_ARTI_FAILING_RUN_CYCLIC
-        ROMTEST_ARTI_FAILING_START
-#endif
-#endif
-        stlError = STL_SCH_RunFlashTM(&romTestCyclic.tmStatus);
+        FAULTINJECTIONSTL_START(FAULTINJECTIONSTL_ROM_RUN_CYCLIC);
+        SAFETY_TRACE_BEGIN(eSAFETY_TRACE_TRACK_TASK, "STL ROM cyclic");
+        stlError = STL_SCH_RunFlashTM(&context->romTestCyclic.tmStatus);
+        SAFETY_TRACE_END(eSAFETY_TRACE_TRACK_TASK, "STL ROM cyclic");
 
-#if FEATURE_SAFETYCHECK_ARTIFICIAL_TEST_ROM_STL
-#if ROMTEST_ARTI_FAILING_RUN_CYCLIC
-        ROMTEST_ARTI_FAILING_STOP
-#endif
-#endif
+        FAULTINJECTIONSTL_STOP();
 #if FEAT_DEBUG
         // Increase test execution counter
-        romTestCyclic.testRoundCounter++;
+        context->romTestCyclic.testRoundCounter++;
 #endif
         }
 
     if(stlError == STL_OK)
         {
         // Statusüberprüfung
-        switch(romTestCyclic.tmStatus)
+        switch(context->romTestCyclic.tmStatus)
             {
             case STL_PARTIAL_PASSED:
                 // Teilstück bestanden
                 testResult = EN61508_TestPass;
                 break;
             case STL_PASSED:
-                lastTestpassTicks = currentTicks;
+                context->lastTestpassTicks = currentTicks;
 
                 // Test completed successfully, reset test
-                if(ROMTestStl_Reset(&romTestCyclic))
+                if(ROMTestStl_Reset(&context->romTestCyclic))
                     {
                     testResult = EN61508_TestPass;
                     }
@@ -248,13 +282,14 @@ EN61508_TestResult ROMTestStl_RunCyclic(U32 const currentTicks)
 
     // Check process safety timeout
     // The Runtime ROM has to be completed at least once per Process Safety Time (SOFTQM-527)
-    if(currentTicks >= lastTestpassTicks)
+    if(currentTicks >= context->lastTestpassTicks)
         {
-        processSafetyTimeFailure = ((currentTicks - lastTestpassTicks) > processSafetyTimeTicksInt);
+        processSafetyTimeFailure = ((currentTicks - context->lastTestpassTicks) > context->processSafetyTimeTicksInt);
         }
     else
         {
-        processSafetyTimeFailure = ((TICKS_MAX_VALUE - lastTestpassTicks + currentTicks) > processSafetyTimeTicksInt);
+        processSafetyTimeFailure = ((TICKS_MAX_VALUE - context->lastTestpassTicks + currentTicks)
+                                    > context->processSafetyTimeTicksInt);
         }
 
     if(processSafetyTimeFailure)
@@ -269,78 +304,126 @@ EN61508_TestResult ROMTestStl_RunCyclic(U32 const currentTicks)
 /// @author k.ehlen @date 08.01.2023
 bool ROMTestStl_SetupTestCyclic(U32 const processSafetyTimeTicks)
     {
-    U8 i;
-
-    processSafetyTimeTicksInt = processSafetyTimeTicks;
+    // Number of tested ROM sections per test execution (SOFTQM-526)
+    return ROMTestStl_ContextSetupTestCyclic(ROMTestStl_GetDefaultContext(), processSafetyTimeTicks,
+                                             ROMTEST_CYCLIC_NUM_SECTIONS);
+    }
+//------------------------------------------------------------------------------
 
-    for(i = 0; i < NUM_FLASH_REGIONS; i++)
+bool ROMTestStl_ContextSetupTestCyclic(ROM_TEST_CONTEXT * const context,
+                                       U32 const processSafetyTimeTicks, U32 const numSectionsAtomic)
+    {
+    if((context == NULL) || (context->flashRegions == NULL) || (numSectionsAtomic < ROMTEST_NUM_SECTIONS_ATOMIC_MIN))
         {
-        flashSubsets[i].StartAddr = (U32) flashRegions[i].start;
-        flashSubsets[i].EndAddr = (U32) flashRegions[i].start + flashRegions[i].length - 1;
-
-        if(i == (NUM_FLASH_REGIONS -1))
-            {
-            flashSubsets[i].pNext = NULL;
-            }
-        else
-            {
-            flashSubsets[i].pNext = &flashSubsets[i + 1];
-            }
+        return false;
         }
 
-    romTestCyclic.memoryConfig.pSubset = flashSubsets;
+    context->processSafetyTimeTicksInt = processSafetyTimeTicks;
 
-    // Number of tested ROM sections per test execution (SOFTQM-526)
-    romTestCyclic.memoryConfig.NumSectionsAtomic = ROMTEST_CYCLIC_NUM_SECTIONS;
+    ROMTestStl_SetupSubsets(context);
+    context->romTestCyclic.memoryConfig.pSubset = context->flashSubsets;
+    context->romTestCyclic.memoryConfig.NumSectionsAtomic = numSectionsAtomic;
 
 #if FEAT_DEBUG
     // Set test round counter to zero
-    romTestCyclic.testRoundCounter = 0;
+    context->romTestCyclic.testRoundCounter = 0;
 #endif
 
-    return ROMTestStl_SetupTest(&romTestCyclic);
+    return ROMTestStl_SetupTest(context, &context->romTestCyclic);
     }
 //------------------------------------------------------------------------------
 
+U32 ROMTestStl_GetMaxCallIntervalTicks(void)
+    {
+    return ROMTestStl_ContextGetMaxCallIntervalTicks(ROMTestStl_GetDefaultContext());
+    }
 //------------------------------------------------------------------------------
-// Funktionsbereich interne Funktionen -----------------------------------------
 
-/// @author k.ehlen @date 08.01.2023
-static bool ROMTestStl_SetupTestAll(void)
+U32 ROMTestStl_ContextGetMaxCallIntervalTicks(ROM_TEST_CONTEXT const * const context)
     {
+    U32 numSections;
+    U32 numCalls;
+    U32 numSectionsAtomic;
     U8 i;
 
-    for(i = 0; i < NUM_FLASH_REGIONS; i++)
+    if(context == NULL)
         {
-        flashSubsets[i].StartAddr = (U32) flashRegions[i].start;
-        flashSubsets[i].EndAddr = (U32) flashRegions[i].start + flashRegions[i].length - 1;
+        return 0;
+        }
 
-        if(i == (NUM_FLASH_REGIONS -1))
-            {
-            flashSubsets[i].pNext = NULL;
-            }
-        else
-            {
-            flashSubsets[i].pNext = &flashSubsets[i + 1];
-            }
+    numSectionsAtomic = context->romTestCyclic.memoryConfig.NumSectionsAtomic;
+    if((context->romTestCyclic.romTestState != ROM_CONFIGURED) || (numSectionsAtomic == 0))
+        {
+        return 0;
+        }
+
+    numSections = 0;
+    for(i = 0; i < context->numFlashRegions; i++)
+        {
+        numSections += (context->flashRegions[i].length + STL_FLASH_SECTION_SIZE - 1) / STL_FLASH_SECTION_SIZE;
+        }
+
+    // Anzahl Aufrufe für einen kompletten Durchlauf, aufgerundet
+    numCalls = numSections / numSectionsAtomic;
+    if((numSections % numSectionsAtomic) != 0)
+        {
+        numCalls++;
+        }
+
+    // Ein zusätzlicher Aufruf als Reserve für den Neustart des Tests
+    return context->processSafetyTimeTicksInt / (numCalls + 1);
+    }
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Funktionsbereich interne Funktionen -----------------------------------------
+
+/// @author k.ehlen @date 08.01.2023
+static bool ROMTestStl_SetupTestAll(ROM_TEST_CONTEXT * const context)
+    {
+    if((context == NULL) || (context->flashRegions == NULL))
+        {
+        return false;
         }
 
-    romTestAll.memoryConfig.pSubset = flashSubsets;
+    ROMTestStl_SetupSubsets(context);
+    context->romTestAll.memoryConfig.pSubset = context->flashSubsets;
 
     // Number of tested ROM sections per test execution
-    romTestAll.memoryConfig.NumSectionsAtomic = ROMTEST_NUM_SECTIONS_ATOMIC_MAX;
+    context->romTestAll.memoryConfig.NumSectionsAtomic = ROMTEST_NUM_SECTIONS_ATOMIC_MAX;
 
 #if FEAT_DEBUG
     // Set test round counter to zero
-    romTestAll.testRoundCounter = 0;
+    context->romTestAll.testRoundCounter = 0;
 #endif
 
-    return ROMTestStl_SetupTest(&romTestAll);
+    return ROMTestStl_SetupTest(context, &context->romTestAll);
+    }
+//------------------------------------------------------------------------------
+
+static void ROMTestStl_SetupSubsets(ROM_TEST_CONTEXT * const context)
+    {
+    U8 i;
+
+    for(i = 0; i < context->numFlashRegions; i++)
+        {
+        context->flashSubsets[i].StartAddr = (U32) context->flashRegions[i].start;
+        context->flashSubsets[i].EndAddr = (U32) context->flashRegions[i].start + context->flashRegions[i].length - 1;
+
+        if(i == (context->numFlashRegions - 1))
+            {
+            context->flashSubsets[i].pNext = NULL;
+            }
+        else
+            {
+            context->flashSubsets[i].pNext = &context->flashSubsets[i + 1];
+            }
+        }
     }
 //------------------------------------------------------------------------------
 
 /// @author k.ehlen @date 08.01.2023
-static bool ROMTestStl_SetupTest(ROM_TEST * const romTest)
+static bool ROMTestStl_SetupTest(ROM_TEST_CONTEXT * const context, ROM_TEST * const romTest)
     {
     bool result;
     bool isInitialized;
@@ -351,6 +434,14 @@ static bool ROMTestStl_SetupTest(ROM_TEST * const romTest)
         return false;
         }
 
+    // Das ROM-Testmodul der STL gehört dem zyklischen Test einer anderen
+    // Instanz, bis diese mit ROMTestStl_ContextInit() freigegeben wird
+    if((romTestConfigured != NULL) && (romTestConfigured != &context->romTestAll)
+            && (romTestConfigured != &context->romTestCyclic))
+        {
+        return false;
+        }
+
     if(!ROMTestStl_CheckMemConfig(&romTest->memoryConfig))
         {
         return false;
@@ -360,33 +451,23 @@ static bool ROMTestStl_SetupTest(ROM_TEST * const romTest)
     result = false;
     stlError = STL_KO;
 
-    if(ROMTestStl_Init(romTest) == true)
+    if(ROMTestStl_Init(context, romTest) == true)
         {
         isInitialized = true;
         }
 
     if(isInitialized)
         {
-#if FEATURE_SAFETYCHECK_ARTIFICIAL_TEST_ROM_STL
-    #if ROMTEST_ARTI_FAILING_CONFIGURE_ALL
-            ROMTEST_ARTI_FAILING_START_ALL
-    #elif ROMTEST_ARTI_FAILING_CONFIGURE_CYCLIC
-            ROMTEST_ARTI_FAILING_START_CYCLIC
-    #endif
-#endif
+        FAULTINJECTIONSTL_START((romTest == &context->romTestAll) ? FAULTINJECTIONSTL_ROM_CONFIGURE_ALL
+                                : FAULTINJECTIONSTL_ROM_CONFIGURE_CYCLIC);
         stlError = STL_SCH_ConfigureFlash(&romTest->tmStatus, &romTest->memoryConfig);
 
-#if FEATURE_SAFETYCHECK_ARTIFICIAL_TEST_ROM_STL
-    #if ROMTEST_ARTI_FAILING_CONFIGURE_ALL
-            ROMTEST_ARTI_FAILING_STOP_ALL
-    #elif ROMTEST_ARTI_FAILING_CONFIGURE_CYCLIC
-            ROMTEST_ARTI_FAILING_STOP_CYCLIC
-    #endif
-#endif
+        FAULTINJECTIONSTL_STOP();
 
         if((stlError == STL_OK) && (romTest->tmStatus == STL_NOT_TESTED))
             {
             romTest->romTestState = ROM_CONFIGURED;
+            romTestConfigured = romTest;
             result = true;
             }
         }
@@ -395,7 +476,7 @@ static bool ROMTestStl_SetupTest(ROM_TEST * const romTest)
 //------------------------------------------------------------------------------
 
 /// @author k.ehlen @date 08.01.2023
-static bool ROMTestStl_Init(ROM_TEST * const romTest)
+static bool ROMTestStl_Init(ROM_TEST_CONTEXT * const context, ROM_TEST * const romTest)
     {
     bool result;
     STL_Status_t stlError;
@@ -414,22 +495,11 @@ static bool ROMTestStl_Init(ROM_TEST * const romTest)
 
     if(Stl_SchedulerIsStarted())
         {
-#if FEATURE_SAFETYCHECK_ARTIFICIAL_TEST_ROM_STL
-    #if ROMTEST_ARTI_FAILING_INIT_ALL
-            ROMTEST_ARTI_FAILING_START_ALL
-    #elif ROMTEST_ARTI_FAILING_INIT_CYCLIC
-            ROMTEST_ARTI_FAILING_START_CYCLIC
-    #endif
-#endif
+        FAULTINJECTIONSTL_START((romTest == &context->romTestAll) ? FAULTINJECTIONSTL_ROM_INIT_ALL
+                                : FAULTINJECTIONSTL_ROM_INIT_CYCLIC);
         stlError = STL_SCH_InitFlash(&romTest->tmStatus);
 
-#if FEATURE_SAFETYCHECK_ARTIFICIAL_TEST_ROM_STL
-    #if ROMTEST_ARTI_FAILING_INIT_ALL
-            ROMTEST_ARTI_FAILING_STOP_ALL
-    #elif ROMTEST_ARTI_FAILING_INIT_CYCLIC
-            ROMTEST_ARTI_FAILING_STOP_CYCLIC
-    #endif
-#endif
+        FAULTINJECTIONSTL_STOP();
         }
 
     if((stlError == STL_OK) && (romTest->tmStatus == STL_NOT_TESTED))
@@ -463,18 +533,12 @@ static bool ROMTestStl_Reset(ROM_TEST * const romTest)
         romTest->testRoundCounter = 0;
 #endif
 
-#if FEATURE_SAFETYCHECK_ARTIFICIAL_TEST_ROM_STL
-#if ROMTEST_ARTI_FAILING_RESET_CYCLIC
-        ROMTEST_ARTI_FAILING_START
-#endif
-#endif
+        FAULTINJECTIONSTL_START(FAULTINJECTIONSTL_ROM_RESET_CYCLIC);
+        SAFETY_TRACE_BEGIN(eSAFETY_TRACE_TRACK_TASK, "STL ROM reset");
         stlError = STL_SCH_ResetFlash(&romTest->tmStatus);
+        SAFETY_TRACE_END(eSAFETY_TRACE_TRACK_TASK, "STL ROM reset");
 
-#if FEATURE_SAFETYCHECK_ARTIFICIAL_TEST_ROM_STL
-#if ROMTEST_ARTI_FAILING_RESET_CYCLIC
-        ROMTEST_ARTI_FAILING_STOP
-#endif
-#endif
+        FAULTINJECTIONSTL_STOP();
         }
 
     if((stlError == STL_OK) && (romTest->tmStatus == STL_NOT_TESTED))
@@ -503,12 +567,12 @@ static bool ROMTestStl_CheckMemConfig(STL_MemConfig_t const * const config)
     while(subset != NULL)
         {
         // Testbereich Start- und Endadresse dürfen nicht im CRC-Bereich liegen
-        if((subset->StartAddr < FLASH_BASE) || (subset->StartAddr >= (U32) &__FLASH_TEST_STL_CRC_START))
+        if((subset->StartAddr < FLASH_BASE) || (subset->StartAddr >= ROMTEST_CRC_START))
             {
             result = false;
             }
 
-        if((subset->EndAddr < FLASH_BASE) || (subset->EndAddr >= (U32) &__FLASH_TEST_STL_CRC_START))
+        if((subset->EndAddr < FLASH_BASE) || (subset->EndAddr >= ROMTEST_CRC_START))
             {
             result = false;
             }
@@ -541,7 +605,10 @@ static bool ROMTestStl_CheckMemConfig(STL_MemConfig_t const * const config)
 /// @author k.ehlen @date 24.01.2023
 static void ROMTestStl_SetIdle(void)
     {
-    romTestAll.romTestState = ROM_IDLE;
-    romTestCyclic.romTestState = ROM_IDLE;
+    if(romTestConfigured != NULL)
+        {
+        romTestConfigured->romTestState = ROM_IDLE;
+        romTestConfigured = NULL;
+        }
     }
 //------------------------------------------------------------------------------
@@ -38,6 +38,21 @@
 
  * (#) Die CRCs müssen als Post-Build-Kommando vom STM32CubeProgrammer eingefügt werden (Handbuch UM2237).
  *
+ * Der Zustand der Tests liegt in einer Instanz @ref ROM_TEST_CONTEXT. Die
+ * Funktionen ohne Instanz arbeiten auf einer Standardinstanz über den im Linker
+ * definierten Testbereich. Die Funktionen ROMTestStl_Context...() arbeiten auf
+ * einer eigenen Instanz mit eigenen Speicherbereichen und eigener Anzahl
+ * Sektoren pro Aufruf.
+ *
+ * Die STL hat nur ein Flash-Testmodul. Der zyklische Test einer Instanz belegt
+ * es ab ROMTestStl_ContextSetupTestCyclic() bis zum nächsten
+ * ROMTestStl_ContextInit() dieser Instanz. Solange lehnen
+ * ROMTestStl_ContextSetupTestCyclic() und ROMTestStl_ContextRunAll() anderer
+ * Instanzen mit einem Fehler ab. Der komplette Test belegt das Testmodul nur
+ * während des Durchlaufs. Innerhalb einer Instanz setzt der komplette Test den
+ * zyklischen Test auf nicht konfiguriert zurück, danach ist erneut
+ * ROMTestStl_ContextSetupTestCyclic() notwendig.
+ *
  * @{
  */
 #ifndef STM32_SAFETY_STL_ROMTEST_ROM_TEST_STL_H
@@ -49,6 +64,8 @@
 extern "C" {
 #endif
 
+#include "SafetyStl.h"
+
 // Allgemeine Definitionen -----------------------------------------------------
 
 // Makros ----------------------------------------------------------------------
@@ -65,8 +82,45 @@ extern "C" {
 /// test execution.
 #define ROMTEST_NUM_SECTIONS_ATOMIC_MIN  (0x1)
 
+#ifndef ROMTEST_REGIONS_MAX
+/// Maximale Anzahl Speicherbereiche einer Instanz.
+#define ROMTEST_REGIONS_MAX              (1u)
+#endif
+
 // Typdefinitionen--------------------------------------------------------------
 
+/// Enumeration für den Zustand des ROM-Tests
+/// Zeigt an, ob der Test konfiguriert ist.
+typedef enum
+{
+    ROM_IDLE = 0,         ///< ROM_IDLE Ausgangszustand
+    ROM_CONFIGURED = 1,   ///< ROM_CONFIGURED konfiguriert, bereit zum Starten
+} ROM_TEST_STATE;
+
+/// Struktur für den Teststatus zur Laufzeit
+typedef struct
+{
+    STL_TmStatus_t tmStatus;          ///< Testmodul-Status von STL
+    ROM_TEST_STATE romTestState;      ///< Status des ROM-Tests
+    STL_MemConfig_t memoryConfig;     ///< Eingestellte Testkonfiguration
+#if FEAT_DEBUG
+    U32 testRoundCounter;             ///< Counts number of test executions
+#endif
+} ROM_TEST;
+
+/// Instanz der ROM-Tests
+typedef struct
+{
+    EN61508_MEM_REGION const * flashRegions;            ///< Zu testende Flash-Bereiche
+    U8 numFlashRegions;                                 ///< Anzahl der Flash-Bereiche
+    STL_MemSubset_t flashSubsets[ROMTEST_REGIONS_MAX];  ///< Subset-Einstellung für STL
+    ROM_TEST romTestAll;                                ///< Laufzeitwerte für kompletten ROM-Testdurchlauf
+    ROM_TEST romTestCyclic;                             ///< Laufzeitwerte für zyklischen ROM-Testdurchlauf
+    U32 lastTestpassTicks;                              ///< Last time in ticks at which the cyclic test passed
+    U32 processSafetyTimeTicksInt;                      ///< Process safety time in ticks set by the user
+    bool firstTestStart;                                ///< Set until the time reference after bootup is taken
+} ROM_TEST_CONTEXT;
+
 // externe Variablen -----------------------------------------------------------
 
 // Prototypen ------------------------------------------------------------------
@@ -76,12 +130,41 @@ extern "C" {
 /// \return @c EN61508_TestPass bei Erfolg, sonst @c EN61508_TestFail.
 extern EN61508_TestResult ROMTestStl_RunAll(void);
 
+/// Initialisierung einer Instanz der ROM-Tests. Setzt den gesamten Zustand der
+/// Instanz zurück, z.B. zwischen zwei Tests in der Simulation.
+/// \param context Instanz der ROM-Tests.
+/// \param regions Flash-Bereiche, müssen gültig bleiben. NULL für den im Linker
+/// definierten Testbereich.
+/// \param numRegions Anzahl der Flash-Bereiche, höchstens @ref ROMTEST_REGIONS_MAX.
+/// \return @c true bei Erfolg, sonst @c false.
+extern bool ROMTestStl_ContextInit(ROM_TEST_CONTEXT * const context,
+                                   EN61508_MEM_REGION const * const regions, U8 const numRegions);
+
+/// Liefert die Standardinstanz, auf der die Funktionen ohne Instanz arbeiten.
+/// \return Standardinstanz der ROM-Tests.
+extern ROM_TEST_CONTEXT * ROMTestStl_GetDefaultContext(void);
+
+/// Kompletter ROM-Test-Durchlauf über die Flash-Bereiche einer Instanz, siehe ROMTestStl_RunAll().
+/// \param context Instanz der ROM-Tests.
+/// \return @c EN61508_TestPass bei Erfolg, sonst @c EN61508_TestFail.
+extern EN61508_TestResult ROMTestStl_ContextRunAll(ROM_TEST_CONTEXT * const context);
+
 /// Initialisierung des zyklischen ROM-Tests, einmalig vor dem Test notwendig.
 /// Es wird geprüft, ob der Test mindestens einmal innerhalb der Process Safety Time durchläuft.
 /// \param processSafetyTimeTicks Process Safety Time (PST) in Ticks.
 /// \return @c true bei Erfolg, sonst @c false.
 extern bool ROMTestStl_SetupTestCyclic(U32 const processSafetyTimeTicks);
 
+/// Initialisierung des zyklischen ROM-Tests einer Instanz, siehe ROMTestStl_SetupTestCyclic().
+/// \param context Instanz der ROM-Tests.
+/// \param processSafetyTimeTicks Process Safety Time (PST) in Ticks.
+/// \param numSectionsAtomic Anzahl getesteter Sektoren pro Aufruf, zwischen
+/// @ref ROMTEST_NUM_SECTIONS_ATOMIC_MIN und @ref ROMTEST_NUM_SECTIONS_ATOMIC_MAX.
+/// \return @c true bei Erfolg, sonst @c false, auch wenn der zyklische Test
+/// einer anderen Instanz das Testmodul der STL belegt.
+extern bool ROMTestStl_ContextSetupTestCyclic(ROM_TEST_CONTEXT * const context,
+                                              U32 const processSafetyTimeTicks, U32 const numSectionsAtomic);
+
 /// Zyklischer ROM-Test über die in @c flashRegions angegebenen Bereiche.
 /// Mit einem Aufruf wird ein Sektor von 1024 Bytes getestet. Beim nächsten Aufruf
 /// wird der nächste Sektor überprüft.
@@ -90,6 +173,26 @@ extern bool ROMTestStl_SetupTestCyclic(U32 const processSafetyTimeTicks);
 /// \return @c EN61508_TestPass bei Erfolg, sonst @c EN61508_TestFail.
 extern EN61508_TestResult ROMTestStl_RunCyclic(U32 const currentTicks);
 
+/// Zyklischer ROM-Test einer Instanz, siehe ROMTestStl_RunCyclic().
+/// \param context Instanz der ROM-Tests.
+/// \param currentTicks Aktuelle Zeit in Ticks.
+/// \return @c EN61508_TestPass bei Erfolg, sonst @c EN61508_TestFail.
+extern EN61508_TestResult ROMTestStl_ContextRunCyclic(ROM_TEST_CONTEXT * const context, U32 const currentTicks);
+
+/// Maximaler Abstand zwischen zwei Aufrufen von ROMTestStl_RunCyclic(), damit
+/// der zyklische ROM-Test innerhalb der Process Safety Time vollständig durchläuft.
+/// Wird für den ereignisgesteuerten Aufruf der Safety-Task benötigt.
+/// \return Maximaler Aufrufabstand in Ticks, 0 wenn der Test nicht konfiguriert
+/// ist oder die Process Safety Time nicht eingehalten werden kann.
+extern U32 ROMTestStl_GetMaxCallIntervalTicks(void);
+
+/// Maximaler Aufrufabstand des zyklischen ROM-Tests einer Instanz, siehe
+/// ROMTestStl_GetMaxCallIntervalTicks().
+/// \param context Instanz der ROM-Tests.
+/// \return Maximaler Aufrufabstand in Ticks, 0 wenn der Test nicht konfiguriert
+/// ist oder die Process Safety Time nicht eingehalten werden kann.
+extern U32 ROMTestStl_ContextGetMaxCallIntervalTicks(ROM_TEST_CONTEXT const * const context);
+
 
 #ifdef __cplusplus
 }
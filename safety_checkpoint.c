@@ -0,0 +1,140 @@
+/*******************************************************************************
+ * Copyright (c) 2026 TWK-ELEKTRONIK GmbH. All rights reserved.
+ ******************************************************************************/
+
+// Gemeinsame Headerdateien einbinden --------------------------------------
+#include "config/version.h"
+
+#include "RTOS_AL/RTOS_AL.h"
+
+#include "error_def.h"
+
+#include "safety_runtime.h"
+#include "safety_startup.h"
+#include "safety_checkpoint.h"
+
+#if FEATURE_SAFETYCHECK_RUNTIME && FEATURE_SAFETYCHECK_RUNTIME_CHECKPOINT
+// Compiler Direktiven -----------------------------------------------------
+
+// Makros ------------------------------------------------------------------
+
+/// Largest deadline in ticks, so that the unsigned tick difference stays unique.
+#define CHECKPOINT_DEADLINE_MAX_TICKS   (RTOS_MAX_TIMEOUT / 2u)
+
+// Allgemeine Definitionen -------------------------------------------------
+
+// externe Variablen -------------------------------------------------------
+
+/// Check-in bits set by the application tasks, collected by the safety task.
+static volatile U32 checkinMask = 0;
+
+/// Mask of completely registered checkpoints.
+static volatile U32 activeMask = 0;
+
+/// Number of allocated checkpoint slots.
+static volatile U32 allocatedCount = 0;
+
+/// Deadline of each checkpoint in ticks.
+static U32 deadlineTicks[SAFETY_CHECKPOINT_MAX];
+
+/// Time of the last check-in of each checkpoint in ticks.
+static U32 lastCheckinTicks[SAFETY_CHECKPOINT_MAX];
+
+/// Latched mask of checkpoints which missed their deadline.
+static U32 missedMask = 0;
+
+// Funktionsbereich --------------------------------------------------------
+
+bool Safety_Checkpoint_Register(U32 const deadlineMs, SAFETY_CHECKPOINT_ID * const id)
+    {
+    U32 slot;
+    U32 const ticks = deadlineMs * configTICK_RATE_HZ_MS;
+
+    if((id == NULL) || (ticks == 0u) || (ticks > CHECKPOINT_DEADLINE_MAX_TICKS))
+        {
+        return false;
+        }
+
+    // Slot lock-free reservieren, Registrierung kann aus mehreren Tasks erfolgen
+    slot = __atomic_fetch_add(&allocatedCount, 1u, __ATOMIC_RELAXED);
+    if(slot >= SAFETY_CHECKPOINT_MAX)
+        {
+        return false;
+        }
+
+    deadlineTicks[slot] = ticks;
+    lastCheckinTicks[slot] = RTOS_GetTime();
+
+    // Checkpoint erst nach vollständiger Initialisierung für die Auswertung freigeben
+    __atomic_fetch_or(&activeMask, (U32) 1u << slot, __ATOMIC_RELEASE);
+
+    *id = (SAFETY_CHECKPOINT_ID) slot;
+    return true;
+    }
+//------------------------------------------------------------------------------
+
+void Safety_Checkpoint_Reached(SAFETY_CHECKPOINT_ID const id)
+    {
+    if(id < SAFETY_CHECKPOINT_MAX)
+        {
+        __atomic_fetch_or(&checkinMask, (U32) 1u << id, __ATOMIC_RELAXED);
+        }
+    }
+//------------------------------------------------------------------------------
+
+bool Safety_Checkpoint_Evaluate(U32 const currentTicks)
+    {
+    U32 const active = __atomic_load_n(&activeMask, __ATOMIC_ACQUIRE);
+    U32 const reached = __atomic_exchange_n(&checkinMask, 0u, __ATOMIC_RELAXED);
+    U32 missed = 0u;
+    U32 i;
+
+    for(i = 0u; i < SAFETY_CHECKPOINT_MAX; i++)
+        {
+        U32 const bit = (U32) 1u << i;
+
+        if((active & bit) == 0u)
+            {
+            continue;
+            }
+
+        if((reached & bit) != 0u)
+            {
+            lastCheckinTicks[i] = currentTicks;
+            }
+        // Vorzeichenlose Differenz ist auch bei Überlauf des Tickzählers korrekt
+        else if((U32) (currentTicks - lastCheckinTicks[i]) > deadlineTicks[i])
+            {
+            missed |= bit;
+            }
+        }
+
+    if((missed != 0u) && (missedMask == 0u))
+        {
+        // Fehlerursache für die Auswertung nach dem Watchdog-Reset sichern
+        missedMask = missed;
+        Safety_SetNonvolatileError(HARD_ERR_INTERN_CHECKPOINT_MISSED);
+        Safety_Checkpoint_MissedHook(missedMask);
+        }
+    else
+        {
+        missedMask |= missed;
+        }
+
+    return missedMask == 0u;
+    }
+//------------------------------------------------------------------------------
+
+U32 Safety_Checkpoint_GetMissedMask(void)
+    {
+    return missedMask;
+    }
+//------------------------------------------------------------------------------
+
+/// \note Default Implementierung per Weak Linkage.
+__attribute__((weak)) void Safety_Checkpoint_MissedHook(U32 const mask)
+    {
+    }
+//------------------------------------------------------------------------------
+
+#endif // FEATURE_SAFETYCHECK_RUNTIME && FEATURE_SAFETYCHECK_RUNTIME_CHECKPOINT
@@ -0,0 +1,115 @@
+/*******************************************************************************
+ * Copyright (c) 2026 TWK-ELEKTRONIK GmbH. All rights reserved.
+ ******************************************************************************/
+
+/**
+ * \defgroup safety_checkpoint Deadline-Checkpoints
+ * \ingroup safety_utils
+ * Überwachung der Lebendigkeit von Anwendungstasks mit Watchdog-Granularität.
+ *
+ * Jede zu überwachende Task meldet einmalig einen Checkpoint mit einer Deadline
+ * an und meldet sich anschließend zyklisch mit Safety_Checkpoint_Reached().
+ * Die Rückmeldung setzt lediglich ein Bit in einer lock-freien Bitmaske, es
+ * werden weder Mutexe noch zusätzliche Tasks benötigt.
+ *
+ * Die Sicherheitstask wertet die Bitmaske in jedem Zyklus aus. Der Watchdog wird
+ * nur noch getriggert, wenn alle angemeldeten Checkpoints ihre Deadline
+ * eingehalten haben. Bei einer Deadline-Überschreitung wird die Maske der
+ * betroffenen Checkpoints festgehalten, der Hard-Error-Code
+ * HARD_ERR_INTERN_CHECKPOINT_MISSED im Backup-Register abgelegt und der
+ * Watchdog nicht mehr getriggert. Nach dem Watchdog-Reset wird der Fehler von
+ * Safety_Startup_PowerOnSelfTests() als Hard-Error ausgewertet.
+ * @{
+ */
+#ifndef GLOBAL_SAFETY_SAFETY_CHECKPOINT_H_
+#define GLOBAL_SAFETY_SAFETY_CHECKPOINT_H_
+
+// Gemeinsame Headerdateien einbinden ---------------------------------------
+
+// Spezielle Headerdateien einbinden ----------------------------------------
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// Compiler Direktiven ------------------------------------------------------
+
+#ifndef FEATURE_SAFETYCHECK_RUNTIME_CHECKPOINT
+/// \ingroup feature_flags
+/// Feature flag activating the deadline checkpoint supervision of application tasks.
+/// This supervision is deactivated by default.
+#define FEATURE_SAFETYCHECK_RUNTIME_CHECKPOINT  (0)
+#endif
+
+#if FEATURE_SAFETYCHECK_RUNTIME_CHECKPOINT
+
+#if !FEATURE_SAFETYCHECK_WATCHDOG
+#error "Checkpoint supervision requires FEATURE_SAFETYCHECK_WATCHDOG"
+#endif
+
+#ifndef HARD_ERR_INTERN_CHECKPOINT_MISSED
+/// Hard error code stored in the RTC backup register if a checkpoint missed its deadline.
+#define HARD_ERR_INTERN_CHECKPOINT_MISSED       0x53
+#endif
+
+// Makros -------------------------------------------------------------------
+
+/// Maximum number of checkpoints. One bit of the check-in mask is used per checkpoint.
+#ifndef SAFETY_CHECKPOINT_MAX
+#define SAFETY_CHECKPOINT_MAX                   (32u)
+#endif
+
+#if (SAFETY_CHECKPOINT_MAX > 32u) || (SAFETY_CHECKPOINT_MAX == 0u)
+#error "SAFETY_CHECKPOINT_MAX must be in the range 1..32"
+#endif
+
+// externe Variablen --------------------------------------------------------
+
+// Allgemeine Definitionen --------------------------------------------------
+
+/// Handle of a registered checkpoint (bit position in the check-in mask).
+typedef U8 SAFETY_CHECKPOINT_ID;
+
+// Prototypen ---------------------------------------------------------------
+
+/// Registers a new checkpoint. The deadline starts with the registration.
+/// May be called from any task, e.g. at the start of the task function.
+/// \param deadlineMs Maximum time in ms between two check-ins. It has to be
+///                   larger than the cycle time of the safety task.
+/// \param id Returns the handle of the checkpoint.
+/// \return true on success, false if no checkpoint is left or the deadline is invalid.
+extern bool Safety_Checkpoint_Register(U32 const deadlineMs, SAFETY_CHECKPOINT_ID * const id);
+
+/// Check-in of a task. Lock-free, may be called from tasks and interrupts.
+/// \param id Handle of the checkpoint returned by Safety_Checkpoint_Register().
+extern void Safety_Checkpoint_Reached(SAFETY_CHECKPOINT_ID const id);
+
+/// Evaluates all registered checkpoints. Called by the safety task in every
+/// cycle before the watchdog is triggered.
+/// \param currentTicks Current time in system ticks.
+/// \return true if all checkpoints met their deadline and the watchdog may be
+///         triggered, false otherwise. Once a deadline is missed the result
+///         stays false until reset.
+extern bool Safety_Checkpoint_Evaluate(U32 const currentTicks);
+
+/// Returns the mask of checkpoints which missed their deadline.
+/// \return Bit n is set if the checkpoint with id n missed its deadline.
+extern U32 Safety_Checkpoint_GetMissedMask(void);
+
+/// Called once from the safety task when the first deadline miss is detected,
+/// before the watchdog runs out. The user may overwrite it with a custom
+/// definition, e.g. to log the missing task.
+/// \param mask Mask of checkpoints which missed their deadline.
+extern void Safety_Checkpoint_MissedHook(U32 const mask);
+
+#endif // FEATURE_SAFETYCHECK_RUNTIME_CHECKPOINT
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GLOBAL_SAFETY_SAFETY_CHECKPOINT_H_ */
+/**
+ * @}
+ */
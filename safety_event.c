@@ -0,0 +1,169 @@
+/*******************************************************************************
+ * Copyright (c) 2026 TWK-ELEKTRONIK GmbH. All rights reserved.
+ ******************************************************************************/
+
+// Gemeinsame Headerdateien einbinden --------------------------------------
+#include "config/version.h"
+
+#include "EventSystem/Event.h"
+
+#include "safety_event.h"
+
+#if FEATURE_SAFETY_EVENT_QUEUE
+// Compiler Direktiven -----------------------------------------------------
+
+// Makros ------------------------------------------------------------------
+
+/// Index mask of the ring buffer.
+#define EVENT_QUEUE_MASK    (SAFETY_EVENT_QUEUE_SIZE - 1u)
+
+// Allgemeine Definitionen -------------------------------------------------
+
+/// Kind of a stored event.
+typedef enum
+{
+    eSAFETY_EVENT_MSG = 0,      //!< Event for SendMsgEvent()
+    eSAFETY_EVENT_ERROR_MSG,    //!< Event for SendErrorMsgEvent()
+} SAFETY_EVENT_TYPE;
+
+/// Entry of the ring buffer.
+typedef struct
+{
+    U32 event;                  ///< Event number
+    U32 value;                  ///< Value or error code levels upper << 16 | intermediate << 8 | lower
+    SAFETY_EVENT_TYPE type;     ///< Kind of the event
+} SAFETY_EVENT_ENTRY;
+
+// externe Variablen -------------------------------------------------------
+
+/// Ring buffer of the events.
+static SAFETY_EVENT_ENTRY eventQueue[SAFETY_EVENT_QUEUE_SIZE];
+
+/// Number of stored events, written by the safety task only.
+static volatile U32 eventHead = 0;
+
+/// Number of forwarded events, written by the consumer only.
+static volatile U32 eventTail = 0;
+
+/// Statistics of the ring buffer, written by the safety task only.
+static SAFETY_EVENT_STATISTICS eventStatistics;
+
+// Funktionsbereich --------------------------------------------------------
+
+/// Stores an event in the ring buffer.
+/// \param type Kind of the event.
+/// \param event Event number.
+/// \param value Value of the event.
+/// \return true if the event is stored or combined, false if the ring buffer is full.
+static bool Safety_Event_Enqueue(SAFETY_EVENT_TYPE const type, U32 const event, U32 const value);
+
+bool Safety_Event_Send(U32 const event, U32 const value)
+    {
+    SAFETY_TRACE_INSTANT(eSAFETY_TRACE_TRACK_EVENT, "Event", event);
+    return Safety_Event_Enqueue(eSAFETY_EVENT_MSG, event, value);
+    }
+//------------------------------------------------------------------------------
+
+bool Safety_Event_SendError(U32 const event, U8 const upper, U8 const intermediate, U8 const lower)
+    {
+    SAFETY_TRACE_INSTANT(eSAFETY_TRACE_TRACK_EVENT, "Error event", event);
+    return Safety_Event_Enqueue(eSAFETY_EVENT_ERROR_MSG, event,
+                                ((U32) upper << 16) | ((U32) intermediate << 8) | (U32) lower);
+    }
+//------------------------------------------------------------------------------
+
+U32 Safety_Event_Process(U32 const maxEvents)
+    {
+    U32 const head = __atomic_load_n(&eventHead, __ATOMIC_ACQUIRE);
+    U32 tail = eventTail;
+    U32 forwarded = 0;
+    SAFETY_EVENT_ENTRY const * entry;
+    bool sent;
+
+    while((tail != head) && (forwarded < maxEvents))
+        {
+        entry = &eventQueue[tail & EVENT_QUEUE_MASK];
+
+        if(entry->type == eSAFETY_EVENT_ERROR_MSG)
+            {
+            sent = SAFETY_EVENT_ACCEPTED(SendErrorMsgEvent(entry->event, (U8) (entry->value >> 16),
+                                                           (U8) (entry->value >> 8), (U8) entry->value));
+            }
+        else
+            {
+            sent = SAFETY_EVENT_ACCEPTED(SendMsgEvent(entry->event, entry->value));
+            }
+
+        // Eventsystem nimmt nichts an, Ereignis bleibt für den nächsten Aufruf erhalten
+        if(!sent)
+            {
+            break;
+            }
+
+        tail++;
+        forwarded++;
+
+        // Eintrag erst nach dem Auslesen für die Sicherheitstask freigeben
+        __atomic_store_n(&eventTail, tail, __ATOMIC_RELEASE);
+        }
+
+    return forwarded;
+    }
+//------------------------------------------------------------------------------
+
+void Safety_Event_GetStatistics(SAFETY_EVENT_STATISTICS * const statistics)
+    {
+    if(statistics == NULL)
+        {
+        return;
+        }
+
+    // Einzelne 32 Bit Werte, jeder für sich konsistent
+    statistics->overflows = __atomic_load_n(&eventStatistics.overflows, __ATOMIC_RELAXED);
+    statistics->coalesced = __atomic_load_n(&eventStatistics.coalesced, __ATOMIC_RELAXED);
+    statistics->maxPending = __atomic_load_n(&eventStatistics.maxPending, __ATOMIC_RELAXED);
+    }
+//------------------------------------------------------------------------------
+
+static bool Safety_Event_Enqueue(SAFETY_EVENT_TYPE const type, U32 const event, U32 const value)
+    {
+    U32 const head = eventHead;
+    U32 const tail = __atomic_load_n(&eventTail, __ATOMIC_ACQUIRE);
+    U32 const pending = head - tail;
+    SAFETY_EVENT_ENTRY * entry;
+
+    // Gleiches Ereignis noch nicht weitergeleitet: zusammenfassen
+    if(pending > 0u)
+        {
+        entry = &eventQueue[(head - 1u) & EVENT_QUEUE_MASK];
+        if((entry->type == type) && (entry->event == event) && (entry->value == value))
+            {
+            __atomic_store_n(&eventStatistics.coalesced, eventStatistics.coalesced + 1u, __ATOMIC_RELAXED);
+            return true;
+            }
+        }
+
+    if(pending >= SAFETY_EVENT_QUEUE_SIZE)
+        {
+        __atomic_store_n(&eventStatistics.overflows, eventStatistics.overflows + 1u, __ATOMIC_RELAXED);
+        return false;
+        }
+
+    entry = &eventQueue[head & EVENT_QUEUE_MASK];
+    entry->type = type;
+    entry->event = event;
+    entry->value = value;
+
+    // Eintrag erst nach vollständigem Schreiben veröffentlichen
+    __atomic_store_n(&eventHead, head + 1u, __ATOMIC_RELEASE);
+
+    if((pending + 1u) > eventStatistics.maxPending)
+        {
+        __atomic_store_n(&eventStatistics.maxPending, pending + 1u, __ATOMIC_RELAXED);
+        }
+
+    return true;
+    }
+//------------------------------------------------------------------------------
+
+#endif // FEATURE_SAFETY_EVENT_QUEUE
@@ -0,0 +1,175 @@
+/*******************************************************************************
+ * Copyright (c) 2026 TWK-ELEKTRONIK GmbH. All rights reserved.
+ ******************************************************************************/
+
+/**
+ * \defgroup safety_event Ereignispuffer
+ * \ingroup safety_utils
+ * Entkopplung der Ereignisse der Sicherheitstask vom Eventsystem.
+ *
+ * Die Sicherheitstask legt ihre Ereignisse mit Safety_Event_Send() und
+ * Safety_Event_SendError() in einem eigenen Ringpuffer ab. Das Ablegen ist
+ * lock-free, blockiert nie und hat eine konstante Laufzeit, unabhängig vom
+ * Zustand der Warteschlange des Eventsystems. Ist der Puffer voll, wird das
+ * Ereignis verworfen und gezählt. Ein Ereignis, das dem zuletzt abgelegten und
+ * noch nicht weitergeleiteten Ereignis entspricht, wird zusammengefasst.
+ *
+ * Safety_Event_Process() leitet die Ereignisse in einem Kontext niedrigerer
+ * Priorität an das Eventsystem weiter, höchstens
+ * \ref SAFETY_EVENT_PROCESS_MAX_EVENTS je Aufruf. Mit
+ * \ref FEATURE_SAFETY_EVENT_TASK legt Safety_Task_Init() dafür eine eigene Task
+ * an, die alle \ref SAFETY_EVENT_TASK_PERIOD_MS weiterleitet. Ohne diese Task
+ * ruft die Applikation Safety_Event_Process() zyklisch aus ihrer Eventtask auf.
+ * Die Laufzeit von SendMsgEvent() und SendErrorMsgEvent() belastet so nicht die
+ * Sicherheitstask. Nimmt das Eventsystem ein Ereignis nicht an, bleibt es im
+ * Puffer und wird beim nächsten Aufruf erneut gesendet.
+ *
+ * Der Puffer hat genau einen Erzeuger, die Sicherheitstask, und genau einen
+ * Verbraucher. Safety_Event_Process() wird nur aus einem Kontext aufgerufen.
+ * @{
+ */
+#ifndef GLOBAL_SAFETY_SAFETY_EVENT_H_
+#define GLOBAL_SAFETY_SAFETY_EVENT_H_
+
+// Gemeinsame Headerdateien einbinden ---------------------------------------
+
+// Spezielle Headerdateien einbinden ----------------------------------------
+#include "safety_trace.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// Compiler Direktiven ------------------------------------------------------
+
+#ifndef FEATURE_SAFETY_EVENT_QUEUE
+/// \ingroup feature_flags
+/// Feature flag activating the ring buffer for the events of the safety task.
+/// Without the ring buffer the events are sent directly to the event system.
+/// Deactivated by default.
+#define FEATURE_SAFETY_EVENT_QUEUE      (0)
+#endif
+
+// Makros -------------------------------------------------------------------
+
+#if FEATURE_SAFETY_EVENT_QUEUE
+
+#ifndef SAFETY_EVENT_QUEUE_SIZE
+/// Number of entries of the ring buffer, has to be a power of two.
+#define SAFETY_EVENT_QUEUE_SIZE         (16u)
+#endif
+
+#if (SAFETY_EVENT_QUEUE_SIZE < 2u) || ((SAFETY_EVENT_QUEUE_SIZE & (SAFETY_EVENT_QUEUE_SIZE - 1u)) != 0u)
+#error "SAFETY_EVENT_QUEUE_SIZE must be a power of two and at least 2"
+#endif
+
+#ifndef SAFETY_EVENT_PROCESS_MAX_EVENTS
+/// Maximum number of events forwarded per call of Safety_Event_Process() by the forwarding task.
+#define SAFETY_EVENT_PROCESS_MAX_EVENTS (4u)
+#endif
+
+#ifndef FEATURE_SAFETY_EVENT_TASK
+/// \ingroup feature_flags
+/// Feature flag activating the forwarding task of the ring buffer, created by
+/// Safety_Task_Init(). Without the task the application has to call
+/// Safety_Event_Process() cyclically from its event task.
+/// Activated by default.
+#define FEATURE_SAFETY_EVENT_TASK       (1)
+#endif
+
+#if FEATURE_SAFETY_EVENT_TASK
+#ifndef SAFETY_EVENT_TASK_PRIORITY
+/// Priority of the forwarding task, has to be lower than the priority of the safety task.
+#define SAFETY_EVENT_TASK_PRIORITY      (1u)
+#endif
+
+#ifndef SAFETY_EVENT_TASK_PERIOD_MS
+/// Period of the forwarding task in ms.
+#define SAFETY_EVENT_TASK_PERIOD_MS     (10u)
+#endif
+#endif // FEATURE_SAFETY_EVENT_TASK
+
+#ifndef SAFETY_EVENT_ACCEPTED
+/// Evaluates the result of SendMsgEvent() and SendErrorMsgEvent(), true if the
+/// event system accepted the event. By default a result other than 0 means
+/// accepted. Can be adapted to the event system, e.g. to
+/// ((void) (result), true) for functions without result.
+#define SAFETY_EVENT_ACCEPTED(result)   ((result) != 0)
+#endif
+
+#elif FEATURE_SAFETY_TRACE
+
+/// Events are traced and sent directly to the event system.
+#define Safety_Event_Send(event, value) \
+    (Safety_Trace_Instant(eSAFETY_TRACE_TRACK_EVENT, "Event", (event)), SendMsgEvent((event), (value)))
+
+/// Error events are traced and sent directly to the event system.
+#define Safety_Event_SendError(event, upper, intermediate, lower) \
+    (Safety_Trace_Instant(eSAFETY_TRACE_TRACK_EVENT, "Error event", (event)), \
+     SendErrorMsgEvent((event), (upper), (intermediate), (lower)))
+
+#else
+
+/// Events are sent directly to the event system.
+#define Safety_Event_Send(event, value)                             SendMsgEvent((event), (value))
+
+/// Error events are sent directly to the event system.
+#define Safety_Event_SendError(event, upper, intermediate, lower)   SendErrorMsgEvent((event), (upper), (intermediate), (lower))
+
+#endif // FEATURE_SAFETY_EVENT_QUEUE
+
+// externe Variablen --------------------------------------------------------
+
+// Allgemeine Definitionen --------------------------------------------------
+
+#if FEATURE_SAFETY_EVENT_QUEUE
+/// Statistics of the ring buffer.
+typedef struct
+{
+    U32 overflows;      ///< Events discarded because the ring buffer was full
+    U32 coalesced;      ///< Events combined with an identical pending event
+    U32 maxPending;     ///< Largest number of pending events
+} SAFETY_EVENT_STATISTICS;
+
+// Prototypen ---------------------------------------------------------------
+
+/// Stores an event for the event system, replaces SendMsgEvent().
+/// Only to be called by the safety task.
+/// \param event Event number.
+/// \param value Value of the event.
+/// \return true if the event is stored or combined, false if the ring buffer is full.
+extern bool Safety_Event_Send(U32 const event, U32 const value);
+
+/// Stores an error event for the event system, replaces SendErrorMsgEvent().
+/// Only to be called by the safety task.
+/// \param event Event number.
+/// \param upper Upper level of the error code.
+/// \param intermediate Intermediate level of the error code.
+/// \param lower Lower level of the error code.
+/// \return true if the event is stored or combined, false if the ring buffer is full.
+extern bool Safety_Event_SendError(U32 const event, U8 const upper, U8 const intermediate, U8 const lower);
+
+/// Forwards pending events to the event system, called cyclically by the
+/// forwarding task or, without \ref FEATURE_SAFETY_EVENT_TASK, by the event task
+/// of the application. Never to be called by the safety task, and only from one
+/// context. An event the event system does not accept, see
+/// \ref SAFETY_EVENT_ACCEPTED, stays pending and is retried with the next call,
+/// the following events wait to keep the order.
+/// \param maxEvents Maximum number of events to forward.
+/// \return Number of forwarded events.
+extern U32 Safety_Event_Process(U32 const maxEvents);
+
+/// Returns the statistics of the ring buffer.
+/// \param statistics Returns the statistics.
+extern void Safety_Event_GetStatistics(SAFETY_EVENT_STATISTICS * const statistics);
+#endif // FEATURE_SAFETY_EVENT_QUEUE
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GLOBAL_SAFETY_SAFETY_EVENT_H_ */
+/**
+ * @}
+ */
@@ -0,0 +1,469 @@
+/*******************************************************************************
+ * Copyright (c) 2026 TWK-ELEKTRONIK GmbH. All rights reserved.
+ ******************************************************************************/
+
+// Gemeinsame Headerdateien einbinden --------------------------------------
+#include "config/version.h"
+
+#include "safety_filter.h"
+
+// Compiler Direktiven -----------------------------------------------------
+
+// Makros ------------------------------------------------------------------
+
+/// Vergleicher des Sortiernetzwerks, a erhält das Minimum und b das Maximum.
+/// Die Ternäroperatoren werden ohne Sprung übersetzt.
+#define FILTER_SORT2(a, b)                          \
+    do                                              \
+        {                                           \
+        S32 const low = ((a) < (b)) ? (a) : (b);    \
+        (b) = ((a) < (b)) ? (b) : (a);              \
+        (a) = low;                                  \
+        } while(0)
+
+// Allgemeine Definitionen -------------------------------------------------
+
+// externe Variablen -------------------------------------------------------
+
+// Funktionsbereich --------------------------------------------------------
+
+/// Adds a value to an accumulator of the statistics.
+/// \param acc Accumulator.
+/// \param value New value, already limited.
+static void Safety_Filter_StatAdd(SAFETY_FILTER_STAT_ACC * const acc, S32 const value);
+
+/// Merges two accumulators of the statistics.
+/// \param a First accumulator.
+/// \param b Second accumulator.
+/// \param merged Returns the merged accumulator.
+static void Safety_Filter_StatMerge(SAFETY_FILTER_STAT_ACC const * const a, SAFETY_FILTER_STAT_ACC const * const b,
+                                    SAFETY_FILTER_STAT_ACC * const merged);
+
+/// Evaluates an accumulator of the statistics.
+/// \param acc Accumulator.
+/// \param values Returns the evaluated statistics.
+static void Safety_Filter_StatEvaluate(SAFETY_FILTER_STAT_ACC const * const acc, SAFETY_FILTER_STAT_VALUES * const values);
+
+U8 Safety_Filter_IirShiftForAverage(U32 const numValues)
+    {
+    U32 const doubleAge = numValues + 1u;
+    U8 shift = 0;
+
+    // Größten Exponenten mit 2^shift <= (N + 1) / 2 bestimmen
+    while((shift < SAFETY_FILTER_IIR_SHIFT_MAX) && (((U32) 4u << shift) <= doubleAge))
+        {
+        shift++;
+        }
+
+    // Auf den nächstgelegenen Exponenten runden
+    if((shift < SAFETY_FILTER_IIR_SHIFT_MAX) && ((2u * doubleAge) >= ((U32) 6u << shift)))
+        {
+        shift++;
+        }
+
+    return shift;
+    }
+//------------------------------------------------------------------------------
+
+bool Safety_Filter_IirInit(SAFETY_FILTER_IIR * const filter, U8 const shift, U8 const validCount)
+    {
+    if((filter == NULL) || (shift > SAFETY_FILTER_IIR_SHIFT_MAX) || (validCount == 0u))
+        {
+        return false;
+        }
+
+    filter->accumulator = 0;
+    filter->shift = shift;
+    filter->count = 0;
+    filter->validCount = validCount;
+    return true;
+    }
+//------------------------------------------------------------------------------
+
+void Safety_Filter_IirUpdate(SAFETY_FILTER_IIR * const filter, S32 const value)
+    {
+    if(filter->count == 0u)
+        {
+        // Erster Wert initialisiert den Filter, kein Einschwingen von 0 aus
+        filter->accumulator = value * ((S32) 1 << filter->shift);
+        }
+    else
+        {
+        // Rückführung gerundet wie der Ausgang, sonst bleibt ein Rest von
+        // einem LSB zum Eingang stehen
+        filter->accumulator += value - Safety_Filter_IirGet(filter);
+        }
+
+    if(filter->count < filter->validCount)
+        {
+        filter->count++;
+        }
+    }
+//------------------------------------------------------------------------------
+
+bool Safety_Filter_IirIsValid(SAFETY_FILTER_IIR const * const filter)
+    {
+    return filter->count >= filter->validCount;
+    }
+//------------------------------------------------------------------------------
+
+S32 Safety_Filter_IirGet(SAFETY_FILTER_IIR const * const filter)
+    {
+    if(filter->shift == 0u)
+        {
+        return filter->accumulator;
+        }
+
+    return (filter->accumulator + ((S32) 1 << (filter->shift - 1u))) >> filter->shift;
+    }
+//------------------------------------------------------------------------------
+
+bool Safety_Filter_IirInitF32(SAFETY_FILTER_IIR_F32 * const filter, U8 const shift, U8 const validCount)
+    {
+    if((filter == NULL) || (shift > SAFETY_FILTER_IIR_SHIFT_MAX) || (validCount == 0u))
+        {
+        return false;
+        }
+
+    filter->value = 0.0f;
+    filter->alpha = 1.0f / (F32) ((U32) 1u << shift);
+    filter->count = 0;
+    filter->validCount = validCount;
+    return true;
+    }
+//------------------------------------------------------------------------------
+
+void Safety_Filter_IirUpdateF32(SAFETY_FILTER_IIR_F32 * const filter, F32 const value)
+    {
+    if(filter->count == 0u)
+        {
+        filter->value = value;
+        }
+    else
+        {
+        filter->value += filter->alpha * (value - filter->value);
+        }
+
+    if(filter->count < filter->validCount)
+        {
+        filter->count++;
+        }
+    }
+//------------------------------------------------------------------------------
+
+bool Safety_Filter_IirIsValidF32(SAFETY_FILTER_IIR_F32 const * const filter)
+    {
+    return filter->count >= filter->validCount;
+    }
+//------------------------------------------------------------------------------
+
+F32 Safety_Filter_IirGetF32(SAFETY_FILTER_IIR_F32 const * const filter)
+    {
+    return filter->value;
+    }
+//------------------------------------------------------------------------------
+
+S32 Safety_Filter_Median3(S32 const * const values)
+    {
+    S32 v0 = values[0];
+    S32 v1 = values[1];
+    S32 v2 = values[2];
+
+    FILTER_SORT2(v0, v1);
+    FILTER_SORT2(v1, v2);
+    FILTER_SORT2(v0, v1);
+    return v1;
+    }
+//------------------------------------------------------------------------------
+
+S32 Safety_Filter_Median5(S32 const * const values)
+    {
+    S32 v0 = values[0];
+    S32 v1 = values[1];
+    S32 v2 = values[2];
+    S32 v3 = values[3];
+    S32 v4 = values[4];
+
+    // Sortiernetzwerk mit 9 Vergleichern
+    FILTER_SORT2(v0, v1);
+    FILTER_SORT2(v3, v4);
+    FILTER_SORT2(v2, v4);
+    FILTER_SORT2(v2, v3);
+    FILTER_SORT2(v0, v3);
+    FILTER_SORT2(v0, v2);
+    FILTER_SORT2(v1, v4);
+    FILTER_SORT2(v1, v3);
+    FILTER_SORT2(v1, v2);
+    return v2;
+    }
+//------------------------------------------------------------------------------
+
+S32 Safety_Filter_Median7(S32 const * const values)
+    {
+    S32 v0 = values[0];
+    S32 v1 = values[1];
+    S32 v2 = values[2];
+    S32 v3 = values[3];
+    S32 v4 = values[4];
+    S32 v5 = values[5];
+    S32 v6 = values[6];
+
+    // Sortiernetzwerk mit 16 Vergleichern
+    FILTER_SORT2(v0, v6);
+    FILTER_SORT2(v2, v3);
+    FILTER_SORT2(v4, v5);
+    FILTER_SORT2(v0, v2);
+    FILTER_SORT2(v1, v4);
+    FILTER_SORT2(v3, v6);
+    FILTER_SORT2(v0, v1);
+    FILTER_SORT2(v2, v5);
+    FILTER_SORT2(v3, v4);
+    FILTER_SORT2(v1, v2);
+    FILTER_SORT2(v4, v6);
+    FILTER_SORT2(v2, v3);
+    FILTER_SORT2(v4, v5);
+    FILTER_SORT2(v1, v2);
+    FILTER_SORT2(v3, v4);
+    FILTER_SORT2(v5, v6);
+    return v3;
+    }
+//------------------------------------------------------------------------------
+
+bool Safety_Filter_MedianInit(SAFETY_FILTER_MEDIAN * const filter, U8 const size)
+    {
+    if((filter == NULL) || ((size != 3u) && (size != 5u) && (size != 7u)))
+        {
+        return false;
+        }
+
+    filter->size = size;
+    filter->index = 0;
+    filter->filled = false;
+    return true;
+    }
+//------------------------------------------------------------------------------
+
+S32 Safety_Filter_MedianUpdate(SAFETY_FILTER_MEDIAN * const filter, S32 const value)
+    {
+    U8 i;
+
+    if(!filter->filled)
+        {
+        // Erster Wert füllt das Fenster, Ausgang sofort gültig
+        for(i = 0; i < SAFETY_FILTER_MEDIAN_MAX; i++)
+            {
+            filter->window[i] = value;
+            }
+        filter->filled = true;
+        }
+    else
+        {
+        filter->window[filter->index] = value;
+        }
+
+    filter->index++;
+    if(filter->index >= filter->size)
+        {
+        filter->index = 0;
+        }
+
+    // Der Median ist unabhängig von der Reihenfolge im Ringpuffer
+    switch(filter->size)
+        {
+        case 3u:
+            return Safety_Filter_Median3(filter->window);
+        case 5u:
+            return Safety_Filter_Median5(filter->window);
+        default:
+            return Safety_Filter_Median7(filter->window);
+        }
+    }
+//------------------------------------------------------------------------------
+
+bool Safety_Filter_StatInit(SAFETY_FILTER_STAT * const stat, U32 const blockSize)
+    {
+    if((stat == NULL) || (blockSize == 0u))
+        {
+        return false;
+        }
+
+    stat->total.count = 0;
+    stat->block[0].count = 0;
+    stat->block[1].count = 0;
+    stat->blockSize = blockSize;
+    stat->current = 0;
+    return true;
+    }
+//------------------------------------------------------------------------------
+
+void Safety_Filter_StatUpdate(SAFETY_FILTER_STAT * const stat, S32 value)
+    {
+    SAFETY_FILTER_STAT_ACC * block = &stat->block[stat->current];
+
+    // Begrenzen, damit die Differenzen im Festkommaformat in 32 Bit passen
+    if(value > SAFETY_FILTER_STAT_VALUE_MAX)
+        {
+        value = SAFETY_FILTER_STAT_VALUE_MAX;
+        }
+    else if(value < -SAFETY_FILTER_STAT_VALUE_MAX)
+        {
+        value = -SAFETY_FILTER_STAT_VALUE_MAX;
+        }
+
+    Safety_Filter_StatAdd(&stat->total, value);
+
+    if(block->count >= stat->blockSize)
+        {
+        // Block voll, der ältere Block wird verworfen und neu begonnen
+        stat->current ^= 1u;
+        block = &stat->block[stat->current];
+        block->count = 0;
+        }
+
+    Safety_Filter_StatAdd(block, value);
+    }
+//------------------------------------------------------------------------------
+
+void Safety_Filter_StatGet(SAFETY_FILTER_STAT const * const stat, SAFETY_FILTER_STAT_VALUES * const total,
+                           SAFETY_FILTER_STAT_VALUES * const window)
+    {
+    SAFETY_FILTER_STAT_ACC merged;
+
+    if(total != NULL)
+        {
+        Safety_Filter_StatEvaluate(&stat->total, total);
+        }
+
+    if(window != NULL)
+        {
+        Safety_Filter_StatMerge(&stat->block[0], &stat->block[1], &merged);
+        Safety_Filter_StatEvaluate(&merged, window);
+        }
+    }
+//------------------------------------------------------------------------------
+
+static void Safety_Filter_StatAdd(SAFETY_FILTER_STAT_ACC * const acc, S32 const value)
+    {
+    S32 const scaled = value * ((S32) 1 << SAFETY_FILTER_STAT_MEAN_SHIFT);
+    S32 delta;
+    S64 product;
+
+    if(acc->count == 0u)
+        {
+        acc->count = 1;
+        acc->min = value;
+        acc->max = value;
+        acc->mean = scaled;
+        acc->m2 = 0;
+        return;
+        }
+
+    if(value < acc->min)
+        {
+        acc->min = value;
+        }
+    if(value > acc->max)
+        {
+        acc->max = value;
+        }
+
+    // Zähler sättigt, der Mittelwert folgt dann mit minimaler Gewichtung
+    if(acc->count < 0x7FFFFFFFu)
+        {
+        acc->count++;
+        }
+
+    // Welford: mean += delta / n, m2 += delta * (x - mean_neu)
+    delta = scaled - acc->mean;
+    acc->mean += delta / (S32) acc->count;
+    product = (S64) delta * (S64) (scaled - acc->mean);
+
+    // Rundungsbedingt negative Beiträge ignorieren, Summe sättigen
+    if((product > 0) && ((acc->m2 + (U64) product) > acc->m2))
+        {
+        acc->m2 += (U64) product;
+        }
+    }
+//------------------------------------------------------------------------------
+
+static void Safety_Filter_StatMerge(SAFETY_FILTER_STAT_ACC const * const a, SAFETY_FILTER_STAT_ACC const * const b,
+                                    SAFETY_FILTER_STAT_ACC * const merged)
+    {
+    U32 count;
+    S64 delta;
+    U64 deltaAbs;
+    U64 weight;
+    U64 remainder;
+    U64 correction;
+    U64 m2;
+
+    if(a->count == 0u)
+        {
+        *merged = *b;
+        return;
+        }
+    if(b->count == 0u)
+        {
+        *merged = *a;
+        return;
+        }
+
+    // Zusammenführung nach Chan, nur beim Auslesen
+    count = a->count + b->count;
+    delta = (S64) b->mean - (S64) a->mean;
+    deltaAbs = (U64) ((delta < 0) ? -delta : delta);
+
+    // Korrektur delta^2 * n_a * n_b / n ganzzahlig, n_a * n_b / n in ganzzahligen
+    // Anteil und Rest zerlegt. |delta| < 2^31 und Rest < 2^32, damit bleiben die
+    // Produkte unter 2^64 und der Anteil des Rests wird exakt abgerundet.
+    weight = ((U64) a->count * (U64) b->count) / count;
+    remainder = deltaAbs * (((U64) a->count * (U64) b->count) % count);
+    correction = ((remainder / count) * deltaAbs) + (((remainder % count) * deltaAbs) / count);
+    if((weight != 0u) && ((deltaAbs * deltaAbs) > ((~(U64) 0 - correction) / weight)))
+        {
+        correction = ~(U64) 0;
+        }
+    else
+        {
+        correction += deltaAbs * deltaAbs * weight;
+        }
+
+    merged->count = count;
+    merged->min = (a->min < b->min) ? a->min : b->min;
+    merged->max = (a->max > b->max) ? a->max : b->max;
+    merged->mean = (S32) ((S64) a->mean + ((delta * (S64) b->count) / (S64) count));
+
+    // Summe sättigen wie in Safety_Filter_StatAdd()
+    m2 = a->m2 + b->m2;
+    if(m2 < a->m2)
+        {
+        m2 = ~(U64) 0;
+        }
+    merged->m2 = ((m2 + correction) < m2) ? ~(U64) 0 : (m2 + correction);
+    }
+//------------------------------------------------------------------------------
+
+static void Safety_Filter_StatEvaluate(SAFETY_FILTER_STAT_ACC const * const acc, SAFETY_FILTER_STAT_VALUES * const values)
+    {
+    U64 variance;
+
+    values->count = acc->count;
+
+    if(acc->count == 0u)
+        {
+        values->min = 0;
+        values->max = 0;
+        values->mean = 0;
+        values->variance = 0;
+        return;
+        }
+
+    values->min = acc->min;
+    values->max = acc->max;
+    values->mean = (acc->mean + ((S32) 1 << (SAFETY_FILTER_STAT_MEAN_SHIFT - 1u))) >> SAFETY_FILTER_STAT_MEAN_SHIFT;
+
+    variance = ((acc->m2 / acc->count) + ((U64) 1 << ((2u * SAFETY_FILTER_STAT_MEAN_SHIFT) - 1u)))
+               >> (2u * SAFETY_FILTER_STAT_MEAN_SHIFT);
+    values->variance = (variance > 0xFFFFFFFFu) ? 0xFFFFFFFFu : (U32) variance;
+    }
+//------------------------------------------------------------------------------
@@ -0,0 +1,232 @@
+/*******************************************************************************
+ * Copyright (c) 2026 TWK-ELEKTRONIK GmbH. All rights reserved.
+ ******************************************************************************/
+
+/**
+ * \defgroup safety_filter Messwertfilter
+ * \ingroup safety_utils
+ * Speichersparende Filter für die Messkanäle der Versorgungsspannungsüberwachung.
+ *
+ * Der exponentielle IIR-Filter 1. Ordnung benötigt unabhängig von der
+ * Filterlänge nur ein Zustandswort:
+ *
+ *     y[n] = y[n-1] + (x[n] - y[n-1]) / 2^shift
+ *
+ * Die Ganzzahlvariante rechnet in Festkomma mit \e shift Nachkommabits.
+ * Ein gleitender Mittelwert über N Werte und ein IIR-Filter mit
+ * alpha = 2 / (N + 1) haben dasselbe mittlere Alter der Messwerte
+ * ((N - 1) / 2 Abtastungen) und damit eine vergleichbare Zeitkonstante.
+ * Safety_Filter_IirShiftForAverage() liefert den Zweierexponenten, der diesem
+ * alpha am nächsten kommt, z.B. shift 2 für N = 8 und shift 3 für N = 16.
+ *
+ * Der Medianfilter über 3, 5 oder 7 Werte unterdrückt einzelne Ausreißer des
+ * ADC, ohne steile Flanken zu verschleifen. Ein Einbruch, der länger als die
+ * halbe Fensterbreite ansteht, erscheint unverzögert am Ausgang. Der Median
+ * wird mit einem festen Sortiernetzwerk aus Minimum-/Maximum-Operationen
+ * berechnet, die Laufzeit ist damit unabhängig von den Messwerten und der
+ * Compiler erzeugt verzweigungsfreien Code (bedingte Ausführung bzw. cmov).
+ *
+ * Die Messwertstatistik erfasst Minimum, Maximum, Mittelwert und Varianz seit
+ * dem Start und über ein gleitendes Fenster. Mittelwert und Varianz werden
+ * nach Welford in Festkomma mit konstantem Aufwand pro Wert fortgeschrieben.
+ * Das Fenster besteht aus zwei Blöcken mit je \e blockSize Werten, die erst beim
+ * Auslesen zusammengeführt werden. Es umfasst damit nach dem Einschwingen
+ * immer die letzten blockSize + 1 bis 2 * blockSize Werte.
+ * @{
+ */
+#ifndef GLOBAL_SAFETY_SAFETY_FILTER_H_
+#define GLOBAL_SAFETY_SAFETY_FILTER_H_
+
+// Gemeinsame Headerdateien einbinden ---------------------------------------
+
+// Spezielle Headerdateien einbinden ----------------------------------------
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// Compiler Direktiven ------------------------------------------------------
+
+// Makros -------------------------------------------------------------------
+
+/// Largest supported shift of the IIR filters.
+#define SAFETY_FILTER_IIR_SHIFT_MAX     (15u)
+
+/// Largest supported window of the median filter.
+#define SAFETY_FILTER_MEDIAN_MAX        (7u)
+
+/// Fractional bits of the mean of the statistics.
+#define SAFETY_FILTER_STAT_MEAN_SHIFT   (7u)
+
+/// Largest magnitude of a value of the statistics, larger values are limited.
+#define SAFETY_FILTER_STAT_VALUE_MAX    ((S32) 0x007FFFFF)
+
+// externe Variablen --------------------------------------------------------
+
+// Allgemeine Definitionen --------------------------------------------------
+
+/// State of a fixed point single-pole IIR filter.
+/// The input values must fit into 31 - shift bits including sign.
+typedef struct
+{
+    S32 accumulator;    ///< Filtered value scaled with 2^shift
+    U8 shift;           ///< Filter coefficient alpha = 1 / 2^shift
+    U8 count;           ///< Number of filtered values up to validCount
+    U8 validCount;      ///< Number of values until the output is valid
+} SAFETY_FILTER_IIR;
+
+/// State of a floating point single-pole IIR filter.
+typedef struct
+{
+    F32 value;          ///< Filtered value
+    F32 alpha;          ///< Filter coefficient 1 / 2^shift
+    U8 count;           ///< Number of filtered values up to validCount
+    U8 validCount;      ///< Number of values until the output is valid
+} SAFETY_FILTER_IIR_F32;
+
+/// State of a median filter over 3, 5 or 7 values.
+typedef struct
+{
+    S32 window[SAFETY_FILTER_MEDIAN_MAX];   ///< Last values, ring buffer
+    U8 size;                                ///< Window size, 3, 5 or 7
+    U8 index;                               ///< Position of the next value in the window
+    bool filled;                            ///< Set after the first value
+} SAFETY_FILTER_MEDIAN;
+
+/// Running statistics of a set of values.
+typedef struct
+{
+    U32 count;      ///< Number of values
+    S32 min;        ///< Smallest value
+    S32 max;        ///< Largest value
+    S32 mean;       ///< Mean scaled with 2^SAFETY_FILTER_STAT_MEAN_SHIFT
+    U64 m2;         ///< Sum of squared deviations from the mean scaled with 2^(2 * SAFETY_FILTER_STAT_MEAN_SHIFT)
+} SAFETY_FILTER_STAT_ACC;
+
+/// State of the statistics since start and over a sliding window.
+typedef struct
+{
+    SAFETY_FILTER_STAT_ACC total;       ///< Statistics since start
+    SAFETY_FILTER_STAT_ACC block[2];    ///< Completed and current block of the window
+    U32 blockSize;                      ///< Number of values per block
+    U8 current;                         ///< Index of the current block
+} SAFETY_FILTER_STAT;
+
+/// Evaluated statistics in the unit of the values.
+typedef struct
+{
+    U32 count;      ///< Number of values, 0 if no statistics are available
+    S32 min;        ///< Smallest value
+    S32 max;        ///< Largest value
+    S32 mean;       ///< Rounded mean
+    U32 variance;   ///< Population variance in the squared unit of the values, limited to U32
+} SAFETY_FILTER_STAT_VALUES;
+
+// Prototypen ---------------------------------------------------------------
+
+/// Returns the shift of an IIR filter with a time constant equivalent to a
+/// moving average over \p numValues values.
+/// \param numValues Number of values of the moving average.
+/// \return Shift of the IIR filter, at most \ref SAFETY_FILTER_IIR_SHIFT_MAX.
+extern U8 Safety_Filter_IirShiftForAverage(U32 const numValues);
+
+/// Initializes a fixed point IIR filter.
+/// \param filter Filter state.
+/// \param shift Filter coefficient alpha = 1 / 2^shift.
+/// \param validCount Number of values until the output is valid, at least 1.
+/// \return true on success, false if a parameter is invalid.
+extern bool Safety_Filter_IirInit(SAFETY_FILTER_IIR * const filter, U8 const shift, U8 const validCount);
+
+/// Filters a new value. The first value initializes the filter.
+/// \param filter Filter state.
+/// \param value New value.
+extern void Safety_Filter_IirUpdate(SAFETY_FILTER_IIR * const filter, S32 const value);
+
+/// Checks if the output of the filter is valid.
+/// \param filter Filter state.
+/// \return true if at least validCount values were filtered.
+extern bool Safety_Filter_IirIsValid(SAFETY_FILTER_IIR const * const filter);
+
+/// Returns the rounded output of the filter.
+/// \param filter Filter state.
+/// \return Filtered value.
+extern S32 Safety_Filter_IirGet(SAFETY_FILTER_IIR const * const filter);
+
+/// Initializes a floating point IIR filter.
+/// \param filter Filter state.
+/// \param shift Filter coefficient alpha = 1 / 2^shift.
+/// \param validCount Number of values until the output is valid, at least 1.
+/// \return true on success, false if a parameter is invalid.
+extern bool Safety_Filter_IirInitF32(SAFETY_FILTER_IIR_F32 * const filter, U8 const shift, U8 const validCount);
+
+/// Filters a new value. The first value initializes the filter.
+/// \param filter Filter state.
+/// \param value New value.
+extern void Safety_Filter_IirUpdateF32(SAFETY_FILTER_IIR_F32 * const filter, F32 const value);
+
+/// Checks if the output of the filter is valid.
+/// \param filter Filter state.
+/// \return true if at least validCount values were filtered.
+extern bool Safety_Filter_IirIsValidF32(SAFETY_FILTER_IIR_F32 const * const filter);
+
+/// Returns the output of the filter.
+/// \param filter Filter state.
+/// \return Filtered value.
+extern F32 Safety_Filter_IirGetF32(SAFETY_FILTER_IIR_F32 const * const filter);
+
+/// Returns the median of 3 values.
+/// \param values Array of 3 values, not modified.
+/// \return Median of the values.
+extern S32 Safety_Filter_Median3(S32 const * const values);
+
+/// Returns the median of 5 values.
+/// \param values Array of 5 values, not modified.
+/// \return Median of the values.
+extern S32 Safety_Filter_Median5(S32 const * const values);
+
+/// Returns the median of 7 values.
+/// \param values Array of 7 values, not modified.
+/// \return Median of the values.
+extern S32 Safety_Filter_Median7(S32 const * const values);
+
+/// Initializes a median filter.
+/// \param filter Filter state.
+/// \param size Window size, 3, 5 or 7.
+/// \return true on success, false if a parameter is invalid.
+extern bool Safety_Filter_MedianInit(SAFETY_FILTER_MEDIAN * const filter, U8 const size);
+
+/// Filters a new value. The first value fills the whole window, so the output
+/// is valid from the first value on.
+/// \param filter Filter state.
+/// \param value New value.
+/// \return Median of the last values.
+extern S32 Safety_Filter_MedianUpdate(SAFETY_FILTER_MEDIAN * const filter, S32 const value);
+
+/// Initializes the statistics.
+/// \param stat Statistics state.
+/// \param blockSize Number of values per block of the sliding window, at least 1.
+/// \return true on success, false if a parameter is invalid.
+extern bool Safety_Filter_StatInit(SAFETY_FILTER_STAT * const stat, U32 const blockSize);
+
+/// Adds a value to the statistics. The value is limited to
+/// +-\ref SAFETY_FILTER_STAT_VALUE_MAX.
+/// \param stat Statistics state.
+/// \param value New value.
+extern void Safety_Filter_StatUpdate(SAFETY_FILTER_STAT * const stat, S32 const value);
+
+/// Evaluates the statistics.
+/// \param stat Statistics state, e.g. a consistent copy.
+/// \param total Returns the statistics since start, can be NULL.
+/// \param window Returns the statistics over the sliding window, can be NULL.
+extern void Safety_Filter_StatGet(SAFETY_FILTER_STAT const * const stat, SAFETY_FILTER_STAT_VALUES * const total,
+                                  SAFETY_FILTER_STAT_VALUES * const window);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GLOBAL_SAFETY_SAFETY_FILTER_H_ */
+/**
+ * @}
+ */
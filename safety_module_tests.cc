@@ -1,12 +1,2390 @@
 #include <gtest/gtest.h>
+#include <thread>
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <vector>
 #include "../build/Driver_Common/ctypes.h"
 
+#include "safety_module_tests_env.h"
+
+#include "error_def.h"
+#include "eventdef.h"
+
+#include "safety_runtime.h"
+#include "safety_startup.h"
+#include "safety_checkpoint.h"
+#include "safety_powersupply.h"
+#include "safety_rtos.h"
+#include "safety_register.h"
+#include "safety_filter.h"
+#include "safety_temperature.h"
+#include "safety_event.h"
+#include "safety_record.h"
+#include "safety_trace.h"
+#include "STM32_Safety_STL_API/HostStl.h"
+#include "STM32_Safety_STL_API/RAMTestStl.h"
+#include "STM32_Safety_STL_API/ROMTestStl.h"
+#include "STM32_Safety_STL_API/CPUTestStl.h"
+#include "STM32_Safety_STL_API/FaultInjectionStl.h"
+
 class SafetyTest : public ::testing::Test {
 protected:
-  void SetUp() override { }
+  void SetUp() override { SafetyTestEnv_Reset(); }
 };
 
 // Sample Test Case
 TEST_F(SafetyTest, SAMPLE_TEST_CASE) {
   ASSERT_EQ(3, 1 + 2);
 }
+
+// Deadline checkpoints
+TEST_F(SafetyTest, CHECKPOINT_REGISTER_REJECTS_INVALID_DEADLINE) {
+  SAFETY_CHECKPOINT_ID id;
+
+  EXPECT_FALSE(Safety_Checkpoint_Register(0, &id));
+  EXPECT_FALSE(Safety_Checkpoint_Register(100, NULL));
+  EXPECT_FALSE(Safety_Checkpoint_Register(RTOS_MAX_TIMEOUT, &id));
+}
+
+TEST_F(SafetyTest, CHECKPOINT_REGISTER_LIMITED_TO_MAX) {
+  SAFETY_CHECKPOINT_ID id;
+
+  for (U32 i = 0; i < SAFETY_CHECKPOINT_MAX; i++) {
+    ASSERT_TRUE(Safety_Checkpoint_Register(100, &id));
+    EXPECT_EQ(i, id);
+  }
+  EXPECT_FALSE(Safety_Checkpoint_Register(100, &id));
+}
+
+TEST_F(SafetyTest, CHECKPOINT_DEADLINE_MET) {
+  SAFETY_CHECKPOINT_ID id;
+  U32 ticks = 0;
+
+  ASSERT_TRUE(Safety_Checkpoint_Register(100, &id));
+  for (U32 cycle = 0; cycle < 10; cycle++) {
+    ticks += 50 * configTICK_RATE_HZ_MS;
+    Safety_Checkpoint_Reached(id);
+    EXPECT_TRUE(Safety_Checkpoint_Evaluate(ticks));
+  }
+  EXPECT_EQ(0u, Safety_Checkpoint_GetMissedMask());
+  EXPECT_EQ(0u, SafetyTestEnv_GetNonvolatileError());
+}
+
+TEST_F(SafetyTest, CHECKPOINT_DEADLINE_MISSED_IS_LATCHED) {
+  SAFETY_CHECKPOINT_ID alive;
+  SAFETY_CHECKPOINT_ID stuck;
+
+  ASSERT_TRUE(Safety_Checkpoint_Register(100, &alive));
+  ASSERT_TRUE(Safety_Checkpoint_Register(100, &stuck));
+
+  // exactly on the deadline is still in time
+  Safety_Checkpoint_Reached(alive);
+  EXPECT_TRUE(Safety_Checkpoint_Evaluate(100 * configTICK_RATE_HZ_MS));
+
+  Safety_Checkpoint_Reached(alive);
+  EXPECT_FALSE(Safety_Checkpoint_Evaluate(101 * configTICK_RATE_HZ_MS));
+  EXPECT_EQ(1u << stuck, Safety_Checkpoint_GetMissedMask());
+  EXPECT_EQ((U32)HARD_ERR_INTERN_CHECKPOINT_MISSED, SafetyTestEnv_GetNonvolatileError());
+
+  // a late check-in does not clear the error
+  Safety_Checkpoint_Reached(alive);
+  Safety_Checkpoint_Reached(stuck);
+  EXPECT_FALSE(Safety_Checkpoint_Evaluate(150 * configTICK_RATE_HZ_MS));
+  EXPECT_EQ(1u << stuck, Safety_Checkpoint_GetMissedMask());
+}
+
+TEST_F(SafetyTest, CHECKPOINT_DEADLINE_ACROSS_TICK_OVERFLOW) {
+  SAFETY_CHECKPOINT_ID id;
+
+  SafetyTestEnv_SetTicks(0xFFFFFFF0u);
+  ASSERT_TRUE(Safety_Checkpoint_Register(100, &id));
+
+  EXPECT_TRUE(Safety_Checkpoint_Evaluate(0xFFFFFFF0u + 100u * configTICK_RATE_HZ_MS));
+  EXPECT_FALSE(Safety_Checkpoint_Evaluate(0xFFFFFFF0u + 101u * configTICK_RATE_HZ_MS));
+}
+
+// Hard error trap
+TEST_F(SafetyTest, HARDERROR_TRAP_RECORDS_STEPS) {
+  SAFETY_HARDERROR_RECORD record;
+  volatile bool returned = false;
+
+  Safety_HardErrorTrap_Arm(&record);
+  if (setjmp(record.jumpBuffer) == 0) {
+    Safety_HardError(HARD_ERR_SAFETY_MEASUREMENT);
+    returned = true;
+  }
+  Safety_HardErrorTrap_Disarm();
+
+  EXPECT_FALSE(returned);
+  EXPECT_EQ(HARD_ERR_SAFETY_MEASUREMENT, record.hardErrorCode);
+  EXPECT_FALSE(record.isPermanent);
+  ASSERT_EQ(4u, record.stepCount);
+  EXPECT_EQ(eSAFETY_HARDERROR_STEP_LOG, record.steps[0]);
+  EXPECT_EQ(eSAFETY_HARDERROR_STEP_INTERRUPT_DISABLE, record.steps[1]);
+  EXPECT_EQ(eSAFETY_HARDERROR_STEP_BACKUP, record.steps[2]);
+  EXPECT_EQ(eSAFETY_HARDERROR_STEP_CUSTOM_ACTION, record.steps[3]);
+  EXPECT_EQ((U32)HARD_ERR_SAFETY_MEASUREMENT, SafetyTestEnv_GetNonvolatileError());
+}
+
+TEST_F(SafetyTest, HARDERROR_TRAP_PERMANENT) {
+  SAFETY_HARDERROR_RECORD record;
+
+  Safety_HardErrorTrap_Arm(&record);
+  if (setjmp(record.jumpBuffer) == 0) {
+    Safety_PermanentHardError(HARD_ERR_INTERN_SAFETY_CYCLIC);
+  }
+  Safety_HardErrorTrap_Disarm();
+
+  EXPECT_EQ(HARD_ERR_INTERN_SAFETY_CYCLIC, record.hardErrorCode);
+  EXPECT_TRUE(record.isPermanent);
+}
+
+TEST_F(SafetyTest, HARDERROR_TRAP_WITHOUT_HARD_ERROR) {
+  SAFETY_HARDERROR_RECORD record;
+  volatile bool returned = false;
+
+  Safety_HardErrorTrap_Arm(&record);
+  if (setjmp(record.jumpBuffer) == 0) {
+    returned = true;
+  }
+  Safety_HardErrorTrap_Disarm();
+
+  EXPECT_TRUE(returned);
+  EXPECT_EQ(0u, record.stepCount);
+  EXPECT_EQ(0u, SafetyTestEnv_GetNonvolatileError());
+}
+
+TEST_F(SafetyTest, HARDERROR_TRAP_DISARMED_RECORD_UNCHANGED) {
+  SAFETY_HARDERROR_RECORD disarmed;
+  SAFETY_HARDERROR_RECORD armed;
+
+  Safety_HardErrorTrap_Arm(&disarmed);
+  Safety_HardErrorTrap_Disarm();
+
+  Safety_HardErrorTrap_Arm(&armed);
+  if (setjmp(armed.jumpBuffer) == 0) {
+    Safety_HardError(HARD_ERR_SAFETY_MEASUREMENT);
+  }
+  Safety_HardErrorTrap_Disarm();
+
+  EXPECT_EQ(0u, disarmed.stepCount);
+  EXPECT_EQ(4u, armed.stepCount);
+}
+
+TEST_F(SafetyTest, HARDERROR_TRAP_PER_THREAD) {
+  SAFETY_HARDERROR_RECORD mainRecord;
+  SAFETY_HARDERROR_RECORD threadRecord;
+
+  Safety_HardErrorTrap_Arm(&mainRecord);
+
+  std::thread worker([&threadRecord]() {
+    Safety_HardErrorTrap_Arm(&threadRecord);
+    if (setjmp(threadRecord.jumpBuffer) == 0) {
+      Safety_HardError(HARD_ERR_INTERN_SAFETY_CYCLIC);
+    }
+    Safety_HardErrorTrap_Disarm();
+  });
+  worker.join();
+
+  Safety_HardErrorTrap_Disarm();
+
+  EXPECT_EQ(HARD_ERR_INTERN_SAFETY_CYCLIC, threadRecord.hardErrorCode);
+  EXPECT_EQ(0u, mainRecord.stepCount);
+}
+
+// Event-driven safety task
+TEST_F(SafetyTest, TICKLESS_PROGFLOW_REFERENCE_PER_MEASUREMENT) {
+  TASK_PARA_STD param = {};
+
+  param.taskDelay = 10 * configTICK_RATE_HZ_MS;
+  ASSERT_TRUE(Safety_Runtime_Startup(&param));
+  EXPECT_EQ(1000u / SAFETY_TICKLESS_MEASUREMENT_PERIOD_MS, SafetyTestEnv_GetProgFlowReference());
+}
+
+TEST_F(SafetyTest, TICKLESS_PROGFLOW_COUNTS_EXECUTED_MEASUREMENTS) {
+  TASK_PARA_STD param = {};
+  SAFETY_POWERSUPPLY_CONFIG config = {};
+  SAFETY_HARDERROR_RECORD record;
+  U32 const periodTicks = SAFETY_TICKLESS_MEASUREMENT_PERIOD_MS * configTICK_RATE_HZ_MS;
+
+  param.taskDelay = 10 * configTICK_RATE_HZ_MS;
+  ASSERT_TRUE(SafetyTestEnv_AttachStlMemory());
+  ASSERT_TRUE(Safety_Runtime_Startup(&param));
+
+  Safety_HardErrorTrap_Arm(&record);
+  if (setjmp(record.jumpBuffer) == 0) {
+    Safety_Runtime_Init(&config);
+
+    // one second with a wake-up in every task delay
+    for (U32 ticks = 0; ticks < RTOS_TICK_RATE; ticks += param.taskDelay) {
+      SafetyTestEnv_SetTicks(ticks);
+      Safety_Runtime_Execute();
+    }
+    EXPECT_EQ(RTOS_TICK_RATE / periodTicks, SafetyTestEnv_GetProgFlowCycles());
+
+    // one second with a single late wake-up counts one measurement only
+    SafetyTestEnv_SetTicks(2 * RTOS_TICK_RATE);
+    Safety_Runtime_Execute();
+    EXPECT_EQ(RTOS_TICK_RATE / periodTicks + 1, SafetyTestEnv_GetProgFlowCycles());
+  }
+  Safety_HardErrorTrap_Disarm();
+  EXPECT_EQ(0u, record.stepCount) << "hard error " << (U32)record.hardErrorCode;
+}
+
+TEST_F(SafetyTest, TICKLESS_WAKEUP_AFTER_MEASUREMENT_PERIOD) {
+  TASK_PARA_STD param = {};
+  SAFETY_POWERSUPPLY_CONFIG config = {};
+  SAFETY_HARDERROR_RECORD record;
+  U32 nextWakeup = 0;
+
+  param.taskDelay = 10 * configTICK_RATE_HZ_MS;
+  ASSERT_TRUE(SafetyTestEnv_AttachStlMemory());
+  ASSERT_TRUE(Safety_Runtime_Startup(&param));
+
+  Safety_HardErrorTrap_Arm(&record);
+  if (setjmp(record.jumpBuffer) == 0) {
+    Safety_Runtime_Init(&config);
+    Safety_Runtime_Execute();
+    nextWakeup = Safety_Runtime_GetNextWakeupTicks(0);
+  }
+  Safety_HardErrorTrap_Disarm();
+  ASSERT_EQ(0u, record.stepCount) << "hard error " << (U32)record.hardErrorCode;
+
+  // sleeps longer than the task delay, at most until the next measurement
+  EXPECT_GT(nextWakeup, param.taskDelay);
+  EXPECT_LE(nextWakeup, SAFETY_TICKLESS_MEASUREMENT_PERIOD_MS * configTICK_RATE_HZ_MS);
+}
+
+// Load and timing statistics of the safety task
+TEST_F(SafetyTest, TASK_STATISTICS_EXECUTION_TIME_AND_OVERRUNS) {
+  SAFETY_TASK_STATISTICS statistics;
+
+  SafetyTestEnv_UpdateTaskStatistics(3, 0, 10, 10);
+  SafetyTestEnv_UpdateTaskStatistics(15, 0, 10, 10);
+  SafetyTestEnv_UpdateTaskStatistics(5, 0, 10, 10);
+
+  ASSERT_TRUE(Safety_Task_GetLoadStatistics(&statistics));
+  EXPECT_EQ(3u, statistics.cycles);
+  EXPECT_EQ(1u, statistics.overruns);
+  EXPECT_EQ(5u, statistics.lastExecutionTime);
+  EXPECT_EQ(15u, statistics.maxExecutionTime);
+  // without a known period no jitter is recorded
+  EXPECT_EQ(0u, statistics.maxJitter);
+  for (U32 i = 0; i < SAFETY_TASK_STAT_JITTER_BUCKETS; i++) {
+    EXPECT_EQ(0u, statistics.jitterHistogram[i]);
+  }
+}
+
+TEST_F(SafetyTest, TASK_STATISTICS_JITTER_HISTOGRAM) {
+  SAFETY_TASK_STATISTICS statistics;
+  U32 const width = SAFETY_TASK_STAT_JITTER_BUCKET_WIDTH;
+
+  SafetyTestEnv_UpdateTaskStatistics(1, 10 * width, 10 * width, 10 * width);
+  SafetyTestEnv_UpdateTaskStatistics(1, 12 * width, 10 * width, 10 * width);
+  SafetyTestEnv_UpdateTaskStatistics(1, 8 * width, 10 * width, 10 * width);
+  SafetyTestEnv_UpdateTaskStatistics(1, 100 * width, 10 * width, 10 * width);
+
+  ASSERT_TRUE(Safety_Task_GetLoadStatistics(&statistics));
+  EXPECT_EQ(1u, statistics.jitterHistogram[0]);
+  // early and late wake-ups count alike
+  EXPECT_EQ(2u, statistics.jitterHistogram[2]);
+  // the last bucket counts all larger values
+  EXPECT_EQ(1u, statistics.jitterHistogram[SAFETY_TASK_STAT_JITTER_BUCKETS - 1]);
+  EXPECT_EQ(90u * width, statistics.maxJitter);
+}
+
+TEST_F(SafetyTest, TASK_STATISTICS_CPU_LOAD_PER_WINDOW) {
+  SAFETY_TASK_STATISTICS statistics;
+  U32 const period = 10 * configTICK_RATE_HZ_MS * SAFETY_TASK_STAT_TIMESTAMP_PER_TICK;
+  U32 const cyclesPerWindow = SAFETY_TASK_STAT_LOAD_WINDOW_MS / 10;
+
+  // 10 % load, the value is published at the end of the window
+  for (U32 cycle = 0; cycle < cyclesPerWindow - 1; cycle++) {
+    SafetyTestEnv_UpdateTaskStatistics(period / 10, period, period, period);
+  }
+  ASSERT_TRUE(Safety_Task_GetLoadStatistics(&statistics));
+  EXPECT_EQ(0u, statistics.cpuLoadPermille);
+
+  SafetyTestEnv_UpdateTaskStatistics(period / 10, period, period, period);
+  ASSERT_TRUE(Safety_Task_GetLoadStatistics(&statistics));
+  EXPECT_EQ(100u, statistics.cpuLoadPermille);
+
+  // an execution longer than the period counts as full load
+  for (U32 cycle = 0; cycle < cyclesPerWindow; cycle++) {
+    SafetyTestEnv_UpdateTaskStatistics(2 * period, period, period, period);
+  }
+  ASSERT_TRUE(Safety_Task_GetLoadStatistics(&statistics));
+  EXPECT_EQ(1000u, statistics.cpuLoadPermille);
+  EXPECT_EQ(cyclesPerWindow, statistics.overruns);
+}
+
+TEST_F(SafetyTest, TASK_STATISTICS_RESET_IN_NEXT_CYCLE) {
+  SAFETY_TASK_STATISTICS statistics;
+
+  SafetyTestEnv_UpdateTaskStatistics(15, 20, 10, 10);
+  Safety_Task_ResetLoadStatistics();
+
+  // the safety task resets the statistics in its next cycle
+  ASSERT_TRUE(Safety_Task_GetLoadStatistics(&statistics));
+  EXPECT_EQ(1u, statistics.cycles);
+
+  SafetyTestEnv_UpdateTaskStatistics(2, 10, 10, 10);
+  ASSERT_TRUE(Safety_Task_GetLoadStatistics(&statistics));
+  EXPECT_EQ(1u, statistics.cycles);
+  EXPECT_EQ(0u, statistics.overruns);
+  EXPECT_EQ(2u, statistics.maxExecutionTime);
+  EXPECT_EQ(0u, statistics.maxJitter);
+}
+
+TEST_F(SafetyTest, TASK_STATISTICS_REJECTS_NULL) {
+  EXPECT_FALSE(Safety_Task_GetLoadStatistics(NULL));
+}
+
+// Runtime checks
+static U32 customCheckCalls = 0;
+
+extern "C" void Safety_Runtime_Custom_CyclicCheck(void) {
+  customCheckCalls++;
+}
+
+TEST_F(SafetyTest, RUNTIME_CUSTOM_CHECK_IN_EVERY_CYCLE) {
+  TASK_PARA_STD param = {};
+  SAFETY_POWERSUPPLY_CONFIG config = {};
+  SAFETY_HARDERROR_RECORD record;
+
+  customCheckCalls = 0;
+  param.taskDelay = 10 * configTICK_RATE_HZ_MS;
+  ASSERT_TRUE(SafetyTestEnv_AttachStlMemory());
+  ASSERT_TRUE(Safety_Runtime_Startup(&param));
+
+  Safety_HardErrorTrap_Arm(&record);
+  if (setjmp(record.jumpBuffer) == 0) {
+    Safety_Runtime_Init(&config);
+    for (U32 cycle = 0; cycle < 3; cycle++) {
+      SafetyTestEnv_SetTicks(cycle * param.taskDelay);
+      Safety_Runtime_Execute();
+    }
+  }
+  Safety_HardErrorTrap_Disarm();
+
+  EXPECT_EQ(0u, record.stepCount) << "hard error " << (U32)record.hardErrorCode;
+  EXPECT_EQ(3u, customCheckCalls);
+}
+
+TEST_F(SafetyTest, RUNTIME_POWERSUPPLY_NOT_INITIALIZED_IS_HARD_ERROR) {
+  TASK_PARA_STD param = {};
+  SAFETY_HARDERROR_RECORD initRecord;
+  SAFETY_HARDERROR_RECORD record;
+
+  param.taskDelay = 10 * configTICK_RATE_HZ_MS;
+  ASSERT_TRUE(SafetyTestEnv_AttachStlMemory());
+  ASSERT_TRUE(Safety_Runtime_Startup(&param));
+
+  // without a configuration the power supply monitoring is not initialized
+  Safety_HardErrorTrap_Arm(&initRecord);
+  if (setjmp(initRecord.jumpBuffer) == 0) {
+    Safety_Runtime_Init(NULL);
+  }
+  Safety_HardErrorTrap_Disarm();
+  ASSERT_EQ(HARD_ERR_SAFETY_INIT, initRecord.hardErrorCode);
+
+  // the runtime check reports the result of the monitoring
+  Safety_HardErrorTrap_Arm(&record);
+  if (setjmp(record.jumpBuffer) == 0) {
+    Safety_Runtime_Execute();
+  }
+  Safety_HardErrorTrap_Disarm();
+  EXPECT_EQ(HARD_ERR_SAFETY_MEASUREMENT, record.hardErrorCode);
+}
+
+// Configuration register monitoring
+TEST_F(SafetyTest, REGISTER_EXPECTED_VALUE_FROM_CONFIGURATION) {
+  static U32 const configuration[3] = { 0x11, 0x22, 0x33 };
+  U32 registers[3] = { 0x11, 0x22, 0x33 };
+  SAFETY_REGISTER_BLOCK const block = { registers, configuration, 3, 0xFFFFFFFFu };
+  SAFETY_REGISTER_ID id;
+
+  ASSERT_TRUE(Safety_Register_AddBlock(&block, &id));
+  EXPECT_TRUE(Safety_Register_Check(0));
+
+  registers[1] = 0x23;
+  EXPECT_FALSE(Safety_Register_Check(1));
+}
+
+TEST_F(SafetyTest, REGISTER_WRONG_CONFIGURATION_AT_REGISTRATION) {
+  static U32 const configuration[2] = { 0x11, 0x22 };
+  U32 registers[2] = { 0x11, 0x20 };
+  SAFETY_REGISTER_BLOCK const block = { registers, configuration, 2, 0xFFFFFFFFu };
+  SAFETY_REGISTER_ID id;
+
+  // the registers did not take the configuration before the registration
+  ASSERT_TRUE(Safety_Register_AddBlock(&block, &id));
+  EXPECT_FALSE(Safety_Register_Check(0));
+}
+
+TEST_F(SafetyTest, REGISTER_MASKED_BITS_IGNORED) {
+  static U32 const configuration[1] = { 0x0F };
+  U32 registers[1] = { 0x0F };
+  SAFETY_REGISTER_BLOCK const block = { registers, configuration, 1, 0x0000FFFFu };
+  SAFETY_REGISTER_ID id;
+
+  ASSERT_TRUE(Safety_Register_AddBlock(&block, &id));
+
+  // status bits outside the mask
+  registers[0] = 0x800F000Fu;
+  EXPECT_TRUE(Safety_Register_Check(0));
+
+  registers[0] = 0x0000000Eu;
+  EXPECT_FALSE(Safety_Register_Check(1));
+}
+
+TEST_F(SafetyTest, REGISTER_UPDATE_WITH_NEW_CONFIGURATION) {
+  static U32 const configuration[1] = { 0x01 };
+  static U32 const reconfiguration[1] = { 0x02 };
+  U32 registers[1] = { 0x01 };
+  SAFETY_REGISTER_BLOCK const block = { registers, configuration, 1, 0xFFFFFFFFu };
+  SAFETY_REGISTER_ID id;
+
+  ASSERT_TRUE(Safety_Register_AddBlock(&block, &id));
+  EXPECT_FALSE(Safety_Register_UpdateBlock(id, NULL));
+  EXPECT_FALSE(Safety_Register_UpdateBlock(SAFETY_REGISTER_BLOCKS_MAX, reconfiguration));
+
+  registers[0] = 0x02;
+  ASSERT_TRUE(Safety_Register_UpdateBlock(id, reconfiguration));
+  EXPECT_TRUE(Safety_Register_Check(0));
+}
+
+TEST_F(SafetyTest, REGISTER_REJECTS_INVALID_BLOCK) {
+  static U32 const configuration[1] = { 0x01 };
+  U32 registers[1] = { 0x01 };
+  SAFETY_REGISTER_BLOCK const withoutConfiguration = { registers, NULL, 1, 0xFFFFFFFFu };
+  SAFETY_REGISTER_BLOCK const empty = { registers, configuration, 0, 0xFFFFFFFFu };
+  SAFETY_REGISTER_ID id;
+
+  EXPECT_FALSE(Safety_Register_AddBlock(&withoutConfiguration, &id));
+  EXPECT_FALSE(Safety_Register_AddBlock(&empty, &id));
+}
+
+TEST_F(SafetyTest, REGISTER_ALL_BLOCKS_WITHIN_PASS_TIME) {
+  static U32 const configuration[1] = { 0x01 };
+  U32 registers[4] = { 0x01, 0x01, 0x01, 0x01 };
+  U32 const passTimeTicks = SAFETY_REGISTER_PASS_TIME_MS * configTICK_RATE_HZ_MS;
+  SAFETY_REGISTER_ID id;
+
+  for (U32 i = 0; i < 4; i++) {
+    SAFETY_REGISTER_BLOCK const block = { &registers[i], configuration, 1, 0xFFFFFFFFu };
+    ASSERT_TRUE(Safety_Register_AddBlock(&block, &id));
+  }
+
+  // the first cycle checks one block only
+  registers[3] = 0x00;
+  EXPECT_TRUE(Safety_Register_Check(0));
+
+  // the last block is checked at the end of the pass time at the latest
+  EXPECT_FALSE(Safety_Register_Check(passTimeTicks));
+}
+
+// External ADC frames
+TEST_F(SafetyTest, EXTERNAL_ADC_FRAME_READ_CURRENT_VALUE) {
+  F32 value = 0.0f;
+
+  SafetyTestEnv_SetExternalAdcValue(MAX116XX_POS_12CHANNEL_ADC, 2, 1.5f);
+  ASSERT_TRUE(SafetyTestEnv_ReadExternalAdcValue(MAX116XX_POS_12CHANNEL_ADC, 2, &value));
+  EXPECT_EQ(1.5f, value);
+
+  SafetyTestEnv_SetExternalAdcValue(MAX116XX_POS_12CHANNEL_ADC, 2, 2.5f);
+  ASSERT_TRUE(SafetyTestEnv_ReadExternalAdcValue(MAX116XX_POS_12CHANNEL_ADC, 2, &value));
+  EXPECT_EQ(2.5f, value);
+}
+
+TEST_F(SafetyTest, EXTERNAL_ADC_FRAME_NO_VALUE_OF_UNPUBLISHED_FRAME) {
+  F32 value = 0.0f;
+
+  SafetyTestEnv_SetExternalAdcValue(MAX116XX_POS_12CHANNEL_ADC, 0, 1.0f);
+
+  // the frame being read is written again after a publication during the read
+  SafetyTestEnv_PublishExternalAdcDuringRead(MAX116XX_POS_12CHANNEL_ADC, 0, 2.0f, 99.0f);
+  ASSERT_TRUE(SafetyTestEnv_ReadExternalAdcValue(MAX116XX_POS_12CHANNEL_ADC, 0, &value));
+  EXPECT_EQ(2.0f, value);
+}
+
+// Deprecated averages of the external ADC channels
+TEST_F(SafetyTest, EXTERNAL_ADC_DEPRECATED_AVERAGES) {
+  SAFETY_POWERSUPPLY_CONFIG config = {};
+  SAFETY_HARDERROR_RECORD record;
+  F32 voltage = 0.0f;
+
+  config.voltageExternalAdcChannel1IsActive = 1;
+  config.voltageExternalAdcChannel2IsActive = 1;
+  config.voltageExternalAdcChannel3IsActive = 1;
+  SafetyTestEnv_SetExternalAdcValue(MAX116XX_POS_12CHANNEL_ADC, EXT_ADC_CHANNEL1_TO_CHECK_CHANNEL, 1.0f);
+
+  Safety_HardErrorTrap_Arm(&record);
+  if (setjmp(record.jumpBuffer) == 0) {
+    ASSERT_TRUE(Safety_Powersuply_Init(&config));
+    for (U32 cycle = 0; cycle < 2 * SYSPWR_NUM_VALUES; cycle++) {
+      SafetyTestEnv_AdvanceTicks(10 * configTICK_RATE_HZ_MS);
+      Safety_Powersupply_Check();
+    }
+  }
+  Safety_HardErrorTrap_Disarm();
+  ASSERT_EQ(0u, record.stepCount) << "hard error " << (U32)record.hardErrorCode;
+
+  ASSERT_TRUE(Safety_Powersupply_GetExternalAdcVoltage(0, &voltage));
+  EXPECT_NEAR(3.072f, voltage, 0.001f);
+  EXPECT_EQ(voltage, tVCCExternalAdcChannel1Avg);
+  EXPECT_EQ(voltage, tVCCExternalAdcChannel2Avg);
+  EXPECT_EQ(voltage, tVCCExternalAdcChannel3Avg);
+}
+
+TEST_F(SafetyTest, VCC_LOW_TIME_ACCUMULATED_ACROSS_DROPOUTS) {
+  SAFETY_POWERSUPPLY_CONFIG config = {};
+  SAFETY_HARDERROR_RECORD record;
+  SAFETY_TEST_ENV_ERROR_EVENT errorEvent = {};
+  U32 dropoutEvents = 0;
+
+  // the events are forwarded after each cycle like by the forwarding task
+  config.supplyVoltageIsActive = 1;
+  SafetyTestEnv_SetPinVoltage(fpADCIN_VCC, 1.42f);
+
+  Safety_HardErrorTrap_Arm(&record);
+  if (setjmp(record.jumpBuffer) == 0) {
+    ASSERT_TRUE(Safety_Powersuply_Init(&config));
+    for (U32 cycle = 0; cycle < 2 * SYSPWR_NUM_VALUES; cycle++) {
+      SafetyTestEnv_AdvanceTicks(10 * configTICK_RATE_HZ_MS);
+      Safety_Powersupply_Check();
+      Safety_Event_Process(SAFETY_EVENT_PROCESS_MAX_EVENTS);
+    }
+    ASSERT_EQ(0u, SafetyTestEnv_GetErrorEventCount());
+
+    // short dropout below the timeout, reported when the voltage returns
+    SafetyTestEnv_SetPinVoltage(fpADCIN_VCC, 0.0f);
+    for (U32 cycle = 0; cycle < SYSPWR_NUM_VALUES; cycle++) {
+      SafetyTestEnv_AdvanceTicks(10 * configTICK_RATE_HZ_MS);
+      Safety_Powersupply_Check();
+      Safety_Event_Process(SAFETY_EVENT_PROCESS_MAX_EVENTS);
+    }
+    SafetyTestEnv_SetPinVoltage(fpADCIN_VCC, 1.42f);
+    for (U32 cycle = 0; cycle < 2 * SYSPWR_NUM_VALUES; cycle++) {
+      SafetyTestEnv_AdvanceTicks(10 * configTICK_RATE_HZ_MS);
+      Safety_Powersupply_Check();
+      Safety_Event_Process(SAFETY_EVENT_PROCESS_MAX_EVENTS);
+    }
+    ASSERT_TRUE(SafetyTestEnv_GetLastErrorEvent(&errorEvent));
+    EXPECT_EQ((U8)eERROR_VOLTAGE_VCC_DROPOUT, errorEvent.intermediate);
+    dropoutEvents = SafetyTestEnv_GetErrorEventCount();
+
+    // the second short dropout adds to the undervoltage time of the first
+    SafetyTestEnv_SetPinVoltage(fpADCIN_VCC, 0.0f);
+    for (U32 cycle = 0; cycle < SYSPWR_NUM_VALUES; cycle++) {
+      SafetyTestEnv_AdvanceTicks(10 * configTICK_RATE_HZ_MS);
+      Safety_Powersupply_Check();
+      Safety_Event_Process(SAFETY_EVENT_PROCESS_MAX_EVENTS);
+    }
+  }
+  Safety_HardErrorTrap_Disarm();
+  ASSERT_EQ(0u, record.stepCount) << "hard error " << (U32)record.hardErrorCode;
+
+  EXPECT_EQ(dropoutEvents + 1, SafetyTestEnv_GetErrorEventCount());
+  ASSERT_TRUE(SafetyTestEnv_GetLastErrorEvent(&errorEvent));
+  EXPECT_EQ((U8)eERROR_VOLTAGE_EXCEEDED_MIN, errorEvent.intermediate);
+}
+
+// Startup of the measurement sources
+/// Runs cycles of Safety_Powersupply_Check() in steps of 1 ms until a hard error
+/// or the given time after the start of the test.
+static void RunPowersupplyUntil(SAFETY_HARDERROR_RECORD &record, U32 const endMs) {
+  while (SafetyTestEnv_GetTicks() < endMs * configTICK_RATE_HZ_MS) {
+    SafetyTestEnv_AdvanceTicks(configTICK_RATE_HZ_MS);
+    Safety_Powersupply_Check();
+    if (record.stepCount != 0u) {
+      break;
+    }
+  }
+}
+
+TEST_F(SafetyTest, POWERSUPPLY_ADC_STARTS_AFTER_STARTUP_DELAY) {
+  SAFETY_POWERSUPPLY_CONFIG config = {};
+  SAFETY_HARDERROR_RECORD record;
+  SAFETY_POWERSUPPLY_STATISTICS statistics;
+
+  config.supplyVoltageIsActive = 1;
+  SafetyTestEnv_SetPinVoltage(fpADCIN_VCC, 1.42f);
+
+  Safety_HardErrorTrap_Arm(&record);
+  if (setjmp(record.jumpBuffer) == 0) {
+    ASSERT_TRUE(Safety_Powersuply_Init(&config));
+    RunPowersupplyUntil(record, SYSPWR_STARTUP_DELAY_MS - 1u);
+    EXPECT_FALSE(Safety_Powersupply_IsSourceReady(eSAFETY_POWERSUPPLY_SOURCE_ADC));
+    ASSERT_TRUE(Safety_Powersupply_GetStatistics(eSAFETY_POWERSUPPLY_STAT_VCC, &statistics));
+    EXPECT_EQ(0u, statistics.total.count);
+
+    // without a signal the channels of the internal ADC start after the delay
+    RunPowersupplyUntil(record, SYSPWR_STARTUP_DELAY_MS);
+    EXPECT_TRUE(Safety_Powersupply_IsSourceReady(eSAFETY_POWERSUPPLY_SOURCE_ADC));
+    ASSERT_TRUE(Safety_Powersupply_GetStatistics(eSAFETY_POWERSUPPLY_STAT_VCC, &statistics));
+    EXPECT_EQ(1u, statistics.total.count);
+  }
+  Safety_HardErrorTrap_Disarm();
+  ASSERT_EQ(0u, record.stepCount) << "hard error " << (U32)record.hardErrorCode;
+}
+
+TEST_F(SafetyTest, POWERSUPPLY_ADC_STARTS_EARLY_WHEN_READY) {
+  SAFETY_POWERSUPPLY_CONFIG config = {};
+  SAFETY_HARDERROR_RECORD record;
+  SAFETY_POWERSUPPLY_STATISTICS statistics;
+
+  config.supplyVoltageIsActive = 1;
+  SafetyTestEnv_SetPinVoltage(fpADCIN_VCC, 1.42f);
+
+  Safety_HardErrorTrap_Arm(&record);
+  if (setjmp(record.jumpBuffer) == 0) {
+    // the signal before the initialization is kept
+    Safety_Powersupply_SignalSourceReady(eSAFETY_POWERSUPPLY_SOURCE_ADC);
+    ASSERT_TRUE(Safety_Powersuply_Init(&config));
+    EXPECT_TRUE(Safety_Powersupply_IsSourceReady(eSAFETY_POWERSUPPLY_SOURCE_ADC));
+    EXPECT_FALSE(Safety_Powersupply_IsSourceReady(eSAFETY_POWERSUPPLY_SOURCE_TMP144));
+    EXPECT_FALSE(Safety_Powersupply_IsSourceReady(eSAFETY_POWERSUPPLY_SOURCE_COUNT));
+
+    RunPowersupplyUntil(record, 1u);
+    ASSERT_TRUE(Safety_Powersupply_GetStatistics(eSAFETY_POWERSUPPLY_STAT_VCC, &statistics));
+    EXPECT_EQ(1u, statistics.total.count);
+  }
+  Safety_HardErrorTrap_Disarm();
+  ASSERT_EQ(0u, record.stepCount) << "hard error " << (U32)record.hardErrorCode;
+}
+
+TEST_F(SafetyTest, POWERSUPPLY_TMP144_STARTUP_TIMEOUT) {
+  SAFETY_POWERSUPPLY_CONFIG config = {};
+  SAFETY_HARDERROR_RECORD record;
+
+  config.temperatureSensorIsActive = 1;
+  SafetyTestEnv_SetTemperatureValid(false);
+
+  // no value of the sensor within its own startup time
+  Safety_HardErrorTrap_Arm(&record);
+  if (setjmp(record.jumpBuffer) == 0) {
+    ASSERT_TRUE(Safety_Powersuply_Init(&config));
+    RunPowersupplyUntil(record, 2u * WAIT_TMP144_STARTUP_MS);
+  }
+  Safety_HardErrorTrap_Disarm();
+  ASSERT_NE(0u, record.stepCount);
+  EXPECT_EQ(HARD_ERR_SAFETY_MEASUREMENT, record.hardErrorCode);
+  EXPECT_FALSE(record.isPermanent);
+  EXPECT_EQ(WAIT_TMP144_STARTUP_MS * configTICK_RATE_HZ_MS, SafetyTestEnv_GetTicks());
+  EXPECT_FALSE(Safety_Powersupply_IsSourceReady(eSAFETY_POWERSUPPLY_SOURCE_TMP144));
+}
+
+TEST_F(SafetyTest, POWERSUPPLY_TMP144_NO_TOLERANCE_AFTER_FIRST_VALUE) {
+  SAFETY_POWERSUPPLY_CONFIG config = {};
+  SAFETY_HARDERROR_RECORD record;
+
+  config.temperatureSensorIsActive = 1;
+
+  Safety_HardErrorTrap_Arm(&record);
+  if (setjmp(record.jumpBuffer) == 0) {
+    ASSERT_TRUE(Safety_Powersuply_Init(&config));
+    RunPowersupplyUntil(record, 10u);
+    EXPECT_TRUE(Safety_Powersupply_IsSourceReady(eSAFETY_POWERSUPPLY_SOURCE_TMP144));
+
+    // the first missing value after the start is a hard error
+    SafetyTestEnv_SetTemperatureValid(false);
+    RunPowersupplyUntil(record, WAIT_TMP144_STARTUP_MS);
+  }
+  Safety_HardErrorTrap_Disarm();
+  ASSERT_NE(0u, record.stepCount);
+  EXPECT_EQ(HARD_ERR_SAFETY_MEASUREMENT, record.hardErrorCode);
+  EXPECT_EQ(11u * configTICK_RATE_HZ_MS, SafetyTestEnv_GetTicks());
+}
+
+TEST_F(SafetyTest, POWERSUPPLY_EXTERNAL_ADC_STARTUP_TIMEOUT) {
+  SAFETY_POWERSUPPLY_CONFIG config = {};
+  SAFETY_HARDERROR_RECORD record;
+
+  config.supplyVoltageIsActive = 1;
+  SafetyTestEnv_SetPinVoltage(fpADCIN_VCC, 1.42f);
+  SafetyTestEnv_WithholdExternalAdc();
+
+  // no frame of the external ADC task within its own startup time
+  Safety_HardErrorTrap_Arm(&record);
+  if (setjmp(record.jumpBuffer) == 0) {
+    ASSERT_TRUE(Safety_Powersuply_Init(&config));
+    RunPowersupplyUntil(record, 2u * WAIT_EXTERNAL_ADC_STARTUP_MS);
+  }
+  Safety_HardErrorTrap_Disarm();
+  ASSERT_NE(0u, record.stepCount);
+  EXPECT_EQ(HARD_ERR_SAFETY_MEASUREMENT, record.hardErrorCode);
+  EXPECT_TRUE(record.isPermanent);
+  EXPECT_EQ(WAIT_EXTERNAL_ADC_STARTUP_MS * configTICK_RATE_HZ_MS, SafetyTestEnv_GetTicks());
+}
+
+TEST_F(SafetyTest, POWERSUPPLY_EXTERNAL_ADC_READY_WITH_FIRST_FRAME) {
+  SAFETY_POWERSUPPLY_CONFIG config = {};
+  SAFETY_HARDERROR_RECORD record;
+
+  config.supplyVoltageIsActive = 1;
+  SafetyTestEnv_SetPinVoltage(fpADCIN_VCC, 1.42f);
+  SafetyTestEnv_WithholdExternalAdc();
+
+  Safety_HardErrorTrap_Arm(&record);
+  if (setjmp(record.jumpBuffer) == 0) {
+    ASSERT_TRUE(Safety_Powersuply_Init(&config));
+    RunPowersupplyUntil(record, WAIT_EXTERNAL_ADC_STARTUP_MS / 2u);
+    EXPECT_FALSE(Safety_Powersupply_IsSourceReady(eSAFETY_POWERSUPPLY_SOURCE_EXTERNAL_ADC));
+
+    // the first frame starts the monitoring before the timeout, the time
+    // after the timeout passes without error
+    SafetyTestEnv_SetExternalAdcValue(MAX116XX_POS_12CHANNEL_ADC, EXT_ADC_CHANNEL1_TO_CHECK_CHANNEL, 1.0f);
+    RunPowersupplyUntil(record, WAIT_EXTERNAL_ADC_STARTUP_MS / 2u + 1u);
+    EXPECT_TRUE(Safety_Powersupply_IsSourceReady(eSAFETY_POWERSUPPLY_SOURCE_EXTERNAL_ADC));
+    RunPowersupplyUntil(record, 2u * WAIT_EXTERNAL_ADC_STARTUP_MS);
+  }
+  Safety_HardErrorTrap_Disarm();
+  ASSERT_EQ(0u, record.stepCount) << "hard error " << (U32)record.hardErrorCode;
+}
+
+// Measurement filters
+TEST_F(SafetyTest, FILTER_IIR_SHIFT_EQUIVALENT_TO_AVERAGE) {
+  // alpha = 1 / 2^shift nearest to 2 / (N + 1)
+  EXPECT_EQ(0u, Safety_Filter_IirShiftForAverage(1));
+  EXPECT_EQ(1u, Safety_Filter_IirShiftForAverage(3));
+  EXPECT_EQ(2u, Safety_Filter_IirShiftForAverage(8));
+  EXPECT_EQ(3u, Safety_Filter_IirShiftForAverage(16));
+  EXPECT_EQ(5u, Safety_Filter_IirShiftForAverage(64));
+  EXPECT_EQ(SAFETY_FILTER_IIR_SHIFT_MAX, Safety_Filter_IirShiftForAverage(0xFFFFFFFEu));
+}
+
+TEST_F(SafetyTest, FILTER_IIR_REJECTS_INVALID_PARAMETERS) {
+  SAFETY_FILTER_IIR filter;
+  SAFETY_FILTER_IIR_F32 filterF32;
+
+  EXPECT_FALSE(Safety_Filter_IirInit(NULL, 2, 8));
+  EXPECT_FALSE(Safety_Filter_IirInit(&filter, SAFETY_FILTER_IIR_SHIFT_MAX + 1, 8));
+  EXPECT_FALSE(Safety_Filter_IirInit(&filter, 2, 0));
+  EXPECT_FALSE(Safety_Filter_IirInitF32(NULL, 2, 8));
+  EXPECT_FALSE(Safety_Filter_IirInitF32(&filterF32, SAFETY_FILTER_IIR_SHIFT_MAX + 1, 8));
+  EXPECT_FALSE(Safety_Filter_IirInitF32(&filterF32, 2, 0));
+}
+
+TEST_F(SafetyTest, FILTER_IIR_FIRST_VALUE_INITIALIZES) {
+  SAFETY_FILTER_IIR filter;
+
+  ASSERT_TRUE(Safety_Filter_IirInit(&filter, 3, 8));
+  Safety_Filter_IirUpdate(&filter, 24000);
+  EXPECT_EQ(24000, Safety_Filter_IirGet(&filter));
+  for (U32 i = 1; i < 8; i++) {
+    EXPECT_FALSE(Safety_Filter_IirIsValid(&filter));
+    Safety_Filter_IirUpdate(&filter, 24000);
+    EXPECT_EQ(24000, Safety_Filter_IirGet(&filter));
+  }
+  EXPECT_TRUE(Safety_Filter_IirIsValid(&filter));
+}
+
+TEST_F(SafetyTest, FILTER_IIR_STEP_RESPONSE) {
+  SAFETY_FILTER_IIR filter;
+  SAFETY_FILTER_IIR_F32 filterF32;
+  double expected = 1000.0;
+
+  ASSERT_TRUE(Safety_Filter_IirInit(&filter, 2, 1));
+  ASSERT_TRUE(Safety_Filter_IirInitF32(&filterF32, 2, 1));
+  Safety_Filter_IirUpdate(&filter, 1000);
+  Safety_Filter_IirUpdateF32(&filterF32, 1000.0f);
+
+  // single pole with alpha = 1/4, the fixed point output follows within rounding
+  for (U32 i = 0; i < 20; i++) {
+    expected += (-2000.0 - expected) / 4.0;
+    Safety_Filter_IirUpdate(&filter, -2000);
+    Safety_Filter_IirUpdateF32(&filterF32, -2000.0f);
+    EXPECT_NEAR(expected, Safety_Filter_IirGet(&filter), 1.0) << "step " << i;
+    EXPECT_NEAR(expected, Safety_Filter_IirGetF32(&filterF32), 0.01) << "step " << i;
+  }
+
+  // the fixed point filter settles at the input without a remaining offset
+  for (U32 i = 0; i < 20; i++) {
+    Safety_Filter_IirUpdate(&filter, -2000);
+  }
+  EXPECT_EQ(-2000, Safety_Filter_IirGet(&filter));
+  for (U32 i = 0; i < 40; i++) {
+    Safety_Filter_IirUpdate(&filter, 2001);
+  }
+  EXPECT_EQ(2001, Safety_Filter_IirGet(&filter));
+}
+
+TEST_F(SafetyTest, FILTER_MEDIAN_KERNELS_ALL_PERMUTATIONS) {
+  // distinct values and repeated values in every order, negative values included
+  S32 const sets[][7] = {{-3, -1, 0, 2, 5, 9, 100}, {4, 4, 4, -7, -7, 12, 12}};
+
+  for (auto const &set : sets) {
+    for (U32 size = 3; size <= 7; size += 2) {
+      S32 values[7];
+      std::copy(set, set + size, values);
+      std::sort(values, values + size);
+      do {
+        S32 sorted[7];
+        S32 median;
+        std::copy(values, values + size, sorted);
+        std::nth_element(sorted, sorted + size / 2, sorted + size);
+        median = (size == 3) ? Safety_Filter_Median3(values)
+                 : (size == 5) ? Safety_Filter_Median5(values) : Safety_Filter_Median7(values);
+        ASSERT_EQ(sorted[size / 2], median) << "size " << size;
+      } while (std::next_permutation(values, values + size));
+    }
+  }
+}
+
+TEST_F(SafetyTest, FILTER_MEDIAN_REJECTS_INVALID_SIZE) {
+  SAFETY_FILTER_MEDIAN filter;
+
+  EXPECT_FALSE(Safety_Filter_MedianInit(NULL, 3));
+  EXPECT_FALSE(Safety_Filter_MedianInit(&filter, 1));
+  EXPECT_FALSE(Safety_Filter_MedianInit(&filter, 4));
+  EXPECT_FALSE(Safety_Filter_MedianInit(&filter, SAFETY_FILTER_MEDIAN_MAX + 2));
+}
+
+TEST_F(SafetyTest, FILTER_MEDIAN_REJECTS_SPIKES) {
+  SAFETY_FILTER_MEDIAN filter;
+
+  ASSERT_TRUE(Safety_Filter_MedianInit(&filter, 5));
+
+  // the first value fills the window
+  EXPECT_EQ(24000, Safety_Filter_MedianUpdate(&filter, 24000));
+
+  // up to two glitches within the window do not reach the output
+  EXPECT_EQ(24000, Safety_Filter_MedianUpdate(&filter, 0));
+  EXPECT_EQ(24000, Safety_Filter_MedianUpdate(&filter, 60000));
+  for (U32 i = 0; i < 3; i++) {
+    EXPECT_EQ(24000, Safety_Filter_MedianUpdate(&filter, 24000));
+  }
+
+  // a dropout longer than half the window is passed after three values
+  EXPECT_EQ(24000, Safety_Filter_MedianUpdate(&filter, 0));
+  EXPECT_EQ(24000, Safety_Filter_MedianUpdate(&filter, 0));
+  EXPECT_EQ(0, Safety_Filter_MedianUpdate(&filter, 0));
+}
+
+// population statistics of values[first..end) in double precision
+static void ReferenceStatistics(std::vector<S32> const &values, size_t first, SAFETY_FILTER_STAT_VALUES *reference,
+                                double *variance) {
+  double mean = 0.0;
+  double m2 = 0.0;
+
+  reference->count = (U32)(values.size() - first);
+  reference->min = *std::min_element(values.begin() + first, values.end());
+  reference->max = *std::max_element(values.begin() + first, values.end());
+  for (size_t i = first; i < values.size(); i++) {
+    mean += values[i];
+  }
+  mean /= reference->count;
+  for (size_t i = first; i < values.size(); i++) {
+    m2 += (values[i] - mean) * (values[i] - mean);
+  }
+  reference->mean = (S32)std::lround(mean);
+  *variance = m2 / reference->count;
+}
+
+TEST_F(SafetyTest, FILTER_STAT_MATCHES_REFERENCE) {
+  SAFETY_FILTER_STAT stat;
+  SAFETY_FILTER_STAT_VALUES total;
+  SAFETY_FILTER_STAT_VALUES window;
+  SAFETY_FILTER_STAT_VALUES reference;
+  std::vector<S32> values;
+  double variance;
+  U32 random = 12345u;
+
+  ASSERT_TRUE(Safety_Filter_StatInit(&stat, 64));
+
+  // supply voltage with ripple around 24 V in mV
+  for (U32 i = 0; i < 1000; i++) {
+    random = random * 1103515245u + 12345u;
+    values.push_back(24000 + (S32)((random >> 16) % 2001u) - 1000);
+    Safety_Filter_StatUpdate(&stat, values.back());
+  }
+  Safety_Filter_StatGet(&stat, &total, &window);
+
+  ReferenceStatistics(values, 0, &reference, &variance);
+  EXPECT_EQ(reference.count, total.count);
+  EXPECT_EQ(reference.min, total.min);
+  EXPECT_EQ(reference.max, total.max);
+  EXPECT_NEAR(reference.mean, total.mean, 1);
+  EXPECT_NEAR(variance, total.variance, variance * 0.001);
+
+  // the window covers the completed and the current block
+  ASSERT_GT(window.count, 64u);
+  ASSERT_LE(window.count, 128u);
+  ReferenceStatistics(values, values.size() - window.count, &reference, &variance);
+  EXPECT_EQ(reference.min, window.min);
+  EXPECT_EQ(reference.max, window.max);
+  EXPECT_NEAR(reference.mean, window.mean, 1);
+  EXPECT_NEAR(variance, window.variance, variance * 0.001);
+}
+
+TEST_F(SafetyTest, FILTER_STAT_WINDOW_FORGETS_OLD_VALUES) {
+  SAFETY_FILTER_STAT stat;
+  SAFETY_FILTER_STAT_VALUES total;
+  SAFETY_FILTER_STAT_VALUES window;
+
+  EXPECT_FALSE(Safety_Filter_StatInit(NULL, 4));
+  EXPECT_FALSE(Safety_Filter_StatInit(&stat, 0));
+  ASSERT_TRUE(Safety_Filter_StatInit(&stat, 4));
+
+  Safety_Filter_StatGet(&stat, &total, &window);
+  EXPECT_EQ(0u, total.count);
+  EXPECT_EQ(0u, window.count);
+
+  // a dropout, then constant values for more than two blocks
+  Safety_Filter_StatUpdate(&stat, 0);
+  for (U32 i = 0; i < 9; i++) {
+    Safety_Filter_StatUpdate(&stat, 24000);
+  }
+  Safety_Filter_StatGet(&stat, &total, &window);
+  EXPECT_EQ(10u, total.count);
+  EXPECT_EQ(0, total.min);
+  EXPECT_EQ(21600, total.mean);
+  EXPECT_NEAR(51840000.0, total.variance, 51840000.0 * 0.000001);
+  EXPECT_EQ(6u, window.count);
+  EXPECT_EQ(24000, window.min);
+  EXPECT_EQ(24000, window.max);
+  EXPECT_EQ(24000, window.mean);
+  EXPECT_EQ(0u, window.variance);
+}
+
+TEST_F(SafetyTest, FILTER_STAT_WINDOW_MERGES_BLOCKS_WITH_DIFFERENT_MEANS) {
+  SAFETY_FILTER_STAT stat;
+  SAFETY_FILTER_STAT_VALUES total;
+  SAFETY_FILTER_STAT_VALUES window;
+
+  // a full block at 0 and a second block at the full range of 16 bits
+  ASSERT_TRUE(Safety_Filter_StatInit(&stat, 4));
+  for (U32 i = 0; i < 4; i++) {
+    Safety_Filter_StatUpdate(&stat, 0);
+  }
+  for (U32 i = 0; i < 3; i++) {
+    Safety_Filter_StatUpdate(&stat, 65535);
+  }
+  Safety_Filter_StatGet(&stat, &total, &window);
+
+  // variance 12 / 49 * 65535^2
+  EXPECT_EQ(7u, window.count);
+  EXPECT_EQ(0, window.min);
+  EXPECT_EQ(65535, window.max);
+  EXPECT_EQ(28086, window.mean);
+  EXPECT_NEAR(1051796627.0, window.variance, 1.0);
+  EXPECT_EQ(total.mean, window.mean);
+}
+
+TEST_F(SafetyTest, FILTER_STAT_LIMITS_VALUES) {
+  SAFETY_FILTER_STAT stat;
+  SAFETY_FILTER_STAT_VALUES total;
+
+  ASSERT_TRUE(Safety_Filter_StatInit(&stat, 4));
+  Safety_Filter_StatUpdate(&stat, 0x7FFFFFFF);
+  Safety_Filter_StatUpdate(&stat, -0x7FFFFFFF);
+  Safety_Filter_StatGet(&stat, &total, NULL);
+  EXPECT_EQ(SAFETY_FILTER_STAT_VALUE_MAX, total.max);
+  EXPECT_EQ(-SAFETY_FILTER_STAT_VALUE_MAX, total.min);
+  EXPECT_EQ(0, total.mean);
+  EXPECT_EQ(0xFFFFFFFFu, total.variance);
+}
+
+TEST_F(SafetyTest, POWERSUPPLY_STATISTICS_OF_SINGLE_MEASUREMENTS) {
+  SAFETY_POWERSUPPLY_CONFIG config = {};
+  SAFETY_HARDERROR_RECORD record;
+  SAFETY_POWERSUPPLY_STATISTICS statistics;
+
+  config.supplyVoltageIsActive = 1;
+
+  EXPECT_FALSE(Safety_Powersupply_GetStatistics(eSAFETY_POWERSUPPLY_STAT_COUNT, &statistics));
+  EXPECT_FALSE(Safety_Powersupply_GetStatistics(eSAFETY_POWERSUPPLY_STAT_VCC, NULL));
+
+  Safety_HardErrorTrap_Arm(&record);
+  if (setjmp(record.jumpBuffer) == 0) {
+    ASSERT_TRUE(Safety_Powersuply_Init(&config));
+    // ripple between 24 V and 25 V, one sample of each per two cycles
+    for (U32 cycle = 0; cycle < 8 * SYSPWR_NUM_VALUES; cycle++) {
+      SafetyTestEnv_SetPinVoltage(fpADCIN_VCC, (cycle & 1u) ? (25.0f / VOLTAGE_VCC_FACTOR) : (24.0f / VOLTAGE_VCC_FACTOR));
+      SafetyTestEnv_AdvanceTicks(10 * configTICK_RATE_HZ_MS);
+      Safety_Powersupply_Check();
+    }
+  }
+  Safety_HardErrorTrap_Disarm();
+  ASSERT_EQ(0u, record.stepCount) << "hard error " << (U32)record.hardErrorCode;
+
+  // the single measurements are recorded, not the average
+  ASSERT_TRUE(Safety_Powersupply_GetStatistics(eSAFETY_POWERSUPPLY_STAT_VCC, &statistics));
+  ASSERT_GT(statistics.total.count, 0u);
+  EXPECT_NEAR(24000, statistics.total.min, 1);
+  EXPECT_NEAR(25000, statistics.total.max, 1);
+  // an odd number of values has one more sample of one level
+  EXPECT_NEAR(24500, statistics.window.mean, 500 / statistics.window.count + 1);
+  EXPECT_NEAR(250000.0, statistics.window.variance, 250000.0 * 0.01);
+  EXPECT_LE(statistics.window.count, 2 * SAFETY_POWERSUPPLY_STAT_WINDOW_VALUES);
+
+  // channels without measurements have no statistics
+  ASSERT_TRUE(Safety_Powersupply_GetStatistics(eSAFETY_POWERSUPPLY_STAT_VCC1, &statistics));
+  EXPECT_EQ(0u, statistics.total.count);
+}
+
+// Temperature conversion
+TEST_F(SafetyTest, TEMPERATURE_NOMINAL_SENSOR_IS_LINEAR) {
+  // V30 + 2.5 mV/K, 1 uV is 0.4 mdeg
+  for (S32 temperature = -40000; temperature <= 150000; temperature += 10) {
+    S32 const microvolt = SAFETY_TEMPERATURE_CAL1_MICROVOLT + ((temperature - 30000) * 5) / 2;
+    ASSERT_NEAR(temperature, Safety_Temperature_ConvertMicrovolt(microvolt), 1) << "at " << temperature << " mdeg";
+  }
+}
+
+TEST_F(SafetyTest, TEMPERATURE_TWO_POINT_CALIBRATION) {
+  // sensor with offset and 2.6 mV/K
+  ASSERT_TRUE(Safety_Temperature_Calibrate(750000, 1010000));
+  EXPECT_EQ(30000, Safety_Temperature_ConvertMicrovolt(750000));
+  EXPECT_EQ(130000, Safety_Temperature_ConvertMicrovolt(1010000));
+  EXPECT_EQ(-40000, Safety_Temperature_ConvertMicrovolt(750000 - 70 * 2600));
+  EXPECT_EQ(85000, Safety_Temperature_ConvertMicrovolt(750000 + 55 * 2600));
+}
+
+TEST_F(SafetyTest, TEMPERATURE_REJECTS_IMPLAUSIBLE_CALIBRATION) {
+  EXPECT_FALSE(Safety_Temperature_Calibrate(760000, 760000));
+  EXPECT_FALSE(Safety_Temperature_Calibrate(1010000, 760000));
+  EXPECT_FALSE(Safety_Temperature_Calibrate(760000, 760000 + 124999));
+  EXPECT_FALSE(Safety_Temperature_Calibrate(760000, 760000 + 500001));
+
+  // the nominal sensor remains
+  EXPECT_EQ(30000, Safety_Temperature_ConvertMicrovolt(SAFETY_TEMPERATURE_CAL1_MICROVOLT));
+  EXPECT_EQ(130000, Safety_Temperature_ConvertMicrovolt(SAFETY_TEMPERATURE_CAL2_MICROVOLT));
+}
+
+// Event queue of the safety task
+TEST_F(SafetyTest, EVENT_QUEUE_FORWARDS_IN_ORDER_PER_CYCLE) {
+  SAFETY_TEST_ENV_ERROR_EVENT errorEvent = {};
+
+  EXPECT_TRUE(Safety_Event_SendError(eEVENT_VCC_CHECK_ERROR, 1, 1, 0));
+  EXPECT_TRUE(Safety_Event_SendError(eEVENT_VCC_CHECK_ERROR, 1, 2, 0));
+  EXPECT_TRUE(Safety_Event_Send(eEVENT_VCC_CHECK_ERROR, 7));
+  EXPECT_EQ(0u, SafetyTestEnv_GetErrorEventCount());
+
+  // limited per call, in the order of the safety task
+  EXPECT_EQ(1u, Safety_Event_Process(1));
+  ASSERT_TRUE(SafetyTestEnv_GetLastErrorEvent(&errorEvent));
+  EXPECT_EQ(1u, errorEvent.intermediate);
+  EXPECT_EQ(2u, Safety_Event_Process(SAFETY_EVENT_PROCESS_MAX_EVENTS));
+  ASSERT_TRUE(SafetyTestEnv_GetLastErrorEvent(&errorEvent));
+  EXPECT_EQ(2u, errorEvent.intermediate);
+  EXPECT_EQ(2u, SafetyTestEnv_GetErrorEventCount());
+  EXPECT_EQ(1u, SafetyTestEnv_GetMsgEventCount());
+  EXPECT_EQ(0u, Safety_Event_Process(SAFETY_EVENT_PROCESS_MAX_EVENTS));
+}
+
+TEST_F(SafetyTest, EVENT_TASK_BELOW_SAFETY_TASK_PRIORITY) {
+  TASK_PARA_STD param = {};
+  U8 safetyPriority = 0;
+  U8 eventPriority = 0;
+
+  // forwarding with the priority of the safety task is rejected
+  param.taskDelay = 10 * configTICK_RATE_HZ_MS;
+  param.ucPrioritaet = SAFETY_EVENT_TASK_PRIORITY;
+  EXPECT_FALSE(Safety_Task_Init(&param));
+  EXPECT_FALSE(SafetyTestEnv_GetCreatedTask("Safety", &safetyPriority));
+  EXPECT_FALSE(SafetyTestEnv_GetCreatedTask("SafetyEvent", &eventPriority));
+
+  param.ucPrioritaet = SAFETY_EVENT_TASK_PRIORITY + 1;
+  ASSERT_TRUE(Safety_Task_Init(&param));
+  ASSERT_TRUE(SafetyTestEnv_GetCreatedTask("Safety", &safetyPriority));
+  ASSERT_TRUE(SafetyTestEnv_GetCreatedTask("SafetyEvent", &eventPriority));
+  EXPECT_LT(eventPriority, safetyPriority);
+}
+
+TEST_F(SafetyTest, EVENT_QUEUE_RETRIES_REJECTED_EVENTS) {
+  SAFETY_TEST_ENV_ERROR_EVENT errorEvent = {};
+
+  EXPECT_TRUE(Safety_Event_SendError(eEVENT_TEMPERATURE, 3, 4, 0));
+  EXPECT_TRUE(Safety_Event_Send(eEVENT_TEMPERATURE, 5));
+
+  // a busy event system keeps the events pending
+  SafetyTestEnv_SetEventSystemBusy(true);
+  EXPECT_EQ(0u, Safety_Event_Process(SAFETY_EVENT_PROCESS_MAX_EVENTS));
+  EXPECT_EQ(0u, Safety_Event_Process(SAFETY_EVENT_PROCESS_MAX_EVENTS));
+  EXPECT_EQ(0u, SafetyTestEnv_GetErrorEventCount());
+  EXPECT_EQ(0u, SafetyTestEnv_GetMsgEventCount());
+
+  SafetyTestEnv_SetEventSystemBusy(false);
+  EXPECT_EQ(2u, Safety_Event_Process(SAFETY_EVENT_PROCESS_MAX_EVENTS));
+  ASSERT_TRUE(SafetyTestEnv_GetLastErrorEvent(&errorEvent));
+  EXPECT_EQ((U32)eEVENT_TEMPERATURE, errorEvent.event);
+  EXPECT_EQ(3u, errorEvent.upper);
+  EXPECT_EQ(4u, errorEvent.intermediate);
+  EXPECT_EQ(1u, SafetyTestEnv_GetMsgEventCount());
+}
+
+TEST_F(SafetyTest, EVENT_QUEUE_OVERFLOW_AND_COALESCING) {
+  SAFETY_EVENT_STATISTICS statistics;
+
+  for (U32 i = 0; i < SAFETY_EVENT_QUEUE_SIZE; i++) {
+    EXPECT_TRUE(Safety_Event_Send(eEVENT_TEMPERATURE, i));
+  }
+
+  // an identical pending event is combined, another one is discarded
+  EXPECT_TRUE(Safety_Event_Send(eEVENT_TEMPERATURE, SAFETY_EVENT_QUEUE_SIZE - 1));
+  EXPECT_FALSE(Safety_Event_Send(eEVENT_TEMPERATURE, SAFETY_EVENT_QUEUE_SIZE));
+  Safety_Event_GetStatistics(&statistics);
+  EXPECT_EQ(1u, statistics.overflows);
+  EXPECT_EQ(1u, statistics.coalesced);
+  EXPECT_EQ(SAFETY_EVENT_QUEUE_SIZE, statistics.maxPending);
+
+  EXPECT_EQ(SAFETY_EVENT_QUEUE_SIZE, Safety_Event_Process(SAFETY_EVENT_QUEUE_SIZE));
+  EXPECT_EQ(SAFETY_EVENT_QUEUE_SIZE, SafetyTestEnv_GetMsgEventCount());
+  EXPECT_TRUE(Safety_Event_Send(eEVENT_TEMPERATURE, SAFETY_EVENT_QUEUE_SIZE));
+}
+
+// Recording read while recording
+static std::vector<U32> RecordedCycleTicks(U8 const *data, U32 size) {
+  std::vector<U32> ticks;
+  U32 position = 0;
+
+  while (position < size) {
+    EXPECT_EQ(0x10u, data[position]) << "no cycle at " << position;
+    EXPECT_LE(position + 7u, size);
+    if ((data[position] != 0x10u) || (position + 7u > size)) {
+      break;
+    }
+    ticks.push_back((U32)data[position + 3] | ((U32)data[position + 4] << 8) | ((U32)data[position + 5] << 16) |
+                    ((U32)data[position + 6] << 24));
+    position += 7u + ((U32)data[position + 1] | ((U32)data[position + 2] << 8));
+  }
+  EXPECT_EQ(size, position);
+  return ticks;
+}
+
+static void RunPowersupplyCycles(U32 cycles) {
+  for (U32 cycle = 0; cycle < cycles; cycle++) {
+    SafetyTestEnv_AdvanceTicks(10 * configTICK_RATE_HZ_MS);
+    Safety_Powersupply_Check();
+  }
+}
+
+TEST_F(SafetyTest, RECORD_READ_WHILE_RECORDING) {
+  SAFETY_POWERSUPPLY_CONFIG config = {};
+  SAFETY_HARDERROR_RECORD record;
+  U8 header[SAFETY_RECORD_HEADER_SIZE];
+  U8 data[SAFETY_RECORD_BUFFER_SIZE];
+  std::vector<U32> first;
+  std::vector<U32> second;
+  U32 size = 0;
+
+  config.supplyVoltageIsActive = 1;
+  SafetyTestEnv_SetPinVoltage(fpADCIN_VCC, 1.42f);
+
+  Safety_HardErrorTrap_Arm(&record);
+  if (setjmp(record.jumpBuffer) == 0) {
+    ASSERT_TRUE(Safety_Powersuply_Init(&config));
+    RunPowersupplyCycles(3);
+    size = Safety_Record_Read(data, sizeof(data));
+    first = RecordedCycleTicks(data, size);
+
+    // only the new cycles, a small buffer gets whole cycles only
+    RunPowersupplyCycles(2);
+    size = Safety_Record_Read(data, 1u);
+    EXPECT_EQ(0u, size);
+    size = Safety_Record_Read(data, sizeof(data));
+    second = RecordedCycleTicks(data, size);
+    EXPECT_EQ(0u, Safety_Record_Read(data, sizeof(data)));
+  }
+  Safety_HardErrorTrap_Disarm();
+  ASSERT_EQ(0u, record.stepCount) << "hard error " << (U32)record.hardErrorCode;
+
+  ASSERT_EQ(3u, first.size());
+  ASSERT_EQ(2u, second.size());
+  EXPECT_EQ(first[0] + 10 * configTICK_RATE_HZ_MS, first[1]);
+  EXPECT_EQ(first[2] + 10 * configTICK_RATE_HZ_MS, second[0]);
+  EXPECT_EQ(second[0] + 10 * configTICK_RATE_HZ_MS, second[1]);
+  EXPECT_EQ(0u, Safety_Record_GetOverflows());
+
+  ASSERT_EQ(SAFETY_RECORD_HEADER_SIZE, Safety_Record_GetHeader(header, sizeof(header)));
+  EXPECT_EQ(0, memcmp("SPRT", header, 4));
+  EXPECT_EQ(0u, Safety_Record_GetHeader(header, sizeof(header) - 1u));
+}
+
+TEST_F(SafetyTest, RECORD_OVERFLOWS_COUNTED) {
+  SAFETY_POWERSUPPLY_CONFIG config = {};
+  SAFETY_HARDERROR_RECORD record;
+  U8 data[SAFETY_RECORD_BUFFER_SIZE];
+  std::vector<U32> read;
+  U32 const cycles = SAFETY_RECORD_BUFFER_SIZE / 8u;
+  U32 size = 0;
+
+  config.supplyVoltageIsActive = 1;
+  SafetyTestEnv_SetPinVoltage(fpADCIN_VCC, 1.42f);
+
+  Safety_HardErrorTrap_Arm(&record);
+  if (setjmp(record.jumpBuffer) == 0) {
+    ASSERT_TRUE(Safety_Powersuply_Init(&config));
+    RunPowersupplyCycles(2);
+    size = Safety_Record_Read(data, sizeof(data));
+    EXPECT_EQ(2u, RecordedCycleTicks(data, size).size());
+
+    // more cycles than the ring buffer holds without reading
+    RunPowersupplyCycles(cycles);
+    size = Safety_Record_Read(data, sizeof(data));
+    read = RecordedCycleTicks(data, size);
+  }
+  Safety_HardErrorTrap_Disarm();
+  ASSERT_EQ(0u, record.stepCount) << "hard error " << (U32)record.hardErrorCode;
+
+  // the read continues with the oldest cycle in the ring buffer, the lost cycles are counted
+  ASSERT_GT(Safety_Record_GetOverflows(), 0u);
+  EXPECT_EQ(cycles, read.size() + Safety_Record_GetOverflows());
+  ASSERT_FALSE(read.empty());
+  EXPECT_EQ((2u + cycles) * 10u * configTICK_RATE_HZ_MS, read.back());
+}
+
+TEST_F(SafetyTest, RECORD_READ_RETRIES_OVERWRITTEN_CYCLES) {
+  SAFETY_POWERSUPPLY_CONFIG config = {};
+  SAFETY_HARDERROR_RECORD record;
+  U8 data[SAFETY_RECORD_BUFFER_SIZE];
+  std::vector<U32> ticks;
+  U32 size = 0;
+  U32 cycles = 0;
+
+  config.supplyVoltageIsActive = 1;
+  SafetyTestEnv_SetPinVoltage(fpADCIN_VCC, 1.42f);
+
+  Safety_HardErrorTrap_Arm(&record);
+  if (setjmp(record.jumpBuffer) == 0) {
+    ASSERT_TRUE(Safety_Powersuply_Init(&config));
+    // fill the ring buffer, then the safety task overwrites the copied cycles during the read
+    while (Safety_Record_GetExportSize() + 32u < SAFETY_RECORD_HEADER_SIZE + SAFETY_RECORD_BUFFER_SIZE) {
+      RunPowersupplyCycles(1);
+      cycles++;
+    }
+    SafetyTestEnv_RecordCyclesDuringRead(4);
+    cycles += 4;
+    size = Safety_Record_Read(data, sizeof(data));
+    ticks = RecordedCycleTicks(data, size);
+    size = Safety_Record_Read(data, sizeof(data));
+    std::vector<U32> const remaining = RecordedCycleTicks(data, size);
+    ticks.insert(ticks.end(), remaining.begin(), remaining.end());
+  }
+  Safety_HardErrorTrap_Disarm();
+  ASSERT_EQ(0u, record.stepCount) << "hard error " << (U32)record.hardErrorCode;
+
+  // no overwritten cycle is returned, every cycle is read or counted once
+  ASSERT_GT(Safety_Record_GetOverflows(), 0u);
+  EXPECT_EQ(cycles, ticks.size() + Safety_Record_GetOverflows());
+  for (size_t i = 1; i < ticks.size(); i++) {
+    EXPECT_EQ(ticks[i - 1] + 10 * configTICK_RATE_HZ_MS, ticks[i]);
+  }
+  ASSERT_FALSE(ticks.empty());
+  EXPECT_EQ(cycles * 10u * configTICK_RATE_HZ_MS, ticks.back());
+}
+
+TEST_F(SafetyTest, RECORD_ONLY_DEFAULT_INSTANCE) {
+  static SAFETY_POWERSUPPLY_CONTEXT context;
+  SAFETY_POWERSUPPLY_CONFIG config = {};
+
+  config.supplyVoltageIsActive = 1;
+  memset(&context, 0, sizeof(context));
+  EXPECT_FALSE(Safety_Powersupply_ContextInit(&context, &config));
+}
+
+// Error handling and initialization of an instance
+struct InstanceErrors {
+  jmp_buf hardErrorReturn;
+  U8 hardErrorCode;
+  bool isPermanent;
+  U32 events;
+  SAFETY_TEST_ENV_ERROR_EVENT lastEvent;
+};
+
+static void InstanceHardError(void *const user, U8 const hardErrorCode, bool const isPermanent) {
+  InstanceErrors *const errors = static_cast<InstanceErrors *>(user);
+  errors->hardErrorCode = hardErrorCode;
+  errors->isPermanent = isPermanent;
+  longjmp(errors->hardErrorReturn, 1);
+}
+
+static void InstanceErrorEvent(void *const user, U32 const event, U8 const upper, U8 const intermediate,
+                               U8 const lower) {
+  InstanceErrors *const errors = static_cast<InstanceErrors *>(user);
+  errors->events++;
+  errors->lastEvent = {event, upper, intermediate, lower};
+}
+
+TEST_F(SafetyTest, POWERSUPPLY_ERROR_HANDLER_OF_INSTANCE) {
+  static InstanceErrors errors;
+  SAFETY_POWERSUPPLY_ERROR_HANDLER const handler = {InstanceHardError, InstanceErrorEvent, &errors};
+  SAFETY_POWERSUPPLY_CONFIG config = {};
+  SAFETY_HARDERROR_RECORD record;
+  SAFETY_POWERSUPPLY_CONTEXT *const context = SafetyTestEnv_GetPowersupplyContext();
+
+  memset(&errors, 0, sizeof(errors));
+  config.supplyVoltageIsActive = 1;
+  config.voltageExternalAdcChannel1IsActive = 1;
+  SafetyTestEnv_SetPinVoltage(fpADCIN_VCC, 0.0f);
+  SafetyTestEnv_SetExternalAdcValue(MAX116XX_POS_12CHANNEL_ADC, EXT_ADC_CHANNEL1_TO_CHECK_CHANNEL, 1.0f);
+
+  EXPECT_FALSE(Safety_Powersupply_ContextConfigureErrorHandler(context, NULL));
+  ASSERT_TRUE(Safety_Powersupply_ContextConfigureErrorHandler(context, &handler));
+
+  // the global hard error handling and event queue stay unused
+  Safety_HardErrorTrap_Arm(&record);
+  if (setjmp(record.jumpBuffer) == 0) {
+    ASSERT_TRUE(Safety_Powersupply_ContextInit(context, &config));
+    EXPECT_FALSE(Safety_Powersupply_ContextConfigureErrorHandler(context, &handler));
+    if (setjmp(errors.hardErrorReturn) == 0) {
+      // undervoltage beyond the timeout
+      RunPowersupplyCycles(4 * SYSPWR_NUM_VALUES);
+      EXPECT_GT(errors.events, 0u);
+      EXPECT_EQ((U8)eERROR_SUPPLY_VOLTAGE, errors.lastEvent.upper);
+
+      // no consistent frame of the external ADCs
+      SafetyTestEnv_PublishExternalAdcDuringEveryRead(true);
+      RunPowersupplyCycles(4 * SYSPWR_NUM_VALUES);
+    }
+  }
+  Safety_HardErrorTrap_Disarm();
+  ASSERT_EQ(0u, record.stepCount) << "hard error " << (U32)record.hardErrorCode;
+
+  EXPECT_EQ(HARD_ERR_SAFETY_MEASUREMENT, errors.hardErrorCode);
+  EXPECT_FALSE(errors.isPermanent);
+  EXPECT_EQ(0u, Safety_Event_Process(SAFETY_EVENT_QUEUE_SIZE));
+  EXPECT_EQ(0u, SafetyTestEnv_GetErrorEventCount());
+  EXPECT_EQ(0u, SafetyTestEnv_GetNonvolatileError());
+}
+
+/// Runs the monitoring of an instance with its own error handling until its
+/// hard error and checks that the global hard error handling stays unused.
+static void RunInstanceUntilHardError(SAFETY_POWERSUPPLY_CONFIG &config, InstanceErrors &errors) {
+  SAFETY_POWERSUPPLY_ERROR_HANDLER const handler = {InstanceHardError, InstanceErrorEvent, &errors};
+  SAFETY_HARDERROR_RECORD record;
+  SAFETY_POWERSUPPLY_CONTEXT *const context = SafetyTestEnv_GetPowersupplyContext();
+
+  ASSERT_TRUE(Safety_Powersupply_ContextConfigureErrorHandler(context, &handler));
+  Safety_HardErrorTrap_Arm(&record);
+  if (setjmp(record.jumpBuffer) == 0) {
+    ASSERT_TRUE(Safety_Powersupply_ContextInit(context, &config));
+    if (setjmp(errors.hardErrorReturn) == 0) {
+      RunPowersupplyCycles(4 * SYSPWR_NUM_VALUES);
+    }
+  }
+  Safety_HardErrorTrap_Disarm();
+  ASSERT_EQ(0u, record.stepCount) << "hard error " << (U32)record.hardErrorCode;
+  EXPECT_EQ(0u, SafetyTestEnv_GetNonvolatileError());
+}
+
+TEST_F(SafetyTest, POWERSUPPLY_VCC_HIGH_PERMANENT_ERROR_OF_INSTANCE) {
+  static InstanceErrors errors;
+  SAFETY_POWERSUPPLY_CONFIG config = {};
+
+  memset(&errors, 0, sizeof(errors));
+  config.supplyVoltageIsActive = 1;
+  SafetyTestEnv_SetPinVoltage(fpADCIN_VCC, 3.5f);
+
+  RunInstanceUntilHardError(config, errors);
+  EXPECT_EQ(HARD_ERR_VOLTAGE_EXCEEDED, errors.hardErrorCode);
+  EXPECT_TRUE(errors.isPermanent);
+}
+
+TEST_F(SafetyTest, POWERSUPPLY_TEMPERATURE_LIMIT_PERMANENT_ERROR_OF_INSTANCE) {
+  static InstanceErrors errors;
+  SAFETY_POWERSUPPLY_CONFIG config = {};
+
+  memset(&errors, 0, sizeof(errors));
+  config.supplyVoltageIsActive = 1;
+  config.temperatureSensorIsActive = 1;
+  SafetyTestEnv_SetPinVoltage(fpADCIN_VCC, 1.42f);
+  SafetyTestEnv_SetTemperature(TEMPERATURE_ERROR_MAX + 10.0f);
+
+  RunInstanceUntilHardError(config, errors);
+  EXPECT_EQ(HARD_ERR_TEMPERATURE_EXCEEDED, errors.hardErrorCode);
+  EXPECT_TRUE(errors.isPermanent);
+}
+
+TEST_F(SafetyTest, POWERSUPPLY_REINIT_KEEPS_CONFIGURATION) {
+  static SAFETY_POWERSUPPLY_EXT_ADC_CHANNEL const channels[] = {
+      {MAX116XX_POS_12CHANNEL_ADC, EXT_ADC_CHANNEL1_TO_CHECK_CHANNEL, 1.0f, 1.0f, 0.0f, 100.0f},
+  };
+  SAFETY_POWERSUPPLY_CONFIG config = {};
+  SAFETY_HARDERROR_RECORD record;
+  F32 voltage = 0.0f;
+  bool validBeforeReinit = false;
+  bool validAfterReinit = true;
+  bool readyAfterInit = false;
+
+  config.supplyVoltageIsActive = 1;
+  SafetyTestEnv_SetPinVoltage(fpADCIN_VCC, 1.42f);
+  SafetyTestEnv_SetExternalAdcValue(MAX116XX_POS_12CHANNEL_ADC, EXT_ADC_CHANNEL1_TO_CHECK_CHANNEL, 1.0f);
+  ASSERT_TRUE(Safety_Powersupply_ConfigureExternalAdc(channels, 1));
+  Safety_Powersupply_SignalSourceReady(eSAFETY_POWERSUPPLY_SOURCE_ADC);
+
+  Safety_HardErrorTrap_Arm(&record);
+  if (setjmp(record.jumpBuffer) == 0) {
+    ASSERT_TRUE(Safety_Powersuply_Init(&config));
+    readyAfterInit = Safety_Powersupply_IsSourceReady(eSAFETY_POWERSUPPLY_SOURCE_ADC);
+    RunPowersupplyCycles(4 * SYSPWR_NUM_VALUES);
+    validBeforeReinit = Safety_Powersupply_GetExternalAdcVoltage(0, &voltage);
+
+    // the filters start again, the channel table and the ready sources are kept
+    ASSERT_TRUE(Safety_Powersupply_ContextInit(SafetyTestEnv_GetPowersupplyContext(), &config));
+    validAfterReinit = Safety_Powersupply_GetExternalAdcVoltage(0, &voltage);
+    RunPowersupplyCycles(4 * SYSPWR_NUM_VALUES);
+  }
+  Safety_HardErrorTrap_Disarm();
+  ASSERT_EQ(0u, record.stepCount) << "hard error " << (U32)record.hardErrorCode;
+
+  EXPECT_TRUE(readyAfterInit);
+  EXPECT_TRUE(validBeforeReinit);
+  EXPECT_FALSE(validAfterReinit);
+  ASSERT_TRUE(Safety_Powersupply_GetExternalAdcVoltage(0, &voltage));
+  EXPECT_TRUE(Safety_Powersupply_IsSourceReady(eSAFETY_POWERSUPPLY_SOURCE_ADC));
+  EXPECT_FALSE(Safety_Powersupply_ConfigureExternalAdc(channels, 1));
+}
+
+// Temperature hook
+struct TemperatureHookCall {
+  float temperature;
+  SYSTEM_TEMPERATURE_STATUS state;
+};
+
+static std::vector<TemperatureHookCall> temperatureHookCalls;
+
+extern "C" void Safety_TemperatureChangedHook(float temperature, SYSTEM_TEMPERATURE_STATUS const temperatureState) {
+  temperatureHookCalls.push_back({temperature, temperatureState});
+}
+
+/// Initializes the monitoring with the temperature sensor and measures the first temperature.
+static void StartTemperatureMonitoring(SAFETY_POWERSUPPLY_CONFIG &config, F32 const temperature) {
+  temperatureHookCalls.clear();
+  config.supplyVoltageIsActive = 1;
+  config.temperatureSensorIsActive = 1;
+  SafetyTestEnv_SetPinVoltage(fpADCIN_VCC, 1.42f);
+  SafetyTestEnv_SetTemperature(temperature);
+  Safety_Powersupply_SignalSourceReady(eSAFETY_POWERSUPPLY_SOURCE_ADC);
+  ASSERT_TRUE(Safety_Powersuply_Init(&config));
+  RunPowersupplyCycles(1);
+}
+
+TEST_F(SafetyTest, POWERSUPPLY_TEMPERATURE_HOOK_DEADBAND_AND_MIN_INTERVAL) {
+  SAFETY_POWERSUPPLY_CONFIG config = {};
+  SAFETY_HARDERROR_RECORD record;
+  size_t callsInDeadband = 0;
+  size_t callsAfterDeadband = 0;
+  size_t callsInInterval = 0;
+
+  Safety_HardErrorTrap_Arm(&record);
+  if (setjmp(record.jumpBuffer) == 0) {
+    StartTemperatureMonitoring(config, 25.0f);
+    ASSERT_EQ(1u, temperatureHookCalls.size());
+
+    // changes within the deadband are not reported
+    SafetyTestEnv_SetTemperature(25.0f + SAFETY_TEMPERATURE_HOOK_DEADBAND_MILLIDEG / DECIMAL_FIXPOINT);
+    RunPowersupplyCycles(2 * SAFETY_TEMPERATURE_HOOK_MIN_INTERVAL_MS / 10);
+    callsInDeadband = temperatureHookCalls.size();
+
+    // a change beyond the deadband after the minimum interval is reported at once
+    SafetyTestEnv_SetTemperature(25.6f);
+    RunPowersupplyCycles(1);
+    callsAfterDeadband = temperatureHookCalls.size();
+
+    // the next change waits for the minimum interval
+    SafetyTestEnv_SetTemperature(26.2f);
+    RunPowersupplyCycles(SAFETY_TEMPERATURE_HOOK_MIN_INTERVAL_MS / 10 - 1);
+    callsInInterval = temperatureHookCalls.size();
+    RunPowersupplyCycles(1);
+  }
+  Safety_HardErrorTrap_Disarm();
+  ASSERT_EQ(0u, record.stepCount) << "hard error " << (U32)record.hardErrorCode;
+
+  EXPECT_EQ(1u, callsInDeadband);
+  EXPECT_EQ(2u, callsAfterDeadband);
+  EXPECT_EQ(2u, callsInInterval);
+  ASSERT_EQ(3u, temperatureHookCalls.size());
+  EXPECT_FLOAT_EQ(25000.0f, temperatureHookCalls[0].temperature);
+  EXPECT_EQ(eSYSTMP_STAT_TMP_STARTUP_VALID, temperatureHookCalls[0].state);
+  EXPECT_FLOAT_EQ(25600.0f, temperatureHookCalls[1].temperature);
+  EXPECT_FLOAT_EQ(26200.0f, temperatureHookCalls[2].temperature);
+}
+
+TEST_F(SafetyTest, POWERSUPPLY_TEMPERATURE_HOOK_STATE_CHANGE_IMMEDIATE) {
+  SAFETY_POWERSUPPLY_CONFIG config = {};
+  SAFETY_HARDERROR_RECORD record;
+  size_t callsAfterChange = 0;
+  size_t callsAfterWarning = 0;
+
+  Safety_HardErrorTrap_Arm(&record);
+  if (setjmp(record.jumpBuffer) == 0) {
+    StartTemperatureMonitoring(config, TEMPERATURE_WARNING_MAX - 1.0f);
+    SafetyTestEnv_SetTemperature(TEMPERATURE_WARNING_MAX - 0.2f);
+    RunPowersupplyCycles(SAFETY_TEMPERATURE_HOOK_MIN_INTERVAL_MS / 10);
+    callsAfterChange = temperatureHookCalls.size();
+
+    // the warning is reported within the minimum interval and the deadband
+    SafetyTestEnv_SetTemperature(TEMPERATURE_WARNING_MAX + 0.1f);
+    RunPowersupplyCycles(1);
+    callsAfterWarning = temperatureHookCalls.size();
+  }
+  Safety_HardErrorTrap_Disarm();
+  ASSERT_EQ(0u, record.stepCount) << "hard error " << (U32)record.hardErrorCode;
+
+  EXPECT_EQ(2u, callsAfterChange);
+  EXPECT_EQ(3u, callsAfterWarning);
+  ASSERT_EQ(3u, temperatureHookCalls.size());
+  EXPECT_EQ(eSYSTMP_STAT_TMP_STARTUP_VALID | eSYSTMP_STAT_WARNING_TMP_HIGH, temperatureHookCalls[2].state);
+  EXPECT_FLOAT_EQ((TEMPERATURE_WARNING_MAX + 0.1f) * DECIMAL_FIXPOINT, temperatureHookCalls[2].temperature);
+}
+
+// External ADC channel table
+static void RunExternalAdcTable(SAFETY_POWERSUPPLY_EXT_ADC_CHANNEL const *channels, U8 count) {
+  SAFETY_POWERSUPPLY_CONFIG config = {};
+  SAFETY_HARDERROR_RECORD record;
+
+  config.supplyVoltageIsActive = 1;
+  SafetyTestEnv_SetPinVoltage(fpADCIN_VCC, 1.42f);
+  ASSERT_TRUE(Safety_Powersupply_ConfigureExternalAdc(channels, count));
+  Safety_Powersupply_SignalSourceReady(eSAFETY_POWERSUPPLY_SOURCE_ADC);
+
+  Safety_HardErrorTrap_Arm(&record);
+  if (setjmp(record.jumpBuffer) == 0) {
+    ASSERT_TRUE(Safety_Powersuply_Init(&config));
+    RunPowersupplyCycles(4 * SYSPWR_NUM_VALUES);
+    Safety_Event_Process(SAFETY_EVENT_PROCESS_MAX_EVENTS);
+  }
+  Safety_HardErrorTrap_Disarm();
+  ASSERT_EQ(0u, record.stepCount) << "hard error " << (U32)record.hardErrorCode;
+}
+
+// Multiplier of a channel without voltage divider, r1 = 0 and r2 = 1
+static F32 const kExternalAdcReference = (F32)MAX11611_REFERENCE_VOLTAGE / 1000.0f;
+
+TEST_F(SafetyTest, POWERSUPPLY_EXTERNAL_ADC_NINE_PLUS_THREE_RAILS) {
+  static SAFETY_POWERSUPPLY_EXT_ADC_CHANNEL channels[12];
+  SAFETY_TEST_ENV_ERROR_EVENT errorEvent;
+  F32 voltage = 0.0f;
+
+  // nine rails on the 12 channel ADC and three rails on the 4 channel ADC
+  for (U8 i = 0; i < 12; i++) {
+    channels[i] = {(U8)((i < 9) ? MAX116XX_POS_12CHANNEL_ADC : MAX116XX_POS_4CHANNEL_ADC),
+                   (U8)((i < 9) ? i : (i - 9)), 0.0f, 1.0f, 0.5f, 10.0f};
+    SafetyTestEnv_SetExternalAdcValue(channels[i].adc, channels[i].channel, 0.5f + 0.1f * i);
+  }
+
+  RunExternalAdcTable(channels, 12);
+
+  for (U8 i = 0; i < 12; i++) {
+    ASSERT_TRUE(Safety_Powersupply_GetExternalAdcVoltage(i, &voltage)) << "channel " << (U32)i;
+    EXPECT_NEAR((0.5f + 0.1f * i) * kExternalAdcReference, voltage, 1e-4f) << "channel " << (U32)i;
+  }
+  EXPECT_FALSE(Safety_Powersupply_GetExternalAdcVoltage(12, &voltage));
+  EXPECT_FALSE(SafetyTestEnv_GetLastErrorEvent(&errorEvent));
+}
+
+TEST_F(SafetyTest, POWERSUPPLY_EXTERNAL_ADC_ERROR_OF_FIRST_CHANNELS) {
+  static SAFETY_POWERSUPPLY_EXT_ADC_CHANNEL channels[5];
+  SAFETY_TEST_ENV_ERROR_EVENT errorEvent = {};
+
+  for (U8 i = 0; i < 5; i++) {
+    channels[i] = {MAX116XX_POS_12CHANNEL_ADC, i, 0.0f, 1.0f, 1.0f, 10.0f};
+    SafetyTestEnv_SetExternalAdcValue(MAX116XX_POS_12CHANNEL_ADC, i, (i == 2) ? 0.25f : 1.0f);
+  }
+
+  RunExternalAdcTable(channels, 5);
+
+  EXPECT_EQ(1u, SafetyTestEnv_GetErrorEventCount());
+  ASSERT_TRUE(SafetyTestEnv_GetLastErrorEvent(&errorEvent));
+  EXPECT_EQ((U32)eEVENT_VCC_CHECK_ERROR, errorEvent.event);
+  EXPECT_EQ(eERROR_EXTERNAL_ADC_VOLTAGE_3, errorEvent.upper);
+  EXPECT_EQ(eERROR_VOLTAGE_EXCEEDED_MIN, errorEvent.intermediate);
+  EXPECT_EQ(ERROR_BYTE_LOWER_LEVEL_FILL_ZERO, errorEvent.lower);
+}
+
+TEST_F(SafetyTest, POWERSUPPLY_EXTERNAL_ADC_ERROR_OF_FURTHER_CHANNEL) {
+  static SAFETY_POWERSUPPLY_EXT_ADC_CHANNEL channels[5];
+  SAFETY_TEST_ENV_ERROR_EVENT errorEvent = {};
+
+  for (U8 i = 0; i < 5; i++) {
+    channels[i] = {MAX116XX_POS_12CHANNEL_ADC, i, 0.0f, 1.0f, 1.0f, 10.0f};
+    SafetyTestEnv_SetExternalAdcValue(MAX116XX_POS_12CHANNEL_ADC, i, (i == 4) ? 0.25f : 1.0f);
+  }
+
+  RunExternalAdcTable(channels, 5);
+
+  // the index of the channel in the table is in the lower error byte
+  EXPECT_EQ(1u, SafetyTestEnv_GetErrorEventCount());
+  ASSERT_TRUE(SafetyTestEnv_GetLastErrorEvent(&errorEvent));
+  EXPECT_EQ((U32)eEVENT_VCC_CHECK_ERROR, errorEvent.event);
+  EXPECT_EQ(eERROR_EXTERNAL_ADC_VOLTAGE_N, errorEvent.upper);
+  EXPECT_EQ(eERROR_VOLTAGE_EXCEEDED_MIN, errorEvent.intermediate);
+  EXPECT_EQ(4u, errorEvent.lower);
+}
+
+TEST_F(SafetyTest, POWERSUPPLY_EXTERNAL_ADC_MORE_THAN_32_CHANNELS) {
+  static SAFETY_POWERSUPPLY_EXT_ADC_CHANNEL channels[SAFETY_POWERSUPPLY_EXT_ADC_CHANNELS_MAX + 1u];
+  SAFETY_TEST_ENV_ERROR_EVENT errorEvent = {};
+  U8 const count = (U8)SAFETY_POWERSUPPLY_EXT_ADC_CHANNELS_MAX;
+  U8 const failing = count - 2u;
+  F32 voltage = 0.0f;
+
+  ASSERT_GT(count, 32u);
+  // the physical channels of both ADCs are monitored several times
+  for (U8 i = 0; i < count + 1u; i++) {
+    channels[i] = {(U8)(((i % 16u) < 12u) ? MAX116XX_POS_12CHANNEL_ADC : MAX116XX_POS_4CHANNEL_ADC),
+                   (U8)(((i % 16u) < 12u) ? (i % 16u) : ((i % 16u) - 12u)), 0.0f, 1.0f, 1.0f, 10.0f};
+  }
+  for (U8 i = 0; i < count; i++) {
+    SafetyTestEnv_SetExternalAdcValue(channels[i].adc, channels[i].channel, 1.0f);
+  }
+  // a channel of the second status word with a lower limit above the voltage
+  channels[failing].limitMinVolt = 3.0f;
+
+  EXPECT_FALSE(Safety_Powersupply_ConfigureExternalAdc(channels, count + 1u));
+  RunExternalAdcTable(channels, count);
+
+  for (U8 i = 0; i < count; i++) {
+    ASSERT_TRUE(Safety_Powersupply_GetExternalAdcVoltage(i, &voltage)) << "channel " << (U32)i;
+    EXPECT_NEAR(kExternalAdcReference, voltage, 1e-4f) << "channel " << (U32)i;
+  }
+  EXPECT_EQ(1u, SafetyTestEnv_GetErrorEventCount());
+  ASSERT_TRUE(SafetyTestEnv_GetLastErrorEvent(&errorEvent));
+  EXPECT_EQ(eERROR_EXTERNAL_ADC_VOLTAGE_N, errorEvent.upper);
+  EXPECT_EQ(failing, errorEvent.lower);
+}
+
+// Chrome trace of the safety functions
+struct TraceOutput {
+  std::string text;
+  U32 writes;
+};
+
+static void TraceToString(char const *data, U32 length, void *context) {
+  TraceOutput *const output = static_cast<TraceOutput *>(context);
+  output->text.append(data, length);
+  output->writes++;
+}
+
+/// JSON value of the trace, only the parts used by the Chrome trace format.
+struct TraceJson {
+  enum Type { kNull, kLiteral, kNumber, kString, kArray, kObject } type = kNull;
+  double number = 0.0;
+  std::string text;
+  std::vector<TraceJson> items;
+  std::vector<std::pair<std::string, TraceJson>> members;
+
+  TraceJson const *Member(char const *name) const {
+    for (auto const &member : members) {
+      if (member.first == name) {
+        return &member.second;
+      }
+    }
+    return NULL;
+  }
+};
+
+static void SkipJsonSpace(std::string const &text, size_t &pos) {
+  while ((pos < text.size()) && std::isspace((unsigned char)text[pos])) {
+    pos++;
+  }
+}
+
+static bool ParseJsonString(std::string const &text, size_t &pos, std::string *value) {
+  if ((pos >= text.size()) || (text[pos] != '"')) {
+    return false;
+  }
+  for (pos++; pos < text.size(); pos++) {
+    char c = text[pos];
+    if (c == '"') {
+      pos++;
+      return true;
+    }
+    if ((unsigned char)c < 0x20u) {
+      return false;
+    }
+    if (c == '\\') {
+      if (++pos >= text.size()) {
+        return false;
+      }
+      c = text[pos];
+      if (c == 'u') {
+        if ((pos + 4 >= text.size()) ||
+            !std::all_of(text.begin() + pos + 1, text.begin() + pos + 5, [](char h) { return std::isxdigit(h); })) {
+          return false;
+        }
+        pos += 4;
+        c = '?';
+      } else if (std::string("\"\\/bfnrt").find(c) == std::string::npos) {
+        return false;
+      }
+    }
+    value->push_back(c);
+  }
+  return false;
+}
+
+static bool ParseJson(std::string const &text, size_t &pos, TraceJson *value) {
+  SkipJsonSpace(text, pos);
+  if (pos >= text.size()) {
+    return false;
+  }
+  if (text[pos] == '"') {
+    value->type = TraceJson::kString;
+    return ParseJsonString(text, pos, &value->text);
+  }
+  if ((text[pos] == '[') || (text[pos] == '{')) {
+    bool const isArray = (text[pos] == '[');
+    char const close = isArray ? ']' : '}';
+    value->type = isArray ? TraceJson::kArray : TraceJson::kObject;
+    pos++;
+    SkipJsonSpace(text, pos);
+    if ((pos < text.size()) && (text[pos] == close)) {
+      pos++;
+      return true;
+    }
+    while (true) {
+      TraceJson item;
+      std::string name;
+      if (!isArray) {
+        SkipJsonSpace(text, pos);
+        if (!ParseJsonString(text, pos, &name)) {
+          return false;
+        }
+        SkipJsonSpace(text, pos);
+        if ((pos >= text.size()) || (text[pos++] != ':')) {
+          return false;
+        }
+      }
+      if (!ParseJson(text, pos, &item)) {
+        return false;
+      }
+      if (isArray) {
+        value->items.push_back(item);
+      } else {
+        value->members.emplace_back(name, item);
+      }
+      SkipJsonSpace(text, pos);
+      if (pos >= text.size()) {
+        return false;
+      }
+      if (text[pos++] == close) {
+        return true;
+      }
+      if (text[pos - 1] != ',') {
+        return false;
+      }
+    }
+  }
+  for (char const *literal : {"true", "false", "null"}) {
+    if (text.compare(pos, strlen(literal), literal) == 0) {
+      value->type = TraceJson::kLiteral;
+      pos += strlen(literal);
+      return true;
+    }
+  }
+  char const *const start = text.c_str() + pos;
+  char *end = NULL;
+  value->type = TraceJson::kNumber;
+  value->number = strtod(start, &end);
+  pos += (size_t)(end - start);
+  return end != start;
+}
+
+/// Parses the complete trace, nothing may follow the top level value.
+static bool ParseTrace(std::string const &text, TraceJson *trace) {
+  size_t pos = 0;
+
+  if (!ParseJson(text, pos, trace)) {
+    return false;
+  }
+  SkipJsonSpace(text, pos);
+  return (pos == text.size()) && (trace->type == TraceJson::kArray);
+}
+
+TEST_F(SafetyTest, TRACE_RUNTIME_CYCLES_ARE_CHROME_TRACE) {
+  TASK_PARA_STD param = {};
+  SAFETY_POWERSUPPLY_CONFIG config = {};
+  SAFETY_HARDERROR_RECORD record;
+  TraceOutput output = {};
+  TraceJson trace;
+  U32 const cycles = 50;
+  U32 threadNames = 0;
+  U32 executes = 0;
+  U32 watchdogTriggers = 0;
+  std::vector<S32> depth(eSAFETY_TRACE_TRACK_COUNT, 0);
+  std::vector<double> lastTimestamp(eSAFETY_TRACE_TRACK_COUNT, 0.0);
+
+  param.taskDelay = 10 * configTICK_RATE_HZ_MS;
+  ASSERT_TRUE(SafetyTestEnv_AttachStlMemory());
+  ASSERT_TRUE(Safety_Runtime_Startup(&param));
+  EXPECT_FALSE(Safety_Trace_Open(NULL, &output));
+  ASSERT_TRUE(Safety_Trace_Open(TraceToString, &output));
+  EXPECT_FALSE(Safety_Trace_Open(TraceToString, &output));
+
+  Safety_HardErrorTrap_Arm(&record);
+  if (setjmp(record.jumpBuffer) == 0) {
+    Safety_Runtime_Init(&config);
+    for (U32 cycle = 0; cycle < cycles; cycle++) {
+      SafetyTestEnv_SetTicks(cycle * param.taskDelay);
+      Safety_Runtime_Execute();
+    }
+  }
+  Safety_HardErrorTrap_Disarm();
+  ASSERT_EQ(0u, record.stepCount) << "hard error " << (U32)record.hardErrorCode;
+  Safety_Trace_Close();
+
+  // written in blocks of SAFETY_TRACE_BUFFER_SIZE
+  EXPECT_GT(output.writes, 1u);
+  ASSERT_TRUE(ParseTrace(output.text, &trace)) << output.text;
+
+  for (TraceJson const &event : trace.items) {
+    ASSERT_EQ(TraceJson::kObject, event.type);
+    TraceJson const *const name = event.Member("name");
+    TraceJson const *const phase = event.Member("ph");
+    TraceJson const *const pid = event.Member("pid");
+    TraceJson const *const tid = event.Member("tid");
+    ASSERT_TRUE((name != NULL) && (name->type == TraceJson::kString));
+    ASSERT_TRUE((phase != NULL) && (phase->type == TraceJson::kString));
+    ASSERT_TRUE((pid != NULL) && (pid->type == TraceJson::kNumber));
+    ASSERT_TRUE((tid != NULL) && (tid->type == TraceJson::kNumber));
+    ASSERT_LT(tid->number, (double)eSAFETY_TRACE_TRACK_COUNT);
+    EXPECT_EQ(1.0, pid->number);
+    size_t const track = (size_t)tid->number;
+
+    if (phase->text == "M") {
+      ASSERT_NE(nullptr, event.Member("args"));
+      threadNames += (name->text == "thread_name") ? 1u : 0u;
+      continue;
+    }
+
+    // timestamps in microseconds, in order per track
+    TraceJson const *const timestamp = event.Member("ts");
+    ASSERT_TRUE((timestamp != NULL) && (timestamp->type == TraceJson::kNumber));
+    EXPECT_LE(timestamp->number, (cycles - 1) * param.taskDelay * 1000.0 / configTICK_RATE_HZ_MS);
+    EXPECT_GE(timestamp->number, lastTimestamp[track]);
+    lastTimestamp[track] = timestamp->number;
+
+    if (phase->text == "B") {
+      depth[track]++;
+      executes += (name->text == "Safety_Runtime_Execute") ? 1u : 0u;
+    } else if (phase->text == "E") {
+      EXPECT_GT(depth[track], 0) << name->text;
+      depth[track]--;
+    } else {
+      ASSERT_EQ("i", phase->text);
+      ASSERT_NE(nullptr, event.Member("args"));
+      watchdogTriggers += ((track == eSAFETY_TRACE_TRACK_WATCHDOG) && (name->text == "Trigger")) ? 1u : 0u;
+    }
+  }
+
+  EXPECT_EQ((U32)eSAFETY_TRACE_TRACK_COUNT - 1u, threadNames);
+  EXPECT_EQ(cycles, executes);
+  EXPECT_GT(SafetyTestEnv_GetWatchdogTriggers(), 0u);
+  EXPECT_EQ(SafetyTestEnv_GetWatchdogTriggers(), watchdogTriggers);
+  for (S32 open : depth) {
+    EXPECT_EQ(0, open);
+  }
+}
+
+TEST_F(SafetyTest, TRACE_VALID_WITHOUT_CLOSE_AFTER_HARD_ERROR) {
+  TASK_PARA_STD param = {};
+  SAFETY_HARDERROR_RECORD initRecord;
+  SAFETY_HARDERROR_RECORD record;
+  TraceOutput output = {};
+  TraceJson trace;
+
+  param.taskDelay = 10 * configTICK_RATE_HZ_MS;
+  ASSERT_TRUE(SafetyTestEnv_AttachStlMemory());
+  ASSERT_TRUE(Safety_Runtime_Startup(&param));
+  Safety_HardErrorTrap_Arm(&initRecord);
+  if (setjmp(initRecord.jumpBuffer) == 0) {
+    Safety_Runtime_Init(NULL);
+  }
+  Safety_HardErrorTrap_Disarm();
+  ASSERT_TRUE(Safety_Trace_Open(TraceToString, &output));
+
+  Safety_HardErrorTrap_Arm(&record);
+  if (setjmp(record.jumpBuffer) == 0) {
+    Safety_Runtime_Execute();
+  }
+  Safety_HardErrorTrap_Disarm();
+  ASSERT_EQ(HARD_ERR_SAFETY_MEASUREMENT, record.hardErrorCode);
+
+  // the hard error flushed the trace, the closing bracket may be missing
+  ASSERT_FALSE(ParseTrace(output.text, &trace));
+  ASSERT_TRUE(ParseTrace(output.text + "\n]", &trace)) << output.text;
+  ASSERT_FALSE(trace.items.empty());
+  TraceJson const &last = trace.items.back();
+  ASSERT_NE(nullptr, last.Member("tid"));
+  ASSERT_NE(nullptr, last.Member("args"));
+  ASSERT_NE(nullptr, last.Member("args")->Member("value"));
+  EXPECT_EQ((double)eSAFETY_TRACE_TRACK_HARDERROR, last.Member("tid")->number);
+  EXPECT_EQ("Hard error", last.Member("name")->text);
+  EXPECT_EQ((double)HARD_ERR_SAFETY_MEASUREMENT, last.Member("args")->Member("value")->number);
+}
+
+// Host emulation of the STL
+static STL_TmStatus_t RunStlRamTest(STL_MemConfig_t *config) {
+  STL_TmStatus_t status = STL_ERROR;
+
+  EXPECT_EQ(STL_OK, STL_SCH_Init());
+  EXPECT_EQ(STL_OK, STL_SCH_InitRam(&status));
+  EXPECT_EQ(STL_OK, STL_SCH_ConfigureRam(&status, config));
+  for (U32 run = 0; run < 64; run++) {
+    EXPECT_EQ(STL_OK, STL_SCH_RunRamTM(&status));
+    if (status != STL_PARTIAL_PASSED) {
+      break;
+    }
+  }
+  return status;
+}
+
+TEST_F(SafetyTest, HOSTSTL_RAM_CLEAN_RUN_PASSES) {
+  static U32 ram[3 * HOSTSTL_RAM_SECTION_SIZE / sizeof(U32)];
+  STL_MemSubset_t subset = {0x20000000u, 0x20000000u + sizeof(ram) - 1u, NULL};
+  STL_MemConfig_t config = {&subset, 1u};
+  HOSTSTL_STATISTICS statistics = {};
+
+  for (U32 i = 0; i < sizeof(ram) / sizeof(ram[0]); i++) {
+    ram[i] = i * 0x9E3779B9u;
+  }
+  ASSERT_TRUE(HostStl_AttachRam(0x20000000u, ram, sizeof(ram)));
+
+  EXPECT_EQ(STL_PASSED, RunStlRamTest(&config));
+
+  // the test is transparent, every section was tested
+  for (U32 i = 0; i < sizeof(ram) / sizeof(ram[0]); i++) {
+    ASSERT_EQ(i * 0x9E3779B9u, ram[i]) << "word " << i;
+  }
+  HostStl_GetStatistics(&statistics);
+  EXPECT_EQ(3u, statistics.ramSections);
+}
+
+TEST_F(SafetyTest, HOSTSTL_RAM_STUCK_AT_BIT_FAILS) {
+  static U32 ram[3 * HOSTSTL_RAM_SECTION_SIZE / sizeof(U32)];
+  STL_MemSubset_t subset = {0x20000000u, 0x20000000u + sizeof(ram) - 1u, NULL};
+  STL_MemConfig_t config = {&subset, 1u};
+  STL_TmStatus_t status = STL_ERROR;
+
+  memset(ram, 0, sizeof(ram));
+  ASSERT_TRUE(HostStl_AttachRam(0x20000000u, ram, sizeof(ram)));
+  EXPECT_FALSE(HostStl_InjectRamFault(0x30000000u, 0x00000100u, 0u));
+
+  // stuck-at-1 bit in the middle section
+  ASSERT_TRUE(HostStl_InjectRamFault(0x20000000u + HOSTSTL_RAM_SECTION_SIZE + 8u, 0x00000100u, 0u));
+  EXPECT_EQ(STL_FAILED, RunStlRamTest(&config));
+
+  // the failure stays until the reset of the test
+  EXPECT_EQ(STL_OK, STL_SCH_RunRamTM(&status));
+  EXPECT_EQ(STL_FAILED, status);
+
+  // stuck-at-0 bit, the new fault replaces the previous one
+  ASSERT_TRUE(HostStl_InjectRamFault(0x20000000u + HOSTSTL_RAM_SECTION_SIZE + 8u, 0u, 0x80000000u));
+  EXPECT_EQ(STL_FAILED, RunStlRamTest(&config));
+
+  // without the fault the same memory passes
+  HostStl_ClearRamFault();
+  EXPECT_EQ(STL_PASSED, RunStlRamTest(&config));
+}
+
+TEST_F(SafetyTest, HOSTSTL_FLASH_CRC) {
+  static U8 image[4 * STL_FLASH_SECTION_SIZE];
+  STL_MemSubset_t subset = {0x08000000u, 0x08000000u + 2u * STL_FLASH_SECTION_SIZE - 1u, NULL};
+  STL_MemConfig_t config = {&subset, 2u};
+  STL_TmStatus_t status = STL_ERROR;
+
+  for (U32 i = 0; i < sizeof(image); i++) {
+    image[i] = (U8)(i * 7u);
+  }
+  ASSERT_TRUE(HostStl_AttachFlash(0x08000000u, image, sizeof(image)));
+  ASSERT_TRUE(HostStl_UpdateFlashCrc());
+
+  ASSERT_EQ(STL_OK, STL_SCH_Init());
+  ASSERT_EQ(STL_OK, STL_SCH_InitFlash(&status));
+  ASSERT_EQ(STL_OK, STL_SCH_ConfigureFlash(&status, &config));
+  ASSERT_EQ(STL_OK, STL_SCH_RunFlashTM(&status));
+  EXPECT_EQ(STL_PASSED, status);
+
+  // a flipped bit in the second section
+  image[STL_FLASH_SECTION_SIZE + 100u] ^= 0x10u;
+  ASSERT_EQ(STL_OK, STL_SCH_ResetFlash(&status));
+  ASSERT_EQ(STL_OK, STL_SCH_RunFlashTM(&status));
+  EXPECT_EQ(STL_FAILED, status);
+}
+
+TEST_F(SafetyTest, RAMTEST_WRAPPER_RUN_ALL) {
+  ASSERT_TRUE(SafetyTestEnv_AttachStlMemory());
+  ASSERT_TRUE(Stl_SchedulerInit());
+
+  EXPECT_EQ(EN61508_TestPass, RAMTestStl_RunAll());
+  EXPECT_EQ(EN61508_TestPass, RAMTestStl_RunAll());
+
+  // stuck-at-1 bit in the second test region
+  ASSERT_TRUE(HostStl_InjectRamFault((U32)(uintptr_t)RAMTEST_REGION2_START + 8u, 0x00000100u, 0u));
+  EXPECT_EQ(EN61508_TestFail, RAMTestStl_RunAll());
+
+  HostStl_ClearRamFault();
+  EXPECT_EQ(EN61508_TestPass, RAMTestStl_RunAll());
+}
+
+TEST_F(SafetyTest, RAMTEST_WRAPPER_CYCLIC_WITHIN_PROCESS_SAFETY_TIME) {
+  // 8 sections of 128 bytes, 2 sections per call
+  U32 const sectionsPerPass = (RAMTEST_REGION1_SIZE + RAMTEST_REGION2_SIZE + RAMTEST_REGION3_SIZE) / 128u;
+  U32 const callsPerPass = sectionsPerPass / RAMTEST_CYCLIC_NUM_SECTIONS;
+  U32 ticks = 1000u;
+
+  ASSERT_TRUE(SafetyTestEnv_AttachStlMemory());
+  ASSERT_TRUE(Stl_SchedulerInit());
+  EXPECT_EQ(0u, RAMTestStl_GetMaxCallIntervalTicks());
+  EXPECT_EQ(EN61508_TestFail, RAMTestStl_RunCyclic(ticks));
+
+  ASSERT_TRUE(RAMTestStl_SetupTestCyclic(100u));
+  EXPECT_EQ(100u / (callsPerPass + 1u), RAMTestStl_GetMaxCallIntervalTicks());
+
+  // two complete passes with the maximum call interval
+  for (U32 i = 0; i < 2u * callsPerPass; i++) {
+    ASSERT_EQ(EN61508_TestPass, RAMTestStl_RunCyclic(ticks)) << "call " << i;
+    ticks += RAMTestStl_GetMaxCallIntervalTicks();
+  }
+
+  // a fault is found within the next pass
+  ASSERT_TRUE(HostStl_InjectRamFault((U32)(uintptr_t)RAMTEST_REGION3_START + 4u, 0u, 0x00000001u));
+  EN61508_TestResult result = EN61508_TestPass;
+  for (U32 i = 0; (i < callsPerPass) && (result == EN61508_TestPass); i++) {
+    result = RAMTestStl_RunCyclic(ticks);
+  }
+  EXPECT_EQ(EN61508_TestFail, result);
+}
+
+TEST_F(SafetyTest, RAMTEST_WRAPPER_CYCLIC_PROCESS_SAFETY_TIME_EXCEEDED) {
+  U32 ticks = 1000u;
+
+  ASSERT_TRUE(SafetyTestEnv_AttachStlMemory());
+  ASSERT_TRUE(Stl_SchedulerInit());
+  ASSERT_TRUE(RAMTestStl_SetupTestCyclic(100u));
+
+  // the first call takes the time reference, the pass is not completed within the PST
+  EXPECT_EQ(EN61508_TestPass, RAMTestStl_RunCyclic(ticks));
+  EXPECT_EQ(EN61508_TestPass, RAMTestStl_RunCyclic(ticks + 50u));
+  EXPECT_EQ(EN61508_TestFail, RAMTestStl_RunCyclic(ticks + 101u));
+}
+
+TEST_F(SafetyTest, ROMTEST_WRAPPER_RUN_ALL) {
+  ASSERT_TRUE(SafetyTestEnv_AttachStlMemory());
+  ASSERT_TRUE(Stl_SchedulerInit());
+
+  EXPECT_EQ(EN61508_TestPass, ROMTestStl_RunAll());
+  EXPECT_EQ(EN61508_TestPass, ROMTestStl_RunAll());
+
+  // a flipped bit in the last section of the test region
+  SafetyTestEnv_FlipFlashBits((U32)(uintptr_t)ROMTEST_REGION_START + ROMTEST_REGION_SIZE - 1u, 0x01u);
+  EXPECT_EQ(EN61508_TestFail, ROMTestStl_RunAll());
+
+  SafetyTestEnv_FlipFlashBits((U32)(uintptr_t)ROMTEST_REGION_START + ROMTEST_REGION_SIZE - 1u, 0x01u);
+  EXPECT_EQ(EN61508_TestPass, ROMTestStl_RunAll());
+}
+
+TEST_F(SafetyTest, ROMTEST_WRAPPER_CYCLIC_WITHIN_PROCESS_SAFETY_TIME) {
+  // 8 sections of 1 KiB, the last one partially used, 2 sections per call
+  U32 const sectionsPerPass = (ROMTEST_REGION_SIZE + STL_FLASH_SECTION_SIZE - 1u) / STL_FLASH_SECTION_SIZE;
+  U32 const callsPerPass = sectionsPerPass / ROMTEST_CYCLIC_NUM_SECTIONS;
+  U32 ticks = 1000u;
+
+  ASSERT_TRUE(SafetyTestEnv_AttachStlMemory());
+  ASSERT_TRUE(Stl_SchedulerInit());
+  EXPECT_EQ(0u, ROMTestStl_GetMaxCallIntervalTicks());
+
+  ASSERT_TRUE(ROMTestStl_SetupTestCyclic(100u));
+  EXPECT_EQ(100u / (callsPerPass + 1u), ROMTestStl_GetMaxCallIntervalTicks());
+
+  for (U32 i = 0; i < 2u * callsPerPass; i++) {
+    ASSERT_EQ(EN61508_TestPass, ROMTestStl_RunCyclic(ticks)) << "call " << i;
+    ticks += ROMTestStl_GetMaxCallIntervalTicks();
+  }
+
+  // a flipped bit in the first section is found within the next pass
+  SafetyTestEnv_FlipFlashBits((U32)(uintptr_t)ROMTEST_REGION_START + 10u, 0x80u);
+  EN61508_TestResult result = EN61508_TestPass;
+  for (U32 i = 0; (i < callsPerPass) && (result == EN61508_TestPass); i++) {
+    result = ROMTestStl_RunCyclic(ticks);
+  }
+  EXPECT_EQ(EN61508_TestFail, result);
+
+  // the PST is exceeded without a complete pass
+  ASSERT_TRUE(ROMTestStl_SetupTestCyclic(100u));
+  EXPECT_EQ(EN61508_TestFail, ROMTestStl_RunCyclic(ticks + 200u));
+}
+
+TEST_F(SafetyTest, FAULTINJECTION_ARM_BY_NAME) {
+  FAULTINJECTIONSTL_ARM arm = {0u, 1u, FAULTINJECTIONSTL_PROBABILITY_MAX};
+  FAULTINJECTIONSTL_ARM invalid = {0u, 1u, FAULTINJECTIONSTL_PROBABILITY_MAX + 1u};
+  FAULTINJECTIONSTL_STATISTICS statistics = {};
+  FAULTINJECTIONSTL_POINT point = FAULTINJECTIONSTL_POINT_COUNT;
+
+  // every point is found by its name
+  for (U32 i = 0; i < (U32)FAULTINJECTIONSTL_POINT_COUNT; i++) {
+    char const *name = FaultInjectionStl_GetName((FAULTINJECTIONSTL_POINT)i);
+    ASSERT_NE(nullptr, name);
+    ASSERT_TRUE(FaultInjectionStl_Find(name, &point)) << name;
+    EXPECT_EQ(i, (U32)point) << name;
+  }
+  EXPECT_EQ(nullptr, FaultInjectionStl_GetName(FAULTINJECTIONSTL_POINT_COUNT));
+
+  EXPECT_FALSE(FaultInjectionStl_Arm("RAM_RUN_SOMETIMES", &arm));
+  EXPECT_FALSE(FaultInjectionStl_Arm("RAM_RUN_ALL", &invalid));
+  EXPECT_FALSE(FaultInjectionStl_Arm("RAM_RUN_ALL", NULL));
+  EXPECT_FALSE(FaultInjectionStl_GetStatistics("RAM_RUN_SOMETIMES", &statistics));
+
+  // only the armed point injects, the complete CPU test passes the point once
+  // per test module and TM1 is never forced to fail
+  ASSERT_TRUE(SafetyTestEnv_AttachStlMemory());
+  ASSERT_TRUE(Stl_SchedulerInit());
+  arm.skipCount = 1u;
+  ASSERT_TRUE(FaultInjectionStl_Arm("CPU_RUN_ALL", &arm));
+  EXPECT_EQ(EN61508_TestPass, RAMTestStl_RunAll());
+  EXPECT_EQ(EN61508_TestPass, ROMTestStl_RunAll());
+  EXPECT_EQ(EN61508_TestFail, CPUTestStl_RunAll());
+  EXPECT_EQ(EN61508_TestPass, CPUTestStl_RunAll());
+
+  ASSERT_TRUE(FaultInjectionStl_GetStatistics("CPU_RUN_ALL", &statistics));
+  EXPECT_EQ(2u * STL_CPU_TM_MAX, statistics.passCount);
+  EXPECT_EQ(1u, statistics.injectCount);
+  EXPECT_EQ(0u, statistics.stlErrorCount);
+  ASSERT_TRUE(FaultInjectionStl_GetStatistics("RAM_RUN_ALL", &statistics));
+  EXPECT_EQ(1u, statistics.passCount);
+  EXPECT_EQ(0u, statistics.injectCount);
+
+  // rearming resets the statistics
+  ASSERT_TRUE(FaultInjectionStl_Arm("CPU_RUN_ALL", &arm));
+  ASSERT_TRUE(FaultInjectionStl_GetStatistics("CPU_RUN_ALL", &statistics));
+  EXPECT_EQ(0u, statistics.passCount);
+  FaultInjectionStl_DisarmAll();
+  EXPECT_EQ(EN61508_TestPass, CPUTestStl_RunAll());
+}
+
+TEST_F(SafetyTest, FAULTINJECTION_SKIP_AND_TRIGGER_COUNT) {
+  // the third and fourth pass of the cyclic RAM test fail
+  FAULTINJECTIONSTL_ARM arm = {2u, 2u, FAULTINJECTIONSTL_PROBABILITY_MAX};
+  FAULTINJECTIONSTL_STATISTICS statistics = {};
+  U32 ticks = 1000u;
+
+  ASSERT_TRUE(SafetyTestEnv_AttachStlMemory());
+  ASSERT_TRUE(Stl_SchedulerInit());
+  ASSERT_TRUE(FaultInjectionStl_Arm("RAM_RUN_CYCLIC", &arm));
+
+  for (U32 i = 0; i < 6u; i++) {
+    ASSERT_TRUE(RAMTestStl_SetupTestCyclic(100u));
+    EXPECT_EQ(((i == 2u) || (i == 3u)) ? EN61508_TestFail : EN61508_TestPass, RAMTestStl_RunCyclic(ticks))
+        << "pass " << i;
+    ticks += 10u;
+  }
+
+  ASSERT_TRUE(FaultInjectionStl_GetStatistics("RAM_RUN_CYCLIC", &statistics));
+  EXPECT_EQ(6u, statistics.passCount);
+  EXPECT_EQ(2u, statistics.injectCount);
+  EXPECT_EQ(0u, statistics.stlErrorCount);
+
+  // a failed configuration of the cyclic ROM test
+  arm = {0u, 1u, FAULTINJECTIONSTL_PROBABILITY_MAX};
+  ASSERT_TRUE(FaultInjectionStl_Arm("ROM_CONFIGURE_CYCLIC", &arm));
+  EXPECT_FALSE(ROMTestStl_SetupTestCyclic(100u));
+  EXPECT_TRUE(ROMTestStl_SetupTestCyclic(100u));
+  EXPECT_EQ(EN61508_TestPass, ROMTestStl_RunCyclic(ticks));
+}
+
+TEST_F(SafetyTest, FAULTINJECTION_PROBABILITY_REPEATS_WITH_SEED) {
+  FAULTINJECTIONSTL_ARM arm = {0u, FAULTINJECTIONSTL_TRIGGER_UNLIMITED, 250u};
+  FAULTINJECTIONSTL_STATISTICS statistics = {};
+  std::vector<bool> failed[2];
+
+  ASSERT_TRUE(SafetyTestEnv_AttachStlMemory());
+  ASSERT_TRUE(Stl_SchedulerInit());
+
+  for (U32 run = 0; run < 2u; run++) {
+    FaultInjectionStl_SetSeed(12345u);
+    ASSERT_TRUE(FaultInjectionStl_Arm("ROM_RUN_ALL", &arm));
+    for (U32 i = 0; i < 200u; i++) {
+      failed[run].push_back(ROMTestStl_RunAll() == EN61508_TestFail);
+    }
+
+    ASSERT_TRUE(FaultInjectionStl_GetStatistics("ROM_RUN_ALL", &statistics));
+    EXPECT_EQ(200u, statistics.passCount);
+    EXPECT_EQ((U32)std::count(failed[run].begin(), failed[run].end(), true), statistics.injectCount);
+    // 250 per mille of 200 passes
+    EXPECT_GT(statistics.injectCount, 25u);
+    EXPECT_LT(statistics.injectCount, 75u);
+  }
+
+  // the same seed repeats the same injections
+  EXPECT_EQ(failed[0], failed[1]);
+}
+
+TEST_F(SafetyTest, RAMTEST_CONTEXT_INIT_RESETS_DEFAULT_INSTANCE) {
+  static EN61508_MEM_REGION const region = {RAMTEST_REGION2_START, 2u * 128u};
+  RAM_TEST_CONTEXT *const context = RAMTestStl_GetDefaultContext();
+  HOSTSTL_STATISTICS statistics = {};
+
+  ASSERT_TRUE(SafetyTestEnv_AttachStlMemory());
+  ASSERT_TRUE(Stl_SchedulerInit());
+  EXPECT_FALSE(RAMTestStl_ContextInit(context, &region, 0u));
+  EXPECT_FALSE(RAMTestStl_ContextInit(context, &region, RAMTEST_REGIONS_MAX + 1u));
+
+  // the default instance runs on its own region after the init
+  ASSERT_TRUE(RAMTestStl_ContextInit(context, &region, 1u));
+  EXPECT_EQ(EN61508_TestPass, RAMTestStl_RunAll());
+  HostStl_GetStatistics(&statistics);
+  EXPECT_EQ(2u, statistics.ramSections);
+
+  ASSERT_TRUE(RAMTestStl_SetupTestCyclic(100u));
+  EXPECT_NE(0u, RAMTestStl_GetMaxCallIntervalTicks());
+  EXPECT_EQ(EN61508_TestPass, RAMTestStl_RunCyclic(1000u));
+
+  // the init without regions returns to the linker regions and drops the cyclic test
+  ASSERT_TRUE(RAMTestStl_ContextInit(context, NULL, 0u));
+  EXPECT_EQ(RAMTEST_REGION1_START, context->ramRegions[0].start);
+  EXPECT_EQ(3u, context->numRamRegions);
+  EXPECT_EQ(0u, RAMTestStl_GetMaxCallIntervalTicks());
+  EXPECT_EQ(EN61508_TestFail, RAMTestStl_RunCyclic(1010u));
+
+  // 2 sections of the complete and the cyclic test on the own region, 8 on the linker regions
+  EXPECT_EQ(EN61508_TestPass, RAMTestStl_RunAll());
+  HostStl_GetStatistics(&statistics);
+  EXPECT_EQ(2u + RAMTEST_CYCLIC_NUM_SECTIONS + 8u, statistics.ramSections);
+}
+
+TEST_F(SafetyTest, RAMTEST_CONTEXTS_WITH_OWN_REGIONS_AND_SECTIONS) {
+  static EN61508_MEM_REGION const regionsA[] = {{RAMTEST_REGION1_START, 4u * 128u}};
+  static EN61508_MEM_REGION const regionsB[] = {{RAMTEST_REGION2_START, 128u}, {RAMTEST_REGION3_START, 2u * 128u}};
+  RAM_TEST_CONTEXT contextA;
+  RAM_TEST_CONTEXT contextB;
+  HOSTSTL_STATISTICS statistics = {};
+  U32 ticks = 1000u;
+
+  ASSERT_TRUE(SafetyTestEnv_AttachStlMemory());
+  ASSERT_TRUE(Stl_SchedulerInit());
+  ASSERT_TRUE(RAMTestStl_ContextInit(&contextA, regionsA, 1u));
+  ASSERT_TRUE(RAMTestStl_ContextInit(&contextB, regionsB, 2u));
+
+  // A: 4 sections, one per call
+  ASSERT_TRUE(RAMTestStl_ContextSetupTestCyclic(&contextA, 100u, 1u));
+  EXPECT_EQ(100u / 5u, RAMTestStl_ContextGetMaxCallIntervalTicks(&contextA));
+
+  // the RAM test module of the STL belongs to the cyclic test of A
+  EXPECT_FALSE(RAMTestStl_ContextSetupTestCyclic(&contextB, 100u, 3u));
+  EXPECT_EQ(0u, RAMTestStl_ContextGetMaxCallIntervalTicks(&contextB));
+  EXPECT_EQ(EN61508_TestFail, RAMTestStl_ContextRunAll(&contextB));
+  EXPECT_EQ(EN61508_TestFail, RAMTestStl_ContextRunCyclic(&contextB, ticks));
+
+  HostStl_GetStatistics(&statistics);
+  U32 const sectionsBefore = statistics.ramSections;
+  for (U32 i = 0; i < 4u; i++) {
+    ASSERT_EQ(EN61508_TestPass, RAMTestStl_ContextRunCyclic(&contextA, ticks)) << "call " << i;
+    ticks += 10u;
+  }
+  HostStl_GetStatistics(&statistics);
+  EXPECT_EQ(sectionsBefore + 4u, statistics.ramSections);
+
+  // after the release of A, B tests its two regions with 3 sections in one call
+  ASSERT_TRUE(RAMTestStl_ContextInit(&contextA, regionsA, 1u));
+  ASSERT_TRUE(RAMTestStl_ContextSetupTestCyclic(&contextB, 100u, 3u));
+  EXPECT_EQ(100u / 2u, RAMTestStl_ContextGetMaxCallIntervalTicks(&contextB));
+  EXPECT_FALSE(RAMTestStl_ContextSetupTestCyclic(&contextA, 100u, 1u));
+
+  // a fault in the region of A is outside of B
+  ASSERT_TRUE(HostStl_InjectRamFault((U32)(uintptr_t)RAMTEST_REGION1_START + 8u, 0x00000100u, 0u));
+  EXPECT_EQ(EN61508_TestPass, RAMTestStl_ContextRunCyclic(&contextB, ticks));
+  EXPECT_EQ(EN61508_TestPass, RAMTestStl_ContextRunCyclic(&contextB, ticks + 10u));
+  HostStl_GetStatistics(&statistics);
+  EXPECT_EQ(sectionsBefore + 4u + 2u * 3u, statistics.ramSections);
+
+  ASSERT_TRUE(HostStl_InjectRamFault((U32)(uintptr_t)RAMTEST_REGION3_START + 8u, 0x00000100u, 0u));
+  EXPECT_EQ(EN61508_TestFail, RAMTestStl_ContextRunCyclic(&contextB, ticks + 20u));
+}
+
+TEST_F(SafetyTest, ROMTEST_CONTEXT_INIT_RESETS_DEFAULT_INSTANCE) {
+  static EN61508_MEM_REGION const region = {ROMTEST_REGION_START, 2u * STL_FLASH_SECTION_SIZE};
+  ROM_TEST_CONTEXT *const context = ROMTestStl_GetDefaultContext();
+  HOSTSTL_STATISTICS statistics = {};
+
+  ASSERT_TRUE(SafetyTestEnv_AttachStlMemory());
+  ASSERT_TRUE(Stl_SchedulerInit());
+  EXPECT_FALSE(ROMTestStl_ContextInit(context, &region, 0u));
+
+  ASSERT_TRUE(ROMTestStl_ContextInit(context, &region, 1u));
+  EXPECT_EQ(EN61508_TestPass, ROMTestStl_RunAll());
+  HostStl_GetStatistics(&statistics);
+  EXPECT_EQ(2u, statistics.flashSections);
+
+  ASSERT_TRUE(ROMTestStl_SetupTestCyclic(100u));
+  EXPECT_NE(0u, ROMTestStl_GetMaxCallIntervalTicks());
+
+  // the init without regions returns to the linker region and drops the cyclic test
+  ASSERT_TRUE(ROMTestStl_ContextInit(context, NULL, 0u));
+  EXPECT_EQ(ROMTEST_REGION_START, context->flashRegions[0].start);
+  EXPECT_EQ(ROMTEST_REGION_SIZE, context->flashRegions[0].length);
+  EXPECT_EQ(0u, ROMTestStl_GetMaxCallIntervalTicks());
+  EXPECT_EQ(EN61508_TestFail, ROMTestStl_RunCyclic(1000u));
+
+  EXPECT_EQ(EN61508_TestPass, ROMTestStl_RunAll());
+  HostStl_GetStatistics(&statistics);
+  EXPECT_EQ(2u + 8u, statistics.flashSections);
+}
+
+TEST_F(SafetyTest, ROMTEST_CONTEXTS_WITH_OWN_REGIONS_AND_SECTIONS) {
+  static EN61508_MEM_REGION const regionsA[] = {{ROMTEST_REGION_START, 4u * STL_FLASH_SECTION_SIZE}};
+  static EN61508_MEM_REGION const regionsB[] = {
+      {ROMTEST_REGION_START + 4u * STL_FLASH_SECTION_SIZE, 3u * STL_FLASH_SECTION_SIZE}};
+  ROM_TEST_CONTEXT contextA;
+  ROM_TEST_CONTEXT contextB;
+  U32 ticks = 1000u;
+
+  ASSERT_TRUE(SafetyTestEnv_AttachStlMemory());
+  ASSERT_TRUE(Stl_SchedulerInit());
+  ASSERT_TRUE(ROMTestStl_ContextInit(&contextA, regionsA, 1u));
+  ASSERT_TRUE(ROMTestStl_ContextInit(&contextB, regionsB, 1u));
+
+  // A: 4 sections, two per call
+  ASSERT_TRUE(ROMTestStl_ContextSetupTestCyclic(&contextA, 100u, 2u));
+  EXPECT_EQ(100u / 3u, ROMTestStl_ContextGetMaxCallIntervalTicks(&contextA));
+  EXPECT_FALSE(ROMTestStl_ContextSetupTestCyclic(&contextB, 100u, 1u));
+  EXPECT_EQ(EN61508_TestFail, ROMTestStl_ContextRunAll(&contextB));
+
+  // a flipped bit in the region of B is outside of A
+  SafetyTestEnv_FlipFlashBits((U32)(uintptr_t)regionsB[0].start + 4u, 0x02u);
+  for (U32 i = 0; i < 4u; i++) {
+    ASSERT_EQ(EN61508_TestPass, ROMTestStl_ContextRunCyclic(&contextA, ticks)) << "call " << i;
+    ticks += 10u;
+  }
+
+  // after the release of A, B tests its 3 sections one per call
+  ASSERT_TRUE(ROMTestStl_ContextInit(&contextA, regionsA, 1u));
+  ASSERT_TRUE(ROMTestStl_ContextSetupTestCyclic(&contextB, 100u, 1u));
+  EXPECT_EQ(100u / 4u, ROMTestStl_ContextGetMaxCallIntervalTicks(&contextB));
+  EXPECT_EQ(EN61508_TestFail, ROMTestStl_ContextRunCyclic(&contextB, ticks));
+}
+
+TEST_F(SafetyTest, CPUTEST_CONTEXTS_ARE_INDEPENDENT) {
+  CPU_TEST_CONTEXT contextA;
+  CPU_TEST_CONTEXT contextB;
+
+  ASSERT_TRUE(Stl_SchedulerInit());
+  ASSERT_TRUE(CPUTestStl_ContextInit(&contextA));
+  ASSERT_TRUE(CPUTestStl_ContextInit(&contextB));
+  ASSERT_TRUE(CPUTestStl_ContextSetupTestCyclic(&contextA, 130u));
+  ASSERT_TRUE(CPUTestStl_ContextSetupTestCyclic(&contextB, 260u));
+  EXPECT_EQ(130u / (STL_CPU_TM_MAX + 1u), CPUTestStl_ContextGetMaxCallIntervalTicks(&contextA));
+  EXPECT_EQ(260u / (STL_CPU_TM_MAX + 1u), CPUTestStl_ContextGetMaxCallIntervalTicks(&contextB));
+
+  // each instance steps through its own test modules
+  for (U32 i = 0; i < 3u; i++) {
+    ASSERT_EQ(EN61508_TestPass, CPUTestStl_ContextRunCyclic(&contextA, 1000u + i));
+  }
+  ASSERT_EQ(EN61508_TestPass, CPUTestStl_ContextRunCyclic(&contextB, 1000u));
+  EXPECT_EQ(3u, (U32)contextA.cpuTestCyclic.testIndex);
+  EXPECT_EQ(1u, (U32)contextB.cpuTestCyclic.testIndex);
+  EXPECT_EQ(EN61508_TestPass, CPUTestStl_ContextRunAll(&contextB));
+  EXPECT_EQ(EN61508_TestPass, CPUTestStl_ContextRunCyclic(&contextA, 1003u));
+
+  // the init of the default instance drops its cyclic test
+  ASSERT_TRUE(CPUTestStl_SetupTestCyclic(130u));
+  EXPECT_EQ(EN61508_TestPass, CPUTestStl_RunCyclic(1000u));
+  ASSERT_TRUE(CPUTestStl_ContextInit(CPUTestStl_GetDefaultContext()));
+  EXPECT_EQ(0u, CPUTestStl_GetMaxCallIntervalTicks());
+  EXPECT_EQ(EN61508_TestFail, CPUTestStl_RunCyclic(1001u));
+  EXPECT_EQ(STL_CPU_TM1_IDX, CPUTestStl_GetDefaultContext()->cpuTestCyclic.testIndex);
+}
@@ -0,0 +1,718 @@
+/*******************************************************************************
+ * Copyright (c) 2026 TWK-ELEKTRONIK GmbH. All rights reserved.
+ ******************************************************************************/
+
+/*
+ * Testumgebung der Modultests, siehe safety_module_tests_env.h.
+ *
+ * Die Module werden direkt eingebunden, damit die Tests mit den Feature-Flags
+ * aus safety_module_tests_env.h laufen und der Zustand der Module zwischen den
+ * Tests zurückgesetzt werden kann. Die STL-Wrapper laufen mit der
+ * Host-Emulation der STL (HostStl.c), die Zieladressen der RAM- und ROM-Tests
+ * sind in safety_module_tests_env.h statt über Linker-Symbole festgelegt. Die
+ * Einbaustellen des Fehlereinbaus (FaultInjectionStl.c) sind einkompiliert.
+ */
+
+// Gemeinsame Headerdateien einbinden ---------------------------------------
+#include "safety_module_tests_env.h"
+
+#include <string.h>
+
+// Module direkt einbinden, der Zustand ist static
+#include "safety_startup.c"
+#include "safety_runtime.c"
+#include "safety_rtos.c"
+#include "safety_powersupply.c"
+#include "safety_checkpoint.c"
+#include "safety_register.c"
+#include "safety_filter.c"
+#include "safety_temperature.c"
+#include "safety_event.c"
+#include "safety_record.c"
+#include "safety_trace.c"
+#include "STM32_Safety_STL_API/SafetyStl.c"
+#include "STM32_Safety_STL_API/HostStl.c"
+#include "STM32_Safety_STL_API/CPUTestStl.c"
+#include "STM32_Safety_STL_API/RAMTestStl.c"
+#include "STM32_Safety_STL_API/ROMTestStl.c"
+#include "STM32_Safety_STL_API/FaultInjectionStl.c"
+
+// Spezielle Headerdateien einbinden ----------------------------------------
+#include "ADC/ADC_Driver.h"
+#include "ErrorLogging/error_logging.h"
+
+// Compiler Direktiven ------------------------------------------------------
+
+#if !FEATURE_SAFETYCHECK_RUNTIME
+#error "The module tests need FEATURE_SAFETYCHECK_RUNTIME"
+#endif
+
+// Makros -------------------------------------------------------------------
+
+/// Temperature after SafetyTestEnv_Reset() in °C.
+#define TEST_ENV_TEMPERATURE_DEFAULT    (25.0f)
+
+// Allgemeine Definitionen --------------------------------------------------
+
+/// Voltage of an ADC pin.
+typedef struct
+{
+    U32 pin;                    ///< Pin of the ADC channel
+    F32 voltage;                ///< Voltage at the pin in V
+} TEST_ENV_PIN_VOLTAGE;
+
+// externe Variablen --------------------------------------------------------
+
+/// Virtual time of RTOS_GetTime().
+static RTOS_TIME testEnvTicks = 0;
+
+/// Voltages of the ADC pins, unset pins return 0 V.
+static TEST_ENV_PIN_VOLTAGE testEnvPinVoltages[SAFETY_TEST_ENV_PINS_MAX];
+
+/// Number of used entries of testEnvPinVoltages.
+static U32 testEnvPinVoltageCount = 0;
+
+/// Values of the external ADCs, published as frame by SafetyTestEnv_PublishExternalAdc().
+static MAX116XX_ADC_VALUES testEnvExternalAdcValues[MAX116XX_NUMBER_OF_ADCS];
+
+/// Set until the next read of a frame publishes testEnvExternalAdcValues.
+static bool testEnvPublishDuringRead = false;
+
+/// Set if every read of a frame publishes testEnvExternalAdcValues.
+static bool testEnvPublishDuringEveryRead = false;
+
+/// Value written into the next frame after the publication during the read.
+static F32 testEnvUnpublishedValue = 0.0f;
+
+/// External ADC and channel of testEnvUnpublishedValue.
+static U32 testEnvUnpublishedAdc = 0;
+static U32 testEnvUnpublishedChannel = 0;
+
+/// Temperature of the TMP144 in °C.
+static F32 testEnvTemperature = TEST_ENV_TEMPERATURE_DEFAULT;
+
+/// Set if TMP144_TemperatureValuePeek() returns testEnvTemperature.
+static bool testEnvTemperatureValid = true;
+
+/// Number of calls of SendErrorMsgEvent().
+static U32 testEnvErrorEventCount = 0;
+
+/// Last error event.
+static SAFETY_TEST_ENV_ERROR_EVENT testEnvLastErrorEvent;
+
+/// Number of calls of SendMsgEvent().
+static U32 testEnvMsgEventCount = 0;
+
+/// Set if the event system rejects the events.
+static bool testEnvEventSystemBusy = false;
+
+/// Content of the backup register of the hard error code.
+static U32 testEnvNonvolatileError = 0;
+
+/// Number of calls of WATCHDOG_Trigger().
+static U32 testEnvWatchdogTriggers = 0;
+
+/// Reference count of the program flow monitoring.
+static U32 testEnvProgFlowReference = 0;
+
+/// Number of calls of EN61508_ProgFlow_IncCycleCounter().
+static U32 testEnvProgFlowCycles = 0;
+
+/// Safety cycles run during the next Safety_Record_Read().
+static U32 testEnvRecordCyclesDuringRead = 0;
+
+/// Size of the flash image of the host STL, test region and CRC area.
+#define TEST_ENV_STL_FLASH_SIZE     (0x2000u)
+
+/// RAM of the RAM test regions, attached by SafetyTestEnv_AttachStlMemory().
+static U32 testEnvStlRam[(RAMTEST_REGION1_SIZE + RAMTEST_REGION2_SIZE + RAMTEST_REGION3_SIZE) / sizeof(U32)];
+
+/// Flash image of the ROM test region, attached by SafetyTestEnv_AttachStlMemory().
+static U8 testEnvStlFlash[TEST_ENV_STL_FLASH_SIZE];
+
+/// Names and priorities of the tasks created with RTOS_TaskCreate().
+static char const * testEnvTaskNames[SAFETY_TEST_ENV_TASKS_MAX];
+static U8 testEnvTaskPriorities[SAFETY_TEST_ENV_TASKS_MAX];
+
+/// Number of used entries of testEnvTaskNames and testEnvTaskPriorities.
+static U32 testEnvTaskCount = 0;
+
+/// Publishes testEnvExternalAdcValues as new frame like the external ADC task.
+static void SafetyTestEnv_PublishExternalAdc(void);
+
+// Treiber und Betriebssystem des Hosts -------------------------------------
+
+RTOS_TIME RTOS_GetTime(void)
+    {
+    return testEnvTicks;
+    }
+
+bool RTOS_MutexCreate(RTOS_MUTEX * mutex)
+    {
+    (void) mutex;
+    return true;
+    }
+
+bool RTOS_TaskCreate(RTOS_TASK * task, char const * name, RTOS_TASK_FUNCTION function, U8 priority, void * parameter)
+    {
+    (void) task;
+    (void) function;
+    (void) parameter;
+
+    if(testEnvTaskCount < SAFETY_TEST_ENV_TASKS_MAX)
+        {
+        testEnvTaskNames[testEnvTaskCount] = name;
+        testEnvTaskPriorities[testEnvTaskCount] = priority;
+        testEnvTaskCount++;
+        }
+    return true;
+    }
+
+void RTOS_DelayUntil(RTOS_TIME * lastWakeTime, U32 delay)
+    {
+    *lastWakeTime += delay;
+    testEnvTicks = *lastWakeTime;
+    }
+
+eADC_RESULT ADC_InitSingleChannel(U32 pin)
+    {
+    (void) pin;
+    return eADC_TRUE;
+    }
+
+eADC_RESULT ADC_SampleSingleChannel(U32 pin, float * value)
+    {
+    U32 i;
+
+    *value = 0.0f;
+    for(i = 0; i < testEnvPinVoltageCount; i++)
+        {
+        if(testEnvPinVoltages[i].pin == pin)
+            {
+            *value = testEnvPinVoltages[i].voltage;
+            }
+        }
+    return eADC_TRUE;
+    }
+
+void ADC_TemperatureSensorEnable(void)
+    {
+    }
+
+void ADC_TemperatureSensorDisable(void)
+    {
+    }
+
+bool TMP144_TemperatureValuePeek(float * value)
+    {
+    *value = testEnvTemperature;
+    return testEnvTemperatureValid;
+    }
+
+bool SendMsgEvent(U32 event, U32 value)
+    {
+    (void) event;
+    (void) value;
+    if(testEnvEventSystemBusy)
+        {
+        return false;
+        }
+    testEnvMsgEventCount++;
+    return true;
+    }
+
+bool SendErrorMsgEvent(U32 event, U8 upper, U8 intermediate, U8 lower)
+    {
+    if(testEnvEventSystemBusy)
+        {
+        return false;
+        }
+    testEnvLastErrorEvent.event = event;
+    testEnvLastErrorEvent.upper = upper;
+    testEnvLastErrorEvent.intermediate = intermediate;
+    testEnvLastErrorEvent.lower = lower;
+    testEnvErrorEventCount++;
+    return true;
+    }
+
+void WATCHDOG_Trigger(void)
+    {
+    testEnvWatchdogTriggers++;
+    }
+
+void WATCHDOG_InitExtended(U32 timeoutMs, U32 windowPercent)
+    {
+    (void) timeoutMs;
+    (void) windowPercent;
+    }
+
+void System_InterruptDisable(void)
+    {
+    }
+
+ESYSTEM_RESET_SOURCE System_GetResetSource(void)
+    {
+    return (ESYSTEM_RESET_SOURCE) 0;
+    }
+
+void RTCDrv_Enable(void)
+    {
+    }
+
+void RTCDrv_SetNonVolatileMemory(U32 reg, U32 value)
+    {
+    if(reg == RTC_REGNUM_ERROR)
+        {
+        testEnvNonvolatileError = value;
+        }
+    }
+
+U32 RTCDrv_GetNonVolatileMemory(U32 reg, U32 * value)
+    {
+    *value = (reg == RTC_REGNUM_ERROR) ? testEnvNonvolatileError : 0u;
+    return TRUE;
+    }
+
+bool M41T62_Init(T_M41T62 * instance, U32 channel, U32 address, void (*callback)(U32))
+    {
+    (void) instance;
+    (void) channel;
+    (void) address;
+    (void) callback;
+    return true;
+    }
+
+U32 ErrorLog_CountStoredErrors(void)
+    {
+    return 0;
+    }
+
+bool ErrorLog_Read(U32 * data, U32 index, U32 size)
+    {
+    (void) data;
+    (void) index;
+    (void) size;
+    return false;
+    }
+
+void ErrorLog_Append(U32 * data, U32 size)
+    {
+    (void) data;
+    (void) size;
+    }
+
+void ErrorLog_AppendHardError(U32 * data, U32 size)
+    {
+    (void) data;
+    (void) size;
+    }
+
+HARD_ERROR_READ_STATUS ErrorLog_ReadHardError(U32 * data, U32 size)
+    {
+    (void) data;
+    (void) size;
+    return HARD_ERROR_READ_NONE;
+    }
+
+bool EN61508_ProgFlow_Init(EN61508_PROGRAMMFLOW * progFlow, U32 reference, U32 tolerance, RTOS_MUTEX * mutex)
+    {
+    (void) progFlow;
+    (void) tolerance;
+    (void) mutex;
+    testEnvProgFlowReference = reference;
+    return true;
+    }
+
+bool EN61508_ProgFlow_Add(EN61508_PROGRAMMFLOW * progFlow)
+    {
+    (void) progFlow;
+    return true;
+    }
+
+bool EN61508_ProgFlow_CheckCycleCounterAll(void)
+    {
+    return true;
+    }
+
+void EN61508_ProgFlow_IncCycleCounter(EN61508_PROGRAMMFLOW * progFlow)
+    {
+    (void) progFlow;
+    testEnvProgFlowCycles++;
+    }
+
+bool Safety_Runtime_RegisterTest(void)
+    {
+    return true;
+    }
+
+// Funktionsbereich ---------------------------------------------------------
+
+static void SafetyTestEnv_PublishExternalAdc(void)
+    {
+    memcpy(Safety_Powersupply_GetExternalAdcFrameBuffer(), testEnvExternalAdcValues, sizeof(testEnvExternalAdcValues));
+    Safety_Powersupply_PublishExternalAdcFrame();
+    }
+//------------------------------------------------------------------------------
+
+void SafetyTestEnv_Reset(void)
+    {
+    testEnvTicks = 0;
+    memset(testEnvPinVoltages, 0, sizeof(testEnvPinVoltages));
+    testEnvPinVoltageCount = 0;
+    memset(testEnvExternalAdcValues, 0, sizeof(testEnvExternalAdcValues));
+    memset(externalAdcFrames, 0, sizeof(externalAdcFrames));
+    externalAdcFrameSequence = 0;
+    SafetyTestEnv_PublishExternalAdc();
+    testEnvPublishDuringRead = false;
+    testEnvPublishDuringEveryRead = false;
+    testEnvTemperature = TEST_ENV_TEMPERATURE_DEFAULT;
+    testEnvTemperatureValid = true;
+    testEnvErrorEventCount = 0;
+    memset(&testEnvLastErrorEvent, 0, sizeof(testEnvLastErrorEvent));
+    testEnvMsgEventCount = 0;
+    testEnvEventSystemBusy = false;
+    testEnvNonvolatileError = 0;
+    testEnvWatchdogTriggers = 0;
+    testEnvProgFlowReference = 0;
+    testEnvProgFlowCycles = 0;
+    testEnvRecordCyclesDuringRead = 0;
+    testEnvTaskCount = 0;
+
+    // safety_runtime.c
+    lastWdgTrigger = 0;
+    nominalTaskDelayTicks = 0;
+    stlMaxCallIntervalTicks = RTOS_MAX_TIMEOUT;
+    measurementPeriodTicks = 0;
+    nextMeasurementTicks = 0;
+    lastExecuteTicks = 0;
+    firstExecute = true;
+    measurementCycleDue = false;
+    lastRtcSecondTicks = 0;
+    memset(internalCheckState, 0, sizeof(internalCheckState));
+    numCheckTables = 0;
+    checksStarted = false;
+    nextCustomCheckTicks = 0;
+    gulRTCSekundeAbgelaufen = FALSE;
+
+    // safety_rtos.c
+    memset(&taskStatistics, 0, sizeof(taskStatistics));
+    taskStatisticsSequence = 0;
+    taskStatisticsResetRequest = FALSE;
+    loadBusyTime = 0;
+    loadElapsedTime = 0;
+
+    // safety_powersupply.c
+    memset(&powerSupplyDefault, 0, sizeof(powerSupplyDefault));
+    tVCCExternalAdcChannel1Avg = 0.0f;
+    tVCCExternalAdcChannel2Avg = 0.0f;
+    tVCCExternalAdcChannel3Avg = 0.0f;
+
+    // SafetyStl.c
+    stlSchedulerState = STL_SCHEDULER_IDLE;
+
+    // HostStl.c
+    HostStl_Reset();
+
+    // CPUTestStl.c
+    cpuTestDefaultInitialized = false;
+
+    // RAMTestStl.c
+    memset(&ramTestDefault, 0, sizeof(ramTestDefault));
+    ramTestConfigured = NULL;
+
+    // ROMTestStl.c
+    memset(&romTestDefault, 0, sizeof(romTestDefault));
+    romTestConfigured = NULL;
+
+    // FaultInjectionStl.c
+    FaultInjectionStl_DisarmAll();
+    FaultInjectionStl_SetSeed(0u);
+    injectionActive = false;
+
+    // safety_register.c
+    memset(blocks, 0, sizeof(blocks));
+    memset(expectedCrc, 0, sizeof(expectedCrc));
+    allocatedBlockCount = 0;
+    memset((void *) blockValid, 0, sizeof(blockValid));
+    nextBlock = 0;
+    checkedInPass = 0;
+    passStartTicks = 0;
+    passStarted = false;
+
+    // safety_checkpoint.c
+    checkinMask = 0;
+    activeMask = 0;
+    allocatedCount = 0;
+    memset(deadlineTicks, 0, sizeof(deadlineTicks));
+    memset(lastCheckinTicks, 0, sizeof(lastCheckinTicks));
+    missedMask = 0;
+
+    // safety_event.c
+    memset(eventQueue, 0, sizeof(eventQueue));
+    eventHead = 0;
+    eventTail = 0;
+    memset(&eventStatistics, 0, sizeof(eventStatistics));
+
+    // safety_record.c
+    recordHead = 0;
+    recordTail = 0;
+    recordCommitted = 0;
+    recordReadPosition = 0;
+    recordOverflows = 0;
+    recordCycleStart = 0;
+    recordInCycle = false;
+    recordCycleDiscarded = false;
+    recordActive = false;
+    recordStopRequested = false;
+    recordDroppedCycles = 0;
+
+    // safety_trace.c
+    traceFill = 0;
+    traceSink = NULL;
+    traceContext = NULL;
+    traceFirstEvent = true;
+
+    // safety_temperature.c
+    calibrationMicrovolt = SAFETY_TEMPERATURE_CAL1_MICROVOLT;
+    calibrationSlope = TEMPERATURE_SLOPE(TEMPERATURE_CAL_SPAN_MICROVOLT);
+    }
+//------------------------------------------------------------------------------
+
+void SafetyTestEnv_SetTicks(RTOS_TIME const ticks)
+    {
+    testEnvTicks = ticks;
+    }
+//------------------------------------------------------------------------------
+
+void SafetyTestEnv_AdvanceTicks(U32 const ticks)
+    {
+    testEnvTicks += ticks;
+    }
+//------------------------------------------------------------------------------
+
+RTOS_TIME SafetyTestEnv_GetTicks(void)
+    {
+    return testEnvTicks;
+    }
+//------------------------------------------------------------------------------
+
+void SafetyTestEnv_SetPinVoltage(U32 const pin, F32 const voltage)
+    {
+    U32 i;
+
+    for(i = 0; i < testEnvPinVoltageCount; i++)
+        {
+        if(testEnvPinVoltages[i].pin == pin)
+            {
+            testEnvPinVoltages[i].voltage = voltage;
+            return;
+            }
+        }
+
+    if(testEnvPinVoltageCount < SAFETY_TEST_ENV_PINS_MAX)
+        {
+        testEnvPinVoltages[testEnvPinVoltageCount].pin = pin;
+        testEnvPinVoltages[testEnvPinVoltageCount].voltage = voltage;
+        testEnvPinVoltageCount++;
+        }
+    }
+//------------------------------------------------------------------------------
+
+void SafetyTestEnv_SetExternalAdcValue(U32 const adc, U32 const channel, F32 const value)
+    {
+    if((adc < MAX116XX_NUMBER_OF_ADCS)
+            && (channel < (sizeof(testEnvExternalAdcValues[0].f32Data) / sizeof(testEnvExternalAdcValues[0].f32Data[0]))))
+        {
+        testEnvExternalAdcValues[adc].f32Data[channel] = value;
+        SafetyTestEnv_PublishExternalAdc();
+        }
+    }
+//------------------------------------------------------------------------------
+
+void SafetyTestEnv_WithholdExternalAdc(void)
+    {
+    memset(externalAdcFrames, 0, sizeof(externalAdcFrames));
+    externalAdcFrameSequence = 0;
+    }
+//------------------------------------------------------------------------------
+
+void SafetyTestEnv_PublishExternalAdcDuringRead(U32 const adc, U32 const channel, F32 const value,
+                                                F32 const unpublishedValue)
+    {
+    if((adc < MAX116XX_NUMBER_OF_ADCS)
+            && (channel < (sizeof(testEnvExternalAdcValues[0].f32Data) / sizeof(testEnvExternalAdcValues[0].f32Data[0]))))
+        {
+        testEnvExternalAdcValues[adc].f32Data[channel] = value;
+        testEnvUnpublishedValue = unpublishedValue;
+        testEnvUnpublishedAdc = adc;
+        testEnvUnpublishedChannel = channel;
+        testEnvPublishDuringRead = true;
+        }
+    }
+//------------------------------------------------------------------------------
+
+void SafetyTestEnv_PublishExternalAdcDuringEveryRead(bool const enable)
+    {
+    testEnvPublishDuringEveryRead = enable;
+    }
+//------------------------------------------------------------------------------
+
+void SafetyTestEnv_FrameReadHook(void)
+    {
+    if(testEnvPublishDuringEveryRead)
+        {
+        SafetyTestEnv_PublishExternalAdc();
+        }
+    else if(testEnvPublishDuringRead)
+        {
+        testEnvPublishDuringRead = false;
+        SafetyTestEnv_PublishExternalAdc();
+
+        // Die ADC-Task beginnt den nächsten Frame, das ist der gerade gelesene
+        Safety_Powersupply_GetExternalAdcFrameBuffer()[testEnvUnpublishedAdc].f32Data[testEnvUnpublishedChannel] = testEnvUnpublishedValue;
+        }
+    }
+//------------------------------------------------------------------------------
+
+void SafetyTestEnv_RecordCyclesDuringRead(U32 const cycles)
+    {
+    testEnvRecordCyclesDuringRead = cycles;
+    }
+//------------------------------------------------------------------------------
+
+void SafetyTestEnv_RecordReadHook(void)
+    {
+    U32 cycles = testEnvRecordCyclesDuringRead;
+
+    // Die Sicherheitstask unterbricht das Lesen
+    testEnvRecordCyclesDuringRead = 0;
+    while(cycles > 0u)
+        {
+        testEnvTicks += 10u * configTICK_RATE_HZ_MS;
+        Safety_Powersupply_Check();
+        cycles--;
+        }
+    }
+//------------------------------------------------------------------------------
+
+SAFETY_POWERSUPPLY_CONTEXT * SafetyTestEnv_GetPowersupplyContext(void)
+    {
+    return &powerSupplyDefault;
+    }
+//------------------------------------------------------------------------------
+
+bool SafetyTestEnv_ReadExternalAdcValue(U32 const adc, U32 const channel, F32 * const value)
+    {
+    return Safety_Powersupply_PeekExternalAdcValue(&powerSupplyDefault, (U8) adc, (U8) channel, value);
+    }
+//------------------------------------------------------------------------------
+
+void SafetyTestEnv_SetTemperature(F32 const temperature)
+    {
+    testEnvTemperature = temperature;
+    }
+//------------------------------------------------------------------------------
+
+void SafetyTestEnv_SetTemperatureValid(bool const valid)
+    {
+    testEnvTemperatureValid = valid;
+    }
+//------------------------------------------------------------------------------
+
+U32 SafetyTestEnv_GetErrorEventCount(void)
+    {
+    return testEnvErrorEventCount;
+    }
+//------------------------------------------------------------------------------
+
+bool SafetyTestEnv_GetLastErrorEvent(SAFETY_TEST_ENV_ERROR_EVENT * const errorEvent)
+    {
+    if(testEnvErrorEventCount == 0u)
+        {
+        return false;
+        }
+
+    *errorEvent = testEnvLastErrorEvent;
+    return true;
+    }
+//------------------------------------------------------------------------------
+
+U32 SafetyTestEnv_GetMsgEventCount(void)
+    {
+    return testEnvMsgEventCount;
+    }
+//------------------------------------------------------------------------------
+
+void SafetyTestEnv_SetEventSystemBusy(bool const busy)
+    {
+    testEnvEventSystemBusy = busy;
+    }
+//------------------------------------------------------------------------------
+
+bool SafetyTestEnv_AttachStlMemory(void)
+    {
+    U32 i;
+
+    for(i = 0; i < sizeof(testEnvStlFlash); i++)
+        {
+        testEnvStlFlash[i] = (U8) (i * 7u);
+        }
+
+    return HostStl_AttachRam((U32) (uintptr_t) RAMTEST_REGION1_START, testEnvStlRam, sizeof(testEnvStlRam))
+           && HostStl_AttachFlash((U32) (uintptr_t) ROMTEST_REGION_START, testEnvStlFlash, sizeof(testEnvStlFlash))
+           && HostStl_UpdateFlashCrc();
+    }
+//------------------------------------------------------------------------------
+
+void SafetyTestEnv_FlipFlashBits(U32 const address, U8 const mask)
+    {
+    testEnvStlFlash[address - (U32) (uintptr_t) ROMTEST_REGION_START] ^= mask;
+    }
+//------------------------------------------------------------------------------
+
+bool SafetyTestEnv_GetCreatedTask(char const * const name, U8 * const priority)
+    {
+    U32 i;
+
+    for(i = 0; i < testEnvTaskCount; i++)
+        {
+        if(strcmp(testEnvTaskNames[i], name) == 0)
+            {
+            *priority = testEnvTaskPriorities[i];
+            return true;
+            }
+        }
+    return false;
+    }
+//------------------------------------------------------------------------------
+
+U32 SafetyTestEnv_GetNonvolatileError(void)
+    {
+    return testEnvNonvolatileError;
+    }
+//------------------------------------------------------------------------------
+
+U32 SafetyTestEnv_GetWatchdogTriggers(void)
+    {
+    return testEnvWatchdogTriggers;
+    }
+//------------------------------------------------------------------------------
+
+U32 SafetyTestEnv_GetProgFlowReference(void)
+    {
+    return testEnvProgFlowReference;
+    }
+//------------------------------------------------------------------------------
+
+U32 SafetyTestEnv_GetProgFlowCycles(void)
+    {
+    return testEnvProgFlowCycles;
+    }
+//------------------------------------------------------------------------------
+
+void SafetyTestEnv_UpdateTaskStatistics(U32 const executionTime, U32 const period,
+                                        U32 const expectedPeriod, U32 const taskDelay)
+    {
+    Safety_Task_UpdateStatistics(executionTime, period, expectedPeriod, taskDelay);
+    }
+//------------------------------------------------------------------------------
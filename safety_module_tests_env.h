@@ -0,0 +1,282 @@
+/*******************************************************************************
+ * Copyright (c) 2026 TWK-ELEKTRONIK GmbH. All rights reserved.
+ ******************************************************************************/
+
+/**
+ * \defgroup safety_module_tests_env Testumgebung der Modultests
+ *
+ * Umgebung der Unittests in safety_module_tests.cc. Die Module werden in
+ * safety_module_tests_env.c direkt eingebunden und mit den hier festgelegten
+ * Feature-Flags übersetzt. Treiber und Betriebssystem sind durch steuerbare
+ * Ersatzfunktionen nachgebildet:
+ *
+ *  (#) Zeit: RTOS_GetTime() liefert eine virtuelle Zeit, die nur durch
+ *      SafetyTestEnv_SetTicks() und SafetyTestEnv_AdvanceTicks() fortschreitet.
+ *  (#) Messwerte: ADC_SampleSingleChannel() liefert die Spannung aus
+ *      SafetyTestEnv_SetPinVoltage(), TMP144_TemperatureValuePeek() die
+ *      Temperatur aus SafetyTestEnv_SetTemperature(). Die Werte der externen
+ *      ADCs aus SafetyTestEnv_SetExternalAdcValue() werden wie von der
+ *      ADC-Task als Frame veröffentlicht, auch während die Sicherheitstask
+ *      einen Frame liest. Für den Anlauf der Quellen liefert der TMP144 nach
+ *      SafetyTestEnv_SetTemperatureValid() keinen Wert und
+ *      SafetyTestEnv_WithholdExternalAdc() verwirft die Frames der externen ADCs.
+ *  (#) Ereignisse: SendErrorMsgEvent() und SendMsgEvent() werden gezählt,
+ *      das letzte Fehlerereignis bleibt abrufbar. Mit
+ *      SafetyTestEnv_SetEventSystemBusy() nimmt das Eventsystem keine
+ *      Ereignisse an.
+ *  (#) Speicher der STL: SafetyTestEnv_AttachStlMemory() blendet RAM und ein
+ *      Flash-Image mit gültigen CRCs unter den Zieladressen der RAM- und
+ *      ROM-Tests (RAMTEST_REGION1_START usw.) in der Host-Emulation ein.
+ *  (#) Tasks: RTOS_TaskCreate() startet keine Task, Name und Priorität sind
+ *      mit SafetyTestEnv_GetCreatedTask() abrufbar.
+ *  (#) Backup-Register: Der Hard-Error-Code aus Safety_SetNonvolatileError()
+ *      bleibt mit SafetyTestEnv_GetNonvolatileError() abrufbar.
+ *  (#) Programmablaufkontrolle: Der Referenzwert aus EN61508_ProgFlow_Init()
+ *      und die Aufrufe von EN61508_ProgFlow_IncCycleCounter() werden
+ *      festgehalten.
+ *  (#) Aufzeichnung: Mit SafetyTestEnv_RecordCyclesDuringRead() zeichnet die
+ *      Sicherheitstask Zyklen auf, während Safety_Record_Read() liest.
+ *
+ * Die Library DataProcess_Averaging wird nicht ersetzt, sie wird wie im Gerät
+ * gelinkt.
+ *
+ * Jeder Test beginnt mit SafetyTestEnv_Reset(). Die Ersatzfunktionen sind nicht
+ * reentrant, die Tests laufen in einem Thread.
+ * @{
+ */
+#ifndef GLOBAL_SAFETY_SAFETY_MODULE_TESTS_ENV_H_
+#define GLOBAL_SAFETY_SAFETY_MODULE_TESTS_ENV_H_
+
+// Compiler Direktiven ------------------------------------------------------
+
+// Konfiguration der Modultests, vor allen Headern der Module festgelegt
+
+#define FEATURE_SAFETYCHECK_RUNTIME_CHECKPOINT          (1)
+#define FEATURE_SAFETYCHECK_RUNTIME_TICKLESS            (1)
+#define FEATURE_SAFETYCHECK_RUNTIME_REGISTER_SHADOW     (1)
+#define FEATURE_SAFETYCHECK_HOST_STL                    (1)
+#define FEATURE_SAFETYCHECK_FAULT_INJECTION_STL         (1)
+#define FEATURE_SAFETY_HARDERROR_TRAP                   (1)
+#define FEATURE_SAFETY_TASK_STATISTICS                  (1)
+#define FEATURE_SAFETY_POWERSUPPLY_EXTERNAL_ADC_FRAMES  (1)
+#define SAFETY_POWERSUPPLY_EXT_ADC_CHANNELS_MAX         (40u)
+#define SAFETY_POWERSUPPLY_FRAME_READ_HOOK()            SafetyTestEnv_FrameReadHook()
+#define SAFETY_TICKLESS_MEASUREMENT_PERIOD_MS           (100u)
+#define SYSPWR_VCC_LOW_TIMEOUT_MS                       (80)
+#define SYSPWR_FILTER_WINDOW_MS                         (800)
+#define SYSPWR_STARTUP_DELAY_MS                         (20)
+#define WAIT_TMP144_STARTUP_MS                          (120)
+#define WAIT_EXTERNAL_ADC_STARTUP_MS                    (60)
+#define FEATURE_SAFETY_POWERSUPPLY_STATISTICS           (1)
+#define SAFETY_POWERSUPPLY_STAT_WINDOW_VALUES           (8u)
+#define FEATURE_SAFETY_TEMPERATURE_INTEGER              (1)
+#define SAFETY_TEMPERATURE_HOOK_DEADBAND_MILLIDEG       (500)
+#define SAFETY_TEMPERATURE_HOOK_MIN_INTERVAL_MS         (100)
+#define FEATURE_SAFETY_EVENT_QUEUE                      (1)
+#define SAFETY_EVENT_QUEUE_SIZE                         (4u)
+#define FEATURE_SAFETY_RECORD                           (1)
+#define SAFETY_RECORD_BUFFER_SIZE                       (256u)
+#define SAFETY_RECORD_READ_HOOK()                       SafetyTestEnv_RecordReadHook()
+#define FEATURE_SAFETY_TRACE                            (1)
+#define SAFETY_TRACE_BUFFER_SIZE                        (1024u)
+
+// Zieladressen der RAM- und ROM-Tests in der Host-Emulation der STL, siehe
+// SafetyTestEnv_AttachStlMemory()
+#define RAMTEST_REGION1_START                           ((U8 *) (uintptr_t) 0x20008000u)
+#define RAMTEST_REGION1_SIZE                            (0x200u)
+#define RAMTEST_REGION2_START                           ((U8 *) (uintptr_t) 0x20008200u)
+#define RAMTEST_REGION2_SIZE                            (0x100u)
+#define RAMTEST_REGION3_START                           ((U8 *) (uintptr_t) 0x20008300u)
+#define RAMTEST_REGION3_SIZE                            (0x100u)
+#define RAMTEST_BACKUP_START                            ((U8 *) (uintptr_t) 0x2000F000u)
+#define RAMTEST_BACKUP_SIZE                             (0x100u)
+#define RAMTEST_CYCLIC_NUM_SECTIONS                     (2u)
+#define ROMTEST_REGION_START                            ((U8 *) (uintptr_t) 0x08000000u)
+#define ROMTEST_REGION_SIZE                             (0x1FE0u)
+#define ROMTEST_CRC_START                               (0x08001FE0u)
+#define ROMTEST_CYCLIC_NUM_SECTIONS                     (2u)
+
+// Gemeinsame Headerdateien einbinden ---------------------------------------
+#include <stdint.h>
+
+#include "config/version.h"
+
+#include "RTOS_AL/RTOS_AL.h"
+
+// Spezielle Headerdateien einbinden ----------------------------------------
+#include "safety_powersupply.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// Makros -------------------------------------------------------------------
+
+/// Maximum number of ADC pins with a voltage set by SafetyTestEnv_SetPinVoltage().
+#define SAFETY_TEST_ENV_PINS_MAX        (16u)
+
+/// Maximum number of tasks recorded by RTOS_TaskCreate().
+#define SAFETY_TEST_ENV_TASKS_MAX       (4u)
+
+// Allgemeine Definitionen --------------------------------------------------
+
+/// Error event sent with SendErrorMsgEvent().
+typedef struct
+{
+    U32 event;                  ///< Event
+    U8 upper;                   ///< Upper error byte
+    U8 intermediate;            ///< Intermediate error byte
+    U8 lower;                   ///< Lower error byte
+} SAFETY_TEST_ENV_ERROR_EVENT;
+
+// externe Variablen --------------------------------------------------------
+
+// Prototypen ---------------------------------------------------------------
+
+/// Resets the replaced drivers and the state of the modules: time 0, no pin
+/// voltages and external ADC values, temperature 25 °C, no events, event system
+/// not busy, no hard error code, no checkpoints, runtime checks not started,
+/// no recording, no created tasks, host STL without memory and scheduler
+/// not started.
+extern void SafetyTestEnv_Reset(void);
+
+/// Sets the virtual time.
+/// \param ticks New time in system ticks.
+extern void SafetyTestEnv_SetTicks(RTOS_TIME const ticks);
+
+/// Advances the virtual time.
+/// \param ticks Time difference in system ticks.
+extern void SafetyTestEnv_AdvanceTicks(U32 const ticks);
+
+/// Returns the virtual time, like RTOS_GetTime().
+/// \return Time in system ticks.
+extern RTOS_TIME SafetyTestEnv_GetTicks(void);
+
+/// Sets the voltage returned by ADC_SampleSingleChannel() for a pin.
+/// \param pin Pin of the ADC channel, e.g. fpADCIN_VCC.
+/// \param voltage Voltage at the pin in V.
+extern void SafetyTestEnv_SetPinVoltage(U32 const pin, F32 const voltage);
+
+/// Sets a value of the external ADCs and publishes all values as new frame,
+/// unset values are 0.
+/// \param adc Position of the external ADC, e.g. MAX116XX_POS_12CHANNEL_ADC.
+/// \param channel Channel of the external ADC.
+/// \param value Value of the channel.
+extern void SafetyTestEnv_SetExternalAdcValue(U32 const adc, U32 const channel, F32 const value);
+
+/// Discards the published frames of the external ADCs, like before the first
+/// frame of the external ADC task. SafetyTestEnv_SetExternalAdcValue() publishes
+/// the next frame.
+extern void SafetyTestEnv_WithholdExternalAdc(void);
+
+/// Publishes a new value of the external ADCs during the next read of a frame,
+/// between reading the frame sequence and the value. Afterwards the external
+/// ADC task starts writing its next frame, the read frame gets an unpublished value.
+/// \param adc Position of the external ADC.
+/// \param channel Channel of the external ADC.
+/// \param value Value of the published frame.
+/// \param unpublishedValue Value written into the next frame without publishing it.
+extern void SafetyTestEnv_PublishExternalAdcDuringRead(U32 const adc, U32 const channel, F32 const value,
+                                                       F32 const unpublishedValue);
+
+/// Publishes the values of the external ADCs during every read of a frame, like
+/// an external ADC task publishing faster than the safety task reads.
+/// \param enable true to publish during every read.
+extern void SafetyTestEnv_PublishExternalAdcDuringEveryRead(bool const enable);
+
+/// Hook of the module in the read of a frame, see SafetyTestEnv_PublishExternalAdcDuringRead()
+/// and SafetyTestEnv_PublishExternalAdcDuringEveryRead().
+extern void SafetyTestEnv_FrameReadHook(void);
+
+/// Runs cycles of Safety_Powersupply_Check() during the next Safety_Record_Read(),
+/// between copying the cycles and checking them. Each cycle advances the time by 10 ms.
+/// \param cycles Number of cycles.
+extern void SafetyTestEnv_RecordCyclesDuringRead(U32 const cycles);
+
+/// Hook of the module in Safety_Record_Read(), see SafetyTestEnv_RecordCyclesDuringRead().
+extern void SafetyTestEnv_RecordReadHook(void);
+
+/// Reads a value of the external ADCs from the published frames like the
+/// safety task.
+/// \param adc Position of the external ADC.
+/// \param channel Channel of the external ADC.
+/// \param value Returns the value.
+/// \return true if a consistent value was read.
+extern bool SafetyTestEnv_ReadExternalAdcValue(U32 const adc, U32 const channel, F32 * const value);
+
+/// Returns the default instance of the power supply monitoring, e.g. to configure
+/// it with the Safety_Powersupply_Context...() functions.
+extern SAFETY_POWERSUPPLY_CONTEXT * SafetyTestEnv_GetPowersupplyContext(void);
+
+/// Sets the temperature returned by TMP144_TemperatureValuePeek().
+/// \param temperature Temperature in °C.
+extern void SafetyTestEnv_SetTemperature(F32 const temperature);
+
+/// Sets whether TMP144_TemperatureValuePeek() returns a valid value, e.g. for a
+/// sensor that is not ready yet or has failed.
+/// \param valid false to return no value.
+extern void SafetyTestEnv_SetTemperatureValid(bool const valid);
+
+/// Returns the number of calls of SendErrorMsgEvent() since the reset.
+extern U32 SafetyTestEnv_GetErrorEventCount(void);
+
+/// Returns the last error event.
+/// \param errorEvent Returns the event, unchanged if none was sent.
+/// \return true if an error event was sent since the reset.
+extern bool SafetyTestEnv_GetLastErrorEvent(SAFETY_TEST_ENV_ERROR_EVENT * const errorEvent);
+
+/// Returns the number of calls of SendMsgEvent() since the reset.
+extern U32 SafetyTestEnv_GetMsgEventCount(void);
+
+/// Sets if the event system accepts events. A busy event system rejects
+/// SendErrorMsgEvent() and SendMsgEvent() without counting the event.
+/// \param busy true to reject the events.
+extern void SafetyTestEnv_SetEventSystemBusy(bool const busy);
+
+/// Attaches the memory of the RAM and ROM tests to the host STL: one buffer for
+/// the RAM test regions and a flash image with valid CRCs. Needed before the
+/// RAM and ROM tests run, e.g. in Safety_Runtime_Init().
+/// \return true on success.
+extern bool SafetyTestEnv_AttachStlMemory(void);
+
+/// Flips bits of the flash image attached by SafetyTestEnv_AttachStlMemory().
+/// \param address Target address of the byte.
+/// \param mask Bits to flip.
+extern void SafetyTestEnv_FlipFlashBits(U32 const address, U8 const mask);
+
+/// Returns the priority of a task created with RTOS_TaskCreate() since the reset.
+/// \param name Name of the task.
+/// \param priority Returns the priority, unchanged if the task was not created.
+/// \return true if the task was created.
+extern bool SafetyTestEnv_GetCreatedTask(char const * const name, U8 * const priority);
+
+/// Returns the last code written by Safety_SetNonvolatileError().
+extern U32 SafetyTestEnv_GetNonvolatileError(void);
+
+/// Returns the number of calls of WATCHDOG_Trigger() since the reset.
+extern U32 SafetyTestEnv_GetWatchdogTriggers(void);
+
+/// Returns the reference count passed to EN61508_ProgFlow_Init().
+extern U32 SafetyTestEnv_GetProgFlowReference(void);
+
+/// Returns the number of calls of EN61508_ProgFlow_IncCycleCounter() since the reset.
+extern U32 SafetyTestEnv_GetProgFlowCycles(void);
+
+/// Updates the load and timing statistics of the safety task like one cycle of
+/// Safety_Task(), without the endless loop of the task.
+/// \param executionTime Duration of Safety_Runtime_Execute().
+/// \param period Time since the previous wake-up, 0 if unknown.
+/// \param expectedPeriod Time between the previous wake-up and the RTOS_DelayUntil() target.
+/// \param taskDelay Nominal task delay.
+extern void SafetyTestEnv_UpdateTaskStatistics(U32 const executionTime, U32 const period,
+                                               U32 const expectedPeriod, U32 const taskDelay);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GLOBAL_SAFETY_SAFETY_MODULE_TESTS_ENV_H_ */
+/**
+ * @}
+ */
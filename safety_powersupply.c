@@ -3,8 +3,11 @@
  ******************************************************************************/
 
 // Gemeinsame Headerdateien einbinden --------------------------------------
+#include <string.h>
+
 #include "config/version.h"
 
+#include "RTOS_AL/RTOS_AL.h"
 #include "ADC/ADC_Driver.h"
 
 #include "eventdef.h"
@@ -22,6 +25,14 @@
 #endif
 
 #include "safety_powersupply.h"
+#include "safety_filter.h"
+#include "safety_temperature.h"
+#include "safety_event.h"
+#include "safety_record.h"
+
+#if FEATURE_SAFETYCHECK_RUNTIME_TICKLESS
+#include "safety_runtime.h"
+#endif
 
 
 #ifdef TMP144_UART_CHANNEL
@@ -159,10 +170,6 @@
 #endif // ((MAX116XX_FEAT_4CHANNEL_ADC) || (MAX116XX_FEAT_12CHANNEL_ADC))
 
 
-#ifndef SYSPWR_NUM_VALUES
-    #define SYSPWR_NUM_VALUES   (8)
-#endif
-
 #ifndef SYSPWR_VCC_LOW_TIMEOUT
 /// Zeit in Ticks bis eine Unterspannung als Fehler gemeldet wird.
 /// Die Zeitkonstante, die sich durch die Filterung der Eingangwerte ergibt,
@@ -170,6 +177,67 @@
     #define SYSPWR_VCC_LOW_TIMEOUT (42)
 #endif
 
+#ifndef SYSPWR_VCC_LOW_TIMEOUT_MS
+/// Zeit in ms bis eine Unterspannung als Fehler gemeldet wird. Ersetzt
+/// \ref SYSPWR_VCC_LOW_TIMEOUT, damit die Zeit unabhängig von der Messperiode
+/// ist. Mit 0 wird \ref SYSPWR_VCC_LOW_TIMEOUT in Messungen verwendet.
+/// Wie bei \ref SYSPWR_VCC_LOW_TIMEOUT wird die Dauer aller Unterspannungen
+/// aufsummiert, eine Rückkehr in den erlaubten Bereich setzt sie nicht zurück.
+    #define SYSPWR_VCC_LOW_TIMEOUT_MS (0)
+#endif
+
+/// Zeit in Ticks bis eine Unterspannung als Fehler gemeldet wird
+#define VCC_LOW_TIMEOUT_TICKS ((U32) SYSPWR_VCC_LOW_TIMEOUT_MS * configTICK_RATE_HZ_MS)
+
+#ifndef SYSPWR_FILTER_WINDOW_MS
+/// Zeitfenster der Mittelwertfilter in ms. Die Anzahl der Werte eines Kanals
+/// ergibt sich aus dem Zeitfenster und der Messperiode des Kanals und ist auf
+/// \ref SYSPWR_NUM_VALUES begrenzt. Mit 0 oder bei Kanälen ohne Messperiode
+/// werden \ref SYSPWR_NUM_VALUES Werte gemittelt.
+    #define SYSPWR_FILTER_WINDOW_MS (0)
+#endif
+
+// Im ereignisgesteuerten Betrieb skalieren die Zeiten in Messungen mit der Messperiode
+#if FEATURE_SAFETYCHECK_RUNTIME_TICKLESS && (SAFETY_TICKLESS_MEASUREMENT_PERIOD_MS > 0)
+#if (SYSPWR_VCC_LOW_TIMEOUT_MS == 0) && ((SAFETY_TICKLESS_MEASUREMENT_PERIOD_MS * SYSPWR_VCC_LOW_TIMEOUT) >= PROCESS_SAFETY_TIME_MS)
+#error "SAFETY_TICKLESS_MEASUREMENT_PERIOD_MS * SYSPWR_VCC_LOW_TIMEOUT exceeds PROCESS_SAFETY_TIME_MS, define SYSPWR_VCC_LOW_TIMEOUT_MS"
+#elif (SYSPWR_VCC_LOW_TIMEOUT_MS == 0) || (SYSPWR_FILTER_WINDOW_MS == 0)
+#error "SAFETY_TICKLESS_MEASUREMENT_PERIOD_MS requires SYSPWR_VCC_LOW_TIMEOUT_MS and SYSPWR_FILTER_WINDOW_MS"
+#elif (SYSPWR_VCC_LOW_TIMEOUT_MS >= PROCESS_SAFETY_TIME_MS)
+#error "SYSPWR_VCC_LOW_TIMEOUT_MS must be below PROCESS_SAFETY_TIME_MS"
+#endif
+#endif
+
+/// Messperioden der Kanäle in ms. Mit 0 wird der Kanal in jedem Zyklus gemessen.
+/// Die Kanäle mit Messperiode werden gleichmäßig auf die Zyklen verteilt.
+#ifndef SYSPWR_CURRENT_PERIOD_MS
+    #define SYSPWR_CURRENT_PERIOD_MS        (0)
+#endif
+#ifndef SYSPWR_VCC_PERIOD_MS
+    #define SYSPWR_VCC_PERIOD_MS            (0)
+#endif
+#ifndef SYSPWR_VCC1_PERIOD_MS
+    #define SYSPWR_VCC1_PERIOD_MS           (0)
+#endif
+#ifndef SYSPWR_VCC2_PERIOD_MS
+    #define SYSPWR_VCC2_PERIOD_MS           (0)
+#endif
+#ifndef SYSPWR_VCC3_PERIOD_MS
+    #define SYSPWR_VCC3_PERIOD_MS           (0)
+#endif
+#ifndef SYSPWR_VCC4_PERIOD_MS
+    #define SYSPWR_VCC4_PERIOD_MS           (0)
+#endif
+#ifndef SYSPWR_VCC5_PERIOD_MS
+    #define SYSPWR_VCC5_PERIOD_MS           (0)
+#endif
+#ifndef SYSPWR_EXT_ADC_PERIOD_MS
+    #define SYSPWR_EXT_ADC_PERIOD_MS        (0)
+#endif
+#ifndef SYSPWR_TEMPERATURE_PERIOD_MS
+    #define SYSPWR_TEMPERATURE_PERIOD_MS    (0)
+#endif
+
 /// Messmodus: Spannung UB wird \b vor dem Shunt gemessen.
 #define SYSPWR_VCC_MEASURE_MODE_VERROR  (1)
 /// Messmodus: Spannung UB wird \b nach dem Shunt gemessen.
@@ -178,9 +246,15 @@
     #define SYSPWR_VCC_MEASURE_MODE     SYSPWR_VCC_MEASURE_MODE_IERROR
 #endif
 
-#ifndef SYSPWR_STARTUP_DELAY
-/// Wartezeit bevor die Prüfungen starten.
-    #define SYSPWR_STARTUP_DELAY   (10)
+#ifdef SYSPWR_STARTUP_DELAY
+#error "SYSPWR_STARTUP_DELAY is replaced by SYSPWR_STARTUP_DELAY_MS. Define the startup delay in ms with SYSPWR_STARTUP_DELAY_MS instead."
+#endif
+
+#ifndef SYSPWR_STARTUP_DELAY_MS
+/// Maximale Wartezeit in ms ab der Initialisierung, bevor die Prüfungen der
+/// Kanäle des internen ADC starten. Die Prüfungen starten früher, sobald der
+/// ADC mit Safety_Powersupply_SignalSourceReady() seine Bereitschaft meldet.
+    #define SYSPWR_STARTUP_DELAY_MS   (20)
 #endif
 
 /// Spannungsfaktor für Versorgungsspannung
@@ -195,6 +269,10 @@
 #define CURRENT_FACTOR      (0.17f)
 #endif
 
+/// Mikrovolt je Volt. ADC_SampleSingleChannel() liefert die Spannung am Eingang
+/// in V, vgl. die Versorgungsspannung in mV aus fVoltage * DECIMAL_FIXPOINT * VOLTAGE_VCC_FACTOR.
+#define MICROVOLT_PER_VOLT  (1000000.0f)
+
 /// Spannungsfaktoren für interne Spannungen
 #ifndef VOLTAGE_1_FACTOR
     #define VOLTAGE_1_FACTOR    (1.000f)
@@ -300,12 +378,6 @@ typedef enum
     eSYSPWR_STAT_ERROR_VCC5_HIGH = 0x40000,     //!< Error state internal voltage 5 too high
     eSYSPWR_STAT_ERROR_POWER_HIGH = 0x80000,    //!< Power consumption error, too high
     eSYSPWR_STAT_WARNING_POWER_HIGH = 0x100000, //!< Power consumption warning, too high
-    eSYSPWR_STAT_ERROR_EXT_ADC_CH1_HIGH = 0x200000, //!< Error state external ADC voltage of first defined channel is to high
-    eSYSPWR_START_ERROR_EXT_ADC_CH1_LOW = 0x400000, //!< Error state external ADC voltage of first defined channel is to low
-    eSYSPWR_STAT_ERROR_EXT_ADC_CH2_HIGH = 0x800000, //!< Error state external ADC voltage of second defined channel is to high
-    eSYSPWR_START_ERROR_EXT_ADC_CH2_LOW = 0x1000000, //!< Error state external ADC voltage of second defined channel is to low
-    eSYSPWR_STAT_ERROR_EXT_ADC_CH3_HIGH = 0x2000000, //!< Error state external ADC voltage of third defined channel is to high
-    eSYSPWR_START_ERROR_EXT_ADC_CH3_LOW = 0x4000000, //!< Error state external ADC voltage of third defined channel is to low
 } SYSPWR_STAT;
 
 // Allgemeine Definitionen -------------------------------------------------
@@ -316,78 +388,46 @@ typedef enum
 
 // externe Variablen -------------------------------------------------------
 
-// 1. Überwachungskanal
-// Versorgungsspannung
-#ifdef fpADCIN_VCC
-static TAVG_CALC tVCCAvg;
-static S32 alVCCValues[SYSPWR_NUM_VALUES];
-static U32 vccLowVoltageTimeout;
-static U32 vccLimitMinMillivolt;
-static U32 vccLimitMaxMillivolt;
-#endif
-
-// 2. Ueberwachungskanal
-// Interne Spannung
-#ifdef fpADCIN_VCC1
-static TAVG_CALC tVCC1Avg;
-static S32 alVCC1Values[SYSPWR_NUM_VALUES];
-static S32 lPowerVoltage1;
-#endif
-
-// 3. Ueberwachungskanal
-// Interne Spannung
-#ifdef fpADCIN_VCC2
-static TAVG_CALC tVCC2Avg;
-static S32 alVCC2Values[SYSPWR_NUM_VALUES];
-static S32 lPowerVoltage2;
-#endif
-
-// 4. Ueberwachungskanal
-// Interne Spannung
-#ifdef fpADCIN_VCC3
-static TAVG_CALC tVCC3Avg;
-static S32 alVCC3Values[SYSPWR_NUM_VALUES];
-static S32 lPowerVoltage3;
-#endif
+#if ((MAX116XX_FEAT_4CHANNEL_ADC) || (MAX116XX_FEAT_12CHANNEL_ADC))
+/// Channels configured with the EXT_ADC_CHANNELx_TO_CHECK macros, used if no
+/// table is configured with Safety_Powersupply_ConfigureExternalAdc()
+static SAFETY_POWERSUPPLY_EXT_ADC_CHANNEL const legacyExternalAdcChannels[] =
+    {
+        {
+        EXT_ADC_CHANNEL1_TO_CHECK_IS_12CHANNEL ? MAX116XX_POS_12CHANNEL_ADC : MAX116XX_POS_4CHANNEL_ADC,
+        EXT_ADC_CHANNEL1_TO_CHECK_CHANNEL, EXT_ADC_CHANNEL1_TO_CHECK_R1, EXT_ADC_CHANNEL1_TO_CHECK_R2,
+        EXT_ADC_CHANNEL1_TO_CHECK_LIMIT_MIN_VOLT, EXT_ADC_CHANNEL1_TO_CHECK_LIMIT_MAX_VOLT
+        },
+        {
+        EXT_ADC_CHANNEL2_TO_CHECK_IS_12CHANNEL ? MAX116XX_POS_12CHANNEL_ADC : MAX116XX_POS_4CHANNEL_ADC,
+        EXT_ADC_CHANNEL2_TO_CHECK_CHANNEL, EXT_ADC_CHANNEL2_TO_CHECK_R1, EXT_ADC_CHANNEL2_TO_CHECK_R2,
+        EXT_ADC_CHANNEL2_TO_CHECK_LIMIT_MIN_VOLT, EXT_ADC_CHANNEL2_TO_CHECK_LIMIT_MAX_VOLT
+        },
+        {
+        EXT_ADC_CHANNEL3_TO_CHECK_IS_12CHANNEL ? MAX116XX_POS_12CHANNEL_ADC : MAX116XX_POS_4CHANNEL_ADC,
+        EXT_ADC_CHANNEL3_TO_CHECK_CHANNEL, EXT_ADC_CHANNEL3_TO_CHECK_R1, EXT_ADC_CHANNEL3_TO_CHECK_R2,
+        EXT_ADC_CHANNEL3_TO_CHECK_LIMIT_MIN_VOLT, EXT_ADC_CHANNEL3_TO_CHECK_LIMIT_MAX_VOLT
+        },
+    };
 
-// 5. Ueberwachungskanal
-// Interne Spannung
-#ifdef fpADCIN_VCC4
-static TAVG_CALC tVCC4Avg;
-static S32 alVCC4Values[SYSPWR_NUM_VALUES];
-static S32 lPowerVoltage4;
-#endif
+/// Number of legacy channels
+#define EXT_ADC_LEGACY_CHANNELS     ((U8) (sizeof(legacyExternalAdcChannels) / sizeof(legacyExternalAdcChannels[0])))
 
-// 6. Ueberwachungskanal
-// Interne Spannung
-#ifdef fpADCIN_VCC5
-static TAVG_CALC tVCC5Avg;
-static S32 alVCC5Values[SYSPWR_NUM_VALUES];
-static S32 lPowerVoltage5;
+#if SAFETY_POWERSUPPLY_EXT_ADC_CHANNELS_MAX < 3
+#error "SAFETY_POWERSUPPLY_EXT_ADC_CHANNELS_MAX must be at least 3 for the EXT_ADC_CHANNELx_TO_CHECK channels"
 #endif
 
-#if ((MAX116XX_FEAT_4CHANNEL_ADC) || (MAX116XX_FEAT_12CHANNEL_ADC))
-static TAVG_CALC_F32 tVCCExternalAdcChannel1AvgInstance;
-static F32 tVCCExternalAdcChannel1Values[SYSPWR_NUM_VALUES];
-F32 tVCCExternalAdcChannel1Avg;
+/// Word of the status bitmaps for a channel
+#define EXT_ADC_STAT_WORD(i)        ((i) / 32u)
+/// Bit of the status bitmaps for a channel
+#define EXT_ADC_STAT_BIT(i)         ((U32) 1u << ((i) % 32u))
 
-static TAVG_CALC_F32 tVCCExternalAdcChannel2AvgInstance;
-static F32 tVCCExternalAdcChannel2Values[SYSPWR_NUM_VALUES];
-F32 tVCCExternalAdcChannel2Avg;
+/// Number of values of one external adc
+#define EXT_ADC_VALUES_PER_ADC      (sizeof(((MAX116XX_ADC_VALUES *) 0)->f32Data) / sizeof(((MAX116XX_ADC_VALUES *) 0)->f32Data[0]))
 
-static TAVG_CALC_F32 tVCCExternalAdcChannel3AvgInstance;
-static F32 tVCCExternalAdcChannel3Values[SYSPWR_NUM_VALUES];
-F32 tVCCExternalAdcChannel3Avg;
 #endif // ((MAX116XX_FEAT_4CHANNEL_ADC) || (MAX116XX_FEAT_12CHANNEL_ADC))
 
-#ifdef fpADCIN_ICC
-static TAVG_CALC tIAvg;
-static S32 alIValues[SYSPWR_NUM_VALUES];
-#endif
-
 #ifdef TMP144_UART_CHANNEL
-static float temperatureValue;
-
 /// User configuration parameters (SOFTQM-431)
 /// Min and max Temperature values
 #ifndef TEMPERATURE_ERROR_MAX
@@ -411,40 +451,124 @@ static float temperatureValue;
 #error "Please define a value for TEMPERATURE_ERROR_MIN in your Project."
 #endif
 
-/// Number of ticks to wait for a valid temperature value provided by the temperature sensor.
-#ifndef WAIT_TMP144_STARTUP_IN_SAFETYCYCLE_TICKS
-/// Default value 150 ticks which corresponds to 150 ms if the temperature is checked every ms.
-#define WAIT_TMP144_STARTUP_IN_SAFETYCYCLE_TICKS  (150)
+/// Temperature limits in milli degrees, calculated by the compiler
+#define TEMPERATURE_ERROR_MAX_MILLIDEG      ((S32) (TEMPERATURE_ERROR_MAX * DECIMAL_FIXPOINT))
+#define TEMPERATURE_WARNING_MAX_MILLIDEG    ((S32) (TEMPERATURE_WARNING_MAX * DECIMAL_FIXPOINT))
+#define TEMPERATURE_WARNING_MIN_MILLIDEG    ((S32) (TEMPERATURE_WARNING_MIN * DECIMAL_FIXPOINT))
+#define TEMPERATURE_ERROR_MIN_MILLIDEG      ((S32) (TEMPERATURE_ERROR_MIN * DECIMAL_FIXPOINT))
+
+#ifdef WAIT_TMP144_STARTUP_IN_SAFETYCYCLE_TICKS
+#error "WAIT_TMP144_STARTUP_IN_SAFETYCYCLE_TICKS is replaced by WAIT_TMP144_STARTUP_MS. Define the startup time of the TMP144 in ms with WAIT_TMP144_STARTUP_MS instead."
 #endif
 
-/// Counter to wait for a valid temperature value from the temperature sensor
-static U32 waitStartupTmpSensorTolerance;
+/// Time in ms after the initialization to wait for the first valid temperature
+/// value provided by the temperature sensor.
+#ifndef WAIT_TMP144_STARTUP_MS
+#define WAIT_TMP144_STARTUP_MS  (150)
+#endif
 #endif
 #if (MAX116XX_FEAT_4CHANNEL_ADC || MAX116XX_FEAT_12CHANNEL_ADC)
-#define WAIT_EXTERNAL_ADC_STARTUP_IN_SAFETYCYCLE_TICKS      (20)
-static U32 waitStartupExternalAdcTolerance = WAIT_EXTERNAL_ADC_STARTUP_IN_SAFETYCYCLE_TICKS;
+/// Time in ms after the initialization to wait for the first values of the external adc task.
+#ifndef WAIT_EXTERNAL_ADC_STARTUP_MS
+#define WAIT_EXTERNAL_ADC_STARTUP_MS                        (40)
 #endif
 
-/// System power voltage status
-static SYSPWR_STAT sysPowerStat;
+#if FEATURE_SAFETY_POWERSUPPLY_EXTERNAL_ADC_FRAMES
+/// Number of retries to read a consistent value from the published frames
+#define EXTERNAL_ADC_FRAME_READ_RETRIES                     (3u)
 
-static U32 startupDelayCount;
-static SAFETY_POWERSUPPLY_CONFIG * powerSupplyUserConfig = NULL;
+#ifndef SAFETY_POWERSUPPLY_FRAME_READ_HOOK
+/// Hook between reading the frame sequence and the value, empty by default.
+/// Only the host module tests define it, together with FEATURE_SAFETY_HARDERROR_TRAP,
+/// and publish a frame at this point.
+#define SAFETY_POWERSUPPLY_FRAME_READ_HOOK()
+#elif !FEATURE_SAFETY_HARDERROR_TRAP
+#error "SAFETY_POWERSUPPLY_FRAME_READ_HOOK is only for the host module tests with FEATURE_SAFETY_HARDERROR_TRAP"
+#endif
 
-#ifdef fpADCIN_VCC
-static S32 lPowerVoltage;
+/// Double buffered result frames of the external adc task. The frame with the
+/// index (externalAdcFrameSequence & 1) is the current one, the other frame is
+/// written by the external adc task.
+static MAX116XX_ADC_VALUES externalAdcFrames[2][MAX116XX_NUMBER_OF_ADCS];
+
+/// Number of published frames, 0 if no frame was published yet
+static volatile U32 externalAdcFrameSequence = 0;
 #endif
-#ifdef fpADCIN_ICC
-static S32 lPowerCurrent;
 #endif
-#if defined(fpADCIN_ICC) && defined(fpADCIN_VCC)
-static U32 ulPower;
+
+/// Measurement period of the channels in ticks, 0 for a measurement in every cycle
+static U32 const channelPeriodTicks[eSYSPWR_CHANNEL_COUNT] =
+    {
+    SYSPWR_CURRENT_PERIOD_MS * configTICK_RATE_HZ_MS,
+    SYSPWR_VCC_PERIOD_MS * configTICK_RATE_HZ_MS,
+    SYSPWR_VCC1_PERIOD_MS * configTICK_RATE_HZ_MS,
+    SYSPWR_VCC2_PERIOD_MS * configTICK_RATE_HZ_MS,
+    SYSPWR_VCC3_PERIOD_MS * configTICK_RATE_HZ_MS,
+    SYSPWR_VCC4_PERIOD_MS * configTICK_RATE_HZ_MS,
+    SYSPWR_VCC5_PERIOD_MS * configTICK_RATE_HZ_MS,
+    SYSPWR_EXT_ADC_PERIOD_MS * configTICK_RATE_HZ_MS,
+    SYSPWR_TEMPERATURE_PERIOD_MS * configTICK_RATE_HZ_MS,
+    };
+
+/// Filter selection of the channels, true for the IIR filter
+static bool const channelFilterIir[eSYSPWR_CHANNEL_COUNT] =
+    {
+    SYSPWR_CURRENT_FILTER_IIR,
+    SYSPWR_VCC_FILTER_IIR,
+    SYSPWR_VCC1_FILTER_IIR,
+    SYSPWR_VCC2_FILTER_IIR,
+    SYSPWR_VCC3_FILTER_IIR,
+    SYSPWR_VCC4_FILTER_IIR,
+    SYSPWR_VCC5_FILTER_IIR,
+    SYSPWR_EXT_ADC_FILTER_IIR,
+    false,
+    };
+
+#if SYSPWR_FILTER_MEDIAN_USED
+/// Window size of the median pre-filter of the channels, 0 without pre-filter
+static U8 const channelMedianSize[eSYSPWR_CHANNEL_COUNT] =
+    {
+    SYSPWR_CURRENT_FILTER_MEDIAN,
+    SYSPWR_VCC_FILTER_MEDIAN,
+    SYSPWR_VCC1_FILTER_MEDIAN,
+    SYSPWR_VCC2_FILTER_MEDIAN,
+    SYSPWR_VCC3_FILTER_MEDIAN,
+    SYSPWR_VCC4_FILTER_MEDIAN,
+    SYSPWR_VCC5_FILTER_MEDIAN,
+    0,
+    0,
+    };
+#endif
+
+#if FEATURE_SAFETY_POWERSUPPLY_STATISTICS
+/// Number of attempts to take a consistent snapshot of the statistics
+#define SYSPWR_STAT_READ_RETRIES    (3u)
+
+/// Channel of the statistics of each measurement channel
+static SAFETY_POWERSUPPLY_STAT_CHANNEL const channelStatistics[eSYSPWR_CHANNEL_COUNT] =
+    {
+    eSAFETY_POWERSUPPLY_STAT_CURRENT,
+    eSAFETY_POWERSUPPLY_STAT_VCC,
+    eSAFETY_POWERSUPPLY_STAT_VCC1,
+    eSAFETY_POWERSUPPLY_STAT_VCC2,
+    eSAFETY_POWERSUPPLY_STAT_VCC3,
+    eSAFETY_POWERSUPPLY_STAT_VCC4,
+    eSAFETY_POWERSUPPLY_STAT_VCC5,
+    eSAFETY_POWERSUPPLY_STAT_COUNT,
+    eSAFETY_POWERSUPPLY_STAT_TEMPERATURE,
+    };
 #endif
-#if defined(fpADCIN_TEMPERATURE) || defined(TMP144_UART_CHANNEL)
-static S32 systemTemperature;
 
-/// System temperature status
-static SYSTEM_TEMPERATURE_STATUS sysTemperatureStat;
+/// Default instance of the monitor, used by the functions without context
+static SAFETY_POWERSUPPLY_CONTEXT powerSupplyDefault;
+
+#if ((MAX116XX_FEAT_4CHANNEL_ADC) || (MAX116XX_FEAT_12CHANNEL_ADC))
+F32 tVCCExternalAdcChannel1Avg;
+F32 tVCCExternalAdcChannel2Avg;
+F32 tVCCExternalAdcChannel3Avg;
+
+/// Deprecated averages of the first three channels of the default instance
+static F32 * const legacyExternalAdcAvg[] = { &tVCCExternalAdcChannel1Avg, &tVCCExternalAdcChannel2Avg, &tVCCExternalAdcChannel3Avg };
 #endif
 
 #if FEAT_MSG_INTERPRETER
@@ -478,25 +602,333 @@ static T_RAM_VAR_ENTRY systemTemperatureRamVar;
 #endif
 
 
-static ERROR_CODE_FORMAT errorCode;
+#if ((MAX116XX_FEAT_4CHANNEL_ADC) || (MAX116XX_FEAT_12CHANNEL_ADC))
+/// Provides the current values of the external adc for the cycle. With
+/// \ref FEATURE_SAFETY_RECORD the result is recorded, with
+/// \ref FEATURE_SAFETY_RECORD_REPLAY it is replayed.
+/// \param context Instance of the monitor.
+/// \return true if values of the external adc are available, otherwise false.
+static bool Safety_Powersupply_UpdateExternalAdc(SAFETY_POWERSUPPLY_CONTEXT * const context);
+
+/// Reads one value of the external adc. With \ref FEATURE_SAFETY_RECORD the
+/// value is recorded, with \ref FEATURE_SAFETY_RECORD_REPLAY it is replayed.
+/// \param context Instance of the monitor.
+/// \param adc Position of the adc, e.g. MAX116XX_POS_12CHANNEL_ADC.
+/// \param channel Channel of the adc.
+/// \param value Returns the value normalized to the reference voltage.
+/// \return true on success, false if no consistent value could be read.
+static bool Safety_Powersupply_ReadExternalAdc(SAFETY_POWERSUPPLY_CONTEXT * const context, U8 const adc, U8 const channel, F32 * const value);
+
+#if !FEATURE_SAFETY_RECORD_REPLAY
+/// Provides the current values of the external adc task for the cycle.
+/// \param context Instance of the monitor.
+/// \return true if values of the external adc are available, otherwise false.
+static bool Safety_Powersupply_PeekExternalAdc(SAFETY_POWERSUPPLY_CONTEXT * const context);
+
+/// Reads one value provided by the external adc task.
+/// \param context Instance of the monitor.
+/// \param adc Position of the adc, e.g. MAX116XX_POS_12CHANNEL_ADC.
+/// \param channel Channel of the adc.
+/// \param value Returns the value normalized to the reference voltage.
+/// \return true on success, false if no consistent value could be read.
+static bool Safety_Powersupply_PeekExternalAdcValue(SAFETY_POWERSUPPLY_CONTEXT * const context, U8 const adc, U8 const channel, F32 * const value);
+#endif
+
+/// Filters the voltage of a channel of the external adc and compares it to its limits.
+/// \param context Instance of the monitor.
+/// \param index Index of the channel in the configuration table.
+static void Safety_Powersupply_CheckExternalAdcChannel(SAFETY_POWERSUPPLY_CONTEXT * const context, U8 const index);
+
+/// Initializes the runtime state of a channel of the external adc.
+/// \param context Instance of the monitor.
+/// \param index Index of the channel in the configuration table.
+/// \return true on success, false if the configuration of the channel is invalid.
+static bool Safety_Powersupply_InitExternalAdcChannel(SAFETY_POWERSUPPLY_CONTEXT * const context, U8 const index);
+#endif
+
+/// Checks if a channel has to be measured in this cycle and schedules its next measurement.
+/// \param context Instance of the monitor.
+/// \param channel Measurement channel.
+/// \param currentTicks Current time in ticks.
+/// \return true if the channel has to be measured, otherwise false.
+static bool Safety_Powersupply_ChannelDue(SAFETY_POWERSUPPLY_CONTEXT * const context, SYSPWR_CHANNEL const channel, U32 const currentTicks);
+
+/// Returns the number of values to be averaged for a channel, according to
+/// \ref SYSPWR_FILTER_WINDOW_MS and the measurement period of the channel.
+/// \param channel Measurement channel.
+/// \return Number of values, at most \ref SYSPWR_NUM_VALUES.
+static U32 Safety_Powersupply_FilterValues(SYSPWR_CHANNEL const channel);
+
+/// Initializes the filter of a channel, either the moving average or the IIR filter.
+/// \param context Instance of the monitor.
+/// \param channel Measurement channel.
+/// \param average Moving average of the channel.
+/// \param buffer Value buffer of the moving average.
+/// \param size Size of the value buffer in bytes.
+/// \return true on success, otherwise false.
+static bool Safety_Powersupply_FilterInit(SAFETY_POWERSUPPLY_CONTEXT * const context, SYSPWR_CHANNEL const channel, TAVG_CALC * const average, S32 * const buffer, U32 const size);
+
+/// Filters a new value of a channel.
+/// \param context Instance of the monitor.
+/// \param channel Measurement channel.
+/// \param average Moving average of the channel.
+/// \param value New value.
+/// \return true on success, otherwise false.
+static bool Safety_Powersupply_FilterUpdate(SAFETY_POWERSUPPLY_CONTEXT * const context, SYSPWR_CHANNEL const channel, TAVG_CALC * const average, S32 value);
+
+/// Checks if the filter output of a channel is valid.
+/// \param context Instance of the monitor.
+/// \param channel Measurement channel.
+/// \param average Moving average of the channel.
+/// \return true if the filter output is valid, otherwise false.
+static bool Safety_Powersupply_FilterIsValid(SAFETY_POWERSUPPLY_CONTEXT * const context, SYSPWR_CHANNEL const channel, TAVG_CALC * const average);
+
+/// Returns the filter output of a channel.
+/// \param context Instance of the monitor.
+/// \param channel Measurement channel.
+/// \param average Moving average of the channel.
+/// \param value Returns the filtered value.
+/// \return true on success, otherwise false.
+static bool Safety_Powersupply_FilterGet(SAFETY_POWERSUPPLY_CONTEXT * const context, SYSPWR_CHANNEL const channel, TAVG_CALC * const average, S32 * const value);
+
+/// Checks if a startup timeout measured from the initialization is elapsed.
+/// \param context Instance of the monitor.
+/// \param currentTicks Current time in ticks.
+/// \param timeoutMs Timeout in ms.
+/// \return true if the timeout is elapsed, otherwise false.
+static bool Safety_Powersupply_StartupTimeElapsed(SAFETY_POWERSUPPLY_CONTEXT * const context, U32 const currentTicks, U32 const timeoutMs);
+
+#if FEATURE_SAFETY_POWERSUPPLY_STATISTICS
+/// Adds a measurement to the running statistics of a channel.
+/// \param context Instance of the monitor.
+/// \param channel Channel of the statistics.
+/// \param value Measured value.
+static void Safety_Powersupply_UpdateStatistics(SAFETY_POWERSUPPLY_CONTEXT * const context, SAFETY_POWERSUPPLY_STAT_CHANNEL const channel, S32 const value);
+#endif
+
+#if defined(fpADCIN_ICC) || defined(fpADCIN_VCC) || defined(fpADCIN_VCC1) || defined(fpADCIN_VCC2) \
+    || defined(fpADCIN_VCC3) || defined(fpADCIN_VCC4) || defined(fpADCIN_VCC5) || defined(fpADCIN_TEMPERATURE)
+/// Samples a channel of the internal adc. With \ref FEATURE_SAFETY_RECORD the
+/// value is recorded, with \ref FEATURE_SAFETY_RECORD_REPLAY it is replayed.
+/// \param channel Measurement channel.
+/// \param pin Input of the adc.
+/// \param value Returns the voltage at the input in V.
+/// \return true on success, otherwise false.
+static bool Safety_Powersupply_SampleAdc(SYSPWR_CHANNEL const channel, U32 const pin, F32 * const value);
+#endif
+
+#ifdef TMP144_UART_CHANNEL
+/// Obtains a new value of the temperature sensor. With \ref FEATURE_SAFETY_RECORD
+/// the value is recorded, with \ref FEATURE_SAFETY_RECORD_REPLAY it is replayed.
+/// \param value Returns the temperature in degrees.
+/// \return true if a new value is available, otherwise false.
+static bool Safety_Powersupply_PeekTemperature(F32 * const value);
+
+/// Calls Safety_TemperatureChangedHook() if the temperature left the deadband
+/// around the last reported value and the minimum interval elapsed, or if the
+/// temperature status changed.
+/// \param context Instance of the monitor.
+static void Safety_Powersupply_DispatchTemperatureHook(SAFETY_POWERSUPPLY_CONTEXT * const context);
+#endif
+
+/// Reports a hard error of an instance to its error handler, without handler or
+/// if the handler returns with Safety_HardError().
+/// \param context Instance of the monitor.
+/// \param hardErrorCode Code of the hard error.
+static void Safety_Powersupply_HardError(SAFETY_POWERSUPPLY_CONTEXT const * const context, U8 const hardErrorCode) __attribute__ ((noreturn));
+
+/// Reports a permanent hard error of an instance to its error handler, without
+/// handler or if the handler returns with Safety_PermanentHardError().
+/// \param context Instance of the monitor.
+/// \param hardErrorCode Code of the hard error.
+static void Safety_Powersupply_PermanentHardError(SAFETY_POWERSUPPLY_CONTEXT const * const context, U8 const hardErrorCode) __attribute__ ((noreturn));
+
+/// Reports an error event of an instance to its error handler, without handler
+/// with Safety_Event_SendError().
+/// \param context Instance of the monitor.
+/// \param event Event of the event system.
+/// \param upper Upper error byte.
+/// \param intermediate Intermediate error byte.
+/// \param lower Lower error byte.
+static void Safety_Powersupply_SendError(SAFETY_POWERSUPPLY_CONTEXT const * const context, U32 const event,
+                                        U8 const upper, U8 const intermediate, U8 const lower);
+
+#if FEAT_MSG_INTERPRETER
+/// Registers the RAM variables of the default instance.
+/// \param safetyPowerSupplyConfig Aktivierung der Messkanäle.
+/// \return true bei Erfolg, sonst false.
+static bool Safety_Powersupply_CreateRamVars(SAFETY_POWERSUPPLY_CONFIG const * const safetyPowerSupplyConfig);
+#endif
 
 // Funktionsbereich --------------------------------------------------------
 
 /// @author m.neubauer @date 07.08.2013
 bool Safety_Powersuply_Init(SAFETY_POWERSUPPLY_CONFIG * const safetyPowerSupplyConfig)
     {
+    bool result = Safety_Powersupply_ContextInit(&powerSupplyDefault, safetyPowerSupplyConfig);
+
+#if FEAT_MSG_INTERPRETER
+    // RAM-Variablen der Factory Device Communication nur für die Standardinstanz
+    if((result) && !Safety_Powersupply_CreateRamVars(safetyPowerSupplyConfig))
+        {
+        result = false;
+        }
+#endif /* FEAT_MSG_INTERPRETER */
+
+    return result;
+    }
+//------------------------------------------------------------------------------
+
+#if FEAT_MSG_INTERPRETER
+static bool Safety_Powersupply_CreateRamVars(SAFETY_POWERSUPPLY_CONFIG const * const safetyPowerSupplyConfig)
+    {
+    bool result = true;
+
+#ifdef fpADCIN_VCC
+    if(safetyPowerSupplyConfig->supplyVoltageIsActive
+            && !MsgIntp_CreateRamVar(&lPowerVoltageRamVar, "Powersupply: Voltage In (mV)", 0,
+                                     sizeof(powerSupplyDefault.lPowerVoltage), &powerSupplyDefault.lPowerVoltage))
+        {
+        result = false;
+        }
+#endif /* fpADCIN_VCC */
+
+#ifdef fpADCIN_ICC
+    if(safetyPowerSupplyConfig->currentIsActive
+            && !MsgIntp_CreateRamVar(&lPowerCurrentRamVar, "Powersupply: Current In (mA)", 0,
+                                     sizeof(powerSupplyDefault.lPowerCurrent), &powerSupplyDefault.lPowerCurrent))
+        {
+        result = false;
+        }
+#endif /* fpADCIN_ICC */
+
+#ifdef fpADCIN_VCC1
+    if(safetyPowerSupplyConfig->voltage1IsActive
+            && !MsgIntp_CreateRamVar(&lPowerVoltage1RamVar, "Powersupply: Voltage 1 In (mV)", 0,
+                                     sizeof(powerSupplyDefault.lPowerVoltage1), &powerSupplyDefault.lPowerVoltage1))
+        {
+        result = false;
+        }
+#endif /* fpADCIN_VCC1 */
+
+#ifdef fpADCIN_VCC2
+    if(safetyPowerSupplyConfig->voltage2IsActive
+            && !MsgIntp_CreateRamVar(&lPowerVoltage2RamVar, "Powersupply: Voltage 2 In (mV)", 0,
+                                     sizeof(powerSupplyDefault.lPowerVoltage2), &powerSupplyDefault.lPowerVoltage2))
+        {
+        result = false;
+        }
+#endif /* fpADCIN_VCC2 */
+
+#ifdef fpADCIN_VCC3
+    if(safetyPowerSupplyConfig->voltage3IsActive
+            && !MsgIntp_CreateRamVar(&lPowerVoltage3RamVar, "Powersupply: Voltage 3 In (mV)", 0,
+                                     sizeof(powerSupplyDefault.lPowerVoltage3), &powerSupplyDefault.lPowerVoltage3))
+        {
+        result = false;
+        }
+#endif /* fpADCIN_VCC3 */
+
+#ifdef fpADCIN_VCC4
+    if(safetyPowerSupplyConfig->voltage4IsActive
+            && !MsgIntp_CreateRamVar(&lPowerVoltage4RamVar, "Powersupply: Voltage 4 In (mV)", 0,
+                                     sizeof(powerSupplyDefault.lPowerVoltage4), &powerSupplyDefault.lPowerVoltage4))
+        {
+        result = false;
+        }
+#endif /* fpADCIN_VCC4 */
+
+#ifdef fpADCIN_VCC5
+    if(safetyPowerSupplyConfig->voltage5IsActive
+            && !MsgIntp_CreateRamVar(&lPowerVoltage5RamVar, "Powersupply: Voltage 5 In (mV)", 0,
+                                     sizeof(powerSupplyDefault.lPowerVoltage5), &powerSupplyDefault.lPowerVoltage5))
+        {
+        result = false;
+        }
+#endif /* fpADCIN_VCC5 */
+
+#if defined(fpADCIN_ICC) && defined(fpADCIN_VCC)
+    if(safetyPowerSupplyConfig->currentIsActive && safetyPowerSupplyConfig->supplyVoltageIsActive)
+        {
+        if((result) && !MsgIntp_CreateRamVar(&lPowerRamVar, "Powersupply: Power (mW)", 0,
+                                             sizeof(powerSupplyDefault.ulPower), &powerSupplyDefault.ulPower))
+            {
+            result = false;
+            }
+        }
+#endif /* fpADCIN_ICC, fpADCIN_VCC */
+
+#if defined(fpADCIN_TEMPERATURE) || defined(TMP144_UART_CHANNEL)
+    if(safetyPowerSupplyConfig->temperatureAdcIsActive || safetyPowerSupplyConfig->temperatureSensorIsActive)
+        {
+        if((result) && !MsgIntp_CreateRamVar(&systemTemperatureRamVar, "uC Chip Temperature", 0,
+                                             sizeof(powerSupplyDefault.systemTemperature), &powerSupplyDefault.systemTemperature))
+            {
+            result = false;
+            }
+        }
+#endif /* fpADCIN_TEMPERATURE, TMP144_UART_CHANNEL */
+
+    return result;
+    }
+//------------------------------------------------------------------------------
+#endif /* FEAT_MSG_INTERPRETER */
+
+bool Safety_Powersupply_ContextInit(SAFETY_POWERSUPPLY_CONTEXT * const context,
+                                    SAFETY_POWERSUPPLY_CONFIG * const safetyPowerSupplyConfig)
+    {
     bool result;
     bool initChannelResult;
+    SAFETY_POWERSUPPLY_ERROR_HANDLER const * errorHandler;
+    U32 sourceReady;
+#if ((MAX116XX_FEAT_4CHANNEL_ADC) || (MAX116XX_FEAT_12CHANNEL_ADC))
+    SAFETY_POWERSUPPLY_EXT_ADC_CHANNEL const * externalAdcChannels;
+    U8 externalAdcChannelCount;
+#endif
+#if ((MAX116XX_FEAT_4CHANNEL_ADC) || (MAX116XX_FEAT_12CHANNEL_ADC)) || FEATURE_SAFETY_POWERSUPPLY_STATISTICS
+    U8 i;
+#endif
+
+    if((context == NULL) || (safetyPowerSupplyConfig == NULL))
+        {
+        return false;
+        }
 
-    if(safetyPowerSupplyConfig == NULL)
+#if FEATURE_SAFETY_RECORD || FEATURE_SAFETY_RECORD_REPLAY
+    // Aufzeichnung und Wiedergabe sind global, nur die Standardinstanz zulässig
+    if(context != &powerSupplyDefault)
         {
         return false;
         }
+#endif
+
+    // Zustand einer erneuten Initialisierung verwerfen, die Konfiguration vor
+    // der Initialisierung und die bereits gemeldeten Quellen bleiben erhalten
+    errorHandler = context->errorHandler;
+    sourceReady = __atomic_load_n(&context->sourceReady, __ATOMIC_ACQUIRE);
+#if ((MAX116XX_FEAT_4CHANNEL_ADC) || (MAX116XX_FEAT_12CHANNEL_ADC))
+    externalAdcChannels = context->externalAdcChannels;
+    externalAdcChannelCount = context->externalAdcChannelCount;
+#endif
+    memset(context, 0, sizeof(*context));
+    context->errorHandler = errorHandler;
+    (void) __atomic_fetch_or(&context->sourceReady, sourceReady, __ATOMIC_RELEASE);
+#if ((MAX116XX_FEAT_4CHANNEL_ADC) || (MAX116XX_FEAT_12CHANNEL_ADC))
+    context->externalAdcChannels = externalAdcChannels;
+    context->externalAdcChannelCount = externalAdcChannelCount;
+#endif
 
-    powerSupplyUserConfig = safetyPowerSupplyConfig;
+    context->powerSupplyUserConfig = safetyPowerSupplyConfig;
 
     result = true;
 
+#if FEATURE_SAFETY_POWERSUPPLY_STATISTICS
+    for(i = 0; i < eSAFETY_POWERSUPPLY_STAT_COUNT; i++)
+        {
+        (void) Safety_Filter_StatInit(&context->statisticsState[i], SAFETY_POWERSUPPLY_STAT_WINDOW_VALUES);
+        }
+#endif
+
     if(safetyPowerSupplyConfig->supplyVoltageIsActive)
         {
         initChannelResult = false;
@@ -509,38 +941,31 @@ bool Safety_Powersuply_Init(SAFETY_POWERSUPPLY_CONFIG * const safetyPowerSupplyC
                 initChannelResult = true;
                 }
 
-            if((initChannelResult) && (AVG_Init(&tVCCAvg, alVCCValues, sizeof(alVCCValues),
-                                                 SYSPWR_NUM_VALUES) != eAVERAGING_NO_ERROR))
+            if((initChannelResult) && !Safety_Powersupply_FilterInit(context, eSYSPWR_CHANNEL_VCC, &context->tVCCAvg, context->alVCCValues, sizeof(context->alVCCValues)))
                 {
                 initChannelResult = false;
                 }
 
-            vccLowVoltageTimeout = SYSPWR_VCC_LOW_TIMEOUT;
+            context->vccLowVoltageTimeout = SYSPWR_VCC_LOW_TIMEOUT;
+            context->vccLowTicks = 0;
+            context->vccEvaluated = false;
 
 #ifdef PARNUM_VOLTAGE_VCC_VALUE_MIN
             if((initChannelResult) && (ParTab_GetValue(PARNUM_VOLTAGE_VCC_VALUE_MIN,
-                                                       vccLimitMinMillivolt) != PARTAB_ERR_NONE))
+                                                       context->vccLimitMinMillivolt) != PARTAB_ERR_NONE))
                 {
                 initChannelResult = false;
                 }
             if((initChannelResult) && (ParTab_GetValue(PARNUM_VOLTAGE_VCC_VALUE_MAX,
-                                                       vccLimitMaxMillivolt) != PARTAB_ERR_NONE))
+                                                       context->vccLimitMaxMillivolt) != PARTAB_ERR_NONE))
                 {
                 initChannelResult = false;
                 }
 #else
-            vccLimitMinMillivolt = VOLTAGE_SUPPLY_LIMIT_MIN_MILLIVOLT;
-            vccLimitMaxMillivolt = VOLTAGE_SUPPLY_LIMIT_MAX_MILLIVOLT;
+            context->vccLimitMinMillivolt = VOLTAGE_SUPPLY_LIMIT_MIN_MILLIVOLT;
+            context->vccLimitMaxMillivolt = VOLTAGE_SUPPLY_LIMIT_MAX_MILLIVOLT;
 
 #endif /* PARNUM_VOLTAGE_VCC_VALUE_MIN */
-
-#if FEAT_MSG_INTERPRETER
-            if((initChannelResult) && !MsgIntp_CreateRamVar(&lPowerVoltageRamVar, "Powersupply: Voltage In (mV)", 0,
-                                                            sizeof(lPowerVoltage), &lPowerVoltage))
-                {
-                initChannelResult = false;
-                }
-#endif /* FEAT_MSG_INTERPRETER */
             }
 #endif /* fpADCIN_VCC */
 
@@ -560,19 +985,10 @@ bool Safety_Powersuply_Init(SAFETY_POWERSUPPLY_CONFIG * const safetyPowerSupplyC
             initChannelResult = true;
             }
 
-        if((initChannelResult) && (AVG_Init(&tIAvg, alIValues, sizeof(alIValues),
-                                            SYSPWR_NUM_VALUES) != eAVERAGING_NO_ERROR))
-            {
-            initChannelResult = false;
-            }
-
-#if FEAT_MSG_INTERPRETER
-        if((initChannelResult) && !MsgIntp_CreateRamVar(&lPowerCurrentRamVar, "Powersupply: Current In (mA)", 0,
-                                                        sizeof(lPowerCurrent), &lPowerCurrent))
+        if((initChannelResult) && !Safety_Powersupply_FilterInit(context, eSYSPWR_CHANNEL_CURRENT, &context->tIAvg, context->alIValues, sizeof(context->alIValues)))
             {
             initChannelResult = false;
             }
-#endif /* FEAT_MSG_INTERPRETER */
 #endif /* fpADCIN_ICC */
 
         if(initChannelResult == false)
@@ -591,19 +1007,10 @@ bool Safety_Powersuply_Init(SAFETY_POWERSUPPLY_CONFIG * const safetyPowerSupplyC
             initChannelResult = true;
             }
 
-        if((initChannelResult) && (AVG_Init(&tVCC1Avg, alVCC1Values, sizeof(alVCC1Values),
-                                            SYSPWR_NUM_VALUES) != eAVERAGING_NO_ERROR))
-            {
-            initChannelResult = false;
-            }
-
-#if FEAT_MSG_INTERPRETER
-        if((initChannelResult) && !MsgIntp_CreateRamVar(&lPowerVoltage1RamVar, "Powersupply: Voltage 1 In (mV)", 0,
-                                                       sizeof(lPowerVoltage1), &lPowerVoltage1))
+        if((initChannelResult) && !Safety_Powersupply_FilterInit(context, eSYSPWR_CHANNEL_VCC1, &context->tVCC1Avg, context->alVCC1Values, sizeof(context->alVCC1Values)))
             {
             initChannelResult = false;
             }
-#endif /* FEAT_MSG_INTERPRETER */
 #endif /* fpADCIN_VCC1 */
 
         if(initChannelResult == false)
@@ -621,19 +1028,10 @@ bool Safety_Powersuply_Init(SAFETY_POWERSUPPLY_CONFIG * const safetyPowerSupplyC
             initChannelResult = true;
             }
 
-        if((initChannelResult) && (AVG_Init(&tVCC2Avg, alVCC2Values, sizeof(alVCC2Values),
-                                            SYSPWR_NUM_VALUES) != eAVERAGING_NO_ERROR))
-            {
-            initChannelResult = false;
-            }
-
-#if FEAT_MSG_INTERPRETER
-        if((initChannelResult) && !MsgIntp_CreateRamVar(&lPowerVoltage2RamVar, "Powersupply: Voltage 2 In (mV)", 0,
-                                                        sizeof(lPowerVoltage2), &lPowerVoltage2))
+        if((initChannelResult) && !Safety_Powersupply_FilterInit(context, eSYSPWR_CHANNEL_VCC2, &context->tVCC2Avg, context->alVCC2Values, sizeof(context->alVCC2Values)))
             {
             initChannelResult = false;
             }
-#endif /* FEAT_MSG_INTERPRETER */
 #endif /* fpADCIN_VCC2 */
 
         if(initChannelResult == false)
@@ -651,19 +1049,10 @@ bool Safety_Powersuply_Init(SAFETY_POWERSUPPLY_CONFIG * const safetyPowerSupplyC
             initChannelResult = true;
             }
 
-        if((initChannelResult) && (AVG_Init(&tVCC3Avg, alVCC3Values, sizeof(alVCC3Values),
-                                            SYSPWR_NUM_VALUES) != eAVERAGING_NO_ERROR))
-            {
-            initChannelResult = false;
-            }
-
-#if FEAT_MSG_INTERPRETER
-        if((initChannelResult) && !MsgIntp_CreateRamVar(&lPowerVoltage3RamVar, "Powersupply: Voltage 3 In (mV)", 0,
-                                                        sizeof(lPowerVoltage3), &lPowerVoltage3))
+        if((initChannelResult) && !Safety_Powersupply_FilterInit(context, eSYSPWR_CHANNEL_VCC3, &context->tVCC3Avg, context->alVCC3Values, sizeof(context->alVCC3Values)))
             {
             initChannelResult = false;
             }
-#endif /* FEAT_MSG_INTERPRETER */
 #endif /* fpADCIN_VCC3 */
 
         if(initChannelResult == false)
@@ -682,19 +1071,10 @@ bool Safety_Powersuply_Init(SAFETY_POWERSUPPLY_CONFIG * const safetyPowerSupplyC
             initChannelResult = true;
             }
 
-        if((initChannelResult) && (AVG_Init(&tVCC4Avg, alVCC4Values, sizeof(alVCC4Values),
-                                            SYSPWR_NUM_VALUES) != eAVERAGING_NO_ERROR))
-            {
-            initChannelResult = false;
-            }
-
-#if FEAT_MSG_INTERPRETER
-        if((initChannelResult) && !MsgIntp_CreateRamVar(&lPowerVoltage4RamVar, "Powersupply: Voltage 4 In (mV)", 0,
-                                                        sizeof(lPowerVoltage4), &lPowerVoltage4))
+        if((initChannelResult) && !Safety_Powersupply_FilterInit(context, eSYSPWR_CHANNEL_VCC4, &context->tVCC4Avg, context->alVCC4Values, sizeof(context->alVCC4Values)))
             {
             initChannelResult = false;
             }
-#endif /* FEAT_MSG_INTERPRETER */
 #endif /* fpADCIN_VCC4 */
 
         if(initChannelResult == false)
@@ -713,19 +1093,10 @@ bool Safety_Powersuply_Init(SAFETY_POWERSUPPLY_CONFIG * const safetyPowerSupplyC
             initChannelResult = true;
             }
 
-        if((initChannelResult) && (AVG_Init(&tVCC5Avg, alVCC5Values, sizeof(alVCC5Values),
-                                            SYSPWR_NUM_VALUES) != eAVERAGING_NO_ERROR))
-            {
-            initChannelResult = false;
-            }
-
-#if FEAT_MSG_INTERPRETER
-        if((initChannelResult) && !MsgIntp_CreateRamVar(&lPowerVoltage5RamVar, "Powersupply: Voltage 5 In (mV)", 0,
-                                                        sizeof(lPowerVoltage5), &lPowerVoltage5))
+        if((initChannelResult) && !Safety_Powersupply_FilterInit(context, eSYSPWR_CHANNEL_VCC5, &context->tVCC5Avg, context->alVCC5Values, sizeof(context->alVCC5Values)))
             {
             initChannelResult = false;
             }
-#endif /* FEAT_MSG_INTERPRETER */
 #endif /* fpADCIN_VCC5 */
 
         if(initChannelResult == false)
@@ -735,22 +1106,37 @@ bool Safety_Powersuply_Init(SAFETY_POWERSUPPLY_CONFIG * const safetyPowerSupplyC
         }
 //--------------------- Block external ADC -----------------------
 #if ((MAX116XX_FEAT_4CHANNEL_ADC) || (MAX116XX_FEAT_12CHANNEL_ADC))
-    if(safetyPowerSupplyConfig->voltageExternalAdcChannel1IsActive)
+    // Ohne Konfigurationstabelle die Kanäle der EXT_ADC_CHANNELx_TO_CHECK-Makros überwachen
+    if(context->externalAdcChannels == NULL)
         {
-        initChannelResult = false;
+        context->externalAdcChannels = legacyExternalAdcChannels;
+        context->externalAdcChannelCount = EXT_ADC_LEGACY_CHANNELS;
         }
 
-    if(AVG_InitF32(&tVCCExternalAdcChannel1AvgInstance, tVCCExternalAdcChannel1Values, sizeof(tVCCExternalAdcChannel1Values), SYSPWR_NUM_VALUES) != eAVERAGING_NO_ERROR)
-        {
-        initChannelResult = false;
-        }
-    if(AVG_InitF32(&tVCCExternalAdcChannel2AvgInstance, tVCCExternalAdcChannel2Values, sizeof(tVCCExternalAdcChannel2Values), SYSPWR_NUM_VALUES) != eAVERAGING_NO_ERROR)
+    for(i = 0; i < SAFETY_POWERSUPPLY_EXT_ADC_STAT_WORDS; i++)
         {
-        initChannelResult = false;
+        context->externalAdcActive[i] = 0u;
+        context->externalAdcErrorLow[i] = 0u;
+        context->externalAdcErrorHigh[i] = 0u;
         }
-    if(AVG_InitF32(&tVCCExternalAdcChannel3AvgInstance, tVCCExternalAdcChannel3Values, sizeof(tVCCExternalAdcChannel3Values), SYSPWR_NUM_VALUES) != eAVERAGING_NO_ERROR)
+
+    for(i = 0; i < context->externalAdcChannelCount; i++)
         {
-        initChannelResult = false;
+        // Ohne Konfigurationstabelle gelten die Aktivierungsbits der drei Standardkanäle
+        if(context->externalAdcChannels == legacyExternalAdcChannels)
+            {
+            if(((i == 0u) && !safetyPowerSupplyConfig->voltageExternalAdcChannel1IsActive)
+                    || ((i == 1u) && !safetyPowerSupplyConfig->voltageExternalAdcChannel2IsActive)
+                    || ((i == 2u) && !safetyPowerSupplyConfig->voltageExternalAdcChannel3IsActive))
+                {
+                continue;
+                }
+            }
+
+        if(!Safety_Powersupply_InitExternalAdcChannel(context, i))
+            {
+            result = false;
+            }
         }
 #endif // ((MAX116XX_FEAT_4CHANNEL_ADC) || (MAX116XX_FEAT_12CHANNEL_ADC))
 //----------------------------------------------------------------
@@ -764,6 +1150,14 @@ bool Safety_Powersuply_Init(SAFETY_POWERSUPPLY_CONFIG * const safetyPowerSupplyC
             {
             initChannelResult = true;
             }
+
+#if FEATURE_SAFETY_TEMPERATURE_INTEGER && !FEATURE_SAFETY_RECORD_REPLAY
+        // Kalibrierwerte des Herstellers für die ganzzahlige Umrechnung übernehmen
+        if((initChannelResult) && !Safety_Temperature_CalibrateFromDevice())
+            {
+            initChannelResult = false;
+            }
+#endif
 #endif
         if(initChannelResult == false)
             {
@@ -776,7 +1170,6 @@ bool Safety_Powersuply_Init(SAFETY_POWERSUPPLY_CONFIG * const safetyPowerSupplyC
         initChannelResult = false;
 
 #ifdef TMP144_UART_CHANNEL
-        waitStartupTmpSensorTolerance = WAIT_TMP144_STARTUP_IN_SAFETYCYCLE_TICKS;
         initChannelResult = true;
 #endif
 
@@ -786,34 +1179,11 @@ bool Safety_Powersuply_Init(SAFETY_POWERSUPPLY_CONFIG * const safetyPowerSupplyC
             }
         }
 
-#if FEAT_MSG_INTERPRETER
-#if defined(fpADCIN_ICC) && defined(fpADCIN_VCC)
-    if(safetyPowerSupplyConfig->currentIsActive && safetyPowerSupplyConfig->supplyVoltageIsActive)
-        {
-        if((result) && !MsgIntp_CreateRamVar(&lPowerRamVar, "Powersupply: Power (mW)", 0,
-                                             sizeof(ulPower), &ulPower))
-            {
-            result = false;
-            }
-        }
-#endif /* fpADCIN_ICC, fpADCIN_VCC */
-
-#if defined(fpADCIN_TEMPERATURE) || defined(TMP144_UART_CHANNEL)
-    if(safetyPowerSupplyConfig->temperatureAdcIsActive || safetyPowerSupplyConfig->temperatureSensorIsActive)
-        {
-        if((result) && !MsgIntp_CreateRamVar(&systemTemperatureRamVar, "uC Chip Temperature", 0,
-                                             sizeof(systemTemperature), &systemTemperature))
-            {
-            result = false;
-            }
-        }
-#endif /* fpADCIN_TEMPERATURE, TMP144_UART_CHANNEL */
-
-#endif /*FEAT_MSG_INTERPRETER*/
-
-    startupDelayCount = SYSPWR_STARTUP_DELAY;
-    sysPowerStat = eSYSPWR_STAT_INIT_OK;
-    errorCode.value = 0;
+    context->startupTicks = RTOS_GetTime();
+    context->sysPowerStat = eSYSPWR_STAT_INIT_OK;
+#if FEATURE_SAFETY_RECORD
+    Safety_Record_Start(safetyPowerSupplyConfig, context->startupTicks);
+#endif
 
     return result;
     }
@@ -822,9 +1192,18 @@ bool Safety_Powersuply_Init(SAFETY_POWERSUPPLY_CONFIG * const safetyPowerSupplyC
 /// @author m.neubauer @date 07.08.2013
 U8 Safety_Powersupply_Check(void)
     {
+    return Safety_Powersupply_ContextCheck(&powerSupplyDefault);
+    }
+//------------------------------------------------------------------------------
+
+U8 Safety_Powersupply_ContextCheck(SAFETY_POWERSUPPLY_CONTEXT * const context)
+    {
 #ifdef fpADCIN_VCC
     U32 ulVoltage;
     float fVoltage;
+#if SYSPWR_VCC_LOW_TIMEOUT_MS > 0
+    U32 vccElapsedTicks;
+#endif
 #endif
 #ifdef fpADCIN_ICC
     U32 ulCurrent;
@@ -853,57 +1232,80 @@ U8 Safety_Powersupply_Check(void)
 #ifdef fpADCIN_TEMPERATURE
     float temperatureVSense;
 #endif
+#ifdef TMP144_UART_CHANNEL
+    float temperatureValue;
+    S32 temperatureMillidegree;
+#endif
 
 
 #if ((MAX116XX_FEAT_4CHANNEL_ADC) || (MAX116XX_FEAT_12CHANNEL_ADC))
-MAX116XX_ADC_VALUES externalAdcValuesList[MAX116XX_NUMBER_OF_ADCS];
+    U8 i;
 #endif // ((MAX116XX_FEAT_4CHANNEL_ADC) || (MAX116XX_FEAT_12CHANNEL_ADC))
+    U32 const currentTicks = RTOS_GetTime();
+    U8 channel;
+    bool adcReady;
 
+    if((context == NULL) || (context->powerSupplyUserConfig == NULL))
+        {
+        return false;
+        }
 
-    //Startverzögerung
-    if(startupDelayCount > 0)
+#if FEATURE_SAFETY_RECORD
+    Safety_Record_BeginCycle(currentTicks);
+#endif
+
+    // Kanäle des internen ADC starten, sobald der ADC bereit ist, spätestens nach der Startverzögerung
+    adcReady = Safety_Powersupply_ContextIsSourceReady(context, eSAFETY_POWERSUPPLY_SOURCE_ADC);
+    if(!adcReady && Safety_Powersupply_StartupTimeElapsed(context, currentTicks, SYSPWR_STARTUP_DELAY_MS))
         {
-        startupDelayCount--;
-        return TRUE;
+        Safety_Powersupply_ContextSignalSourceReady(context, eSAFETY_POWERSUPPLY_SOURCE_ADC);
+        adcReady = true;
         }
 
-    if(powerSupplyUserConfig == NULL)
+    if(!context->channelScheduleStarted)
         {
-        return false;
+        context->channelScheduleStarted = true;
+
+        // Erste Messung der Kanäle zeitlich versetzen, damit sich die Messungen
+        // gleichmäßig auf die Zyklen verteilen
+        for(channel = 0; channel < eSYSPWR_CHANNEL_COUNT; channel++)
+            {
+            context->channelNextTicks[channel] = currentTicks + ((channelPeriodTicks[channel] * channel) / eSYSPWR_CHANNEL_COUNT);
+            }
         }
 
     // Auswertung Strom
 #ifdef fpADCIN_ICC
-    if(powerSupplyUserConfig->currentIsActive)
+    if(context->powerSupplyUserConfig->currentIsActive && adcReady && Safety_Powersupply_ChannelDue(context, eSYSPWR_CHANNEL_CURRENT, currentTicks))
         {
         // Messwertaufnahme
-        if(ADC_SampleSingleChannel(fpADCIN_ICC, &fCurrent) != eADC_TRUE)
+        if(!Safety_Powersupply_SampleAdc(eSYSPWR_CHANNEL_CURRENT, fpADCIN_ICC, &fCurrent))
             {
             // Enter non-permanent hard error state if measurement fails (SOFTQM-677)
-            Safety_HardError(HARD_ERR_SAFETY_MEASUREMENT);
+            Safety_Powersupply_HardError(context, HARD_ERR_SAFETY_MEASUREMENT);
             }
 
         // Umwandlung in Integer
         ulCurrent = (U32)(fCurrent * DECIMAL_FIXPOINT * CURRENT_FACTOR);
 
         // Mittelwertberechnung
-        if(AVG_Update(&tIAvg, ulCurrent) != eAVERAGING_NO_ERROR)
+        if(!Safety_Powersupply_FilterUpdate(context, eSYSPWR_CHANNEL_CURRENT, &context->tIAvg, ulCurrent))
             {
             // Enter non-permanent hard error state if measurement fails (SOFTQM-677)
-            Safety_HardError(HARD_ERR_SAFETY_MEASUREMENT);
+            Safety_Powersupply_HardError(context, HARD_ERR_SAFETY_MEASUREMENT);
             }
 
-        if(AVG_GetIsValid(&tIAvg.data))
+        if(Safety_Powersupply_FilterIsValid(context, eSYSPWR_CHANNEL_CURRENT, &context->tIAvg))
             {
-            if(AVG_Get(&tIAvg, (S32*) &ulCurrent) != eAVERAGING_NO_ERROR)
+            if(!Safety_Powersupply_FilterGet(context, eSYSPWR_CHANNEL_CURRENT, &context->tIAvg, (S32*) &ulCurrent))
                 {
                 // Enter non-permanent hard error state if measurement fails (SOFTQM-677)
-                Safety_HardError(HARD_ERR_SAFETY_MEASUREMENT);
+                Safety_Powersupply_HardError(context, HARD_ERR_SAFETY_MEASUREMENT);
                 }
 
             // In RAM-Variable für Factory Device Communication eintragen
-            lPowerCurrent = ulCurrent;
-            sysPowerStat |= eSYSPWR_STAT_I_VALID;
+            context->lPowerCurrent = ulCurrent;
+            context->sysPowerStat |= eSYSPWR_STAT_I_VALID;
             }
         }
 
@@ -911,13 +1313,13 @@ MAX116XX_ADC_VALUES externalAdcValuesList[MAX116XX_NUMBER_OF_ADCS];
 
     // Auswertung Vcc
 #ifdef fpADCIN_VCC
-    if(powerSupplyUserConfig->supplyVoltageIsActive)
+    if(context->powerSupplyUserConfig->supplyVoltageIsActive && adcReady && Safety_Powersupply_ChannelDue(context, eSYSPWR_CHANNEL_VCC, currentTicks))
         {
         // Messwertaufnahme
-        if(ADC_SampleSingleChannel(fpADCIN_VCC, &fVoltage) != eADC_TRUE)
+        if(!Safety_Powersupply_SampleAdc(eSYSPWR_CHANNEL_VCC, fpADCIN_VCC, &fVoltage))
             {
             // Enter non-permanent hard error state if measurement fails (SOFTQM-677)
-            Safety_HardError(HARD_ERR_SAFETY_MEASUREMENT);
+            Safety_Powersupply_HardError(context, HARD_ERR_SAFETY_MEASUREMENT);
             }
 
         ulVoltage = (U32)(fVoltage * DECIMAL_FIXPOINT * VOLTAGE_VCC_FACTOR);
@@ -925,70 +1327,99 @@ MAX116XX_ADC_VALUES externalAdcValuesList[MAX116XX_NUMBER_OF_ADCS];
 #if defined(fpADCIN_ICC) && (SYSPWR_VCC_MEASURE_MODE == SYSPWR_VCC_MEASURE_MODE_VERROR)
             // UB wird vor dem Shunt gemessen. Spannungsabfall über dem Shunt
             // berücksichtigen.
-            if(sysPowerStat & eSYSPWR_STAT_I_VALID)
+            if(context->sysPowerStat & eSYSPWR_STAT_I_VALID)
                 {
-                ulVoltage -= ((U32)(INA168_SHUNT_RESISTOR * lPowerCurrent));
+                ulVoltage -= ((U32)(INA168_SHUNT_RESISTOR * context->lPowerCurrent));
 
                 // Mittelwertberechnung
-                if(AVG_Update(&tVCCAvg, ulVoltage) != eAVERAGING_NO_ERROR)
+                if(!Safety_Powersupply_FilterUpdate(context, eSYSPWR_CHANNEL_VCC, &context->tVCCAvg, ulVoltage))
                     {
                     // Enter non-permanent hard error state if measurement fails (SOFTQM-677)
-                    Safety_HardError(HARD_ERR_SAFETY_MEASUREMENT);
+                    Safety_Powersupply_HardError(context, HARD_ERR_SAFETY_MEASUREMENT);
                     }
                 }
 #else
             // Mittelwertberechnung
-            if(AVG_Update(&tVCCAvg, ulVoltage) != eAVERAGING_NO_ERROR)
+            if(!Safety_Powersupply_FilterUpdate(context, eSYSPWR_CHANNEL_VCC, &context->tVCCAvg, ulVoltage))
                 {
                 // Enter non-permanent hard error state if measurement fails (SOFTQM-677)
-                Safety_HardError(HARD_ERR_SAFETY_MEASUREMENT);
+                Safety_Powersupply_HardError(context, HARD_ERR_SAFETY_MEASUREMENT);
                 }
 #endif
 
-            if(AVG_GetIsValid(&tVCCAvg.data))
+            if(Safety_Powersupply_FilterIsValid(context, eSYSPWR_CHANNEL_VCC, &context->tVCCAvg))
                 {
-                if(AVG_Get(&tVCCAvg, (S32*) &ulVoltage) != eAVERAGING_NO_ERROR)
+                if(!Safety_Powersupply_FilterGet(context, eSYSPWR_CHANNEL_VCC, &context->tVCCAvg, (S32*) &ulVoltage))
                     {
                     // Enter non-permanent hard error state if measurement fails (SOFTQM-677)
-                    Safety_HardError(HARD_ERR_SAFETY_MEASUREMENT);
+                    Safety_Powersupply_HardError(context, HARD_ERR_SAFETY_MEASUREMENT);
                     }
 
                 // RAM-Variable für Factory Device Communication aktualisieren
-                lPowerVoltage = ulVoltage;
-                sysPowerStat |= eSYSPWR_STAT_VCC_VALID;
+                context->lPowerVoltage = ulVoltage;
+                context->sysPowerStat |= eSYSPWR_STAT_VCC_VALID;
+
+#if SYSPWR_VCC_FILTER_MEDIAN
+                // Einbruch am Medianausgang erkennen, bevor er im Mittelwert sichtbar ist
+                if(((U32) context->vccMedianVoltage < ulVoltage) && ((U32) context->vccMedianVoltage < context->vccLimitMinMillivolt))
+                    {
+                    ulVoltage = (U32) context->vccMedianVoltage;
+                    }
+#endif
+
+#if SYSPWR_VCC_LOW_TIMEOUT_MS > 0
+                // Zeit seit der vorherigen Auswertung, Zeitbasis der Unterspannungsdauer
+                vccElapsedTicks = context->vccEvaluated ? (currentTicks - context->vccLastEvaluationTicks) : 0u;
+                context->vccEvaluated = true;
+                context->vccLastEvaluationTicks = currentTicks;
+#endif
 
                 // Check supply voltage error limits (SOFTQM-596)
-                if(ulVoltage < vccLimitMinMillivolt)
+                if(ulVoltage < context->vccLimitMinMillivolt)
                     {
                     // Supply voltage decreases below minimum error limit
-                    sysPowerStat |= eSYSPWR_STAT_DETECT_VCC_LOW;
+                    context->sysPowerStat |= eSYSPWR_STAT_DETECT_VCC_LOW;
 
                     // Check if delay time for minimum voltage error is exceeded (SOFTQM-596)
-                    if(vccLowVoltageTimeout > 0)
+#if SYSPWR_VCC_LOW_TIMEOUT_MS > 0
+                    // Dauer der Unterspannung aufsummieren, wie der Zähler der Messungen
+                    // ohne Rücksetzen bei Rückkehr in den erlaubten Bereich
+                    if(context->vccLowTicks < VCC_LOW_TIMEOUT_TICKS)
+                        {
+                        context->vccLowTicks += vccElapsedTicks;
+                        }
+
+                    if(context->vccLowTicks < VCC_LOW_TIMEOUT_TICKS)
+                        {
+                        // Unterspannung noch nicht lange genug
+                        }
+#else
+                    if(context->vccLowVoltageTimeout > 0)
                         {
-                        vccLowVoltageTimeout--;
+                        context->vccLowVoltageTimeout--;
                         }
+#endif
                     else
                         {
-                        if((sysPowerStat & eSYSPWR_STAT_ERROR_VCC_LOW) == 0)
+                        if((context->sysPowerStat & eSYSPWR_STAT_ERROR_VCC_LOW) == 0)
                             {
-                            sysPowerStat |= eSYSPWR_STAT_ERROR_VCC_LOW;
+                            context->sysPowerStat |= eSYSPWR_STAT_ERROR_VCC_LOW;
 
                             // Send error event with supply voltage error if the voltage is below
                             // the minimum error level for the delay time (SOFTQM-596, SOFTQM-657)
-                            SendErrorMsgEvent(eEVENT_VCC_CHECK_ERROR, eERROR_SUPPLY_VOLTAGE, eERROR_VOLTAGE_EXCEEDED_MIN,
-                                              ERROR_BYTE_LOWER_LEVEL_FILL_ZERO);
+                            Safety_Powersupply_SendError(context, eEVENT_VCC_CHECK_ERROR, eERROR_SUPPLY_VOLTAGE, eERROR_VOLTAGE_EXCEEDED_MIN,
+                                                                  ERROR_BYTE_LOWER_LEVEL_FILL_ZERO);
                             }
                         }
                     }
-                else if(ulVoltage > vccLimitMaxMillivolt)
+                else if(ulVoltage > context->vccLimitMaxMillivolt)
                     {
                     // Supply voltage is above maximum error limit
-                    if((sysPowerStat & eSYSPWR_STAT_ERROR_VCC_HIGH) == 0)
+                    if((context->sysPowerStat & eSYSPWR_STAT_ERROR_VCC_HIGH) == 0)
                         {
                         // Enter permanent hard error if voltage exceeds maximum error level (SOFTQM-636)
-                        sysPowerStat |= eSYSPWR_STAT_ERROR_VCC_HIGH;
-                        Safety_PermanentHardError(HARD_ERR_VOLTAGE_EXCEEDED);
+                        context->sysPowerStat |= eSYSPWR_STAT_ERROR_VCC_HIGH;
+                        Safety_Powersupply_PermanentHardError(context, HARD_ERR_VOLTAGE_EXCEEDED);
                         }
                     }
                 else
@@ -996,36 +1427,36 @@ MAX116XX_ADC_VALUES externalAdcValuesList[MAX116XX_NUMBER_OF_ADCS];
                     // Supply voltage within allowed voltage range, check if it was below
                     // minimum error limit previously (SOFTQM-596)
 
-                    if((sysPowerStat & eSYSPWR_STAT_DETECT_VCC_LOW)
-                            && !(sysPowerStat & eSYSPWR_STAT_ERROR_VCC_DROPOUT))
+                    if((context->sysPowerStat & eSYSPWR_STAT_DETECT_VCC_LOW)
+                            && !(context->sysPowerStat & eSYSPWR_STAT_ERROR_VCC_DROPOUT))
                         {
-                        sysPowerStat |= eSYSPWR_STAT_ERROR_VCC_DROPOUT;
+                        context->sysPowerStat |= eSYSPWR_STAT_ERROR_VCC_DROPOUT;
 
                         // Send error event with supply voltage dropout error was previously detected to
                         // be below the minimum error limit and the allowed voltage range is reentered (SOFTQM-657)
-                        SendErrorMsgEvent(eEVENT_VCC_CHECK_ERROR, eERROR_SUPPLY_VOLTAGE, eERROR_VOLTAGE_VCC_DROPOUT,
-                                          ERROR_BYTE_LOWER_LEVEL_FILL_ZERO);
+                        Safety_Powersupply_SendError(context, eEVENT_VCC_CHECK_ERROR, eERROR_SUPPLY_VOLTAGE, eERROR_VOLTAGE_VCC_DROPOUT,
+                                                              ERROR_BYTE_LOWER_LEVEL_FILL_ZERO);
                         }
                     }
 
                 // Check if supply voltage is below warning limit (SOFTQM-596)
                 if((ulVoltage < (VOLTAGE_SUPPLY_WARNING_MIN_VOLT * DECIMAL_FIXPOINT)) &&
-                   !(sysPowerStat & eSYSPWR_STAT_WARNING_VCC_LOW))
+                   !(context->sysPowerStat & eSYSPWR_STAT_WARNING_VCC_LOW))
                     {
                     // Send warning (SOFTQM-638)
-                    sysPowerStat |= eSYSPWR_STAT_WARNING_VCC_LOW;
-                    SendErrorMsgEvent(eEVENT_VCC_CHECK_WARNING, eERROR_SUPPLY_VOLTAGE, eERROR_VOLTAGE_EXCEEDED_MIN,
-                                      ERROR_BYTE_LOWER_LEVEL_FILL_ZERO);
+                    context->sysPowerStat |= eSYSPWR_STAT_WARNING_VCC_LOW;
+                    Safety_Powersupply_SendError(context, eEVENT_VCC_CHECK_WARNING, eERROR_SUPPLY_VOLTAGE, eERROR_VOLTAGE_EXCEEDED_MIN,
+                                                          ERROR_BYTE_LOWER_LEVEL_FILL_ZERO);
                     }
 
                 // Check if supply voltage is above warning limit (SOFTQM-596)
                 if((ulVoltage > (VOLTAGE_SUPPLY_WARNING_MAX_VOLT * DECIMAL_FIXPOINT)) &&
-                   !(sysPowerStat & eSYSPWR_STAT_WARNING_VCC_HIGH))
+                   !(context->sysPowerStat & eSYSPWR_STAT_WARNING_VCC_HIGH))
                     {
                     // Send warning (SOFTQM-638)
-                    sysPowerStat |= eSYSPWR_STAT_WARNING_VCC_HIGH;
-                    SendErrorMsgEvent(eEVENT_VCC_CHECK_WARNING, eERROR_SUPPLY_VOLTAGE, eERROR_VOLTAGE_EXCEEDED_MAX,
-                                      ERROR_BYTE_LOWER_LEVEL_FILL_ZERO);
+                    context->sysPowerStat |= eSYSPWR_STAT_WARNING_VCC_HIGH;
+                    Safety_Powersupply_SendError(context, eEVENT_VCC_CHECK_WARNING, eERROR_SUPPLY_VOLTAGE, eERROR_VOLTAGE_EXCEEDED_MAX,
+                                                          ERROR_BYTE_LOWER_LEVEL_FILL_ZERO);
                     }
                 }
 
@@ -1035,47 +1466,47 @@ MAX116XX_ADC_VALUES externalAdcValuesList[MAX116XX_NUMBER_OF_ADCS];
 
 // Auswertung 2. Versorgung
 #ifdef fpADCIN_VCC1
-    if(powerSupplyUserConfig->voltage1IsActive)
+    if(context->powerSupplyUserConfig->voltage1IsActive && adcReady && Safety_Powersupply_ChannelDue(context, eSYSPWR_CHANNEL_VCC1, currentTicks))
         {
-        if(ADC_SampleSingleChannel(fpADCIN_VCC1, &fVoltage1) != eADC_TRUE)
+        if(!Safety_Powersupply_SampleAdc(eSYSPWR_CHANNEL_VCC1, fpADCIN_VCC1, &fVoltage1))
             {
             // Enter non-permanent hard error state if measurement fails (SOFTQM-677)
-            Safety_HardError(HARD_ERR_SAFETY_MEASUREMENT);
+            Safety_Powersupply_HardError(context, HARD_ERR_SAFETY_MEASUREMENT);
             }
 
         // Umwandlung in Integer
         ulVoltage1 = (U32)(fVoltage1 * DECIMAL_FIXPOINT * VOLTAGE_1_FACTOR);
 
         // Mittelwertberechnung
-        if(AVG_Update(&tVCC1Avg, ulVoltage1) != eAVERAGING_NO_ERROR)
+        if(!Safety_Powersupply_FilterUpdate(context, eSYSPWR_CHANNEL_VCC1, &context->tVCC1Avg, ulVoltage1))
              {
             // Enter non-permanent hard error state if measurement fails (SOFTQM-677)
-             Safety_HardError(HARD_ERR_SAFETY_MEASUREMENT);
+             Safety_Powersupply_HardError(context, HARD_ERR_SAFETY_MEASUREMENT);
              }
 
-        if(AVG_GetIsValid(&tVCC1Avg.data))
+        if(Safety_Powersupply_FilterIsValid(context, eSYSPWR_CHANNEL_VCC1, &context->tVCC1Avg))
             {
-            if(AVG_Get(&tVCC1Avg, (S32*) &ulVoltage1) != eAVERAGING_NO_ERROR)
+            if(!Safety_Powersupply_FilterGet(context, eSYSPWR_CHANNEL_VCC1, &context->tVCC1Avg, (S32*) &ulVoltage1))
                 {
                 // Enter non-permanent hard error state if measurement fails (SOFTQM-677)
-                Safety_HardError(HARD_ERR_SAFETY_MEASUREMENT);
+                Safety_Powersupply_HardError(context, HARD_ERR_SAFETY_MEASUREMENT);
                 }
 
             // Spannung in RAM-Variable für Factory Device Communication eintragen
-            lPowerVoltage1 = ulVoltage1;
+            context->lPowerVoltage1 = ulVoltage1;
 
             // Check if voltage is below error level (SOFTQM-602)
             if((ulVoltage1 < VOLTAGE_1_LIMIT_MIN_MILLIVOLT))
                 {
                 // Only send error if supply voltage is not below error level (SOFTQM-602)
-                if((sysPowerStat & eSYSPWR_STAT_DETECT_VCC_LOW) == 0)
+                if((context->sysPowerStat & eSYSPWR_STAT_DETECT_VCC_LOW) == 0)
                     {
-                    if((sysPowerStat & eSYSPWR_STAT_ERROR_VCC1_LOW) == 0)
+                    if((context->sysPowerStat & eSYSPWR_STAT_ERROR_VCC1_LOW) == 0)
                         {
-                        sysPowerStat |= eSYSPWR_STAT_ERROR_VCC1_LOW;
+                        context->sysPowerStat |= eSYSPWR_STAT_ERROR_VCC1_LOW;
                         // Send error event if the voltage is below the minimum error level (SOFTQM-657)
-                        SendErrorMsgEvent(eEVENT_VCC_CHECK_ERROR, eERROR_INTERNAL_VOLTAGE_1, eERROR_VOLTAGE_EXCEEDED_MIN,
-                                          ERROR_BYTE_LOWER_LEVEL_FILL_ZERO);
+                        Safety_Powersupply_SendError(context, eEVENT_VCC_CHECK_ERROR, eERROR_INTERNAL_VOLTAGE_1, eERROR_VOLTAGE_EXCEEDED_MIN,
+                                                              ERROR_BYTE_LOWER_LEVEL_FILL_ZERO);
                         }
                     }
                 }
@@ -1083,11 +1514,11 @@ MAX116XX_ADC_VALUES externalAdcValuesList[MAX116XX_NUMBER_OF_ADCS];
             // Check if voltage is above error level (SOFTQM-602)
             if((ulVoltage1 > VOLTAGE_1_LIMIT_MAX_MILLIVOLT))
                 {
-                if((sysPowerStat & eSYSPWR_STAT_ERROR_VCC1_HIGH) == 0)
+                if((context->sysPowerStat & eSYSPWR_STAT_ERROR_VCC1_HIGH) == 0)
                     {
                     // Send a permanent hard error if voltage exceeds maximum error level (SOFTQM-636)
-                    sysPowerStat |= eSYSPWR_STAT_ERROR_VCC1_HIGH;
-                    Safety_PermanentHardError(HARD_ERR_VOLTAGE_EXCEEDED);
+                    context->sysPowerStat |= eSYSPWR_STAT_ERROR_VCC1_HIGH;
+                    Safety_Powersupply_PermanentHardError(context, HARD_ERR_VOLTAGE_EXCEEDED);
                     }
                 }
             }
@@ -1096,48 +1527,48 @@ MAX116XX_ADC_VALUES externalAdcValuesList[MAX116XX_NUMBER_OF_ADCS];
 
 // Auswertung 3. Versorgung
 #ifdef fpADCIN_VCC2
-    if(powerSupplyUserConfig->voltage2IsActive)
+    if(context->powerSupplyUserConfig->voltage2IsActive && adcReady && Safety_Powersupply_ChannelDue(context, eSYSPWR_CHANNEL_VCC2, currentTicks))
         {
         // Messwertaufnahme
-        if(ADC_SampleSingleChannel(fpADCIN_VCC2, &fVoltage2) != eADC_TRUE)
+        if(!Safety_Powersupply_SampleAdc(eSYSPWR_CHANNEL_VCC2, fpADCIN_VCC2, &fVoltage2))
             {
             // Enter non-permanent hard error state if measurement fails (SOFTQM-677)
-            Safety_HardError(HARD_ERR_SAFETY_MEASUREMENT);
+            Safety_Powersupply_HardError(context, HARD_ERR_SAFETY_MEASUREMENT);
             }
 
         // Umwandlung in Integer
         ulVoltage2 = (U32)(fVoltage2 * DECIMAL_FIXPOINT * VOLTAGE_2_FACTOR);
 
         // Mittwelwertberechnung
-        if(AVG_Update(&tVCC2Avg, ulVoltage2) != eAVERAGING_NO_ERROR)
+        if(!Safety_Powersupply_FilterUpdate(context, eSYSPWR_CHANNEL_VCC2, &context->tVCC2Avg, ulVoltage2))
             {
             // Enter non-permanent hard error state if measurement fails (SOFTQM-677)
-            Safety_HardError(HARD_ERR_SAFETY_MEASUREMENT);
+            Safety_Powersupply_HardError(context, HARD_ERR_SAFETY_MEASUREMENT);
             }
 
-        if(AVG_GetIsValid(&tVCC2Avg.data))
+        if(Safety_Powersupply_FilterIsValid(context, eSYSPWR_CHANNEL_VCC2, &context->tVCC2Avg))
             {
-            if(AVG_Get(&tVCC2Avg, (S32*) &ulVoltage2) != eAVERAGING_NO_ERROR)
+            if(!Safety_Powersupply_FilterGet(context, eSYSPWR_CHANNEL_VCC2, &context->tVCC2Avg, (S32*) &ulVoltage2))
                 {
                 // Enter non-permanent hard error state if measurement fails (SOFTQM-677)
-                Safety_HardError(HARD_ERR_SAFETY_MEASUREMENT);
+                Safety_Powersupply_HardError(context, HARD_ERR_SAFETY_MEASUREMENT);
                 }
 
             // Spannung in RAM-Variable für Factory Device Communication eintragen
-            lPowerVoltage2 = ulVoltage2;
+            context->lPowerVoltage2 = ulVoltage2;
 
             // Check if voltage is below error level (SOFTQM-602)
             if((ulVoltage2 < VOLTAGE_2_LIMIT_MIN_MILLIVOLT))
                 {
                 // Only send error if supply voltage is not below error level (SOFTQM-602)
-                if((sysPowerStat & eSYSPWR_STAT_DETECT_VCC_LOW) == 0)
+                if((context->sysPowerStat & eSYSPWR_STAT_DETECT_VCC_LOW) == 0)
                     {
-                    if((sysPowerStat & eSYSPWR_STAT_ERROR_VCC2_LOW) == 0)
+                    if((context->sysPowerStat & eSYSPWR_STAT_ERROR_VCC2_LOW) == 0)
                         {
-                        sysPowerStat |= eSYSPWR_STAT_ERROR_VCC2_LOW;
+                        context->sysPowerStat |= eSYSPWR_STAT_ERROR_VCC2_LOW;
                         // Send error event if the voltage is below the minimum error level (SOFTQM-657)
-                        SendErrorMsgEvent(eEVENT_VCC_CHECK_ERROR, eERROR_INTERNAL_VOLTAGE_2, eERROR_VOLTAGE_EXCEEDED_MIN,
-                                          ERROR_BYTE_LOWER_LEVEL_FILL_ZERO);
+                        Safety_Powersupply_SendError(context, eEVENT_VCC_CHECK_ERROR, eERROR_INTERNAL_VOLTAGE_2, eERROR_VOLTAGE_EXCEEDED_MIN,
+                                                              ERROR_BYTE_LOWER_LEVEL_FILL_ZERO);
                         }
                     }
                 }
@@ -1145,11 +1576,11 @@ MAX116XX_ADC_VALUES externalAdcValuesList[MAX116XX_NUMBER_OF_ADCS];
             // Check if voltage is above error level (SOFTQM-602)
             if((ulVoltage2 > VOLTAGE_2_LIMIT_MAX_MILLIVOLT))
                 {
-                if((sysPowerStat & eSYSPWR_STAT_ERROR_VCC2_HIGH) == 0)
+                if((context->sysPowerStat & eSYSPWR_STAT_ERROR_VCC2_HIGH) == 0)
                     {
                     // Send a permanent hard error if voltage exceeds maximum error level (SOFTQM-636)
-                    sysPowerStat |= eSYSPWR_STAT_ERROR_VCC2_HIGH;
-                    Safety_PermanentHardError(HARD_ERR_VOLTAGE_EXCEEDED);
+                    context->sysPowerStat |= eSYSPWR_STAT_ERROR_VCC2_HIGH;
+                    Safety_Powersupply_PermanentHardError(context, HARD_ERR_VOLTAGE_EXCEEDED);
                     }
                 }
             }
@@ -1158,48 +1589,48 @@ MAX116XX_ADC_VALUES externalAdcValuesList[MAX116XX_NUMBER_OF_ADCS];
 
 // Auswertung 3. Versorgung
 #ifdef fpADCIN_VCC3
-    if(powerSupplyUserConfig->voltage3IsActive)
+    if(context->powerSupplyUserConfig->voltage3IsActive && adcReady && Safety_Powersupply_ChannelDue(context, eSYSPWR_CHANNEL_VCC3, currentTicks))
         {
         // Messwertaufnahme
-        if(ADC_SampleSingleChannel(fpADCIN_VCC3, &fVoltage3) != eADC_TRUE)
+        if(!Safety_Powersupply_SampleAdc(eSYSPWR_CHANNEL_VCC3, fpADCIN_VCC3, &fVoltage3))
             {
             // Enter non-permanent hard error state if measurement fails (SOFTQM-677)
-            Safety_HardError(HARD_ERR_SAFETY_MEASUREMENT);
+            Safety_Powersupply_HardError(context, HARD_ERR_SAFETY_MEASUREMENT);
             }
 
         // Umwandlung in Integer
         ulVoltage3 = (U32)(fVoltage3 * DECIMAL_FIXPOINT * VOLTAGE_3_FACTOR);
 
         // Mittwelwertberechnung
-        if(AVG_Update(&tVCC3Avg, ulVoltage3) != eAVERAGING_NO_ERROR)
+        if(!Safety_Powersupply_FilterUpdate(context, eSYSPWR_CHANNEL_VCC3, &context->tVCC3Avg, ulVoltage3))
             {
             // Enter non-permanent hard error state if measurement fails (SOFTQM-677)
-            Safety_HardError(HARD_ERR_SAFETY_MEASUREMENT);
+            Safety_Powersupply_HardError(context, HARD_ERR_SAFETY_MEASUREMENT);
             }
 
-        if(AVG_GetIsValid(&tVCC3Avg.data))
+        if(Safety_Powersupply_FilterIsValid(context, eSYSPWR_CHANNEL_VCC3, &context->tVCC3Avg))
             {
-            if(AVG_Get(&tVCC3Avg, (S32*) &ulVoltage3) != eAVERAGING_NO_ERROR)
+            if(!Safety_Powersupply_FilterGet(context, eSYSPWR_CHANNEL_VCC3, &context->tVCC3Avg, (S32*) &ulVoltage3))
                 {
                 // Enter non-permanent hard error state if measurement fails (SOFTQM-677)
-                Safety_HardError(HARD_ERR_SAFETY_MEASUREMENT);
+                Safety_Powersupply_HardError(context, HARD_ERR_SAFETY_MEASUREMENT);
                 }
 
             // Spannung in RAM-Variable für Factory Device Communication eintragen
-            lPowerVoltage3 = ulVoltage3;
+            context->lPowerVoltage3 = ulVoltage3;
 
             // Check if voltage is below error level (SOFTQM-602)
             if((ulVoltage3 < VOLTAGE_3_LIMIT_MIN_MILLIVOLT))
                 {
                 // Only send error if supply voltage is not below error level (SOFTQM-602)
-                if((sysPowerStat & eSYSPWR_STAT_DETECT_VCC_LOW) == 0)
+                if((context->sysPowerStat & eSYSPWR_STAT_DETECT_VCC_LOW) == 0)
                     {
-                    if((sysPowerStat & eSYSPWR_STAT_ERROR_VCC3_LOW) == 0)
+                    if((context->sysPowerStat & eSYSPWR_STAT_ERROR_VCC3_LOW) == 0)
                         {
-                        sysPowerStat |= eSYSPWR_STAT_ERROR_VCC3_LOW;
+                        context->sysPowerStat |= eSYSPWR_STAT_ERROR_VCC3_LOW;
                         // Send error event if the voltage is below the minimum error level (SOFTQM-657)
-                        SendErrorMsgEvent(eEVENT_VCC_CHECK_ERROR, eERROR_INTERNAL_VOLTAGE_3, eERROR_VOLTAGE_EXCEEDED_MIN,
-                                          ERROR_BYTE_LOWER_LEVEL_FILL_ZERO);
+                        Safety_Powersupply_SendError(context, eEVENT_VCC_CHECK_ERROR, eERROR_INTERNAL_VOLTAGE_3, eERROR_VOLTAGE_EXCEEDED_MIN,
+                                                              ERROR_BYTE_LOWER_LEVEL_FILL_ZERO);
                         }
                     }
                 }
@@ -1207,11 +1638,11 @@ MAX116XX_ADC_VALUES externalAdcValuesList[MAX116XX_NUMBER_OF_ADCS];
             // Check if voltage is above error level (SOFTQM-602)
             if((ulVoltage3 > VOLTAGE_3_LIMIT_MAX_MILLIVOLT))
                 {
-                if((sysPowerStat & eSYSPWR_STAT_ERROR_VCC3_HIGH) == 0)
+                if((context->sysPowerStat & eSYSPWR_STAT_ERROR_VCC3_HIGH) == 0)
                     {
                     // Send a permanent hard error if voltage exceeds maximum error level (SOFTQM-636)
-                    sysPowerStat |= eSYSPWR_STAT_ERROR_VCC3_HIGH;
-                    Safety_PermanentHardError(HARD_ERR_VOLTAGE_EXCEEDED);
+                    context->sysPowerStat |= eSYSPWR_STAT_ERROR_VCC3_HIGH;
+                    Safety_Powersupply_PermanentHardError(context, HARD_ERR_VOLTAGE_EXCEEDED);
                     }
                 }
             }
@@ -1220,48 +1651,48 @@ MAX116XX_ADC_VALUES externalAdcValuesList[MAX116XX_NUMBER_OF_ADCS];
 
 // Auswertung 4. Versorgung
 #ifdef fpADCIN_VCC4
-    if(powerSupplyUserConfig->voltage4IsActive)
+    if(context->powerSupplyUserConfig->voltage4IsActive && adcReady && Safety_Powersupply_ChannelDue(context, eSYSPWR_CHANNEL_VCC4, currentTicks))
         {
         // Messwertaufnahme
-        if(ADC_SampleSingleChannel(fpADCIN_VCC4, &fVoltage4) != eADC_TRUE)
+        if(!Safety_Powersupply_SampleAdc(eSYSPWR_CHANNEL_VCC4, fpADCIN_VCC4, &fVoltage4))
             {
             // Enter non-permanent hard error state if measurement fails (SOFTQM-677)
-            Safety_HardError(HARD_ERR_SAFETY_MEASUREMENT);
+            Safety_Powersupply_HardError(context, HARD_ERR_SAFETY_MEASUREMENT);
             }
 
         // Umwandlung in Integer
         ulVoltage4 = (U32)(fVoltage4 * DECIMAL_FIXPOINT * VOLTAGE_4_FACTOR);
 
         // Mittwelwertberechnung
-        if(AVG_Update(&tVCC4Avg, ulVoltage4) != eAVERAGING_NO_ERROR)
+        if(!Safety_Powersupply_FilterUpdate(context, eSYSPWR_CHANNEL_VCC4, &context->tVCC4Avg, ulVoltage4))
             {
             // Enter non-permanent hard error state if measurement fails (SOFTQM-677)
-            Safety_HardError(HARD_ERR_SAFETY_MEASUREMENT);
+            Safety_Powersupply_HardError(context, HARD_ERR_SAFETY_MEASUREMENT);
             }
 
-        if(AVG_GetIsValid(&tVCC4Avg.data))
+        if(Safety_Powersupply_FilterIsValid(context, eSYSPWR_CHANNEL_VCC4, &context->tVCC4Avg))
             {
-            if(AVG_Get(&tVCC4Avg, (S32*) &ulVoltage4) != eAVERAGING_NO_ERROR)
+            if(!Safety_Powersupply_FilterGet(context, eSYSPWR_CHANNEL_VCC4, &context->tVCC4Avg, (S32*) &ulVoltage4))
                 {
                 // Enter non-permanent hard error state if measurement fails (SOFTQM-677)
-                Safety_HardError(HARD_ERR_SAFETY_MEASUREMENT);
+                Safety_Powersupply_HardError(context, HARD_ERR_SAFETY_MEASUREMENT);
                 }
 
             // Spannung in RAM-Variable für Factory Device Communication eintragen
-            lPowerVoltage4 = ulVoltage4;
+            context->lPowerVoltage4 = ulVoltage4;
 
             // Check if voltage is below error level (SOFTQM-602)
             if((ulVoltage4 < VOLTAGE_4_LIMIT_MIN_MILLIVOLT))
                 {
                 // Only send error if supply voltage is not below error level (SOFTQM-602)
-                if((sysPowerStat & eSYSPWR_STAT_DETECT_VCC_LOW) == 0)
+                if((context->sysPowerStat & eSYSPWR_STAT_DETECT_VCC_LOW) == 0)
                     {
-                    if((sysPowerStat & eSYSPWR_STAT_ERROR_VCC4_LOW) == 0)
+                    if((context->sysPowerStat & eSYSPWR_STAT_ERROR_VCC4_LOW) == 0)
                         {
-                        sysPowerStat |= eSYSPWR_STAT_ERROR_VCC4_LOW;
+                        context->sysPowerStat |= eSYSPWR_STAT_ERROR_VCC4_LOW;
                         // Send error event if the voltage is below the minimum error level (SOFTQM-657)
-                        SendErrorMsgEvent(eEVENT_VCC_CHECK_ERROR, eERROR_INTERNAL_VOLTAGE_4, eERROR_VOLTAGE_EXCEEDED_MIN,
-                                          ERROR_BYTE_LOWER_LEVEL_FILL_ZERO);
+                        Safety_Powersupply_SendError(context, eEVENT_VCC_CHECK_ERROR, eERROR_INTERNAL_VOLTAGE_4, eERROR_VOLTAGE_EXCEEDED_MIN,
+                                                              ERROR_BYTE_LOWER_LEVEL_FILL_ZERO);
                         }
                     }
                 }
@@ -1269,11 +1700,11 @@ MAX116XX_ADC_VALUES externalAdcValuesList[MAX116XX_NUMBER_OF_ADCS];
             // Check if voltage is above error level (SOFTQM-602)
             if((ulVoltage4 > VOLTAGE_4_LIMIT_MAX_MILLIVOLT))
                 {
-                if((sysPowerStat & eSYSPWR_STAT_ERROR_VCC4_HIGH) == 0)
+                if((context->sysPowerStat & eSYSPWR_STAT_ERROR_VCC4_HIGH) == 0)
                     {
                     // Send a permanent hard error if voltage exceeds maximum error level (SOFTQM-636)
-                    sysPowerStat |= eSYSPWR_STAT_ERROR_VCC4_HIGH;
-                    Safety_PermanentHardError(HARD_ERR_VOLTAGE_EXCEEDED);
+                    context->sysPowerStat |= eSYSPWR_STAT_ERROR_VCC4_HIGH;
+                    Safety_Powersupply_PermanentHardError(context, HARD_ERR_VOLTAGE_EXCEEDED);
                     }
                 }
             }
@@ -1282,48 +1713,48 @@ MAX116XX_ADC_VALUES externalAdcValuesList[MAX116XX_NUMBER_OF_ADCS];
 
 // Auswertung 5. Versorgung
 #ifdef fpADCIN_VCC5
-    if(powerSupplyUserConfig->voltage5IsActive)
+    if(context->powerSupplyUserConfig->voltage5IsActive && adcReady && Safety_Powersupply_ChannelDue(context, eSYSPWR_CHANNEL_VCC5, currentTicks))
         {
         // Messwertaufnahme
-        if(ADC_SampleSingleChannel(fpADCIN_VCC5, &fVoltage5) != eADC_TRUE)
+        if(!Safety_Powersupply_SampleAdc(eSYSPWR_CHANNEL_VCC5, fpADCIN_VCC5, &fVoltage5))
             {
             // Enter non-permanent hard error state if measurement fails (SOFTQM-677)
-            Safety_HardError(HARD_ERR_SAFETY_MEASUREMENT);
+            Safety_Powersupply_HardError(context, HARD_ERR_SAFETY_MEASUREMENT);
             }
 
         // Umwandlung in Integer
         ulVoltage5 = (U32)(fVoltage5 * DECIMAL_FIXPOINT * VOLTAGE_5_FACTOR);
 
         // Mittwelwertberechnung
-        if(AVG_Update(&tVCC5Avg, ulVoltage5) != eAVERAGING_NO_ERROR)
+        if(!Safety_Powersupply_FilterUpdate(context, eSYSPWR_CHANNEL_VCC5, &context->tVCC5Avg, ulVoltage5))
             {
             // Enter non-permanent hard error state if measurement fails (SOFTQM-677)
-            Safety_HardError(HARD_ERR_SAFETY_MEASUREMENT);
+            Safety_Powersupply_HardError(context, HARD_ERR_SAFETY_MEASUREMENT);
             }
 
-        if(AVG_GetIsValid(&tVCC5Avg.data))
+        if(Safety_Powersupply_FilterIsValid(context, eSYSPWR_CHANNEL_VCC5, &context->tVCC5Avg))
             {
-            if(AVG_Get(&tVCC5Avg, (S32*) &ulVoltage5) != eAVERAGING_NO_ERROR)
+            if(!Safety_Powersupply_FilterGet(context, eSYSPWR_CHANNEL_VCC5, &context->tVCC5Avg, (S32*) &ulVoltage5))
                 {
                 // Enter non-permanent hard error state if measurement fails (SOFTQM-677)
-                Safety_HardError(HARD_ERR_SAFETY_MEASUREMENT);
+                Safety_Powersupply_HardError(context, HARD_ERR_SAFETY_MEASUREMENT);
                 }
 
             // Spannung in RAM-Variable für Factory Device Communication eintragen
-            lPowerVoltage5 = ulVoltage5;
+            context->lPowerVoltage5 = ulVoltage5;
 
             // Check if voltage is below error level (SOFTQM-602)
             if((ulVoltage5 < VOLTAGE_5_LIMIT_MIN_MILLIVOLT))
                 {
                 // Only send error if supply voltage is not below error level (SOFTQM-602)
-                if((sysPowerStat & eSYSPWR_STAT_DETECT_VCC_LOW) == 0)
+                if((context->sysPowerStat & eSYSPWR_STAT_DETECT_VCC_LOW) == 0)
                     {
-                    if((sysPowerStat & eSYSPWR_STAT_ERROR_VCC5_LOW) == 0)
+                    if((context->sysPowerStat & eSYSPWR_STAT_ERROR_VCC5_LOW) == 0)
                         {
-                        sysPowerStat |= eSYSPWR_STAT_ERROR_VCC5_LOW;
+                        context->sysPowerStat |= eSYSPWR_STAT_ERROR_VCC5_LOW;
                         // Send error event if the voltage is below the minimum error level (SOFTQM-657)
-                        SendErrorMsgEvent(eEVENT_VCC_CHECK_ERROR, eERROR_INTERNAL_VOLTAGE_5, eERROR_VOLTAGE_EXCEEDED_MIN,
-                                          ERROR_BYTE_LOWER_LEVEL_FILL_ZERO);
+                        Safety_Powersupply_SendError(context, eEVENT_VCC_CHECK_ERROR, eERROR_INTERNAL_VOLTAGE_5, eERROR_VOLTAGE_EXCEEDED_MIN,
+                                                              ERROR_BYTE_LOWER_LEVEL_FILL_ZERO);
                         }
                     }
                 }
@@ -1331,11 +1762,11 @@ MAX116XX_ADC_VALUES externalAdcValuesList[MAX116XX_NUMBER_OF_ADCS];
             // Check if voltage is above error level (SOFTQM-602)
             if((ulVoltage5 > VOLTAGE_5_LIMIT_MAX_MILLIVOLT))
                 {
-                if((sysPowerStat & eSYSPWR_STAT_ERROR_VCC5_HIGH) == 0)
+                if((context->sysPowerStat & eSYSPWR_STAT_ERROR_VCC5_HIGH) == 0)
                     {
                     // Send a permanent hard error if voltage exceeds maximum error level (SOFTQM-636)
-                    sysPowerStat |= eSYSPWR_STAT_ERROR_VCC5_HIGH;
-                    Safety_PermanentHardError(HARD_ERR_VOLTAGE_EXCEEDED);
+                    context->sysPowerStat |= eSYSPWR_STAT_ERROR_VCC5_HIGH;
+                    Safety_Powersupply_PermanentHardError(context, HARD_ERR_VOLTAGE_EXCEEDED);
                     }
                 }
             }
@@ -1345,206 +1776,37 @@ MAX116XX_ADC_VALUES externalAdcValuesList[MAX116XX_NUMBER_OF_ADCS];
 //------------------- BLOCK: Get values from queue -----------------------
 #if ((MAX116XX_FEAT_4CHANNEL_ADC) || (MAX116XX_FEAT_12CHANNEL_ADC))
     // Get value from queue of external adc task
-    if(MAX116XX_AdcValuesPeek(externalAdcValuesList) != true)
+    if(!Safety_Powersupply_ChannelDue(context, eSYSPWR_CHANNEL_EXT_ADC, currentTicks))
         {
-        // The external adc task needs some time to provide the first values. It does get a tolerance of WAIT_EXTERNAL_ADC_STARTUP_IN_SAFETYCYCLE_TICKS cycles of the safety task.
-        if(waitStartupExternalAdcTolerance == 0)
-            {
-            Safety_PermanentHardError(HARD_ERR_SAFETY_MEASUREMENT);
-            }
-        else
+        // Externer ADC ist in diesem Zyklus nicht zu messen
+        }
+    else if(!Safety_Powersupply_UpdateExternalAdc(context))
+        {
+        // The external adc task needs some time to provide the first values. It does get a tolerance of
+        // WAIT_EXTERNAL_ADC_STARTUP_MS after the initialization, once it provided values there is no tolerance.
+        if(Safety_Powersupply_ContextIsSourceReady(context, eSAFETY_POWERSUPPLY_SOURCE_EXTERNAL_ADC)
+                || Safety_Powersupply_StartupTimeElapsed(context, currentTicks, WAIT_EXTERNAL_ADC_STARTUP_MS))
             {
-            waitStartupExternalAdcTolerance--;
+            Safety_Powersupply_PermanentHardError(context, HARD_ERR_SAFETY_MEASUREMENT);
             }
         }
     else
         {
-        // If reading was successful once, the tolerance is set to 0.
-        waitStartupExternalAdcTolerance = 0;
+        // First values of the external adc, the monitoring starts immediately
+        Safety_Powersupply_ContextSignalSourceReady(context, eSAFETY_POWERSUPPLY_SOURCE_EXTERNAL_ADC);
 
 //------------------------------------------------------------------------
 
-//------------------- BLOCK: first voltage of external ADC----------------
-        // Checking of the voltages on the external ADC MAX166xx
-        if(powerSupplyUserConfig->voltageExternalAdcChannel1IsActive)
-            {
-//------------------- BLOCK: Calculting Averages -------------------------
-            // calculate the average
-#if EXT_ADC_CHANNEL1_TO_CHECK_IS_12CHANNEL
-            // Float values are normalized to the internal reference voltage of 2.048V. Calculate real voltage on the pin of the external adc.
-            externalAdcValuesList[MAX116XX_POS_12CHANNEL_ADC].f32Data[EXT_ADC_CHANNEL1_TO_CHECK_CHANNEL] = externalAdcValuesList[MAX116XX_POS_12CHANNEL_ADC].f32Data[EXT_ADC_CHANNEL1_TO_CHECK_CHANNEL] * ((F32)MAX11611_REFERENCE_VOLTAGE / 1000.0f);;
-            // The voltage measured is divided by a voltage divider. Recalculate the actual input voltage
-            externalAdcValuesList[MAX116XX_POS_12CHANNEL_ADC].f32Data[EXT_ADC_CHANNEL1_TO_CHECK_CHANNEL] = externalAdcValuesList[MAX116XX_POS_12CHANNEL_ADC].f32Data[EXT_ADC_CHANNEL1_TO_CHECK_CHANNEL] * EXT_ADC_CHANNEL1_TO_CHECK_V_DIVIDER_MULTIPLIKATOR;
-            if(AVG_UpdateF32(&tVCCExternalAdcChannel1AvgInstance, externalAdcValuesList[MAX116XX_POS_12CHANNEL_ADC].f32Data[EXT_ADC_CHANNEL1_TO_CHECK_CHANNEL] ) != eAVERAGING_NO_ERROR)
-#else
-                // Float values are normalized to the internal reference voltage of 2.048V. Calculate real voltage on the pin of the external adc.
-            externalAdcValuesList[MAX116XX_POS_4CHANNEL_ADC].f32Data[EXT_ADC_CHANNEL1_TO_CHECK_CHANNEL] = externalAdcValuesList[MAX116XX_POS_4CHANNEL_ADC].f32Data[EXT_ADC_CHANNEL1_TO_CHECK_CHANNEL] * ((F32)MAX11607_REFERENCE_VOLTAGE / 1000.0f);;
-            // The voltage measured is divided by a voltage divider. Recalculate the actual input voltage
-            externalAdcValuesList[MAX116XX_POS_4CHANNEL_ADC].f32Data[EXT_ADC_CHANNEL1_TO_CHECK_CHANNEL] = externalAdcValuesList[MAX116XX_POS_4CHANNEL_ADC].f32Data[EXT_ADC_CHANNEL1_TO_CHECK_CHANNEL] * EXT_ADC_CHANNEL1_TO_CHECK_V_DIVIDER_MULTIPLIKATOR;
-            if(AVG_UpdateF32(&tVCCExternalAdcChannel1AvgInstance, externalAdcValuesList[MAX116XX_FEAT_4CHANNEL_ADC].f32Data[EXT_ADC_CHANNEL1_TO_CHECK_CHANNEL] ) != eAVERAGING_NO_ERROR)
-#endif // EXT_ADC_CHANNEL1_TO_CHECK_IS_12CHANNEL
-                {
-                // Enter non-permanent hard error state if measurement fails (SOFTQM-677)
-                Safety_HardError(HARD_ERR_SAFETY_MEASUREMENT);
-                }
-
-                if(AVG_IsValidF32(&tVCCExternalAdcChannel1AvgInstance))
-                    {
-                    if(AVG_GetF32(&tVCCExternalAdcChannel1AvgInstance, &tVCCExternalAdcChannel1Avg) != eAVERAGING_NO_ERROR)
-                        {
-                        // Enter non-permanent hard error state if measurement fails (SOFTQM-677)
-                        Safety_HardError(HARD_ERR_SAFETY_MEASUREMENT);
-                        }
-//------------------------------------------------------------------------
-//------------------- BLOCK: Comparing to thresholds----------------------
-                        // Check if voltage is below error level (SOFTQM-602)
-                    if((tVCCExternalAdcChannel1Avg < EXT_ADC_CHANNEL1_TO_CHECK_LIMIT_MIN_VOLT))
-                        {
-                        // Only send error if supply voltage is not below error level (SOFTQM-602)
-                        if((sysPowerStat & eSYSPWR_STAT_DETECT_VCC_LOW) == 0)
-                            {
-                            if((sysPowerStat & eSYSPWR_START_ERROR_EXT_ADC_CH1_LOW) == 0)
-                                {
-                                sysPowerStat |= eSYSPWR_START_ERROR_EXT_ADC_CH1_LOW;
-                                // Send error event if the voltage is below the minimum error level (SOFTQM-657)
-                                SendErrorMsgEvent(eEVENT_VCC_CHECK_ERROR, eERROR_EXTERNAL_ADC_VOLTAGE_1, eERROR_VOLTAGE_EXCEEDED_MIN,
-                                                ERROR_BYTE_LOWER_LEVEL_FILL_ZERO);
-                                }
-                            }
-                        }
-                    if((tVCCExternalAdcChannel1Avg > EXT_ADC_CHANNEL1_TO_CHECK_LIMIT_MAX_VOLT))
-                            {
-                            if((sysPowerStat & eSYSPWR_STAT_ERROR_EXT_ADC_CH1_HIGH) == 0)
-                                {
-                                // Send a permanent hard error if voltage exceeds maximum error level (SOFTQM-636)
-                                sysPowerStat |= eSYSPWR_STAT_ERROR_EXT_ADC_CH1_HIGH;
-                                Safety_PermanentHardError(HARD_ERR_VOLTAGE_EXCEEDED);
-                                }
-                            }
-                    } // if(AVG_IsValidF32(&tVCCExternalAdcChannel1AvgInstance))
-            } // if(powerSupplyUserConfig->voltageExternalAdcChannel1IsActive)
-
-
-//------------------- BLOCK: second voltage of external ADC---------------
+//------------------- BLOCK: voltages of external ADC---------------------
         // Checking of the voltages on the external ADC MAX166xx
-        if(powerSupplyUserConfig->voltageExternalAdcChannel2IsActive)
+        for(i = 0; i < context->externalAdcChannelCount; i++)
             {
-//------------------- BLOCK: Calculting Averages -------------------------
-            // calculate the average
-#if EXT_ADC_CHANNEL2_TO_CHECK_IS_12CHANNEL
-            // Float values are normalized to the internal reference voltage of 2.048V. Calculate real voltage on the pin of the external adc.
-            externalAdcValuesList[MAX116XX_POS_12CHANNEL_ADC].f32Data[EXT_ADC_CHANNEL2_TO_CHECK_CHANNEL] = externalAdcValuesList[MAX116XX_POS_12CHANNEL_ADC].f32Data[EXT_ADC_CHANNEL2_TO_CHECK_CHANNEL] * ((F32)MAX11611_REFERENCE_VOLTAGE / 1000.0f);;
-            // The voltage measured is divided by a voltage divider. Recalculate the actual input voltage
-            externalAdcValuesList[MAX116XX_POS_12CHANNEL_ADC].f32Data[EXT_ADC_CHANNEL2_TO_CHECK_CHANNEL] = externalAdcValuesList[MAX116XX_POS_12CHANNEL_ADC].f32Data[EXT_ADC_CHANNEL2_TO_CHECK_CHANNEL] * EXT_ADC_CHANNEL2_TO_CHECK_V_DIVIDER_MULTIPLIKATOR;
-            if(AVG_UpdateF32(&tVCCExternalAdcChannel2AvgInstance, externalAdcValuesList[MAX116XX_POS_12CHANNEL_ADC].f32Data[EXT_ADC_CHANNEL2_TO_CHECK_CHANNEL] ) != eAVERAGING_NO_ERROR)
-#else
-            // Float values are normalized to the internal reference voltage of 2.048V. Calculate real voltage on the pin of the external adc.
-            externalAdcValuesList[MAX116XX_POS_4CHANNEL_ADC].f32Data[EXT_ADC_CHANNEL2_TO_CHECK_CHANNEL] = externalAdcValuesList[MAX116XX_POS_4CHANNEL_ADC].f32Data[EXT_ADC_CHANNEL2_TO_CHECK_CHANNEL] * ((F32)MAX11607_REFERENCE_VOLTAGE / 1000.0f);;
-            // The voltage measured is divided by a voltage divider. Recalculate the actual input voltage
-            externalAdcValuesList[MAX116XX_POS_4CHANNEL_ADC].f32Data[EXT_ADC_CHANNEL2_TO_CHECK_CHANNEL] = externalAdcValuesList[MAX116XX_POS_4CHANNEL_ADC].f32Data[EXT_ADC_CHANNEL2_TO_CHECK_CHANNEL] * EXT_ADC_CHANNEL2_TO_CHECK_V_DIVIDER_MULTIPLIKATOR;
-            if(AVG_UpdateF32(&tVCCExternalAdcChannel2AvgInstance, externalAdcValuesList[MAX116XX_FEAT_4CHANNEL_ADC].f32Data[EXT_ADC_CHANNEL2_TO_CHECK_CHANNEL] ) != eAVERAGING_NO_ERROR)
-#endif // EXT_ADC_CHANNEL2_TO_CHECK_IS_12CHANNEL
-                {
-                // Enter non-permanent hard error state if measurement fails (SOFTQM-677)
-                Safety_HardError(HARD_ERR_SAFETY_MEASUREMENT);
-                }
-
-                if(AVG_IsValidF32(&tVCCExternalAdcChannel2AvgInstance))
-                    {
-                    if(AVG_GetF32(&tVCCExternalAdcChannel2AvgInstance, &tVCCExternalAdcChannel2Avg) != eAVERAGING_NO_ERROR)
-                        {
-                        // Enter non-permanent hard error state if measurement fails (SOFTQM-677)
-                        Safety_HardError(HARD_ERR_SAFETY_MEASUREMENT);
-                        }
-        //------------------------------------------------------------------------
-        //------------------- BLOCK: Comparing to thresholds----------------------
-                    // Check if voltage is below error level (SOFTQM-602)
-                    if((tVCCExternalAdcChannel2Avg < EXT_ADC_CHANNEL2_TO_CHECK_LIMIT_MIN_VOLT))
-                        {
-                        // Only send error if supply voltage is not below error level (SOFTQM-602)
-                        if((sysPowerStat & eSYSPWR_STAT_DETECT_VCC_LOW) == 0)
-                            {
-                            if((sysPowerStat & eSYSPWR_START_ERROR_EXT_ADC_CH2_LOW) == 0)
-                                {
-                                sysPowerStat |= eSYSPWR_START_ERROR_EXT_ADC_CH2_LOW;
-                                // Send error event if the voltage is below the minimum error level (SOFTQM-657)
-                                SendErrorMsgEvent(eEVENT_VCC_CHECK_ERROR, eERROR_EXTERNAL_ADC_VOLTAGE_2, eERROR_VOLTAGE_EXCEEDED_MIN,
-                                                ERROR_BYTE_LOWER_LEVEL_FILL_ZERO);
-                                }
-                            }
-                        }
-                    if((tVCCExternalAdcChannel2Avg > EXT_ADC_CHANNEL2_TO_CHECK_LIMIT_MAX_VOLT))
-                            {
-                            if((sysPowerStat & eSYSPWR_STAT_ERROR_EXT_ADC_CH2_HIGH) == 0)
-                                {
-                                // Send a permanent hard error if voltage exceeds maximum error level (SOFTQM-636)
-                                sysPowerStat |= eSYSPWR_STAT_ERROR_EXT_ADC_CH2_HIGH;
-                                Safety_PermanentHardError(HARD_ERR_VOLTAGE_EXCEEDED);
-                                }
-                            }
-                    }
-            } // if(powerSupplyUserConfig->voltageExternalAdcChannel2IsActive)
-
-//------------------- BLOCK: third voltage of external ADC----------------
-        // Checking of the voltages on the external ADC MAX166xx
-        if(powerSupplyUserConfig->voltageExternalAdcChannel3IsActive)
-            {
-//------------------- BLOCK: Calculting Averages -------------------------
-            // calculate the average
-#if EXT_ADC_CHANNEL3_TO_CHECK_IS_12CHANNEL
-            // Float values are normalized to the internal reference voltage of 2.048V. Calculate real voltage on the pin of the external adc.
-            externalAdcValuesList[MAX116XX_POS_12CHANNEL_ADC].f32Data[EXT_ADC_CHANNEL3_TO_CHECK_CHANNEL] = externalAdcValuesList[MAX116XX_POS_12CHANNEL_ADC].f32Data[EXT_ADC_CHANNEL3_TO_CHECK_CHANNEL] * ((F32)MAX11611_REFERENCE_VOLTAGE / 1000.0f);;
-            // The voltage measured is divided by a voltage divider. Recalculate the actual input voltage
-            externalAdcValuesList[MAX116XX_POS_12CHANNEL_ADC].f32Data[EXT_ADC_CHANNEL3_TO_CHECK_CHANNEL] = externalAdcValuesList[MAX116XX_POS_12CHANNEL_ADC].f32Data[EXT_ADC_CHANNEL3_TO_CHECK_CHANNEL] * EXT_ADC_CHANNEL3_TO_CHECK_V_DIVIDER_MULTIPLIKATOR;
-            if(AVG_UpdateF32(&tVCCExternalAdcChannel3AvgInstance, externalAdcValuesList[MAX116XX_POS_12CHANNEL_ADC].f32Data[EXT_ADC_CHANNEL3_TO_CHECK_CHANNEL] ) != eAVERAGING_NO_ERROR)
-#else
-            // Float values are normalized to the internal reference voltage of 2.048V. Calculate real voltage on the pin of the external adc.
-            externalAdcValuesList[MAX116XX_POS_4CHANNEL_ADC].f32Data[EXT_ADC_CHANNEL3_TO_CHECK_CHANNEL] = externalAdcValuesList[MAX116XX_POS_4CHANNEL_ADC].f32Data[EXT_ADC_CHANNEL3_TO_CHECK_CHANNEL] * ((F32)MAX11607_REFERENCE_VOLTAGE / 1000.0f);;
-            // The voltage measured is divided by a voltage divider. Recalculate the actual input voltage
-            externalAdcValuesList[MAX116XX_POS_4CHANNEL_ADC].f32Data[EXT_ADC_CHANNEL3_TO_CHECK_CHANNEL] = externalAdcValuesList[MAX116XX_POS_4CHANNEL_ADC].f32Data[EXT_ADC_CHANNEL3_TO_CHECK_CHANNEL] * EXT_ADC_CHANNEL3_TO_CHECK_V_DIVIDER_MULTIPLIKATOR;
-            if(AVG_UpdateF32(&tVCCExternalAdcChannel3AvgInstance, externalAdcValuesList[MAX116XX_FEAT_4CHANNEL_ADC].f32Data[EXT_ADC_CHANNEL3_TO_CHECK_CHANNEL] ) != eAVERAGING_NO_ERROR)
-#endif // EXT_ADC_CHANNEL3_TO_CHECK_IS_12CHANNEL
+            if((context->externalAdcActive[EXT_ADC_STAT_WORD(i)] & EXT_ADC_STAT_BIT(i)) != 0u)
                 {
-                // Enter non-permanent hard error state if measurement fails (SOFTQM-677)
-                Safety_HardError(HARD_ERR_SAFETY_MEASUREMENT);
+                Safety_Powersupply_CheckExternalAdcChannel(context, i);
                 }
-
-                if(AVG_IsValidF32(&tVCCExternalAdcChannel3AvgInstance))
-                    {
-                    if(AVG_GetF32(&tVCCExternalAdcChannel3AvgInstance, &tVCCExternalAdcChannel3Avg) != eAVERAGING_NO_ERROR)
-                        {
-                        // Enter non-permanent hard error state if measurement fails (SOFTQM-677)
-                        Safety_HardError(HARD_ERR_SAFETY_MEASUREMENT);
-                        }
-//------------------------------------------------------------------------
-//------------------- BLOCK: Comparing to thresholds----------------------
-                    // Check if voltage is below error level (SOFTQM-602)
-                    if((tVCCExternalAdcChannel3Avg < EXT_ADC_CHANNEL3_TO_CHECK_LIMIT_MIN_VOLT))
-                        {
-                        // Only send error if supply voltage is not below error level (SOFTQM-602)
-                        if((sysPowerStat & eSYSPWR_STAT_DETECT_VCC_LOW) == 0)
-                            {
-                            if((sysPowerStat & eSYSPWR_START_ERROR_EXT_ADC_CH3_LOW) == 0)
-                                {
-                                sysPowerStat |= eSYSPWR_START_ERROR_EXT_ADC_CH3_LOW;
-                                // Send error event if the voltage is below the minimum error level (SOFTQM-657)
-                                SendErrorMsgEvent(eEVENT_VCC_CHECK_ERROR, eERROR_EXTERNAL_ADC_VOLTAGE_3, eERROR_VOLTAGE_EXCEEDED_MIN,
-                                                ERROR_BYTE_LOWER_LEVEL_FILL_ZERO);
-                                }
-                            }
-                        } // if((tVCCExternalAdcChannel3Avg < EXT_ADC_CHANNEL3_TO_CHECK_LIMIT_MIN_VOLT))
-                    if((tVCCExternalAdcChannel3Avg > EXT_ADC_CHANNEL3_TO_CHECK_LIMIT_MAX_VOLT))
-                            {
-                            if((sysPowerStat & eSYSPWR_STAT_ERROR_EXT_ADC_CH3_HIGH) == 0)
-                                {
-                                // Send a permanent hard error if voltage exceeds maximum error level (SOFTQM-636)
-                                sysPowerStat |= eSYSPWR_STAT_ERROR_EXT_ADC_CH3_HIGH;
-                                Safety_PermanentHardError(HARD_ERR_VOLTAGE_EXCEEDED);
-                                }
-                            } // if((tVCCExternalAdcChannel3Avg > EXT_ADC_CHANNEL3_TO_CHECK_LIMIT_MAX_VOLT))
-                    } // if(AVG_IsValidF32(&tVCCExternalAdcChannel3AvgInstance))
             }
-        } // if(MAX116XX_AdcValuesPeek(externalAdcValuesList) != true)
+        } // if(!Safety_Powersupply_UpdateExternalAdc(context))
 #endif // ((MAX116XX_FEAT_4CHANNEL_ADC) || (MAX116XX_FEAT_12CHANNEL_ADC))
 //------------------------------------------------------------------------
 
@@ -1552,30 +1814,33 @@ MAX116XX_ADC_VALUES externalAdcValuesList[MAX116XX_NUMBER_OF_ADCS];
 
 // Leistungsaufnahme
 #if defined(fpADCIN_ICC) && defined(fpADCIN_VCC)
-    if(powerSupplyUserConfig->supplyVoltageIsActive && powerSupplyUserConfig->currentIsActive)
+    if(context->powerSupplyUserConfig->supplyVoltageIsActive && context->powerSupplyUserConfig->currentIsActive)
         {
-        if((sysPowerStat & (eSYSPWR_STAT_VCC_VALID | eSYSPWR_STAT_I_VALID)) == (eSYSPWR_STAT_VCC_VALID | eSYSPWR_STAT_I_VALID))
+        if((context->sysPowerStat & (eSYSPWR_STAT_VCC_VALID | eSYSPWR_STAT_I_VALID)) == (eSYSPWR_STAT_VCC_VALID | eSYSPWR_STAT_I_VALID))
             {
-            ulPower = (U32)((lPowerVoltage * lPowerCurrent) / DECIMAL_FIXPOINT);
+            context->ulPower = (U32)((context->lPowerVoltage * context->lPowerCurrent) / DECIMAL_FIXPOINT);
+#if FEATURE_SAFETY_POWERSUPPLY_STATISTICS
+            Safety_Powersupply_UpdateStatistics(context, eSAFETY_POWERSUPPLY_STAT_POWER, (S32) context->ulPower);
+#endif
 
-            if(ulPower > POWER_LIMIT_MAX_MILLIWATT)
+            if(context->ulPower > POWER_LIMIT_MAX_MILLIWATT)
                 {
-                if((sysPowerStat & eSYSPWR_STAT_ERROR_POWER_HIGH) == 0)
+                if((context->sysPowerStat & eSYSPWR_STAT_ERROR_POWER_HIGH) == 0)
                     {
-                    sysPowerStat |= eSYSPWR_STAT_ERROR_POWER_HIGH;
-                    Safety_PermanentHardError(HARD_ERR_POWER_EXCEEDED);
+                    context->sysPowerStat |= eSYSPWR_STAT_ERROR_POWER_HIGH;
+                    Safety_Powersupply_PermanentHardError(context, HARD_ERR_POWER_EXCEEDED);
                     }
                 }
 
-            if(ulPower > (U32)(POWER_LIMIT_WARNING_MAX_WATT * DECIMAL_FIXPOINT))
+            if(context->ulPower > (U32)(POWER_LIMIT_WARNING_MAX_WATT * DECIMAL_FIXPOINT))
                 {
                 // Power too high
-                if(!(sysPowerStat & eSYSPWR_STAT_WARNING_POWER_HIGH))
+                if(!(context->sysPowerStat & eSYSPWR_STAT_WARNING_POWER_HIGH))
                     {
-                    sysPowerStat |= eSYSPWR_STAT_WARNING_POWER_HIGH;
+                    context->sysPowerStat |= eSYSPWR_STAT_WARNING_POWER_HIGH;
                     // Send warning if power exceeds maximum warning limit (SOFTQM-640)
-                    SendErrorMsgEvent(eEVENT_POWER_CHECK, eERROR_SUPPLY_POWER, eERROR_POWER_EXCEEDED_MAX,
-                                      ERROR_BYTE_LOWER_LEVEL_FILL_ZERO);
+                    Safety_Powersupply_SendError(context, eEVENT_POWER_CHECK, eERROR_SUPPLY_POWER, eERROR_POWER_EXCEEDED_MAX,
+                                                          ERROR_BYTE_LOWER_LEVEL_FILL_ZERO);
                     }
                 }
             }
@@ -1585,102 +1850,116 @@ MAX116XX_ADC_VALUES externalAdcValuesList[MAX116XX_NUMBER_OF_ADCS];
 
 // Temperatur
 #ifdef fpADCIN_TEMPERATURE
-    if(powerSupplyUserConfig->temperatureAdcIsActive)
+    if(context->powerSupplyUserConfig->temperatureAdcIsActive && adcReady && Safety_Powersupply_ChannelDue(context, eSYSPWR_CHANNEL_TEMPERATURE, currentTicks))
         {
         ADC_TemperatureSensorEnable();
-        ADC_SampleSingleChannel(fpADCIN_TEMPERATURE, &temperatureVSense);
+        (void) Safety_Powersupply_SampleAdc(eSYSPWR_CHANNEL_TEMPERATURE, fpADCIN_TEMPERATURE, &temperatureVSense);
         ADC_TemperatureSensorDisable();
-        systemTemperature = (S32)(ADC_ConvertTemperature(temperatureVSense) * DECIMAL_FIXPOINT);
+#if FEATURE_SAFETY_TEMPERATURE_INTEGER
+        // Ganzzahlige Umrechnung, nur die Sensorspannung in V wird einmalig in uV gewandelt
+        context->systemTemperature = Safety_Temperature_ConvertMicrovolt((S32) (temperatureVSense * MICROVOLT_PER_VOLT));
+#else
+        context->systemTemperature = (S32)(ADC_ConvertTemperature(temperatureVSense) * DECIMAL_FIXPOINT);
+#endif
+#if FEATURE_SAFETY_POWERSUPPLY_STATISTICS
+        Safety_Powersupply_UpdateStatistics(context, eSAFETY_POWERSUPPLY_STAT_TEMPERATURE, context->systemTemperature);
+#endif
         }
 #endif
 
 #ifdef TMP144_UART_CHANNEL
-    if(powerSupplyUserConfig->temperatureSensorIsActive)
+    if(context->powerSupplyUserConfig->temperatureSensorIsActive)
         {
         // Obtain new temperature value (SOFTQM-543)
-        if(TMP144_TemperatureValuePeek(&temperatureValue))
+        if(Safety_Powersupply_PeekTemperature(&temperatureValue))
             {
-            S32 oldSystemTemperature;
+            // Einmalig in gerundete Milligrad wandeln, alle Vergleiche ganzzahlig
+            temperatureValue *= DECIMAL_FIXPOINT;
+            temperatureMillidegree = (S32) ((temperatureValue < 0.0f) ? (temperatureValue - 0.5f) : (temperatureValue + 0.5f));
 
             // Set measurement valid
-            if(!(sysTemperatureStat & eSYSTMP_STAT_TMP_STARTUP_VALID))
+            if(!(context->sysTemperatureStat & eSYSTMP_STAT_TMP_STARTUP_VALID))
                 {
-                sysTemperatureStat |= eSYSTMP_STAT_TMP_STARTUP_VALID;
+                context->sysTemperatureStat |= eSYSTMP_STAT_TMP_STARTUP_VALID;
+                Safety_Powersupply_ContextSignalSourceReady(context, eSAFETY_POWERSUPPLY_SOURCE_TMP144);
                 }
 
             // Check if temperature is below error level (SOFTQM-588)
-            if(temperatureValue < TEMPERATURE_ERROR_MIN)
+            if(temperatureMillidegree < TEMPERATURE_ERROR_MIN_MILLIDEG)
                 {
-                if(!(sysTemperatureStat & eSYSTMP_STAT_ERROR_TMP_LOW))
+                if(!(context->sysTemperatureStat & eSYSTMP_STAT_ERROR_TMP_LOW))
                     {
-                    sysTemperatureStat |= eSYSTMP_STAT_ERROR_TMP_LOW;
+                    context->sysTemperatureStat |= eSYSTMP_STAT_ERROR_TMP_LOW;
 
                     // Enter permanent hard-error if temperature exceeds error limits (SOFTQM-643)
-                    Safety_PermanentHardError(HARD_ERR_TEMPERATURE_EXCEEDED);
+                    Safety_Powersupply_PermanentHardError(context, HARD_ERR_TEMPERATURE_EXCEEDED);
                     }
                 }
 
             // Check if temperature is below warning level (SOFTQM-588)
-            if(temperatureValue < TEMPERATURE_WARNING_MIN)
+            if(temperatureMillidegree < TEMPERATURE_WARNING_MIN_MILLIDEG)
                 {
-                if(!(sysTemperatureStat & eSYSTMP_STAT_WARNING_TMP_LOW))
+                if(!(context->sysTemperatureStat & eSYSTMP_STAT_WARNING_TMP_LOW))
                     {
-                    sysTemperatureStat |= eSYSTMP_STAT_WARNING_TMP_LOW;
+                    context->sysTemperatureStat |= eSYSTMP_STAT_WARNING_TMP_LOW;
                     // Send warning if temperature exceeds warning limits (SOFTQM-642)
-                    SendErrorMsgEvent(eEVENT_TEMPERATURE, eERROR_SYSTEM_TEMPERATURE, eERROR_TEMPERATURE_EXCEEDED_MIN,
-                                      ERROR_BYTE_LOWER_LEVEL_FILL_ZERO);
+                    Safety_Powersupply_SendError(context, eEVENT_TEMPERATURE, eERROR_SYSTEM_TEMPERATURE, eERROR_TEMPERATURE_EXCEEDED_MIN,
+                                                          ERROR_BYTE_LOWER_LEVEL_FILL_ZERO);
                     }
                 }
 
             // Check if temperature is above error level (SOFTQM-588)
-            if(temperatureValue > TEMPERATURE_ERROR_MAX)
+            if(temperatureMillidegree > TEMPERATURE_ERROR_MAX_MILLIDEG)
                 {
-                if(!(sysTemperatureStat & eSYSTMP_STAT_ERROR_TMP_HIGH))
+                if(!(context->sysTemperatureStat & eSYSTMP_STAT_ERROR_TMP_HIGH))
                     {
-                    sysTemperatureStat |= eSYSTMP_STAT_ERROR_TMP_HIGH;
+                    context->sysTemperatureStat |= eSYSTMP_STAT_ERROR_TMP_HIGH;
 
                     // Enter permanent hard-error if temperature exceeds error limits (SOFTQM-643)
-                    Safety_PermanentHardError(HARD_ERR_TEMPERATURE_EXCEEDED);
+                    Safety_Powersupply_PermanentHardError(context, HARD_ERR_TEMPERATURE_EXCEEDED);
                     }
                 }
 
             // Check if temperature is above warning level (SOFTQM-588)
-            if(temperatureValue > TEMPERATURE_WARNING_MAX)
+            if(temperatureMillidegree > TEMPERATURE_WARNING_MAX_MILLIDEG)
                 {
-                if(!(sysTemperatureStat & eSYSTMP_STAT_WARNING_TMP_HIGH))
+                if(!(context->sysTemperatureStat & eSYSTMP_STAT_WARNING_TMP_HIGH))
                     {
-                    sysTemperatureStat |= eSYSTMP_STAT_WARNING_TMP_HIGH;
+                    context->sysTemperatureStat |= eSYSTMP_STAT_WARNING_TMP_HIGH;
                     // Send warning if temperature exceeds warning limits (SOFTQM-642)
-                    SendErrorMsgEvent(eEVENT_TEMPERATURE, eERROR_SYSTEM_TEMPERATURE, eERROR_TEMPERATURE_EXCEEDED_MAX,
-                                      ERROR_BYTE_LOWER_LEVEL_FILL_ZERO);
+                    Safety_Powersupply_SendError(context, eEVENT_TEMPERATURE, eERROR_SYSTEM_TEMPERATURE, eERROR_TEMPERATURE_EXCEEDED_MAX,
+                                                          ERROR_BYTE_LOWER_LEVEL_FILL_ZERO);
                     }
                 }
 
-            oldSystemTemperature = systemTemperature;
-            temperatureValue = roundf(temperatureValue * DECIMAL_FIXPOINT);
-            systemTemperature = (S32)temperatureValue;
-            if(systemTemperature != oldSystemTemperature)
-                {
-                // Execute custom action if temperature value differs from previous measurement (SOFTQM-696)
-                Safety_TemperatureChangedHook(temperatureValue, sysTemperatureStat);
-                }
+            context->systemTemperature = temperatureMillidegree;
+#if FEATURE_SAFETY_POWERSUPPLY_STATISTICS
+            Safety_Powersupply_UpdateStatistics(context, eSAFETY_POWERSUPPLY_STAT_TEMPERATURE, context->systemTemperature);
+#endif
+
+            // Execute custom action if temperature value differs from previous measurement (SOFTQM-696)
+            Safety_Powersupply_DispatchTemperatureHook(context);
             }
         else
             {
             // Wait for startup of temperature sensor at startup
-            if(!(sysTemperatureStat & eSYSTMP_STAT_TMP_STARTUP_VALID) && (waitStartupTmpSensorTolerance > 0))
+            if(!Safety_Powersupply_ContextIsSourceReady(context, eSAFETY_POWERSUPPLY_SOURCE_TMP144)
+                    && !Safety_Powersupply_StartupTimeElapsed(context, currentTicks, WAIT_TMP144_STARTUP_MS))
                 {
-                waitStartupTmpSensorTolerance--;
+                // Sensor noch nicht bereit
                 }
             else
                 {
                 // Enter non-permanent hard error state if measurement fails (SOFTQM-677)
-                Safety_HardError(HARD_ERR_SAFETY_MEASUREMENT);
+                Safety_Powersupply_HardError(context, HARD_ERR_SAFETY_MEASUREMENT);
                 }
             }
         }
 #endif
 
+#if FEATURE_SAFETY_RECORD
+    Safety_Record_EndCycle();
+#endif
     return TRUE;
     }
 //------------------------------------------------------------------------------
@@ -1689,7 +1968,13 @@ MAX116XX_ADC_VALUES externalAdcValuesList[MAX116XX_NUMBER_OF_ADCS];
 #if defined(fpADCIN_TEMPERATURE) || defined(TMP144_UART_CHANNEL)
 S32 Safety_GetSystemTemperature(void)
     {
-    return systemTemperature;
+    return Safety_Powersupply_ContextGetSystemTemperature(&powerSupplyDefault);
+    }
+//------------------------------------------------------------------------------
+
+S32 Safety_Powersupply_ContextGetSystemTemperature(SAFETY_POWERSUPPLY_CONTEXT const * const context)
+    {
+    return context->systemTemperature;
     }
 //------------------------------------------------------------------------------
 
@@ -1700,12 +1985,640 @@ void TWK_WEAK Safety_TemperatureChangedHook(float temperature, SYSTEM_TEMPERATUR
 #endif
 //------------------------------------------------------------------------------
 
+#if ((MAX116XX_FEAT_4CHANNEL_ADC) || (MAX116XX_FEAT_12CHANNEL_ADC))
+#if FEATURE_SAFETY_POWERSUPPLY_EXTERNAL_ADC_FRAMES
+MAX116XX_ADC_VALUES * Safety_Powersupply_GetExternalAdcFrameBuffer(void)
+    {
+    // Den nicht aktuellen Frame beschreiben, die Sicherheitstask liest den aktuellen
+    return externalAdcFrames[(__atomic_load_n(&externalAdcFrameSequence, __ATOMIC_RELAXED) + 1u) & 1u];
+    }
+//------------------------------------------------------------------------------
+
+void Safety_Powersupply_PublishExternalAdcFrame(void)
+    {
+    __atomic_fetch_add(&externalAdcFrameSequence, 1u, __ATOMIC_RELEASE);
+    }
+//------------------------------------------------------------------------------
+
+#if !FEATURE_SAFETY_RECORD_REPLAY
+static bool Safety_Powersupply_PeekExternalAdc(SAFETY_POWERSUPPLY_CONTEXT * const context)
+    {
+    return __atomic_load_n(&externalAdcFrameSequence, __ATOMIC_ACQUIRE) != 0u;
+    }
+//------------------------------------------------------------------------------
+
+static bool Safety_Powersupply_PeekExternalAdcValue(SAFETY_POWERSUPPLY_CONTEXT * const context, U8 const adc, U8 const channel, F32 * const value)
+    {
+    U32 sequence;
+    U32 retries;
+
+    for(retries = 0u; retries < EXTERNAL_ADC_FRAME_READ_RETRIES; retries++)
+        {
+        sequence = __atomic_load_n(&externalAdcFrameSequence, __ATOMIC_ACQUIRE);
+        SAFETY_POWERSUPPLY_FRAME_READ_HOOK();
+        *value = externalAdcFrames[sequence & 1u][adc].f32Data[channel];
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+        // Nach der nächsten Veröffentlichung ist der gelesene Frame wieder der
+        // Schreibpuffer der ADC-Task. Konsistent nur ohne Veröffentlichung
+        // während des Lesens.
+        if(__atomic_load_n(&externalAdcFrameSequence, __ATOMIC_RELAXED) == sequence)
+            {
+            return true;
+            }
+        }
+
+    return false;
+    }
+//------------------------------------------------------------------------------
+#endif
+#else
+#if !FEATURE_SAFETY_RECORD_REPLAY
+static bool Safety_Powersupply_PeekExternalAdc(SAFETY_POWERSUPPLY_CONTEXT * const context)
+    {
+    return MAX116XX_AdcValuesPeek(context->externalAdcValuesList);
+    }
+//------------------------------------------------------------------------------
+
+static bool Safety_Powersupply_PeekExternalAdcValue(SAFETY_POWERSUPPLY_CONTEXT * const context, U8 const adc, U8 const channel, F32 * const value)
+    {
+    *value = context->externalAdcValuesList[adc].f32Data[channel];
+    return true;
+    }
+//------------------------------------------------------------------------------
+#endif
+#endif // FEATURE_SAFETY_POWERSUPPLY_EXTERNAL_ADC_FRAMES
+
+static bool Safety_Powersupply_UpdateExternalAdc(SAFETY_POWERSUPPLY_CONTEXT * const context)
+    {
+#if FEATURE_SAFETY_RECORD_REPLAY
+    return Safety_Record_ReplayInput(eSAFETY_RECORD_INPUT_EXT_ADC_UPDATE, 0u, NULL);
+#else
+    bool const result = Safety_Powersupply_PeekExternalAdc(context);
+
+#if FEATURE_SAFETY_RECORD
+    Safety_Record_Input(eSAFETY_RECORD_INPUT_EXT_ADC_UPDATE, 0u, result, 0.0f);
+#endif
+    return result;
+#endif
+    }
+//------------------------------------------------------------------------------
+
+static bool Safety_Powersupply_ReadExternalAdc(SAFETY_POWERSUPPLY_CONTEXT * const context, U8 const adc, U8 const channel, F32 * const value)
+    {
+#if FEATURE_SAFETY_RECORD_REPLAY
+    return Safety_Record_ReplayInput(eSAFETY_RECORD_INPUT_EXT_ADC_VALUE, (U8) ((adc << 4) | channel), value);
+#else
+    bool const result = Safety_Powersupply_PeekExternalAdcValue(context, adc, channel, value);
+
+#if FEATURE_SAFETY_RECORD
+    Safety_Record_Input(eSAFETY_RECORD_INPUT_EXT_ADC_VALUE, (U8) ((adc << 4) | channel), result, result ? *value : 0.0f);
+#endif
+    return result;
+#endif
+    }
+//------------------------------------------------------------------------------
+
+bool Safety_Powersupply_ConfigureExternalAdc(SAFETY_POWERSUPPLY_EXT_ADC_CHANNEL const * const channels, U8 const count)
+    {
+    return Safety_Powersupply_ContextConfigureExternalAdc(&powerSupplyDefault, channels, count);
+    }
+//------------------------------------------------------------------------------
+
+bool Safety_Powersupply_ContextConfigureExternalAdc(SAFETY_POWERSUPPLY_CONTEXT * const context,
+                                                    SAFETY_POWERSUPPLY_EXT_ADC_CHANNEL const * const channels, U8 const count)
+    {
+    if((context == NULL) || (channels == NULL) || (count == 0u) || (count > SAFETY_POWERSUPPLY_EXT_ADC_CHANNELS_MAX)
+            || (context->powerSupplyUserConfig != NULL))
+        {
+        return false;
+        }
+
+    context->externalAdcChannels = channels;
+    context->externalAdcChannelCount = count;
+    return true;
+    }
+//------------------------------------------------------------------------------
+
+bool Safety_Powersupply_GetExternalAdcVoltage(U8 const index, F32 * const voltage)
+    {
+    return Safety_Powersupply_ContextGetExternalAdcVoltage(&powerSupplyDefault, index, voltage);
+    }
+//------------------------------------------------------------------------------
+
+bool Safety_Powersupply_ContextGetExternalAdcVoltage(SAFETY_POWERSUPPLY_CONTEXT * const context,
+                                                     U8 const index, F32 * const voltage)
+    {
+    if((context == NULL) || (index >= context->externalAdcChannelCount) || (voltage == NULL)
+            || ((context->externalAdcActive[EXT_ADC_STAT_WORD(index)] & EXT_ADC_STAT_BIT(index)) == 0u)
+#if SYSPWR_EXT_ADC_FILTER_IIR
+            || !Safety_Filter_IirIsValidF32(&context->externalAdcState[index].average))
+#else
+            || !AVG_IsValidF32(&context->externalAdcState[index].average))
+#endif
+        {
+        return false;
+        }
+
+    *voltage = context->externalAdcState[index].voltage;
+    return true;
+    }
+//------------------------------------------------------------------------------
+
+static bool Safety_Powersupply_InitExternalAdcChannel(SAFETY_POWERSUPPLY_CONTEXT * const context, U8 const index)
+    {
+    SAFETY_POWERSUPPLY_EXT_ADC_CHANNEL const * const channel = &context->externalAdcChannels[index];
+    SAFETY_POWERSUPPLY_EXT_ADC_STATE * const state = &context->externalAdcState[index];
+    F32 reference;
+
+    if((channel->channel >= EXT_ADC_VALUES_PER_ADC) || (channel->r2 <= 0.0f))
+        {
+        return false;
+        }
+
+    // Float values are normalized to the internal reference voltage of the adc.
+    switch(channel->adc)
+        {
+#if MAX116XX_FEAT_12CHANNEL_ADC
+        case MAX116XX_POS_12CHANNEL_ADC:
+            reference = (F32)MAX11611_REFERENCE_VOLTAGE / 1000.0f;
+            break;
+#endif
+#if MAX116XX_FEAT_4CHANNEL_ADC
+        case MAX116XX_POS_4CHANNEL_ADC:
+            reference = (F32)MAX11607_REFERENCE_VOLTAGE / 1000.0f;
+            break;
+#endif
+        default:
+            return false;
+        }
+
+    // The measured voltage is divided by a voltage divider. R2 represents the resistor on which the voltage is measured.
+    state->multiplier = reference * ((channel->r1 + channel->r2) / channel->r2);
+    state->voltage = 0.0f;
+
+#if SYSPWR_EXT_ADC_FILTER_IIR
+    if(!Safety_Filter_IirInitF32(&state->average,
+                                 Safety_Filter_IirShiftForAverage(Safety_Powersupply_FilterValues(eSYSPWR_CHANNEL_EXT_ADC)),
+                                 (U8) Safety_Powersupply_FilterValues(eSYSPWR_CHANNEL_EXT_ADC)))
+#else
+    if(AVG_InitF32(&state->average, state->values, sizeof(state->values),
+                   Safety_Powersupply_FilterValues(eSYSPWR_CHANNEL_EXT_ADC)) != eAVERAGING_NO_ERROR)
+#endif
+        {
+        return false;
+        }
+
+    context->externalAdcActive[EXT_ADC_STAT_WORD(index)] |= EXT_ADC_STAT_BIT(index);
+    return true;
+    }
+//------------------------------------------------------------------------------
+
+static void Safety_Powersupply_CheckExternalAdcChannel(SAFETY_POWERSUPPLY_CONTEXT * const context, U8 const index)
+    {
+    SAFETY_POWERSUPPLY_EXT_ADC_CHANNEL const * const channel = &context->externalAdcChannels[index];
+    SAFETY_POWERSUPPLY_EXT_ADC_STATE * const state = &context->externalAdcState[index];
+    U32 const word = EXT_ADC_STAT_WORD(index);
+    U32 const bit = EXT_ADC_STAT_BIT(index);
+    F32 voltage;
+    U8 errorChannel;
+    U8 errorIndex;
+
+//------------------- BLOCK: Calculting Averages -------------------------
+    if(!Safety_Powersupply_ReadExternalAdc(context, channel->adc, channel->channel, &voltage))
+        {
+        // Enter non-permanent hard error state if measurement fails (SOFTQM-677)
+        Safety_Powersupply_HardError(context, HARD_ERR_SAFETY_MEASUREMENT);
+        }
+
+#if SYSPWR_EXT_ADC_FILTER_IIR
+    Safety_Filter_IirUpdateF32(&state->average, voltage * state->multiplier);
+
+    if(!Safety_Filter_IirIsValidF32(&state->average))
+        {
+        return;
+        }
+
+    state->voltage = Safety_Filter_IirGetF32(&state->average);
+#else
+    if(AVG_UpdateF32(&state->average, voltage * state->multiplier) != eAVERAGING_NO_ERROR)
+        {
+        // Enter non-permanent hard error state if measurement fails (SOFTQM-677)
+        Safety_Powersupply_HardError(context, HARD_ERR_SAFETY_MEASUREMENT);
+        }
+
+    if(!AVG_IsValidF32(&state->average))
+        {
+        return;
+        }
+
+    if(AVG_GetF32(&state->average, &state->voltage) != eAVERAGING_NO_ERROR)
+        {
+        // Enter non-permanent hard error state if measurement fails (SOFTQM-677)
+        Safety_Powersupply_HardError(context, HARD_ERR_SAFETY_MEASUREMENT);
+        }
+#endif
+
+    // Veraltete globale Mittelwerte der Standardinstanz weiter bereitstellen
+    if((context == &powerSupplyDefault) && (index < (sizeof(legacyExternalAdcAvg) / sizeof(legacyExternalAdcAvg[0]))))
+        {
+        *legacyExternalAdcAvg[index] = state->voltage;
+        }
+
+//------------------- BLOCK: Comparing to thresholds----------------------
+    // Check if voltage is below error level (SOFTQM-602)
+    if(state->voltage < channel->limitMinVolt)
+        {
+        // Only send error if supply voltage is not below error level (SOFTQM-602)
+        if(((context->sysPowerStat & eSYSPWR_STAT_DETECT_VCC_LOW) == 0) && ((context->externalAdcErrorLow[word] & bit) == 0u))
+            {
+            context->externalAdcErrorLow[word] |= bit;
+
+            // Die ersten drei Kanäle behalten ihre Fehlercodes, weitere Kanäle
+            // übertragen ihren Index im unteren Fehlerbyte
+            if(index < 3u)
+                {
+                errorChannel = (U8) (eERROR_EXTERNAL_ADC_VOLTAGE_1 + index);
+                errorIndex = ERROR_BYTE_LOWER_LEVEL_FILL_ZERO;
+                }
+            else
+                {
+                errorChannel = eERROR_EXTERNAL_ADC_VOLTAGE_N;
+                errorIndex = index;
+                }
+
+            // Send error event if the voltage is below the minimum error level (SOFTQM-657)
+            Safety_Powersupply_SendError(context, eEVENT_VCC_CHECK_ERROR, errorChannel, eERROR_VOLTAGE_EXCEEDED_MIN, errorIndex);
+            }
+        }
+
+    if(state->voltage > channel->limitMaxVolt)
+        {
+        if((context->externalAdcErrorHigh[word] & bit) == 0u)
+            {
+            // Send a permanent hard error if voltage exceeds maximum error level (SOFTQM-636)
+            context->externalAdcErrorHigh[word] |= bit;
+            Safety_Powersupply_PermanentHardError(context, HARD_ERR_VOLTAGE_EXCEEDED);
+            }
+        }
+    }
+//------------------------------------------------------------------------------
+#endif // ((MAX116XX_FEAT_4CHANNEL_ADC) || (MAX116XX_FEAT_12CHANNEL_ADC))
+
+static bool Safety_Powersupply_ChannelDue(SAFETY_POWERSUPPLY_CONTEXT * const context, SYSPWR_CHANNEL const channel, U32 const currentTicks)
+    {
+    U32 const period = channelPeriodTicks[channel];
+
+    if(period == 0u)
+        {
+        return true;
+        }
+
+    // Vorzeichenbehaftete Differenz ist auch bei Überlauf des Tickzählers korrekt
+    if(((S32) (currentTicks - context->channelNextTicks[channel])) < 0)
+        {
+        return false;
+        }
+
+    // Nächste Messung im Raster des Kanals, auch bei verspätetem Aufruf
+    context->channelNextTicks[channel] += period * (((currentTicks - context->channelNextTicks[channel]) / period) + 1u);
+    return true;
+    }
+//------------------------------------------------------------------------------
+
+static U32 Safety_Powersupply_FilterValues(SYSPWR_CHANNEL const channel)
+    {
+    U32 values;
+
+    if((SYSPWR_FILTER_WINDOW_MS == 0) || (channelPeriodTicks[channel] == 0u))
+        {
+        return SYSPWR_NUM_VALUES;
+        }
+
+    values = ((U32) SYSPWR_FILTER_WINDOW_MS * configTICK_RATE_HZ_MS) / channelPeriodTicks[channel];
+    if(values == 0u)
+        {
+        values = 1u;
+        }
+    else if(values > SYSPWR_NUM_VALUES)
+        {
+        values = SYSPWR_NUM_VALUES;
+        }
+
+    return values;
+    }
+//------------------------------------------------------------------------------
+
+static bool Safety_Powersupply_FilterInit(SAFETY_POWERSUPPLY_CONTEXT * const context, SYSPWR_CHANNEL const channel, TAVG_CALC * const average, S32 * const buffer, U32 const size)
+    {
+    U32 const values = Safety_Powersupply_FilterValues(channel);
+
+#if SYSPWR_FILTER_MEDIAN_USED
+    if((channelMedianSize[channel] != 0u)
+            && !Safety_Filter_MedianInit(&context->channelMedian[channel], channelMedianSize[channel]))
+        {
+        return false;
+        }
+#endif
+
+    if(channelFilterIir[channel])
+        {
+        return Safety_Filter_IirInit(&context->channelIir[channel], Safety_Filter_IirShiftForAverage(values), (U8) values);
+        }
+
+    return AVG_Init(average, buffer, size, values) == eAVERAGING_NO_ERROR;
+    }
+//------------------------------------------------------------------------------
+
+static bool Safety_Powersupply_FilterUpdate(SAFETY_POWERSUPPLY_CONTEXT * const context, SYSPWR_CHANNEL const channel, TAVG_CALC * const average, S32 value)
+    {
+#if FEATURE_SAFETY_POWERSUPPLY_STATISTICS
+    // Einzelmessung vor der Filterung erfassen
+    if(channelStatistics[channel] < eSAFETY_POWERSUPPLY_STAT_COUNT)
+        {
+        Safety_Powersupply_UpdateStatistics(context, channelStatistics[channel], value);
+        }
+#endif
+
+#if SYSPWR_FILTER_MEDIAN_USED
+    // Ausreißer vor der Mittelung entfernen
+    if(channelMedianSize[channel] != 0u)
+        {
+        value = Safety_Filter_MedianUpdate(&context->channelMedian[channel], value);
+        }
+#endif
+
+#if SYSPWR_VCC_FILTER_MEDIAN
+    if(channel == eSYSPWR_CHANNEL_VCC)
+        {
+        context->vccMedianVoltage = value;
+        }
+#endif
+
+    if(channelFilterIir[channel])
+        {
+        Safety_Filter_IirUpdate(&context->channelIir[channel], value);
+        return true;
+        }
+
+    return AVG_Update(average, value) == eAVERAGING_NO_ERROR;
+    }
+//------------------------------------------------------------------------------
+
+static bool Safety_Powersupply_FilterIsValid(SAFETY_POWERSUPPLY_CONTEXT * const context, SYSPWR_CHANNEL const channel, TAVG_CALC * const average)
+    {
+    if(channelFilterIir[channel])
+        {
+        return Safety_Filter_IirIsValid(&context->channelIir[channel]);
+        }
+
+    return AVG_GetIsValid(&average->data);
+    }
+//------------------------------------------------------------------------------
+
+static bool Safety_Powersupply_FilterGet(SAFETY_POWERSUPPLY_CONTEXT * const context, SYSPWR_CHANNEL const channel, TAVG_CALC * const average, S32 * const value)
+    {
+    if(channelFilterIir[channel])
+        {
+        *value = Safety_Filter_IirGet(&context->channelIir[channel]);
+        return true;
+        }
+
+    return AVG_Get(average, value) == eAVERAGING_NO_ERROR;
+    }
+//------------------------------------------------------------------------------
+
+bool Safety_Powersupply_ContextConfigureErrorHandler(SAFETY_POWERSUPPLY_CONTEXT * const context,
+                                                    SAFETY_POWERSUPPLY_ERROR_HANDLER const * const errorHandler)
+    {
+    if((context == NULL) || (errorHandler == NULL) || (errorHandler->hardError == NULL)
+            || (errorHandler->errorEvent == NULL) || (context->powerSupplyUserConfig != NULL))
+        {
+        return false;
+        }
+
+    context->errorHandler = errorHandler;
+    return true;
+    }
+//------------------------------------------------------------------------------
+
+void Safety_Powersupply_SignalSourceReady(SAFETY_POWERSUPPLY_SOURCE const source)
+    {
+    Safety_Powersupply_ContextSignalSourceReady(&powerSupplyDefault, source);
+    }
+//------------------------------------------------------------------------------
+
+void Safety_Powersupply_ContextSignalSourceReady(SAFETY_POWERSUPPLY_CONTEXT * const context, SAFETY_POWERSUPPLY_SOURCE const source)
+    {
+    if((context != NULL) && (source < eSAFETY_POWERSUPPLY_SOURCE_COUNT))
+        {
+        (void) __atomic_fetch_or(&context->sourceReady, (U32) 1u << source, __ATOMIC_RELEASE);
+        }
+    }
+//------------------------------------------------------------------------------
+
+bool Safety_Powersupply_IsSourceReady(SAFETY_POWERSUPPLY_SOURCE const source)
+    {
+    return Safety_Powersupply_ContextIsSourceReady(&powerSupplyDefault, source);
+    }
+//------------------------------------------------------------------------------
+
+bool Safety_Powersupply_ContextIsSourceReady(SAFETY_POWERSUPPLY_CONTEXT * const context, SAFETY_POWERSUPPLY_SOURCE const source)
+    {
+    if((context == NULL) || (source >= eSAFETY_POWERSUPPLY_SOURCE_COUNT))
+        {
+        return false;
+        }
+
+    return (__atomic_load_n(&context->sourceReady, __ATOMIC_ACQUIRE) & ((U32) 1u << source)) != 0u;
+    }
+//------------------------------------------------------------------------------
+
+static bool Safety_Powersupply_StartupTimeElapsed(SAFETY_POWERSUPPLY_CONTEXT * const context, U32 const currentTicks, U32 const timeoutMs)
+    {
+    return (U32) (currentTicks - context->startupTicks) >= (timeoutMs * configTICK_RATE_HZ_MS);
+    }
+//------------------------------------------------------------------------------
+
+#if FEATURE_SAFETY_POWERSUPPLY_STATISTICS
+bool Safety_Powersupply_GetStatistics(SAFETY_POWERSUPPLY_STAT_CHANNEL const channel,
+                                      SAFETY_POWERSUPPLY_STATISTICS * const statistics)
+    {
+    return Safety_Powersupply_ContextGetStatistics(&powerSupplyDefault, channel, statistics);
+    }
+//------------------------------------------------------------------------------
+
+bool Safety_Powersupply_ContextGetStatistics(SAFETY_POWERSUPPLY_CONTEXT * const context,
+                                             SAFETY_POWERSUPPLY_STAT_CHANNEL const channel,
+                                             SAFETY_POWERSUPPLY_STATISTICS * const statistics)
+    {
+    SAFETY_FILTER_STAT snapshot;
+    U32 sequence;
+    U32 retries;
+
+    if((context == NULL) || (statistics == NULL) || (channel >= eSAFETY_POWERSUPPLY_STAT_COUNT))
+        {
+        return false;
+        }
+
+    for(retries = 0; retries < SYSPWR_STAT_READ_RETRIES; retries++)
+        {
+        sequence = __atomic_load_n(&context->statisticsSequence[channel], __ATOMIC_ACQUIRE);
+
+        // Ungerader Zähler: Safety-Task aktualisiert gerade
+        if((sequence & 1u) == 0u)
+            {
+            snapshot = context->statisticsState[channel];
+            __atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+            if(sequence == context->statisticsSequence[channel])
+                {
+                // Auswertung auf der Kopie, außerhalb der Sicherheitstask
+                Safety_Filter_StatGet(&snapshot, &statistics->total, &statistics->window);
+                return true;
+                }
+            }
+        }
+
+    return false;
+    }
+//------------------------------------------------------------------------------
+
+static void Safety_Powersupply_UpdateStatistics(SAFETY_POWERSUPPLY_CONTEXT * const context, SAFETY_POWERSUPPLY_STAT_CHANNEL const channel, S32 const value)
+    {
+    __atomic_store_n(&context->statisticsSequence[channel], context->statisticsSequence[channel] + 1u, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    Safety_Filter_StatUpdate(&context->statisticsState[channel], value);
+
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    __atomic_store_n(&context->statisticsSequence[channel], context->statisticsSequence[channel] + 1u, __ATOMIC_RELAXED);
+    }
+//------------------------------------------------------------------------------
+#endif // FEATURE_SAFETY_POWERSUPPLY_STATISTICS
+
+#if defined(fpADCIN_ICC) || defined(fpADCIN_VCC) || defined(fpADCIN_VCC1) || defined(fpADCIN_VCC2) \
+    || defined(fpADCIN_VCC3) || defined(fpADCIN_VCC4) || defined(fpADCIN_VCC5) || defined(fpADCIN_TEMPERATURE)
+static bool Safety_Powersupply_SampleAdc(SYSPWR_CHANNEL const channel, U32 const pin, F32 * const value)
+    {
+#if FEATURE_SAFETY_RECORD_REPLAY
+    (void) pin;
+    return Safety_Record_ReplayInput(eSAFETY_RECORD_INPUT_ADC, (U8) channel, value);
+#else
+    bool const result = (ADC_SampleSingleChannel(pin, value) == eADC_TRUE);
+
+#if FEATURE_SAFETY_RECORD
+    Safety_Record_Input(eSAFETY_RECORD_INPUT_ADC, (U8) channel, result, result ? *value : 0.0f);
+#else
+    (void) channel;
+#endif
+    return result;
+#endif
+    }
+//------------------------------------------------------------------------------
+#endif
+
+#ifdef TMP144_UART_CHANNEL
+static bool Safety_Powersupply_PeekTemperature(F32 * const value)
+    {
+#if FEATURE_SAFETY_RECORD_REPLAY
+    return Safety_Record_ReplayInput(eSAFETY_RECORD_INPUT_TMP144, 0u, value);
+#else
+    bool const result = TMP144_TemperatureValuePeek(value);
+
+#if FEATURE_SAFETY_RECORD
+    Safety_Record_Input(eSAFETY_RECORD_INPUT_TMP144, 0u, result, result ? *value : 0.0f);
+#endif
+    return result;
+#endif
+    }
+//------------------------------------------------------------------------------
+
+static void Safety_Powersupply_DispatchTemperatureHook(SAFETY_POWERSUPPLY_CONTEXT * const context)
+    {
+    U32 const currentTicks = RTOS_GetTime();
+    S32 difference;
+
+    // Statusänderungen (Warnung/Fehler) immer sofort melden
+    if(context->hookCalled && (context->sysTemperatureStat == context->hookTemperatureStat))
+        {
+        difference = context->systemTemperature - context->hookTemperature;
+        if(difference < 0)
+            {
+            difference = -difference;
+            }
+
+        // Rauschen innerhalb des Totbands nicht melden
+        if(difference <= SAFETY_TEMPERATURE_HOOK_DEADBAND_MILLIDEG)
+            {
+            return;
+            }
+
+#if SAFETY_TEMPERATURE_HOOK_MIN_INTERVAL_MS > 0
+        if((U32) (currentTicks - context->hookTicks) < ((U32) SAFETY_TEMPERATURE_HOOK_MIN_INTERVAL_MS * configTICK_RATE_HZ_MS))
+            {
+            return;
+            }
+#endif
+        }
+
+    context->hookCalled = true;
+    context->hookTemperature = context->systemTemperature;
+    context->hookTemperatureStat = context->sysTemperatureStat;
+    context->hookTicks = currentTicks;
+
+    Safety_TemperatureChangedHook((float) context->systemTemperature, context->sysTemperatureStat);
+    }
+//------------------------------------------------------------------------------
+#endif
+
 /// @author A.Fischer @date 20.12.2022
 #ifdef fpADCIN_VCC
 S32 Safety_GetPowerVoltage(void)
     {
-    return lPowerVoltage;
+    return Safety_Powersupply_ContextGetPowerVoltage(&powerSupplyDefault);
+    }
+//------------------------------------------------------------------------------
+
+S32 Safety_Powersupply_ContextGetPowerVoltage(SAFETY_POWERSUPPLY_CONTEXT const * const context)
+    {
+    return context->lPowerVoltage;
     }
 #endif
 //------------------------------------------------------------------------------
 
+static void Safety_Powersupply_HardError(SAFETY_POWERSUPPLY_CONTEXT const * const context, U8 const hardErrorCode)
+    {
+    if(context->errorHandler != NULL)
+        {
+        context->errorHandler->hardError(context->errorHandler->user, hardErrorCode, false);
+        }
+
+    Safety_HardError(hardErrorCode);
+    }
+//------------------------------------------------------------------------------
+
+static void Safety_Powersupply_PermanentHardError(SAFETY_POWERSUPPLY_CONTEXT const * const context, U8 const hardErrorCode)
+    {
+    if(context->errorHandler != NULL)
+        {
+        context->errorHandler->hardError(context->errorHandler->user, hardErrorCode, true);
+        }
+
+    Safety_PermanentHardError(hardErrorCode);
+    }
+//------------------------------------------------------------------------------
+
+static void Safety_Powersupply_SendError(SAFETY_POWERSUPPLY_CONTEXT const * const context, U32 const event,
+                                        U8 const upper, U8 const intermediate, U8 const lower)
+    {
+    if(context->errorHandler != NULL)
+        {
+        context->errorHandler->errorEvent(context->errorHandler->user, event, upper, intermediate, lower);
+        }
+    else
+        {
+        (void) Safety_Event_SendError(event, upper, intermediate, lower);
+        }
+    }
+//------------------------------------------------------------------------------
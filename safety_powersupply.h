@@ -17,6 +17,27 @@
 *
 * Das Modul kann zusätzlich die Systemtemperatur messen. Es erfolgt aber keine
 * weitere Prüfung der Temperatur.
+*
+* Der Zustand der Überwachung liegt in einer Instanz @ref SAFETY_POWERSUPPLY_CONTEXT.
+* Die Funktionen ohne Kontext arbeiten auf einer Standardinstanz, nur diese
+* registriert die RAM-Variablen der Factory Device Communication und empfängt
+* die Frames der externen ADC-Task. Die Safety_Powersupply_Context...()-Funktionen
+* arbeiten auf einer eigenen Instanz, z.B. für viele unabhängige Überwachungen
+* in parallelen Threads einer Simulation. Jede Instanz darf nur von einem Thread
+* geprüft werden. Die Messwerte liefern für alle Instanzen dieselben
+* Treiberfunktionen (ADC_SampleSingleChannel(), TMP144_TemperatureValuePeek(),
+* MAX116XX_AdcValuesPeek()), eine Simulation stellt sie pro Thread bereit.
+*
+* Hard-Errors (Safety_HardError() und Safety_PermanentHardError() mit der Falle
+* Safety_HardErrorTrap_Arm()) und
+* der Ringpuffer der Fehlerereignisse (Safety_Event_SendError()) sind global
+* für den Prozess. Instanzen in parallelen Threads erhalten daher mit
+* Safety_Powersupply_ContextConfigureErrorHandler() eine eigene Fehlerbehandlung,
+* ohne sie dürfen Instanzen nicht parallel geprüft werden.
+* Safety_TemperatureChangedHook() wird für alle Instanzen aufgerufen. Mit
+* FEATURE_SAFETY_RECORD oder FEATURE_SAFETY_RECORD_REPLAY ist nur die
+* Standardinstanz zulässig, Safety_Powersupply_ContextInit() weist andere
+* Instanzen zurück.
 * @{
 */
 #ifndef GLOBAL_SAFETY_SAFETY_POWERSUPPLY_H_
@@ -25,6 +46,11 @@
 // Gemeinsame Headerdateien einbinden ---------------------------------------
 
 // Spezielle Headerdateien einbinden ----------------------------------------
+#include "DataProcess_Averaging/averaging.h"
+#include "DataProcess_Averaging/averaging_f32.h"
+#include "Devices_ADC_MAX116XX/MAX116XX_Task.h"
+#include "Devices_ADC_MAX116XX/MAX116XX.h"
+#include "safety_filter.h"
 
 #ifdef __cplusplus
 extern "C"
@@ -32,6 +58,69 @@ extern "C"
 #endif
 
 // Compiler Direktiven ------------------------------------------------------
+
+#ifndef FEATURE_SAFETY_POWERSUPPLY_EXTERNAL_ADC_FRAMES
+/// \ingroup feature_flags
+/// Feature flag activating the double buffered result frames for the external adc.
+/// The external adc task writes its results directly into the frame returned by
+/// Safety_Powersupply_GetExternalAdcFrameBuffer() and publishes it with
+/// Safety_Powersupply_PublishExternalAdcFrame(). The safety task reads only the
+/// monitored channels from the current frame, no copy of the values is needed.
+/// Deactivated by default, the values are then copied with MAX116XX_AdcValuesPeek().
+#define FEATURE_SAFETY_POWERSUPPLY_EXTERNAL_ADC_FRAMES     (0)
+#endif
+
+#ifndef FEATURE_SAFETY_POWERSUPPLY_STATISTICS
+/// \ingroup feature_flags
+/// Feature flag activating the running statistics of the measurement channels.
+/// Minimum, maximum, mean and variance are recorded since start and over a
+/// sliding window and can be read with Safety_Powersupply_GetStatistics().
+/// The statistics are deactivated by default.
+#define FEATURE_SAFETY_POWERSUPPLY_STATISTICS              (0)
+#endif
+
+#if FEATURE_SAFETY_POWERSUPPLY_STATISTICS
+#ifndef SAFETY_POWERSUPPLY_STAT_WINDOW_VALUES
+/// Number of measurements per block of the sliding window. The window covers
+/// the last SAFETY_POWERSUPPLY_STAT_WINDOW_VALUES + 1 to
+/// 2 * SAFETY_POWERSUPPLY_STAT_WINDOW_VALUES measurements of a channel.
+#define SAFETY_POWERSUPPLY_STAT_WINDOW_VALUES              (256u)
+#endif
+
+/// Channels of the running statistics
+typedef enum
+{
+    eSAFETY_POWERSUPPLY_STAT_CURRENT = 0,       //!< Current consumption in mA
+    eSAFETY_POWERSUPPLY_STAT_VCC,               //!< Supply voltage in mV
+    eSAFETY_POWERSUPPLY_STAT_VCC1,              //!< Internal voltage 1 in mV
+    eSAFETY_POWERSUPPLY_STAT_VCC2,              //!< Internal voltage 2 in mV
+    eSAFETY_POWERSUPPLY_STAT_VCC3,              //!< Internal voltage 3 in mV
+    eSAFETY_POWERSUPPLY_STAT_VCC4,              //!< Internal voltage 4 in mV
+    eSAFETY_POWERSUPPLY_STAT_VCC5,              //!< Internal voltage 5 in mV
+    eSAFETY_POWERSUPPLY_STAT_POWER,             //!< Power consumption in mW
+    eSAFETY_POWERSUPPLY_STAT_TEMPERATURE,       //!< System temperature in m°C
+    eSAFETY_POWERSUPPLY_STAT_COUNT,             //!< Number of channels
+} SAFETY_POWERSUPPLY_STAT_CHANNEL;
+
+/// Snapshot of the running statistics of a channel. The voltage and current
+/// channels record the single measurements before filtering, so that ripple
+/// and spikes are visible.
+typedef struct
+{
+    SAFETY_FILTER_STAT_VALUES total;            ///< Statistics since start
+    SAFETY_FILTER_STAT_VALUES window;           ///< Statistics over the sliding window
+} SAFETY_POWERSUPPLY_STATISTICS;
+#endif
+
+/// Measurement sources signaling their readiness with Safety_Powersupply_SignalSourceReady()
+typedef enum
+{
+    eSAFETY_POWERSUPPLY_SOURCE_ADC = 0,         //!< Internal ADC, calibrated and ready for measurements
+    eSAFETY_POWERSUPPLY_SOURCE_TMP144,          //!< Temperature sensor TMP144, first valid value
+    eSAFETY_POWERSUPPLY_SOURCE_EXTERNAL_ADC,    //!< External ADCs MAX116XX, first values
+    eSAFETY_POWERSUPPLY_SOURCE_COUNT,           //!< Number of sources
+} SAFETY_POWERSUPPLY_SOURCE;
+
 /// Configuration to activate and deactivate measurement channels (SOFTQM-681)
 /// Only activated channels will be measured and monitored.
 typedef struct
@@ -42,7 +131,7 @@ typedef struct
     bit voltage3IsActive: 1;                    ///< Internal voltage 3 monitoring
     bit voltage4IsActive: 1;                    ///< Internal voltage 4 monitoring
     bit voltage5IsActive: 1;                    ///< Internal voltage 5 monitoring
-    bit voltageExternalAdcChannel1IsActive: 1;  ///< Voltage monitoring with the external ADC. Channel 1 does not mean "hardware" channel 1 but the first channel to check. This has to be configured by the user by using the CHANNEL1_TO_CHECK_CHANNEL macro.
+    bit voltageExternalAdcChannel1IsActive: 1;  ///< Only used without Safety_Powersupply_ConfigureExternalAdc(). Voltage monitoring with the external ADC. Channel 1 does not mean "hardware" channel 1 but the first channel to check. This has to be configured by the user by using the CHANNEL1_TO_CHECK_CHANNEL macro.
     bit voltageExternalAdcChannel2IsActive: 1;  ///< Voltage monitoring with the external ADC. Channel 2 does not mean "hardware" channel 2 but the second channel to check. This has to be configured by the user by using the CHANNEL2_TO_CHECK_CHANNEL macro.
     bit voltageExternalAdcChannel3IsActive: 1;  ///< Voltage monitoring with the external ADC. Channel 1 does not mean "hardware" channel 3 but the third channel to check. This has to be configured by the user by using the CHANNEL3_TO_CHECK_CHANNEL macro.
     bit currentIsActive: 1;                     ///< Current monitoring
@@ -51,8 +140,94 @@ typedef struct
 } SAFETY_POWERSUPPLY_CONFIG;
 
 
+/// Configuration of a monitored channel of the external ADC
+typedef struct
+{
+    U8 adc;                 ///< Position of the ADC, MAX116XX_POS_12CHANNEL_ADC or MAX116XX_POS_4CHANNEL_ADC
+    U8 channel;             ///< Channel of the ADC, 0-11 for the 12-channel and 0-3 for the 4-channel ADC
+    F32 r1;                 ///< Upper resistor of the voltage divider
+    F32 r2;                 ///< Lower resistor of the voltage divider on which the voltage is measured
+    F32 limitMinVolt;       ///< Lower boundary of the voltage in Volt
+    F32 limitMaxVolt;       ///< Upper boundary of the voltage in Volt
+} SAFETY_POWERSUPPLY_EXT_ADC_CHANNEL;
+
 // Makros -------------------------------------------------------------------
 
+/// Maximum number of monitored channels of the external ADCs.
+#ifndef SAFETY_POWERSUPPLY_EXT_ADC_CHANNELS_MAX
+#define SAFETY_POWERSUPPLY_EXT_ADC_CHANNELS_MAX     (3u)
+#endif
+
+/// Number of words of the status bitmaps of the external adc channels
+#define SAFETY_POWERSUPPLY_EXT_ADC_STAT_WORDS       ((SAFETY_POWERSUPPLY_EXT_ADC_CHANNELS_MAX + 31u) / 32u)
+
+#ifndef SYSPWR_NUM_VALUES
+    #define SYSPWR_NUM_VALUES   (8)
+#endif
+
+/// Filterauswahl der Kanäle. Mit 1 wird statt des gleitenden Mittelwerts ein
+/// exponentieller IIR-Filter mit vergleichbarer Zeitkonstante verwendet, siehe
+/// \ref safety_filter. Der Speicherbedarf ist dann unabhängig von der Filterlänge.
+#ifndef SYSPWR_CURRENT_FILTER_IIR
+    #define SYSPWR_CURRENT_FILTER_IIR       (0)
+#endif
+#ifndef SYSPWR_VCC_FILTER_IIR
+    #define SYSPWR_VCC_FILTER_IIR           (0)
+#endif
+#ifndef SYSPWR_VCC1_FILTER_IIR
+    #define SYSPWR_VCC1_FILTER_IIR          (0)
+#endif
+#ifndef SYSPWR_VCC2_FILTER_IIR
+    #define SYSPWR_VCC2_FILTER_IIR          (0)
+#endif
+#ifndef SYSPWR_VCC3_FILTER_IIR
+    #define SYSPWR_VCC3_FILTER_IIR          (0)
+#endif
+#ifndef SYSPWR_VCC4_FILTER_IIR
+    #define SYSPWR_VCC4_FILTER_IIR          (0)
+#endif
+#ifndef SYSPWR_VCC5_FILTER_IIR
+    #define SYSPWR_VCC5_FILTER_IIR          (0)
+#endif
+#ifndef SYSPWR_EXT_ADC_FILTER_IIR
+    #define SYSPWR_EXT_ADC_FILTER_IIR       (0)
+#endif
+
+/// Medianvorfilter der Kanäle mit 3, 5 oder 7 Werten, mit 0 ohne Vorfilter.
+/// Der Median unterdrückt einzelne Ausreißer vor der Mittelwertbildung. Bei der
+/// Versorgungsspannung wird die Unterspannung zusätzlich direkt am Ausgang des
+/// Medians erkannt, ein Einbruch wird damit nicht durch die Mittelung verzögert.
+#ifndef SYSPWR_CURRENT_FILTER_MEDIAN
+    #define SYSPWR_CURRENT_FILTER_MEDIAN    (0)
+#endif
+#ifndef SYSPWR_VCC_FILTER_MEDIAN
+    #define SYSPWR_VCC_FILTER_MEDIAN        (0)
+#endif
+#ifndef SYSPWR_VCC1_FILTER_MEDIAN
+    #define SYSPWR_VCC1_FILTER_MEDIAN       (0)
+#endif
+#ifndef SYSPWR_VCC2_FILTER_MEDIAN
+    #define SYSPWR_VCC2_FILTER_MEDIAN       (0)
+#endif
+#ifndef SYSPWR_VCC3_FILTER_MEDIAN
+    #define SYSPWR_VCC3_FILTER_MEDIAN       (0)
+#endif
+#ifndef SYSPWR_VCC4_FILTER_MEDIAN
+    #define SYSPWR_VCC4_FILTER_MEDIAN       (0)
+#endif
+#ifndef SYSPWR_VCC5_FILTER_MEDIAN
+    #define SYSPWR_VCC5_FILTER_MEDIAN       (0)
+#endif
+
+/// Set if at least one channel uses the median pre-filter
+#define SYSPWR_FILTER_MEDIAN_USED   ((SYSPWR_CURRENT_FILTER_MEDIAN) || (SYSPWR_VCC_FILTER_MEDIAN) \
+                                     || (SYSPWR_VCC1_FILTER_MEDIAN) || (SYSPWR_VCC2_FILTER_MEDIAN) \
+                                     || (SYSPWR_VCC3_FILTER_MEDIAN) || (SYSPWR_VCC4_FILTER_MEDIAN) \
+                                     || (SYSPWR_VCC5_FILTER_MEDIAN))
+
+/// Größe des Wertepuffers eines Kanals, mit IIR-Filter wird kein Puffer benötigt
+#define SYSPWR_FILTER_BUFFER_VALUES(iir)    ((iir) ? 1 : SYSPWR_NUM_VALUES)
+
 /// Factor for turning float to integer in milli-units
 #define DECIMAL_FIXPOINT                     (1000.0f)
 
@@ -83,8 +258,34 @@ typedef struct
 #define VOLTAGE_SUPPLY_WARNING_MAX_VOLT         (33.000f)
 #endif
 
+/// Deadband of Safety_TemperatureChangedHook() in milli degrees. The hook is only
+/// called if the temperature differs by more than this value from the temperature
+/// of the last call. With 0 every change of the temperature is reported.
+#ifndef SAFETY_TEMPERATURE_HOOK_DEADBAND_MILLIDEG
+#define SAFETY_TEMPERATURE_HOOK_DEADBAND_MILLIDEG   (0)
+#endif
+
+/// Minimum interval in ms between two calls of Safety_TemperatureChangedHook()
+/// due to a temperature change. A change of the temperature status is always
+/// reported immediately. With 0 the interval is not limited.
+#ifndef SAFETY_TEMPERATURE_HOOK_MIN_INTERVAL_MS
+#define SAFETY_TEMPERATURE_HOOK_MIN_INTERVAL_MS     (0)
+#endif
+
 // externe Variablen --------------------------------------------------------
 
+#if ((MAX116XX_FEAT_4CHANNEL_ADC) || (MAX116XX_FEAT_12CHANNEL_ADC))
+/// Averaged voltage in Volt of the first three monitored channels of the external
+/// ADCs of the default instance, 0 until the average is valid.
+/// \deprecated Only kept for existing applications, use
+///             Safety_Powersupply_GetExternalAdcVoltage() instead.
+extern F32 tVCCExternalAdcChannel1Avg;
+/// \copydoc tVCCExternalAdcChannel1Avg
+extern F32 tVCCExternalAdcChannel2Avg;
+/// \copydoc tVCCExternalAdcChannel1Avg
+extern F32 tVCCExternalAdcChannel3Avg;
+#endif
+
 // Allgemeine Definitionen --------------------------------------------------
 /// System temperature status
 typedef enum
@@ -113,6 +314,7 @@ typedef enum
     eERROR_EXTERNAL_ADC_VOLTAGE_1 = 0x06,  ///< External ADC voltage 1
     eERROR_EXTERNAL_ADC_VOLTAGE_2 = 0x07,  ///< External ADC voltage 2
     eERROR_EXTERNAL_ADC_VOLTAGE_3 = 0x08,  ///< External ADC voltage 3
+    eERROR_EXTERNAL_ADC_VOLTAGE_N = 0x09,  ///< External ADC voltage of a further channel, the lower level error byte holds the index of the channel in the configuration table
     eERROR_SUPPLY_VOLTAGE = 0x10,          ///< External supply voltage
 } eERROR_VOLTAGE_CHANNELS;
 
@@ -168,6 +370,144 @@ typedef enum
 /// Fill lower level error byte with 0
 #define ERROR_BYTE_LOWER_LEVEL_FILL_ZERO   (0x00)
 
+/// Measurement channels with their own measurement period
+typedef enum
+{
+    eSYSPWR_CHANNEL_CURRENT = 0,    //!< Current
+    eSYSPWR_CHANNEL_VCC,            //!< External supply voltage
+    eSYSPWR_CHANNEL_VCC1,           //!< Internal voltage 1
+    eSYSPWR_CHANNEL_VCC2,           //!< Internal voltage 2
+    eSYSPWR_CHANNEL_VCC3,           //!< Internal voltage 3
+    eSYSPWR_CHANNEL_VCC4,           //!< Internal voltage 4
+    eSYSPWR_CHANNEL_VCC5,           //!< Internal voltage 5
+    eSYSPWR_CHANNEL_EXT_ADC,        //!< Voltages of the external adc
+    eSYSPWR_CHANNEL_TEMPERATURE,    //!< Temperature of the internal adc
+    eSYSPWR_CHANNEL_COUNT           //!< Number of channels
+} SYSPWR_CHANNEL;
+
+#if ((MAX116XX_FEAT_4CHANNEL_ADC) || (MAX116XX_FEAT_12CHANNEL_ADC))
+/// Runtime state of a monitored channel of the external adc
+typedef struct
+{
+#if SYSPWR_EXT_ADC_FILTER_IIR
+    SAFETY_FILTER_IIR_F32 average;      ///< IIR filter of the voltage
+#else
+    TAVG_CALC_F32 average;              ///< Averaging of the voltage
+    F32 values[SYSPWR_NUM_VALUES];      ///< Buffer of the averaging
+#endif
+    F32 multiplier;                     ///< Factor from the normalized adc value to the input voltage in Volt
+    F32 voltage;                        ///< Averaged input voltage in Volt
+} SAFETY_POWERSUPPLY_EXT_ADC_STATE;
+
+#endif
+
+/// Error handling of an instance of the power supply monitor, replaces the
+/// process-global hard error handling and event system for this instance.
+typedef struct
+{
+    /// Called instead of Safety_HardError() and Safety_PermanentHardError(),
+    /// must not return, e.g. ends the thread of the instance or returns with
+    /// longjmp(). isPermanent is true for a permanent hard error, e.g. a
+    /// voltage or temperature beyond its error limit. If it returns,
+    /// Safety_HardError() or Safety_PermanentHardError() is called.
+    void (*hardError)(void * const user, U8 const hardErrorCode, bool const isPermanent);
+    /// Called instead of Safety_Event_SendError().
+    void (*errorEvent)(void * const user, U32 const event, U8 const upper, U8 const intermediate, U8 const lower);
+    void * user;                                ///< First argument of the callbacks
+} SAFETY_POWERSUPPLY_ERROR_HANDLER;
+
+/// State of a power supply monitor. The default instance is used by
+/// Safety_Powersuply_Init() and Safety_Powersupply_Check(), further instances
+/// are used with the Safety_Powersupply_Context...() functions, e.g. to run
+/// independent monitors in parallel threads of a simulation.
+/// The members are only accessed by safety_powersupply.c.
+typedef struct
+{
+#ifdef fpADCIN_VCC
+    TAVG_CALC tVCCAvg;                          ///< Filter of the supply voltage
+    S32 alVCCValues[SYSPWR_FILTER_BUFFER_VALUES(SYSPWR_VCC_FILTER_IIR)];    ///< Buffer of the filter
+    U32 vccLowVoltageTimeout;                   ///< Remaining measurements until an undervoltage is an error
+    U32 vccLimitMinMillivolt;                   ///< Lower error limit of the supply voltage in mV
+    U32 vccLimitMaxMillivolt;                   ///< Upper error limit of the supply voltage in mV
+    U32 vccLowTicks;                            ///< Accumulated time of undervoltage in ticks, not reset within the allowed range
+    U32 vccLastEvaluationTicks;                 ///< Time of the previous evaluation of the supply voltage limits in ticks
+    bool vccEvaluated;                          ///< Set with the first evaluation of the supply voltage limits
+    S32 lPowerVoltage;                          ///< Supply voltage in mV
+#endif
+#ifdef fpADCIN_VCC1
+    TAVG_CALC tVCC1Avg;                         ///< Filter of the internal voltage 1
+    S32 alVCC1Values[SYSPWR_FILTER_BUFFER_VALUES(SYSPWR_VCC1_FILTER_IIR)];  ///< Buffer of the filter
+    S32 lPowerVoltage1;                         ///< Internal voltage 1 in mV
+#endif
+#ifdef fpADCIN_VCC2
+    TAVG_CALC tVCC2Avg;                         ///< Filter of the internal voltage 2
+    S32 alVCC2Values[SYSPWR_FILTER_BUFFER_VALUES(SYSPWR_VCC2_FILTER_IIR)];  ///< Buffer of the filter
+    S32 lPowerVoltage2;                         ///< Internal voltage 2 in mV
+#endif
+#ifdef fpADCIN_VCC3
+    TAVG_CALC tVCC3Avg;                         ///< Filter of the internal voltage 3
+    S32 alVCC3Values[SYSPWR_FILTER_BUFFER_VALUES(SYSPWR_VCC3_FILTER_IIR)];  ///< Buffer of the filter
+    S32 lPowerVoltage3;                         ///< Internal voltage 3 in mV
+#endif
+#ifdef fpADCIN_VCC4
+    TAVG_CALC tVCC4Avg;                         ///< Filter of the internal voltage 4
+    S32 alVCC4Values[SYSPWR_FILTER_BUFFER_VALUES(SYSPWR_VCC4_FILTER_IIR)];  ///< Buffer of the filter
+    S32 lPowerVoltage4;                         ///< Internal voltage 4 in mV
+#endif
+#ifdef fpADCIN_VCC5
+    TAVG_CALC tVCC5Avg;                         ///< Filter of the internal voltage 5
+    S32 alVCC5Values[SYSPWR_FILTER_BUFFER_VALUES(SYSPWR_VCC5_FILTER_IIR)];  ///< Buffer of the filter
+    S32 lPowerVoltage5;                         ///< Internal voltage 5 in mV
+#endif
+#ifdef fpADCIN_ICC
+    TAVG_CALC tIAvg;                            ///< Filter of the current
+    S32 alIValues[SYSPWR_FILTER_BUFFER_VALUES(SYSPWR_CURRENT_FILTER_IIR)];  ///< Buffer of the filter
+    S32 lPowerCurrent;                          ///< Current consumption in mA
+#endif
+#if defined(fpADCIN_ICC) && defined(fpADCIN_VCC)
+    U32 ulPower;                                ///< Power consumption in mW
+#endif
+#if defined(fpADCIN_TEMPERATURE) || defined(TMP144_UART_CHANNEL)
+    S32 systemTemperature;                      ///< System temperature in milli degrees
+    SYSTEM_TEMPERATURE_STATUS sysTemperatureStat;   ///< System temperature status
+#endif
+#ifdef TMP144_UART_CHANNEL
+    S32 hookTemperature;                        ///< Temperature reported with the last call of Safety_TemperatureChangedHook()
+    SYSTEM_TEMPERATURE_STATUS hookTemperatureStat;  ///< Temperature status reported with the last call of Safety_TemperatureChangedHook()
+    U32 hookTicks;                              ///< Time of the last call of Safety_TemperatureChangedHook() in ticks
+    bool hookCalled;                            ///< Set with the first call of Safety_TemperatureChangedHook()
+#endif
+#if ((MAX116XX_FEAT_4CHANNEL_ADC) || (MAX116XX_FEAT_12CHANNEL_ADC))
+    SAFETY_POWERSUPPLY_EXT_ADC_CHANNEL const * externalAdcChannels;     ///< Configured channels of the external adc
+    U8 externalAdcChannelCount;                 ///< Number of configured channels of the external adc
+    SAFETY_POWERSUPPLY_EXT_ADC_STATE externalAdcState[SAFETY_POWERSUPPLY_EXT_ADC_CHANNELS_MAX]; ///< Runtime state of the channels
+    U32 externalAdcActive[SAFETY_POWERSUPPLY_EXT_ADC_STAT_WORDS];       ///< Bitmap of the monitored channels
+    U32 externalAdcErrorLow[SAFETY_POWERSUPPLY_EXT_ADC_STAT_WORDS];     ///< Bitmap of the channels in error state voltage too low
+    U32 externalAdcErrorHigh[SAFETY_POWERSUPPLY_EXT_ADC_STAT_WORDS];    ///< Bitmap of the channels in error state voltage too high
+#if !FEATURE_SAFETY_POWERSUPPLY_EXTERNAL_ADC_FRAMES
+    MAX116XX_ADC_VALUES externalAdcValuesList[MAX116XX_NUMBER_OF_ADCS]; ///< Copy of the external adc values, read once per cycle
+#endif
+#endif
+    U32 sysPowerStat;                           ///< System power voltage status
+    U32 channelNextTicks[eSYSPWR_CHANNEL_COUNT];    ///< Next measurement of the channels in ticks
+    bool channelScheduleStarted;                ///< Set after the measurement schedule was initialized with the first check
+    SAFETY_FILTER_IIR channelIir[eSYSPWR_CHANNEL_COUNT];    ///< IIR filter state of the channels using the IIR filter
+#if SYSPWR_FILTER_MEDIAN_USED
+    SAFETY_FILTER_MEDIAN channelMedian[eSYSPWR_CHANNEL_COUNT];  ///< Median pre-filter state of the channels
+#endif
+#if SYSPWR_VCC_FILTER_MEDIAN
+    S32 vccMedianVoltage;                       ///< Last output of the median pre-filter of the supply voltage
+#endif
+#if FEATURE_SAFETY_POWERSUPPLY_STATISTICS
+    SAFETY_FILTER_STAT statisticsState[eSAFETY_POWERSUPPLY_STAT_COUNT];     ///< Running statistics of the channels
+    volatile U32 statisticsSequence[eSAFETY_POWERSUPPLY_STAT_COUNT];        ///< Sequence counter of the statistics, odd during an update
+#endif
+    U32 startupTicks;                           ///< Time of the initialization in ticks, start of the startup timeouts
+    volatile U32 sourceReady;                   ///< Bitmap of the sources which signaled their readiness
+    SAFETY_POWERSUPPLY_ERROR_HANDLER const * errorHandler;  ///< Error handling of the instance, NULL for the global handling
+    SAFETY_POWERSUPPLY_CONFIG * powerSupplyUserConfig;  ///< Channel configuration, NULL before the initialization
+} SAFETY_POWERSUPPLY_CONTEXT;
+
 // Prototypen ---------------------------------------------------------------
 
 /// Initialissierung der Spannungsüberwachung.
@@ -176,11 +516,68 @@ typedef enum
 /// \return true bei Erfolg, sonst false.
 extern bool Safety_Powersuply_Init(SAFETY_POWERSUPPLY_CONFIG * const safetyPowerSupplyConfig);
 
+/// Initialisierung einer Instanz der Spannungsüberwachung, siehe Safety_Powersuply_Init().
+/// Die Instanz muss vor der ersten Verwendung mit 0 initialisiert sein, z.B.
+/// statisch oder mit memset(). Die Initialisierung setzt den gesamten Zustand
+/// zurück, auch bei erneutem Aufruf. Erhalten bleiben die Konfiguration aus
+/// Safety_Powersupply_ContextConfigureExternalAdc() und
+/// Safety_Powersupply_ContextConfigureErrorHandler() sowie die mit
+/// Safety_Powersupply_ContextSignalSourceReady() gemeldeten Quellen.
+/// RAM-Variablen werden nicht registriert.
+/// Mit FEATURE_SAFETY_RECORD oder FEATURE_SAFETY_RECORD_REPLAY nicht verfügbar.
+/// \param context Instanz der Überwachung.
+/// \param safetyPowerSupplyConfig Aktivierung der Messkanäle, muss gültig bleiben.
+/// \return true bei Erfolg, sonst false.
+extern bool Safety_Powersupply_ContextInit(SAFETY_POWERSUPPLY_CONTEXT * const context,
+                                           SAFETY_POWERSUPPLY_CONFIG * const safetyPowerSupplyConfig);
+
 /// Die Zykluszeit mit der die Funktion aufgerufen wird, dient intern als
 /// Zeitbasis für Timeouts, usw.
 /// @return TRUE
 extern U8 Safety_Powersupply_Check(void);
 
+/// Zyklische Prüfung einer Instanz, siehe Safety_Powersupply_Check().
+/// \param context Instanz der Überwachung.
+/// @return TRUE, FALSE wenn die Instanz nicht initialisiert ist.
+extern U8 Safety_Powersupply_ContextCheck(SAFETY_POWERSUPPLY_CONTEXT * const context);
+
+/// Configures the error handling of an instance, e.g. for instances in parallel
+/// threads. Has to be called before Safety_Powersupply_ContextInit().
+/// \param context Instance of the monitor.
+/// \param errorHandler Callbacks of the instance, both have to be set. Has to stay valid.
+/// \return true on success, otherwise false.
+extern bool Safety_Powersupply_ContextConfigureErrorHandler(SAFETY_POWERSUPPLY_CONTEXT * const context,
+                                                            SAFETY_POWERSUPPLY_ERROR_HANDLER const * const errorHandler);
+
+/// Signals that a measurement source is ready. The monitoring of the channels
+/// of the source starts with the next cycle of the safety task instead of
+/// waiting for the startup timeout. Can be called from any task or interrupt,
+/// also before Safety_Powersuply_Init().
+/// The TMP144 and the external ADCs are detected as ready automatically with
+/// their first valid value.
+/// \param source Ready source.
+extern void Safety_Powersupply_SignalSourceReady(SAFETY_POWERSUPPLY_SOURCE const source);
+
+/// Signals that a measurement source of an instance is ready, see
+/// Safety_Powersupply_SignalSourceReady().
+/// \param context Instance of the monitor.
+/// \param source Ready source.
+extern void Safety_Powersupply_ContextSignalSourceReady(SAFETY_POWERSUPPLY_CONTEXT * const context,
+                                                        SAFETY_POWERSUPPLY_SOURCE const source);
+
+/// Checks if a measurement source is ready.
+/// \param source Source to check.
+/// \return true if the source signaled its readiness. The internal ADC is also
+///         ready after the startup delay SYSPWR_STARTUP_DELAY_MS.
+extern bool Safety_Powersupply_IsSourceReady(SAFETY_POWERSUPPLY_SOURCE const source);
+
+/// Checks if a measurement source of an instance is ready, see Safety_Powersupply_IsSourceReady().
+/// \param context Instance of the monitor.
+/// \param source Source to check.
+/// \return true if the source signaled its readiness.
+extern bool Safety_Powersupply_ContextIsSourceReady(SAFETY_POWERSUPPLY_CONTEXT * const context,
+                                                    SAFETY_POWERSUPPLY_SOURCE const source);
+
 #if defined(fpADCIN_TEMPERATURE) || defined(TMP144_UART_CHANNEL)
 /// Abfrage der internen Systemtemperatur.
 /// Die Funktion ist nur aktiv, wenn der ADC Eingang, der genutzt werden soll,
@@ -189,13 +586,91 @@ extern U8 Safety_Powersupply_Check(void);
 /// \return Aktuelle Systemtemperatur.
 extern S32 Safety_GetSystemTemperature(void);
 
-/// This function is called whenever the measured temperature value changed.
+/// Abfrage der Systemtemperatur einer Instanz, siehe Safety_GetSystemTemperature().
+/// \param context Instanz der Überwachung.
+/// \return Aktuelle Systemtemperatur.
+extern S32 Safety_Powersupply_ContextGetSystemTemperature(SAFETY_POWERSUPPLY_CONTEXT const * const context);
+
+/// This function is called whenever the measured temperature value changed by more
+/// than \ref SAFETY_TEMPERATURE_HOOK_DEADBAND_MILLIDEG, at most once per
+/// \ref SAFETY_TEMPERATURE_HOOK_MIN_INTERVAL_MS, and immediately on every change
+/// of the temperature state.
 /// The user may overwrite it with a custom definition. (SOFTQM-680)
 /// @param temperature The currently measured device temperature.
 /// @param temperatureState The state of the temperature giving information about warning and error states
 extern void Safety_TemperatureChangedHook(float temperature, SYSTEM_TEMPERATURE_STATUS const temperatureState);
 #endif
 
+#if ((MAX116XX_FEAT_4CHANNEL_ADC) || (MAX116XX_FEAT_12CHANNEL_ADC))
+/// Configures the monitored channels of the external ADCs. Has to be called
+/// before Safety_Powersuply_Init(). Without a configuration the three channels
+/// of the EXT_ADC_CHANNELx_TO_CHECK macros are monitored.
+/// An error of the first three channels is reported with eERROR_EXTERNAL_ADC_VOLTAGE_1..3,
+/// an error of a further channel with eERROR_EXTERNAL_ADC_VOLTAGE_N and the index
+/// of the channel in the lower level error byte.
+/// \param channels Table of the channels, has to stay valid.
+/// \param count Number of channels, at most \ref SAFETY_POWERSUPPLY_EXT_ADC_CHANNELS_MAX.
+/// \return true on success, otherwise false.
+extern bool Safety_Powersupply_ConfigureExternalAdc(SAFETY_POWERSUPPLY_EXT_ADC_CHANNEL const * const channels, U8 const count);
+
+/// Configures the monitored channels of the external ADCs of an instance, see
+/// Safety_Powersupply_ConfigureExternalAdc(). Has to be called before Safety_Powersupply_ContextInit().
+/// \param context Instance of the monitor.
+/// \param channels Table of the channels, has to stay valid.
+/// \param count Number of channels, at most \ref SAFETY_POWERSUPPLY_EXT_ADC_CHANNELS_MAX.
+/// \return true on success, otherwise false.
+extern bool Safety_Powersupply_ContextConfigureExternalAdc(SAFETY_POWERSUPPLY_CONTEXT * const context,
+                                                           SAFETY_POWERSUPPLY_EXT_ADC_CHANNEL const * const channels, U8 const count);
+
+/// Returns the averaged voltage of a monitored channel of the external ADCs.
+/// \param index Index of the channel in the configuration table.
+/// \param voltage Returns the voltage in Volt.
+/// \return true if a valid voltage is available, otherwise false.
+extern bool Safety_Powersupply_GetExternalAdcVoltage(U8 const index, F32 * const voltage);
+
+/// Returns the averaged voltage of a monitored channel of the external ADCs of an instance.
+/// \param context Instance of the monitor.
+/// \param index Index of the channel in the configuration table.
+/// \param voltage Returns the voltage in Volt.
+/// \return true if a valid voltage is available, otherwise false.
+extern bool Safety_Powersupply_ContextGetExternalAdcVoltage(SAFETY_POWERSUPPLY_CONTEXT * const context,
+                                                            U8 const index, F32 * const voltage);
+#endif
+
+#if ((MAX116XX_FEAT_4CHANNEL_ADC) || (MAX116XX_FEAT_12CHANNEL_ADC)) && FEATURE_SAFETY_POWERSUPPLY_EXTERNAL_ADC_FRAMES
+/// Returns the frame to be written by the external adc task. The frame holds the
+/// values of all external adcs and stays valid until it is published. After the
+/// publication the frame of the previous publication is the next frame to be
+/// written, a read of the safety task concurrent to the publication is repeated.
+/// \note Only one task may write and publish frames.
+/// \return Frame to be written.
+extern MAX116XX_ADC_VALUES * Safety_Powersupply_GetExternalAdcFrameBuffer(void);
+
+/// Publishes the frame written by the external adc task as current frame.
+extern void Safety_Powersupply_PublishExternalAdcFrame(void);
+#endif
+
+#if FEATURE_SAFETY_POWERSUPPLY_STATISTICS
+/// Returns a consistent snapshot of the running statistics of a channel.
+/// Can be called from any task.
+/// \param channel Channel of the statistics.
+/// \param statistics Returns the statistics, count is 0 for channels without measurements.
+/// \return true on success, false if the parameters are invalid or no consistent
+///         snapshot could be taken because the safety task updated the statistics concurrently.
+extern bool Safety_Powersupply_GetStatistics(SAFETY_POWERSUPPLY_STAT_CHANNEL const channel,
+                                             SAFETY_POWERSUPPLY_STATISTICS * const statistics);
+
+/// Returns a consistent snapshot of the running statistics of a channel of an
+/// instance, see Safety_Powersupply_GetStatistics().
+/// \param context Instance of the monitor.
+/// \param channel Channel of the statistics.
+/// \param statistics Returns the statistics.
+/// \return true on success, otherwise false.
+extern bool Safety_Powersupply_ContextGetStatistics(SAFETY_POWERSUPPLY_CONTEXT * const context,
+                                                    SAFETY_POWERSUPPLY_STAT_CHANNEL const channel,
+                                                    SAFETY_POWERSUPPLY_STATISTICS * const statistics);
+#endif
+
 #ifdef fpADCIN_VCC
 /// Abfrage der internen Versorgungsspannung.
 /// Die Funktion ist nur aktiv, wenn der ADC Eingang, der genutzt werden soll,
@@ -203,6 +678,11 @@ extern void Safety_TemperatureChangedHook(float temperature, SYSTEM_TEMPERATURE_
 /// Die Spannung wird mit \e DECIMAL_FIXPOINT skaliert.
 /// \return Aktuelle Versorgungsspannung.
 extern S32 Safety_GetPowerVoltage(void);
+
+/// Abfrage der Versorgungsspannung einer Instanz, siehe Safety_GetPowerVoltage().
+/// \param context Instanz der Überwachung.
+/// \return Aktuelle Versorgungsspannung.
+extern S32 Safety_Powersupply_ContextGetPowerVoltage(SAFETY_POWERSUPPLY_CONTEXT const * const context);
 #endif
 
 #ifdef __cplusplus
@@ -0,0 +1,648 @@
+/*******************************************************************************
+ * Copyright (c) 2026 TWK-ELEKTRONIK GmbH. All rights reserved.
+ ******************************************************************************/
+
+// Gemeinsame Headerdateien einbinden --------------------------------------
+#include "config/version.h"
+
+#include "RTOS_AL/RTOS_AL.h"
+#include "Devices_ADC_MAX116XX/MAX116XX.h"
+
+#include "safety_record.h"
+#include "safety_startup.h"
+
+#if FEATURE_SAFETY_RECORD || FEATURE_SAFETY_RECORD_REPLAY
+// Compiler Direktiven -----------------------------------------------------
+
+#if SAFETY_RECORD_BUFFER_SIZE > 65536u
+#error "SAFETY_RECORD_BUFFER_SIZE must not exceed 65536, the cycle length is stored in 16 bits"
+#endif
+
+// Makros ------------------------------------------------------------------
+
+/// Index mask of the ring buffer.
+#define RECORD_BUFFER_MASK      (SAFETY_RECORD_BUFFER_SIZE - 1u)
+
+/// Identifier of a cycle.
+#define RECORD_TAG_CYCLE        (0x10u)
+
+/// Size of the cycle identifier with length and ticks.
+#define RECORD_CYCLE_SIZE       (7u)
+
+/// Result bit of the identifier of an input.
+#define RECORD_TAG_RESULT       (0x01u)
+
+/// Number of attempts of Safety_Record_Read() to copy cycles not overwritten during the copy.
+#define RECORD_READ_RETRIES     (3u)
+
+#ifndef SAFETY_RECORD_READ_HOOK
+/// Hook between copying the cycles and checking them in Safety_Record_Read(),
+/// empty by default. Only the host module tests define it, together with
+/// FEATURE_SAFETY_HARDERROR_TRAP, and record cycles at this point.
+#define SAFETY_RECORD_READ_HOOK()
+#elif !FEATURE_SAFETY_HARDERROR_TRAP
+#error "SAFETY_RECORD_READ_HOOK is only for the host module tests with FEATURE_SAFETY_HARDERROR_TRAP"
+#endif
+
+// Allgemeine Definitionen -------------------------------------------------
+
+/// Bit pattern of a value.
+typedef union
+{
+    F32 value;      ///< Value
+    U32 bits;       ///< Bit pattern of the value
+} RECORD_F32_BITS;
+
+// externe Variablen -------------------------------------------------------
+
+#if FEATURE_SAFETY_RECORD
+/// Ring buffer of the recorded cycles.
+static U8 recordBuffer[SAFETY_RECORD_BUFFER_SIZE];
+
+/// Write position, free running.
+static U32 recordHead = 0;
+
+/// Start of the oldest recorded cycle, free running.
+static volatile U32 recordTail = 0;
+
+/// End of the last completed cycle, free running.
+static volatile U32 recordCommitted = 0;
+
+/// Start of the next cycle for Safety_Record_Read(), free running, written by the reader only.
+static volatile U32 recordReadPosition = 0;
+
+/// Cycles overwritten before Safety_Record_Read() read them.
+static U32 recordOverflows = 0;
+
+/// Start of the current cycle.
+static U32 recordCycleStart = 0;
+
+/// Set between Safety_Record_BeginCycle() and Safety_Record_EndCycle().
+static bool recordInCycle = false;
+
+/// Set if the current cycle does not fit into the ring buffer.
+static bool recordCycleDiscarded = false;
+
+/// Set while recording.
+static bool recordActive = false;
+
+/// Set by Safety_Record_Stop(), evaluated at the start of a cycle.
+static volatile bool recordStopRequested = false;
+
+/// Channel configuration for the header.
+static U16 recordConfig = 0;
+
+/// Ticks of the start for the header.
+static U32 recordStartTicks = 0;
+
+/// Cycles overwritten or discarded since the start.
+static U32 recordDroppedCycles = 0;
+#endif
+
+#if FEATURE_SAFETY_RECORD_REPLAY
+/// Replayed recording.
+static U8 const * replayData = NULL;
+
+/// Size of the replayed recording.
+static U32 replaySize = 0;
+
+/// Position of the next input.
+static U32 replayPosition = 0;
+
+/// End of the current cycle.
+static U32 replayCycleEnd = 0;
+
+/// Number of inputs not matching the recording.
+static U32 replayMismatches = 0;
+#endif
+
+// Funktionsbereich --------------------------------------------------------
+
+/// Checks if an input is stored with a channel.
+/// \param input Kind of the input.
+/// \return true if the identifier is followed by the channel.
+static bool Safety_Record_HasIndex(SAFETY_RECORD_INPUT const input);
+
+/// Checks if an input is stored with a value.
+/// \param input Kind of the input.
+/// \return true if the identifier is followed by a value if the result is true.
+static bool Safety_Record_HasValue(SAFETY_RECORD_INPUT const input);
+
+#if FEATURE_SAFETY_RECORD
+/// Converts the channel configuration to the bit mask of the header.
+/// \param config Channel configuration.
+/// \return Bit mask, the bits follow the order of SAFETY_POWERSUPPLY_CONFIG.
+static U16 Safety_Record_ConfigToMask(SAFETY_POWERSUPPLY_CONFIG const * const config);
+
+/// Stores bytes of the current cycle in the ring buffer. The oldest cycles are
+/// discarded if necessary.
+/// \param bytes Bytes to store.
+/// \param count Number of bytes.
+static void Safety_Record_Write(U8 const * const bytes, U32 const count);
+
+/// Writes the header of a recording.
+/// \param destination Destination buffer of at least \ref SAFETY_RECORD_HEADER_SIZE bytes.
+/// \param droppedCycles Cycles missing before the first cycle of the recording.
+static void Safety_Record_WriteHeader(U8 * const destination, U32 const droppedCycles);
+#endif
+
+#if FEATURE_SAFETY_RECORD_REPLAY
+/// Converts the bit mask of the header to the channel configuration.
+/// \param mask Bit mask of the header.
+/// \param config Returns the channel configuration.
+static void Safety_Record_MaskToConfig(U16 const mask, SAFETY_POWERSUPPLY_CONFIG * const config);
+
+/// Reads a little endian value of the recording.
+/// \param position Position of the value.
+/// \param size Size of the value in bytes, 1 to 4.
+/// \return Value.
+static U32 Safety_Record_ReadLe(U32 const position, U8 const size);
+#endif
+
+#if FEATURE_SAFETY_RECORD
+void Safety_Record_Start(SAFETY_POWERSUPPLY_CONFIG const * const config, U32 const ticks)
+    {
+    if(config == NULL)
+        {
+        return;
+        }
+
+    recordHead = 0;
+    recordTail = 0;
+    recordCommitted = 0;
+    recordReadPosition = 0;
+    recordOverflows = 0;
+    recordCycleStart = 0;
+    recordInCycle = false;
+    recordCycleDiscarded = false;
+    recordDroppedCycles = 0;
+    recordConfig = Safety_Record_ConfigToMask(config);
+    recordStartTicks = ticks;
+    __atomic_store_n(&recordStopRequested, false, __ATOMIC_RELAXED);
+    recordActive = true;
+    }
+//------------------------------------------------------------------------------
+
+void Safety_Record_Stop(void)
+    {
+    __atomic_store_n(&recordStopRequested, true, __ATOMIC_RELAXED);
+    }
+//------------------------------------------------------------------------------
+
+void Safety_Record_BeginCycle(U32 const ticks)
+    {
+    U8 bytes[RECORD_CYCLE_SIZE];
+
+    if(recordInCycle)
+        {
+        Safety_Record_EndCycle();
+        }
+
+    if(recordActive && __atomic_load_n(&recordStopRequested, __ATOMIC_RELAXED))
+        {
+        recordActive = false;
+        }
+
+    if(!recordActive)
+        {
+        return;
+        }
+
+    recordCycleStart = recordHead;
+    recordInCycle = true;
+    recordCycleDiscarded = false;
+
+    // Länge wird am Ende des Zyklus eingetragen
+    bytes[0] = RECORD_TAG_CYCLE;
+    bytes[1] = 0u;
+    bytes[2] = 0u;
+    bytes[3] = (U8) ticks;
+    bytes[4] = (U8) (ticks >> 8);
+    bytes[5] = (U8) (ticks >> 16);
+    bytes[6] = (U8) (ticks >> 24);
+    Safety_Record_Write(bytes, RECORD_CYCLE_SIZE);
+    }
+//------------------------------------------------------------------------------
+
+void Safety_Record_EndCycle(void)
+    {
+    U32 length;
+
+    if(!recordInCycle)
+        {
+        return;
+        }
+
+    recordInCycle = false;
+
+    if(!recordCycleDiscarded)
+        {
+        length = recordHead - recordCycleStart - RECORD_CYCLE_SIZE;
+        recordBuffer[(recordCycleStart + 1u) & RECORD_BUFFER_MASK] = (U8) length;
+        recordBuffer[(recordCycleStart + 2u) & RECORD_BUFFER_MASK] = (U8) (length >> 8);
+
+        // Zyklus erst vollständig für Safety_Record_Read() freigeben
+        __atomic_store_n(&recordCommitted, recordHead, __ATOMIC_RELEASE);
+        }
+    }
+//------------------------------------------------------------------------------
+
+void Safety_Record_Input(SAFETY_RECORD_INPUT const input, U8 const index, bool const result, F32 const value)
+    {
+    U8 bytes[6];
+    U32 count = 0;
+    RECORD_F32_BITS converter;
+
+    if(!recordInCycle)
+        {
+        return;
+        }
+
+    bytes[count++] = (U8) (((U32) input << 4) | (result ? RECORD_TAG_RESULT : 0u));
+
+    if(Safety_Record_HasIndex(input))
+        {
+        bytes[count++] = index;
+        }
+
+    if(result && Safety_Record_HasValue(input))
+        {
+        converter.value = value;
+        bytes[count++] = (U8) converter.bits;
+        bytes[count++] = (U8) (converter.bits >> 8);
+        bytes[count++] = (U8) (converter.bits >> 16);
+        bytes[count++] = (U8) (converter.bits >> 24);
+        }
+
+    Safety_Record_Write(bytes, count);
+    }
+//------------------------------------------------------------------------------
+
+U32 Safety_Record_GetExportSize(void)
+    {
+    return SAFETY_RECORD_HEADER_SIZE + (recordHead - recordTail);
+    }
+//------------------------------------------------------------------------------
+
+U32 Safety_Record_Export(U8 * const destination, U32 const size)
+    {
+    U32 const length = recordHead - recordTail;
+    U32 cycleLength;
+    U32 offset;
+    U32 i;
+
+    if((destination == NULL) || (size < (SAFETY_RECORD_HEADER_SIZE + length)))
+        {
+        return 0;
+        }
+
+    Safety_Record_WriteHeader(destination, recordDroppedCycles);
+
+    for(i = 0; i < length; i++)
+        {
+        destination[SAFETY_RECORD_HEADER_SIZE + i] = recordBuffer[(recordTail + i) & RECORD_BUFFER_MASK];
+        }
+
+    // Nicht abgeschlossener Zyklus, z.B. nach einem Hard-Error: Länge bis zum letzten Wert eintragen
+    if(recordInCycle && !recordCycleDiscarded)
+        {
+        offset = SAFETY_RECORD_HEADER_SIZE + (recordCycleStart - recordTail);
+        cycleLength = recordHead - recordCycleStart - RECORD_CYCLE_SIZE;
+        destination[offset + 1u] = (U8) cycleLength;
+        destination[offset + 2u] = (U8) (cycleLength >> 8);
+        }
+
+    return SAFETY_RECORD_HEADER_SIZE + length;
+    }
+//------------------------------------------------------------------------------
+
+U32 Safety_Record_GetHeader(U8 * const destination, U32 const size)
+    {
+    if((destination == NULL) || (size < SAFETY_RECORD_HEADER_SIZE))
+        {
+        return 0;
+        }
+
+    Safety_Record_WriteHeader(destination, __atomic_load_n(&recordOverflows, __ATOMIC_RELAXED));
+    return SAFETY_RECORD_HEADER_SIZE;
+    }
+//------------------------------------------------------------------------------
+
+U32 Safety_Record_Read(U8 * const destination, U32 const size)
+    {
+    U32 committed;
+    U32 start;
+    U32 position;
+    U32 length;
+    U32 retry;
+    U32 i;
+
+    if(destination == NULL)
+        {
+        return 0;
+        }
+
+    for(retry = 0; retry < RECORD_READ_RETRIES; retry++)
+        {
+        committed = __atomic_load_n(&recordCommitted, __ATOMIC_ACQUIRE);
+        start = recordReadPosition;
+
+        // Noch nicht gelesene Zyklen wurden überschrieben: ab dem ältesten vorhandenen Zyklus lesen
+        if((S32) (__atomic_load_n(&recordTail, __ATOMIC_ACQUIRE) - start) > 0)
+            {
+            start = __atomic_load_n(&recordTail, __ATOMIC_ACQUIRE);
+            }
+
+        // Nur vollständige Zyklen, die ganz in den Zielpuffer passen
+        position = start;
+        while((S32) (committed - position) > 0)
+            {
+            length = RECORD_CYCLE_SIZE + ((U32) recordBuffer[(position + 1u) & RECORD_BUFFER_MASK]
+                                          | ((U32) recordBuffer[(position + 2u) & RECORD_BUFFER_MASK] << 8));
+            if(((position - start + length) > size) || ((S32) (committed - (position + length)) < 0))
+                {
+                break;
+                }
+
+            for(i = 0; i < length; i++)
+                {
+                destination[position - start + i] = recordBuffer[(position + i) & RECORD_BUFFER_MASK];
+                }
+            position += length;
+            }
+
+        SAFETY_RECORD_READ_HOOK();
+
+        // Die Sicherheitstask gibt Zyklen frei, bevor sie sie überschreibt. Ist der
+        // älteste Zyklus noch nicht hinter dem Anfang, ist die Kopie unverändert.
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if((S32) (__atomic_load_n(&recordTail, __ATOMIC_RELAXED) - start) <= 0)
+            {
+            __atomic_store_n(&recordReadPosition, position, __ATOMIC_RELEASE);
+            return position - start;
+            }
+        }
+
+    return 0;
+    }
+//------------------------------------------------------------------------------
+
+U32 Safety_Record_GetOverflows(void)
+    {
+    return __atomic_load_n(&recordOverflows, __ATOMIC_RELAXED);
+    }
+//------------------------------------------------------------------------------
+
+static U16 Safety_Record_ConfigToMask(SAFETY_POWERSUPPLY_CONFIG const * const config)
+    {
+    return (U16) ((config->supplyVoltageIsActive ? 0x0001u : 0u)
+            | (config->voltage1IsActive ? 0x0002u : 0u)
+            | (config->voltage2IsActive ? 0x0004u : 0u)
+            | (config->voltage3IsActive ? 0x0008u : 0u)
+            | (config->voltage4IsActive ? 0x0010u : 0u)
+            | (config->voltage5IsActive ? 0x0020u : 0u)
+            | (config->voltageExternalAdcChannel1IsActive ? 0x0040u : 0u)
+            | (config->voltageExternalAdcChannel2IsActive ? 0x0080u : 0u)
+            | (config->voltageExternalAdcChannel3IsActive ? 0x0100u : 0u)
+            | (config->currentIsActive ? 0x0200u : 0u)
+            | (config->temperatureSensorIsActive ? 0x0400u : 0u)
+            | (config->temperatureAdcIsActive ? 0x0800u : 0u));
+    }
+//------------------------------------------------------------------------------
+
+static void Safety_Record_Write(U8 const * const bytes, U32 const count)
+    {
+    U32 tail = recordTail;
+    U32 length;
+    U32 i;
+
+    if(recordCycleDiscarded)
+        {
+        return;
+        }
+
+    // Älteste Zyklen verwerfen, bis die Bytes in den Puffer passen
+    while((recordHead - tail + count) > SAFETY_RECORD_BUFFER_SIZE)
+        {
+        if(tail == recordCycleStart)
+            {
+            // Aktueller Zyklus allein größer als der Puffer
+            recordHead = recordCycleStart;
+            recordCycleDiscarded = true;
+            recordDroppedCycles++;
+            return;
+            }
+
+        // Noch nicht von Safety_Record_Read() gelesen
+        if((S32) (tail - __atomic_load_n(&recordReadPosition, __ATOMIC_RELAXED)) >= 0)
+            {
+            __atomic_store_n(&recordOverflows, recordOverflows + 1u, __ATOMIC_RELAXED);
+            }
+
+        length = (U32) recordBuffer[(tail + 1u) & RECORD_BUFFER_MASK]
+                | ((U32) recordBuffer[(tail + 2u) & RECORD_BUFFER_MASK] << 8);
+        tail += RECORD_CYCLE_SIZE + length;
+        recordDroppedCycles++;
+        }
+
+    if(tail != recordTail)
+        {
+        // Zyklen freigeben, bevor sie überschrieben werden
+        __atomic_store_n(&recordTail, tail, __ATOMIC_RELAXED);
+        __atomic_thread_fence(__ATOMIC_RELEASE);
+        }
+
+    for(i = 0; i < count; i++)
+        {
+        recordBuffer[(recordHead + i) & RECORD_BUFFER_MASK] = bytes[i];
+        }
+    recordHead += count;
+    }
+//------------------------------------------------------------------------------
+
+static void Safety_Record_WriteHeader(U8 * const destination, U32 const droppedCycles)
+    {
+    U32 i;
+
+    destination[0] = 'S';
+    destination[1] = 'P';
+    destination[2] = 'R';
+    destination[3] = 'T';
+    destination[4] = SAFETY_RECORD_VERSION;
+    destination[5] = (U8) configTICK_RATE_HZ_MS;
+    destination[6] = (U8) recordConfig;
+    destination[7] = (U8) (recordConfig >> 8);
+    for(i = 0; i < 4u; i++)
+        {
+        destination[8u + i] = (U8) (recordStartTicks >> (8u * i));
+        destination[12u + i] = (U8) (droppedCycles >> (8u * i));
+        }
+    }
+//------------------------------------------------------------------------------
+#endif // FEATURE_SAFETY_RECORD
+
+#if FEATURE_SAFETY_RECORD_REPLAY
+bool Safety_Record_ReplayStart(U8 const * const data, U32 const size, SAFETY_RECORD_HEADER * const header)
+    {
+    if((data == NULL) || (header == NULL) || (size < SAFETY_RECORD_HEADER_SIZE))
+        {
+        return false;
+        }
+
+    if((data[0] != 'S') || (data[1] != 'P') || (data[2] != 'R') || (data[3] != 'T')
+            || (data[4] != SAFETY_RECORD_VERSION))
+        {
+        return false;
+        }
+
+    replayData = data;
+    replaySize = size;
+    replayPosition = SAFETY_RECORD_HEADER_SIZE;
+    replayCycleEnd = SAFETY_RECORD_HEADER_SIZE;
+    replayMismatches = 0;
+
+    header->ticksPerMs = data[5];
+    Safety_Record_MaskToConfig((U16) Safety_Record_ReadLe(6u, 2u), &header->config);
+    header->startTicks = Safety_Record_ReadLe(8u, 4u);
+    header->droppedCycles = Safety_Record_ReadLe(12u, 4u);
+    return true;
+    }
+//------------------------------------------------------------------------------
+
+bool Safety_Record_ReplayNextCycle(U32 * const ticks)
+    {
+    U32 length;
+
+    if((replayData == NULL) || (ticks == NULL))
+        {
+        return false;
+        }
+
+    // Nicht abgefragte Werte des vorherigen Zyklus
+    if(replayPosition != replayCycleEnd)
+        {
+        replayMismatches++;
+        }
+    replayPosition = replayCycleEnd;
+
+    if(((replayPosition + RECORD_CYCLE_SIZE) > replaySize) || (replayData[replayPosition] != RECORD_TAG_CYCLE))
+        {
+        return false;
+        }
+
+    length = Safety_Record_ReadLe(replayPosition + 1u, 2u);
+    if((replayPosition + RECORD_CYCLE_SIZE + length) > replaySize)
+        {
+        // Unvollständige Aufzeichnung
+        return false;
+        }
+
+    *ticks = Safety_Record_ReadLe(replayPosition + 3u, 4u);
+    replayPosition += RECORD_CYCLE_SIZE;
+    replayCycleEnd = replayPosition + length;
+    return true;
+    }
+//------------------------------------------------------------------------------
+
+bool Safety_Record_ReplayInput(SAFETY_RECORD_INPUT const input, U8 const index, F32 * const value)
+    {
+    U32 position = replayPosition;
+    RECORD_F32_BITS converter;
+    bool result;
+    U8 tag;
+
+    if((replayData == NULL) || (position >= replayCycleEnd))
+        {
+        replayMismatches++;
+        return false;
+        }
+
+    tag = replayData[position++];
+    result = (tag & RECORD_TAG_RESULT) != 0u;
+    if((U32) (tag >> 4) != (U32) input)
+        {
+        replayMismatches++;
+        return false;
+        }
+
+    if(Safety_Record_HasIndex(input))
+        {
+        if((position >= replayCycleEnd) || (replayData[position] != index))
+            {
+            replayMismatches++;
+            return false;
+            }
+        position++;
+        }
+
+    if(result && Safety_Record_HasValue(input))
+        {
+        if((position + 4u) > replayCycleEnd)
+            {
+            replayMismatches++;
+            return false;
+            }
+        converter.bits = Safety_Record_ReadLe(position, 4u);
+        if(value != NULL)
+            {
+            *value = converter.value;
+            }
+        position += 4u;
+        }
+
+    replayPosition = position;
+    return result;
+    }
+//------------------------------------------------------------------------------
+
+U32 Safety_Record_ReplayGetMismatches(void)
+    {
+    return replayMismatches;
+    }
+//------------------------------------------------------------------------------
+
+static void Safety_Record_MaskToConfig(U16 const mask, SAFETY_POWERSUPPLY_CONFIG * const config)
+    {
+    config->supplyVoltageIsActive = (mask & 0x0001u) != 0u;
+    config->voltage1IsActive = (mask & 0x0002u) != 0u;
+    config->voltage2IsActive = (mask & 0x0004u) != 0u;
+    config->voltage3IsActive = (mask & 0x0008u) != 0u;
+    config->voltage4IsActive = (mask & 0x0010u) != 0u;
+    config->voltage5IsActive = (mask & 0x0020u) != 0u;
+    config->voltageExternalAdcChannel1IsActive = (mask & 0x0040u) != 0u;
+    config->voltageExternalAdcChannel2IsActive = (mask & 0x0080u) != 0u;
+    config->voltageExternalAdcChannel3IsActive = (mask & 0x0100u) != 0u;
+    config->currentIsActive = (mask & 0x0200u) != 0u;
+    config->temperatureSensorIsActive = (mask & 0x0400u) != 0u;
+    config->temperatureAdcIsActive = (mask & 0x0800u) != 0u;
+    }
+//------------------------------------------------------------------------------
+
+static U32 Safety_Record_ReadLe(U32 const position, U8 const size)
+    {
+    U32 value = 0;
+    U8 i;
+
+    for(i = 0; i < size; i++)
+        {
+        value |= (U32) replayData[position + i] << (8u * i);
+        }
+
+    return value;
+    }
+//------------------------------------------------------------------------------
+#endif // FEATURE_SAFETY_RECORD_REPLAY
+
+static bool Safety_Record_HasIndex(SAFETY_RECORD_INPUT const input)
+    {
+    return (input == eSAFETY_RECORD_INPUT_ADC) || (input == eSAFETY_RECORD_INPUT_EXT_ADC_VALUE);
+    }
+//------------------------------------------------------------------------------
+
+static bool Safety_Record_HasValue(SAFETY_RECORD_INPUT const input)
+    {
+    return input != eSAFETY_RECORD_INPUT_EXT_ADC_UPDATE;
+    }
+//------------------------------------------------------------------------------
+
+#endif // FEATURE_SAFETY_RECORD || FEATURE_SAFETY_RECORD_REPLAY
@@ -0,0 +1,220 @@
+/*******************************************************************************
+ * Copyright (c) 2026 TWK-ELEKTRONIK GmbH. All rights reserved.
+ ******************************************************************************/
+
+/**
+ * \defgroup safety_record Aufzeichnung der Versorgungsspannungsüberwachung
+ * \ingroup safety_utils
+ * Aufzeichnung und Wiedergabe der Eingangswerte von Safety_Powersupply_Check().
+ *
+ * Mit @ref FEATURE_SAFETY_RECORD zeichnet das Gerät pro Sicherheitszyklus die
+ * Rohwerte des internen ADC, die Werte des TMP144 und die Werte der externen
+ * ADCs MAX116XX mit dem Zeitstempel des Zyklus in einem Ringpuffer im RAM auf.
+ * Ist der Puffer voll, werden die ältesten Zyklen verworfen, der Puffer enthält
+ * damit immer die Vorgeschichte des letzten Zyklus. Ein Zyklus, der mit einem
+ * Hard-Error endet, ist bereits vollständig im Puffer.
+ *
+ * Mit @ref FEATURE_SAFETY_RECORD_REPLAY liest Safety_Powersupply_Check() die
+ * Eingangswerte nicht von den Treibern, sondern aus einer Aufzeichnung. Ein
+ * Wiedergabeprogramm auf dem Host (tools/safety_replay.c) führt damit die
+ * unveränderte Überwachung mit den Werten aus dem Feld aus. Die Firmware-
+ * Konfiguration (Kanäle, Grenzwerte, Filter) muss der des Geräts entsprechen.
+ *
+ * Format der Aufzeichnung, alle Werte little endian:
+ *
+ *  | Eintrag      | Aufbau                                                     |
+ *  |:-------------|:-----------------------------------------------------------|
+ *  | Kopf         | "SPRT", U8 Version, U8 Ticks/ms, U16 Konfiguration, U32 Start-Ticks, U32 verworfene Zyklen |
+ *  | Zyklus       | Kennung 0x10, U16 Länge der folgenden Werte, U32 Ticks     |
+ *  | ADC          | Kennung 0x2r, U8 Kanal (SYSPWR_CHANNEL), F32 Spannung wenn r = 1 |
+ *  | TMP144       | Kennung 0x3r, F32 Temperatur wenn r = 1                    |
+ *  | MAX116XX neu | Kennung 0x4r                                               |
+ *  | MAX116XX     | Kennung 0x5r, U8 ADC * 16 + Kanal, F32 Spannung wenn r = 1 |
+ *
+ * r ist das Ergebnis des Treiberaufrufs (1 = Wert gültig). Ein Zyklus mit
+ * ADC-Strom und -Spannung belegt damit 19 Bytes.
+ *
+ * Während der Aufzeichnung liest eine Task niedrigerer Priorität die neuen
+ * Zyklen mit Safety_Record_Read() aus, z.B. zur Übertragung an den Host. Der
+ * Strom besteht aus dem Kopf von Safety_Record_GetHeader() und den gelesenen
+ * Zyklen. Zyklen, die vor dem Lesen überschrieben wurden, zählt
+ * Safety_Record_GetOverflows().
+ *
+ * Aufgezeichnet wird nur die Standardinstanz der Versorgungsspannungsüberwachung.
+ * @{
+ */
+#ifndef GLOBAL_SAFETY_SAFETY_RECORD_H_
+#define GLOBAL_SAFETY_SAFETY_RECORD_H_
+
+// Gemeinsame Headerdateien einbinden ---------------------------------------
+
+// Spezielle Headerdateien einbinden ----------------------------------------
+#include "safety_powersupply.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// Compiler Direktiven ------------------------------------------------------
+
+#ifndef FEATURE_SAFETY_RECORD
+/// \ingroup feature_flags
+/// Feature flag activating the recording of the inputs of the power supply
+/// monitoring into a ring buffer in RAM. Deactivated by default.
+#define FEATURE_SAFETY_RECORD           (0)
+#endif
+
+#ifndef FEATURE_SAFETY_RECORD_REPLAY
+/// \ingroup feature_flags
+/// Feature flag for host builds only: the power supply monitoring reads its
+/// inputs from a recording instead of the drivers. Deactivated by default.
+#define FEATURE_SAFETY_RECORD_REPLAY    (0)
+#endif
+
+#if FEATURE_SAFETY_RECORD && FEATURE_SAFETY_RECORD_REPLAY
+#error "FEATURE_SAFETY_RECORD and FEATURE_SAFETY_RECORD_REPLAY cannot be used together"
+#endif
+
+// Makros -------------------------------------------------------------------
+
+#ifndef SAFETY_RECORD_BUFFER_SIZE
+/// Size of the ring buffer in bytes, has to be a power of two.
+#define SAFETY_RECORD_BUFFER_SIZE       (4096u)
+#endif
+
+#if (SAFETY_RECORD_BUFFER_SIZE < 64u) || ((SAFETY_RECORD_BUFFER_SIZE & (SAFETY_RECORD_BUFFER_SIZE - 1u)) != 0u)
+#error "SAFETY_RECORD_BUFFER_SIZE must be a power of two and at least 64"
+#endif
+
+/// Size of the header of an exported recording in bytes.
+#define SAFETY_RECORD_HEADER_SIZE       (16u)
+
+/// Version of the recording format.
+#define SAFETY_RECORD_VERSION           (1u)
+
+// externe Variablen --------------------------------------------------------
+
+// Allgemeine Definitionen --------------------------------------------------
+
+/// Recorded inputs, the value is the identifier in the recording.
+typedef enum
+{
+    eSAFETY_RECORD_INPUT_ADC = 2,               //!< ADC_SampleSingleChannel(), index is the SYSPWR_CHANNEL
+    eSAFETY_RECORD_INPUT_TMP144 = 3,            //!< TMP144_TemperatureValuePeek()
+    eSAFETY_RECORD_INPUT_EXT_ADC_UPDATE = 4,    //!< New values of the external ADCs available
+    eSAFETY_RECORD_INPUT_EXT_ADC_VALUE = 5,     //!< Value of the external ADCs, index is ADC * 16 + channel
+} SAFETY_RECORD_INPUT;
+
+/// Header of a recording.
+typedef struct
+{
+    SAFETY_POWERSUPPLY_CONFIG config;   ///< Channel configuration at the start of the recording
+    U32 startTicks;                     ///< Ticks at the initialization of the power supply monitoring
+    U32 droppedCycles;                  ///< Cycles overwritten in the ring buffer before the first recorded cycle
+    U8 ticksPerMs;                      ///< Ticks per millisecond of the recording device
+} SAFETY_RECORD_HEADER;
+
+// Prototypen ---------------------------------------------------------------
+
+#if FEATURE_SAFETY_RECORD
+
+/// Starts a new recording, the ring buffer is cleared.
+/// Called by the initialization of the power supply monitoring.
+/// \param config Channel configuration.
+/// \param ticks Current ticks.
+extern void Safety_Record_Start(SAFETY_POWERSUPPLY_CONFIG const * const config, U32 const ticks);
+
+/// Stops the recording after the current cycle, e.g. to keep the history of an
+/// error. The recording is not restarted until Safety_Record_Start().
+extern void Safety_Record_Stop(void);
+
+/// Starts the recording of a cycle of Safety_Powersupply_Check().
+/// \param ticks Ticks of the cycle.
+extern void Safety_Record_BeginCycle(U32 const ticks);
+
+/// Completes the recording of a cycle.
+extern void Safety_Record_EndCycle(void);
+
+/// Records an input of the current cycle.
+/// \param input Kind of the input.
+/// \param index Channel of the input, 0 if the input has no channel.
+/// \param result Result of the driver, the value is only recorded if true.
+/// \param value Value of the input.
+extern void Safety_Record_Input(SAFETY_RECORD_INPUT const input, U8 const index, bool const result, F32 const value);
+
+/// Returns the size of the recording for Safety_Record_Export().
+/// \return Size in bytes including the header.
+extern U32 Safety_Record_GetExportSize(void);
+
+/// Copies the recording with header, oldest cycle first.
+/// Call only while no cycle is recorded, i.e. after Safety_Record_Stop() and the
+/// end of the cycle, from the safety task or after the safety task halted in a
+/// hard error. An incomplete last cycle is exported up to its last input.
+/// \param destination Destination buffer.
+/// \param size Size of the destination buffer.
+/// \return Number of copied bytes, 0 if the buffer is too small.
+extern U32 Safety_Record_Export(U8 * const destination, U32 const size);
+
+/// Copies the header for a recording read with Safety_Record_Read(). The
+/// dropped cycles of the header are the overflows at the time of the call.
+/// \param destination Destination buffer.
+/// \param size Size of the destination buffer.
+/// \return Number of copied bytes, 0 if the buffer is too small.
+extern U32 Safety_Record_GetHeader(U8 * const destination, U32 const size);
+
+/// Copies the completed cycles recorded since the previous call, oldest cycle
+/// first. Only whole cycles are copied, the remaining cycles are returned by
+/// the next call. If cycles were overwritten before they were read, the copy
+/// continues with the oldest cycle in the ring buffer.
+/// Can be called during the recording from one task with a lower priority than
+/// the safety task. Returns 0 if the safety task overwrote the copied cycles in
+/// every attempt.
+/// \param destination Destination buffer.
+/// \param size Size of the destination buffer.
+/// \return Number of copied bytes.
+extern U32 Safety_Record_Read(U8 * const destination, U32 const size);
+
+/// Returns the number of cycles overwritten before Safety_Record_Read() read
+/// them since Safety_Record_Start().
+/// \return Number of lost cycles.
+extern U32 Safety_Record_GetOverflows(void);
+
+#endif // FEATURE_SAFETY_RECORD
+
+#if FEATURE_SAFETY_RECORD_REPLAY
+
+/// Starts the replay of a recording.
+/// \param data Recording with header, e.g. a memory-mapped file. Must stay valid during the replay.
+/// \param size Size of the recording in bytes.
+/// \param header Returns the header of the recording.
+/// \return true on success, false if the header is invalid.
+extern bool Safety_Record_ReplayStart(U8 const * const data, U32 const size, SAFETY_RECORD_HEADER * const header);
+
+/// Advances to the next recorded cycle.
+/// \param ticks Returns the ticks of the cycle.
+/// \return true if a complete cycle is available, false at the end of the recording.
+extern bool Safety_Record_ReplayNextCycle(U32 * const ticks);
+
+/// Returns the next recorded input of the current cycle.
+/// \param input Expected kind of the input.
+/// \param index Expected channel of the input.
+/// \param value Returns the recorded value if the result is true.
+/// \return Recorded result of the driver, false if the recording does not match.
+extern bool Safety_Record_ReplayInput(SAFETY_RECORD_INPUT const input, U8 const index, F32 * const value);
+
+/// Returns the number of inputs that did not match the recording, e.g. because
+/// the configuration of the replay differs from the recording device.
+/// \return Number of mismatches since Safety_Record_ReplayStart().
+extern U32 Safety_Record_ReplayGetMismatches(void);
+
+#endif // FEATURE_SAFETY_RECORD_REPLAY
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GLOBAL_SAFETY_SAFETY_RECORD_H_ */
+/**
+ * @}
+ */
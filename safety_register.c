@@ -0,0 +1,212 @@
+/*******************************************************************************
+ * Copyright (c) 2026 TWK-ELEKTRONIK GmbH. All rights reserved.
+ ******************************************************************************/
+
+// Gemeinsame Headerdateien einbinden --------------------------------------
+#include "config/version.h"
+
+#include "RTOS_AL/RTOS_AL.h"
+
+#include "error_def.h"
+
+#include "safety_runtime.h"
+#include "safety_register.h"
+
+#if FEATURE_SAFETYCHECK_RUNTIME && FEATURE_SAFETYCHECK_RUNTIME_REGISTER_SHADOW
+// Compiler Direktiven -----------------------------------------------------
+
+// Makros ------------------------------------------------------------------
+
+/// Time for one pass over all blocks in ticks.
+#define REGISTER_PASS_TIME_TICKS    ((U32) SAFETY_REGISTER_PASS_TIME_MS * configTICK_RATE_HZ_MS)
+
+/// Start value of the CRC32.
+#define REGISTER_CRC_INIT           (0xFFFFFFFFu)
+
+// Allgemeine Definitionen -------------------------------------------------
+
+// externe Variablen -------------------------------------------------------
+
+/// CRC32 (IEEE 802.3, reflektiert) Tabelle für die Berechnung pro Nibble.
+static U32 const crcNibbleTable[16] =
+    {
+    0x00000000u, 0x1DB71064u, 0x3B6E20C8u, 0x26D930ACu,
+    0x76DC4190u, 0x6B6B51F4u, 0x4DB26158u, 0x5005713Cu,
+    0xEDB88320u, 0xF00F9344u, 0xD6D6A3E8u, 0xCB61B38Cu,
+    0x9B64C2B0u, 0x86D3D2D4u, 0xA00AE278u, 0xBDBDF21Cu
+    };
+
+/// Registered register blocks.
+static SAFETY_REGISTER_BLOCK blocks[SAFETY_REGISTER_BLOCKS_MAX];
+
+/// Expected CRC of each register block.
+static U32 expectedCrc[SAFETY_REGISTER_BLOCKS_MAX];
+
+/// Number of allocated block slots.
+static volatile U32 allocatedBlockCount = 0;
+
+/// Set for each completely registered block.
+static volatile bool blockValid[SAFETY_REGISTER_BLOCKS_MAX];
+
+/// Next block to check.
+static U32 nextBlock = 0;
+
+/// Number of blocks checked in the current pass.
+static U32 checkedInPass = 0;
+
+/// Start of the current pass in ticks.
+static U32 passStartTicks = 0;
+
+/// Set with the first check.
+static bool passStarted = false;
+
+// Funktionsbereich --------------------------------------------------------
+
+/// Calculates the CRC32 over masked register values.
+/// \param values Register values, either the registers or their configured values.
+/// \param count Number of values.
+/// \param mask Mask applied to every value.
+/// \return CRC32 of the values.
+static U32 Safety_Register_CalculateCrc(U32 const volatile * const values, U16 const count, U32 const mask);
+
+bool Safety_Register_AddBlock(SAFETY_REGISTER_BLOCK const * const block, SAFETY_REGISTER_ID * const id)
+    {
+    U32 slot;
+
+    if((block == NULL) || (id == NULL) || (block->address == NULL) || (block->expected == NULL) || (block->count == 0u))
+        {
+        return false;
+        }
+
+    // Slot lock-free reservieren, Registrierung kann aus mehreren Tasks erfolgen
+    slot = __atomic_fetch_add(&allocatedBlockCount, 1u, __ATOMIC_RELAXED);
+    if(slot >= SAFETY_REGISTER_BLOCKS_MAX)
+        {
+        return false;
+        }
+
+    // Sollwert aus der Konfiguration des Treibers, nicht aus den Registern. Eine
+    // bereits bei der Anmeldung fehlerhafte Konfiguration wird so erkannt.
+    blocks[slot] = *block;
+    expectedCrc[slot] = Safety_Register_CalculateCrc(block->expected, block->count, block->mask);
+
+    // Block erst nach vollständiger Initialisierung für die Prüfung freigeben
+    __atomic_store_n(&blockValid[slot], true, __ATOMIC_RELEASE);
+
+    *id = (SAFETY_REGISTER_ID) slot;
+    return true;
+    }
+//------------------------------------------------------------------------------
+
+bool Safety_Register_UpdateBlock(SAFETY_REGISTER_ID const id, U32 const * const expected)
+    {
+    if((id >= SAFETY_REGISTER_BLOCKS_MAX) || (expected == NULL) || !__atomic_load_n(&blockValid[id], __ATOMIC_ACQUIRE))
+        {
+        return false;
+        }
+
+    blocks[id].expected = expected;
+    expectedCrc[id] = Safety_Register_CalculateCrc(expected, blocks[id].count, blocks[id].mask);
+    return true;
+    }
+//------------------------------------------------------------------------------
+
+bool Safety_Register_Check(U32 const currentTicks)
+    {
+    U32 count = __atomic_load_n(&allocatedBlockCount, __ATOMIC_RELAXED);
+    U32 elapsed;
+    U32 target;
+    U32 todo;
+
+    if(count > SAFETY_REGISTER_BLOCKS_MAX)
+        {
+        count = SAFETY_REGISTER_BLOCKS_MAX;
+        }
+
+    if(count == 0u)
+        {
+        return true;
+        }
+
+    if(!passStarted)
+        {
+        passStarted = true;
+        passStartTicks = currentTicks;
+        }
+
+    // Anzahl der Blöcke, die bis jetzt im Durchlauf geprüft sein müssen, damit
+    // der Durchlauf spätestens nach REGISTER_PASS_TIME_TICKS abgeschlossen ist
+    elapsed = currentTicks - passStartTicks;
+    if(elapsed >= REGISTER_PASS_TIME_TICKS)
+        {
+        target = count;
+        }
+    else
+        {
+        target = ((count * elapsed) + REGISTER_PASS_TIME_TICKS - 1u) / REGISTER_PASS_TIME_TICKS;
+        }
+
+    todo = (target > checkedInPass) ? (target - checkedInPass) : 0u;
+    if(todo < SAFETY_REGISTER_BLOCKS_PER_CYCLE)
+        {
+        todo = SAFETY_REGISTER_BLOCKS_PER_CYCLE;
+        }
+    if(todo > count)
+        {
+        todo = count;
+        }
+
+    while(todo > 0u)
+        {
+        if(nextBlock >= count)
+            {
+            nextBlock = 0u;
+            }
+
+        // Noch nicht vollständig angemeldete Blöcke überspringen
+        if(__atomic_load_n(&blockValid[nextBlock], __ATOMIC_ACQUIRE)
+                && (Safety_Register_CalculateCrc(blocks[nextBlock].address, blocks[nextBlock].count, blocks[nextBlock].mask)
+                    != expectedCrc[nextBlock]))
+            {
+            return false;
+            }
+
+        nextBlock++;
+        checkedInPass++;
+        todo--;
+
+        if(checkedInPass >= count)
+            {
+            // Durchlauf abgeschlossen, nächster Durchlauf beginnt
+            checkedInPass = 0u;
+            passStartTicks = currentTicks;
+            }
+        }
+
+    return true;
+    }
+//------------------------------------------------------------------------------
+
+static U32 Safety_Register_CalculateCrc(U32 const volatile * const values, U16 const count, U32 const mask)
+    {
+    U32 crc = REGISTER_CRC_INIT;
+    U32 value;
+    U16 i;
+    U8 nibble;
+
+    for(i = 0; i < count; i++)
+        {
+        value = values[i] & mask;
+
+        for(nibble = 0; nibble < 8u; nibble++)
+            {
+            crc = (crc >> 4) ^ crcNibbleTable[(crc ^ value) & 0x0Fu];
+            value >>= 4;
+            }
+        }
+
+    return ~crc;
+    }
+//------------------------------------------------------------------------------
+
+#endif // FEATURE_SAFETYCHECK_RUNTIME && FEATURE_SAFETYCHECK_RUNTIME_REGISTER_SHADOW
@@ -0,0 +1,130 @@
+/*******************************************************************************
+ * Copyright (c) 2026 TWK-ELEKTRONIK GmbH. All rights reserved.
+ ******************************************************************************/
+
+/**
+ * \defgroup safety_register Registerüberwachung
+ * \ingroup safety_utils
+ * Zyklische Überwachung der Konfigurationsregister von Hardwaretreibern.
+ *
+ * Die Treiber melden ihre Registerblöcke einmalig mit Safety_Register_AddBlock()
+ * an. Dabei wird für jeden Block eine CRC32 über die maskierten Werte aus der
+ * Konfigurationstabelle des Treibers als Sollwert abgelegt. Zur Laufzeit wird
+ * nur die CRC32 der Register berechnet, auch eine schon bei der Konfiguration
+ * fehlerhaft übernommene Einstellung wird damit erkannt.
+ *
+ * Die Sicherheitstask prüft in jedem Zyklus nur einen Teil der Blöcke im
+ * Round-Robin-Verfahren, mindestens \ref SAFETY_REGISTER_BLOCKS_PER_CYCLE.
+ * Die Anzahl der Blöcke pro Zyklus wird zusätzlich so erhöht, dass alle Blöcke
+ * innerhalb von \ref SAFETY_REGISTER_PASS_TIME_MS geprüft sind. Damit ist die
+ * vollständige Abdeckung innerhalb der Process Safety Time sichergestellt und
+ * die Laufzeit pro Zyklus bleibt begrenzt.
+ *
+ * Eine Abweichung führt zum Hard-Error HARD_ERR_INTERN_CHECK_REGISTER_CYCLIC.
+ * @{
+ */
+#ifndef GLOBAL_SAFETY_SAFETY_REGISTER_H_
+#define GLOBAL_SAFETY_SAFETY_REGISTER_H_
+
+// Gemeinsame Headerdateien einbinden ---------------------------------------
+
+// Spezielle Headerdateien einbinden ----------------------------------------
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// Compiler Direktiven ------------------------------------------------------
+
+#ifndef FEATURE_SAFETYCHECK_RUNTIME_REGISTER_SHADOW
+/// \ingroup feature_flags
+/// Feature flag activating the incremental CRC based monitoring of hardware
+/// configuration registers. The monitoring is deactivated by default.
+#define FEATURE_SAFETYCHECK_RUNTIME_REGISTER_SHADOW (0)
+#endif
+
+#if FEATURE_SAFETYCHECK_RUNTIME_REGISTER_SHADOW
+
+#ifndef HARD_ERR_INTERN_CHECK_REGISTER_CYCLIC
+#define HARD_ERR_INTERN_CHECK_REGISTER_CYCLIC   0x52 // SOFTQM-648
+#endif
+
+// Makros -------------------------------------------------------------------
+
+/// Maximum number of register blocks.
+#ifndef SAFETY_REGISTER_BLOCKS_MAX
+#define SAFETY_REGISTER_BLOCKS_MAX              (16u)
+#endif
+
+/// Minimum number of register blocks checked per cycle of the safety task.
+#ifndef SAFETY_REGISTER_BLOCKS_PER_CYCLE
+#define SAFETY_REGISTER_BLOCKS_PER_CYCLE        (1u)
+#endif
+
+/// Maximum time in ms for one pass over all register blocks. Half of the
+/// Process Safety Time by default, so that a corrupted register is detected
+/// within the PST.
+#ifndef SAFETY_REGISTER_PASS_TIME_MS
+#define SAFETY_REGISTER_PASS_TIME_MS            (PROCESS_SAFETY_TIME_MS / 2u)
+#endif
+
+#if (SAFETY_REGISTER_BLOCKS_MAX > 255u) || (SAFETY_REGISTER_BLOCKS_MAX == 0u)
+#error "SAFETY_REGISTER_BLOCKS_MAX must be in the range 1..255"
+#endif
+
+#if SAFETY_REGISTER_BLOCKS_PER_CYCLE == 0u
+#error "SAFETY_REGISTER_BLOCKS_PER_CYCLE must be at least 1"
+#endif
+
+// externe Variablen --------------------------------------------------------
+
+// Allgemeine Definitionen --------------------------------------------------
+
+/// Definition of a block of consecutive 32 bit configuration registers.
+typedef struct
+{
+    U32 const volatile * address;   ///< Address of the first register
+    U32 const * expected;           ///< Configured values of the registers, e.g. the configuration table of the driver. Has to stay valid.
+    U16 count;                      ///< Number of registers in the block
+    U32 mask;                       ///< Mask of the monitored bits, applied to every register of the block. Status bits have to be masked out.
+} SAFETY_REGISTER_BLOCK;
+
+/// Handle of a registered register block.
+typedef U8 SAFETY_REGISTER_ID;
+
+// Prototypen ---------------------------------------------------------------
+
+/// Registers a block of configuration registers. The CRC of the configured
+/// values in SAFETY_REGISTER_BLOCK::expected is stored as expected value, the
+/// registers themselves are only read by the check. Registration is possible
+/// from any task.
+/// \param block Definition of the register block, it is copied.
+/// \param id Returns the handle of the block.
+/// \return true on success, false if no block is left or the block is invalid.
+extern bool Safety_Register_AddBlock(SAFETY_REGISTER_BLOCK const * const block, SAFETY_REGISTER_ID * const id);
+
+/// Sets new configured values of a block as expected value.
+/// Has to be called by the driver with an intended reconfiguration of the hardware.
+/// \note The update must not be interrupted by the safety task, e.g. it has to
+///       be done in a critical section together with the reconfiguration.
+/// \param id Handle of the block returned by Safety_Register_AddBlock().
+/// \param expected New configured values of the registers, has to stay valid.
+/// \return true on success, false if the handle or the values are invalid.
+extern bool Safety_Register_UpdateBlock(SAFETY_REGISTER_ID const id, U32 const * const expected);
+
+/// Checks the next slice of register blocks. Called by the safety task in every cycle.
+/// \param currentTicks Current time in system ticks.
+/// \return true if all checked blocks match their expected value, otherwise false.
+extern bool Safety_Register_Check(U32 const currentTicks);
+
+#endif // FEATURE_SAFETYCHECK_RUNTIME_REGISTER_SHADOW
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GLOBAL_SAFETY_SAFETY_REGISTER_H_ */
+/**
+ * @}
+ */
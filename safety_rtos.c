@@ -15,8 +15,13 @@
 #include "safety_runtime.h"
 
 #include "safety_rtos.h"
+#include "safety_event.h"
 #include "WATCHDOG/WATCHDOG_Driver.h"
 
+#if FEATURE_SAFETY_TASK_STATISTICS && FEAT_MSG_INTERPRETER
+#include "Factory_Device_Communication/msg_interpreter.h"
+#endif
+
 #if FEAT_RTOS
 // Allgemeine Definitionen -------------------------------------------------
 
@@ -24,12 +29,60 @@
 #define SAFETYTASK_STACKSIZE  (RTOS_MINIMAL_STACKSIZE * 4)
 #endif
 
+#if FEATURE_SAFETY_EVENT_QUEUE && FEATURE_SAFETY_EVENT_TASK
+#ifndef SAFETYEVENTTASK_STACKSIZE
+#define SAFETYEVENTTASK_STACKSIZE  (RTOS_MINIMAL_STACKSIZE * 2)
+#endif
+#endif
+
 // externe Variablen -------------------------------------------------------
 
 static volatile U32 safetyTaskRestart;
 
 // interne Variablen -------------------------------------------------------
 RTOS_TASK_STRUCT(safetyTask, SAFETYTASK_STACKSIZE)
+#if FEATURE_SAFETY_EVENT_QUEUE && FEATURE_SAFETY_EVENT_TASK
+RTOS_TASK_STRUCT(safetyEventTask, SAFETYEVENTTASK_STACKSIZE)
+#endif
+
+#if FEATURE_SAFETY_TASK_STATISTICS
+/// Load window in timestamp units
+#define SAFETY_TASK_STAT_LOAD_WINDOW    ((U32) SAFETY_TASK_STAT_LOAD_WINDOW_MS * configTICK_RATE_HZ_MS * SAFETY_TASK_STAT_TIMESTAMP_PER_TICK)
+
+/// Number of attempts to take a consistent copy of the statistics
+#define SAFETY_TASK_STAT_READ_RETRIES   (3u)
+
+/// Statistics of the safety task, only written by the safety task
+static SAFETY_TASK_STATISTICS taskStatistics;
+
+/// Sequence counter for consistent reading of the statistics, odd while updating
+static volatile U32 taskStatisticsSequence = 0;
+
+/// Reset request of the statistics
+static volatile U32 taskStatisticsResetRequest = FALSE;
+
+/// Accumulated execution time in the current load window
+static U32 loadBusyTime = 0;
+
+/// Elapsed time in the current load window
+static U32 loadElapsedTime = 0;
+
+#if FEAT_MSG_INTERPRETER
+static T_RAM_VAR_ENTRY cpuLoadRamVar;
+static T_RAM_VAR_ENTRY overrunsRamVar;
+static T_RAM_VAR_ENTRY maxExecutionTimeRamVar;
+static T_RAM_VAR_ENTRY maxJitterRamVar;
+static T_RAM_VAR_ENTRY jitterHistogramRamVar;
+#endif
+
+/// Updates the statistics after one cycle of the safety task.
+/// \param executionTime Duration of Safety_Runtime_Execute().
+/// \param period Time since the previous wake-up, 0 if unknown.
+/// \param expectedPeriod Time between the previous wake-up and the RTOS_DelayUntil() target.
+/// \param taskDelay Nominal task delay in timestamp units.
+static void Safety_Task_UpdateStatistics(U32 const executionTime, U32 const period,
+                                         U32 const expectedPeriod, U32 const taskDelay);
+#endif
 
 // Funktionsbereich --------------------------------------------------------
 #if FEATURE_SAFETYCHECK_RUNTIME
@@ -37,7 +90,14 @@ RTOS_TASK_STRUCT(safetyTask, SAFETYTASK_STACKSIZE)
 /// @author m.neubauer @date 30.05.2016
 void Safety_Task(TASK_PARA_STD * const tParam)
     {
-    RTOS_TIME xLastWakeTime;
+    RTOS_TIME xLastWakeTime = 0;
+#if FEATURE_SAFETY_TASK_STATISTICS
+    U32 wakeTimestamp;
+    U32 wakeTicks;
+    U32 previousWakeTimestamp = 0;
+    U32 previousWakeTicks = 0;
+    bool previousWakeValid = false;
+#endif
 
     safetyTaskRestart = TRUE;
 
@@ -59,17 +119,44 @@ void Safety_Task(TASK_PARA_STD * const tParam)
             {
             xLastWakeTime = RTOS_GetTime();
             safetyTaskRestart = FALSE;
+#if FEATURE_SAFETY_TASK_STATISTICS
+            // Nach einem Neustart ist der Abstand zum vorherigen Aufruf nicht aussagekräftig
+            previousWakeValid = false;
+#endif
             }
 
+#if FEATURE_SAFETY_TASK_STATISTICS
+        wakeTimestamp = SAFETY_TASK_STAT_TIMESTAMP();
+        wakeTicks = RTOS_GetTime();
+#endif
+
         Safety_Runtime_Execute();
 
+#if FEATURE_SAFETY_TASK_STATISTICS
+        // Abweichung des Aufrufs vom Weckzeitpunkt aus RTOS_DelayUntil() bestimmen.
+        // xLastWakeTime enthält das Ziel des vorherigen Aufrufs von RTOS_DelayUntil().
+        Safety_Task_UpdateStatistics(SAFETY_TASK_STAT_TIMESTAMP() - wakeTimestamp,
+                                     previousWakeValid ? (wakeTimestamp - previousWakeTimestamp) : 0,
+                                     (xLastWakeTime - previousWakeTicks) * SAFETY_TASK_STAT_TIMESTAMP_PER_TICK,
+                                     tParam->taskDelay * SAFETY_TASK_STAT_TIMESTAMP_PER_TICK);
+        previousWakeTimestamp = wakeTimestamp;
+        previousWakeTicks = wakeTicks;
+        previousWakeValid = true;
+#endif
+
 #if FEAT_DEBUG
 #ifdef fpSafetyTask
         PORT_WRITE(fpSafetyTask, GPIO_LOW);
 #endif
 #endif
         // Ende der Sicherheitstaskueberwachung
+#if FEATURE_SAFETYCHECK_RUNTIME_TICKLESS
+        // Ereignisgesteuerter Betrieb: bis zur nächsten fälligen Sicherheitsfunktion schlafen
+        xLastWakeTime = RTOS_GetTime();
+        RTOS_DelayUntil(&xLastWakeTime, Safety_Runtime_GetNextWakeupTicks(xLastWakeTime) - xLastWakeTime);
+#else
         RTOS_DelayUntil(&xLastWakeTime, tParam->taskDelay);
+#endif
 
 #if FEAT_DEBUG
 #ifdef fpSafetyTask
@@ -82,9 +169,36 @@ void Safety_Task(TASK_PARA_STD * const tParam)
 //------------------------------------------------------------------------------
 #endif
 
+#if FEATURE_SAFETY_EVENT_QUEUE && FEATURE_SAFETY_EVENT_TASK
+/// Forwarding task of the event ring buffer. Runs with a lower priority than
+/// the safety task, so the event system does not delay the safety functions.
+/// \param param Unused.
+static void Safety_Event_Task(void * const param)
+    {
+    RTOS_TIME xLastWakeTime = RTOS_GetTime();
+
+    (void) param;
+
+    while(TRUE)
+        {
+        (void) Safety_Event_Process(SAFETY_EVENT_PROCESS_MAX_EVENTS);
+        RTOS_DelayUntil(&xLastWakeTime, SAFETY_EVENT_TASK_PERIOD_MS * configTICK_RATE_HZ_MS);
+        }
+    }
+//------------------------------------------------------------------------------
+#endif
+
 /// @author m.neubauer @date 30.05.2016
 U32 Safety_Task_Init(TASK_PARA_STD * const tParam)
     {
+#if FEATURE_SAFETY_EVENT_QUEUE && FEATURE_SAFETY_EVENT_TASK
+    // Weiterleitung mit gleicher oder höherer Priorität würde die Sicherheitstask verzögern
+    if(SAFETY_EVENT_TASK_PRIORITY >= tParam->ucPrioritaet)
+        {
+        return FALSE;
+        }
+#endif
+
 #if FEATURE_SAFETYCHECK_RUNTIME
     if(!Safety_Runtime_Startup(tParam))
         {
@@ -92,11 +206,34 @@ U32 Safety_Task_Init(TASK_PARA_STD * const tParam)
         }
 #endif
 
+#if FEATURE_SAFETY_TASK_STATISTICS && FEAT_MSG_INTERPRETER
+    if(!MsgIntp_CreateRamVar(&cpuLoadRamVar, "Safety task: CPU load (0.1 %)", 0,
+                             sizeof(taskStatistics.cpuLoadPermille), &taskStatistics.cpuLoadPermille)
+            || !MsgIntp_CreateRamVar(&overrunsRamVar, "Safety task: Overruns", 0,
+                                     sizeof(taskStatistics.overruns), &taskStatistics.overruns)
+            || !MsgIntp_CreateRamVar(&maxExecutionTimeRamVar, "Safety task: Max. execution time", 0,
+                                     sizeof(taskStatistics.maxExecutionTime), &taskStatistics.maxExecutionTime)
+            || !MsgIntp_CreateRamVar(&maxJitterRamVar, "Safety task: Max. jitter", 0,
+                                     sizeof(taskStatistics.maxJitter), &taskStatistics.maxJitter)
+            || !MsgIntp_CreateRamVar(&jitterHistogramRamVar, "Safety task: Jitter histogram", 0,
+                                     sizeof(taskStatistics.jitterHistogram), taskStatistics.jitterHistogram))
+        {
+        return FALSE;
+        }
+#endif
+
     if(!RTOS_TaskCreate(&safetyTask, "Safety", (RTOS_TASK_FUNCTION)Safety_Task, tParam->ucPrioritaet, tParam))
         {
         return FALSE;
         }
 
+#if FEATURE_SAFETY_EVENT_QUEUE && FEATURE_SAFETY_EVENT_TASK
+    if(!RTOS_TaskCreate(&safetyEventTask, "SafetyEvent", Safety_Event_Task, SAFETY_EVENT_TASK_PRIORITY, NULL))
+        {
+        return FALSE;
+        }
+#endif
+
     return TRUE;
     }
 //------------------------------------------------------------------------------
@@ -108,4 +245,108 @@ void Safety_Restart(void)
     }
 //------------------------------------------------------------------------------
 
+#if FEATURE_SAFETY_TASK_STATISTICS
+bool Safety_Task_GetLoadStatistics(SAFETY_TASK_STATISTICS * const statistics)
+    {
+    U32 sequence;
+    U32 retries;
+
+    if(statistics == NULL)
+        {
+        return false;
+        }
+
+    for(retries = 0; retries < SAFETY_TASK_STAT_READ_RETRIES; retries++)
+        {
+        sequence = __atomic_load_n(&taskStatisticsSequence, __ATOMIC_ACQUIRE);
+
+        // Ungerader Zähler: Safety-Task aktualisiert gerade
+        if((sequence & 1u) == 0u)
+            {
+            *statistics = taskStatistics;
+            __atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+            if(sequence == taskStatisticsSequence)
+                {
+                return true;
+                }
+            }
+        }
+
+    return false;
+    }
+//------------------------------------------------------------------------------
+
+void Safety_Task_ResetLoadStatistics(void)
+    {
+    taskStatisticsResetRequest = TRUE;
+    }
+//------------------------------------------------------------------------------
+
+static void Safety_Task_UpdateStatistics(U32 const executionTime, U32 const period,
+                                         U32 const expectedPeriod, U32 const taskDelay)
+    {
+    U32 jitter;
+    U32 bucket;
+
+    __atomic_store_n(&taskStatisticsSequence, taskStatisticsSequence + 1u, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    if(taskStatisticsResetRequest)
+        {
+        taskStatisticsResetRequest = FALSE;
+        taskStatistics = (SAFETY_TASK_STATISTICS) {0};
+        loadBusyTime = 0;
+        loadElapsedTime = 0;
+        }
+
+    taskStatistics.cycles++;
+    taskStatistics.lastExecutionTime = executionTime;
+
+    if(executionTime > taskStatistics.maxExecutionTime)
+        {
+        taskStatistics.maxExecutionTime = executionTime;
+        }
+
+    // Laufzeit länger als die Zykluszeit der Task
+    if(executionTime > taskDelay)
+        {
+        taskStatistics.overruns++;
+        }
+
+    if(period != 0)
+        {
+        // Abweichung vom Weckzeitpunkt, Betrag der Differenz
+        jitter = (period > expectedPeriod) ? (period - expectedPeriod) : (expectedPeriod - period);
+
+        if(jitter > taskStatistics.maxJitter)
+            {
+            taskStatistics.maxJitter = jitter;
+            }
+
+        bucket = jitter / SAFETY_TASK_STAT_JITTER_BUCKET_WIDTH;
+        if(bucket >= SAFETY_TASK_STAT_JITTER_BUCKETS)
+            {
+            bucket = SAFETY_TASK_STAT_JITTER_BUCKETS - 1u;
+            }
+        taskStatistics.jitterHistogram[bucket]++;
+
+        // Rollierende CPU-Last über das Lastfenster
+        loadBusyTime += (executionTime < period) ? executionTime : period;
+        loadElapsedTime += period;
+
+        if(loadElapsedTime >= SAFETY_TASK_STAT_LOAD_WINDOW)
+            {
+            taskStatistics.cpuLoadPermille = (U32) (((U64) loadBusyTime * 1000u) / loadElapsedTime);
+            loadBusyTime = 0;
+            loadElapsedTime = 0;
+            }
+        }
+
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    __atomic_store_n(&taskStatisticsSequence, taskStatisticsSequence + 1u, __ATOMIC_RELAXED);
+    }
+//------------------------------------------------------------------------------
+#endif // FEATURE_SAFETY_TASK_STATISTICS
+
 #endif
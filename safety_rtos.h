@@ -20,12 +20,62 @@ extern "C"
 
 // Compiler Direktiven ------------------------------------------------------
 #if FEAT_RTOS
+
+#ifndef FEATURE_SAFETY_TASK_STATISTICS
+/// \ingroup feature_flags
+/// Feature flag activating the CPU load and period jitter accounting of the safety task.
+/// The accounting is deactivated by default.
+#define FEATURE_SAFETY_TASK_STATISTICS          (0)
+#endif
+
 // Makros -------------------------------------------------------------------
 
+#if FEATURE_SAFETY_TASK_STATISTICS
+#ifndef SAFETY_TASK_STAT_TIMESTAMP
+/// Timestamp source of the statistics. Can be replaced by a high resolution
+/// counter, e.g. the DWT cycle counter, together with
+/// \ref SAFETY_TASK_STAT_TIMESTAMP_PER_TICK.
+#define SAFETY_TASK_STAT_TIMESTAMP()            ((U32) RTOS_GetTime())
+/// Timestamp units per system tick.
+#define SAFETY_TASK_STAT_TIMESTAMP_PER_TICK     (1u)
+#endif
+
+#ifndef SAFETY_TASK_STAT_JITTER_BUCKETS
+/// Number of buckets of the jitter histogram. The last bucket counts all larger values.
+#define SAFETY_TASK_STAT_JITTER_BUCKETS         (8u)
+#endif
+
+#ifndef SAFETY_TASK_STAT_JITTER_BUCKET_WIDTH
+/// Width of one bucket of the jitter histogram in timestamp units.
+#define SAFETY_TASK_STAT_JITTER_BUCKET_WIDTH    (SAFETY_TASK_STAT_TIMESTAMP_PER_TICK)
+#endif
+
+#ifndef SAFETY_TASK_STAT_LOAD_WINDOW_MS
+/// Time window in ms over which the CPU load is calculated.
+#define SAFETY_TASK_STAT_LOAD_WINDOW_MS         (1000u)
+#endif
+#endif // FEATURE_SAFETY_TASK_STATISTICS
+
 // externe Variablen --------------------------------------------------------
 
 // Allgemeine Definitionen --------------------------------------------------
 
+#if FEATURE_SAFETY_TASK_STATISTICS
+/// Load and timing statistics of the safety task. All times are in timestamp
+/// units of \ref SAFETY_TASK_STAT_TIMESTAMP and include preemption by tasks
+/// and interrupts of higher priority.
+typedef struct
+{
+    U32 cycles;                 ///< Number of measured task cycles
+    U32 overruns;               ///< Cycles in which Safety_Runtime_Execute() ran longer than the task delay
+    U32 lastExecutionTime;      ///< Duration of the last Safety_Runtime_Execute()
+    U32 maxExecutionTime;       ///< Longest duration of Safety_Runtime_Execute()
+    U32 maxJitter;              ///< Largest deviation of a wake-up from the RTOS_DelayUntil() target
+    U32 cpuLoadPermille;        ///< CPU load of the safety task in 0.1 % over the last load window
+    U32 jitterHistogram[SAFETY_TASK_STAT_JITTER_BUCKETS];  ///< Histogram of the wake-up deviation
+} SAFETY_TASK_STATISTICS;
+#endif
+
 // Prototypen ---------------------------------------------------------------
 
 /// \ingroup tasklist
@@ -53,13 +103,27 @@ extern "C"
 /// Differenz nicht eindeutig bestimmt werden kann.
 extern void Safety_Task(TASK_PARA_STD * const tParam);
 
-/// Initialisierung der Sicherheitstask.
+/// Initialisierung der Sicherheitstask. Mit \ref FEATURE_SAFETY_EVENT_TASK wird
+/// zusätzlich die Task zur Weiterleitung der Ereignisse angelegt, deren Priorität
+/// \ref SAFETY_EVENT_TASK_PRIORITY unter der Priorität der Sicherheitstask liegen muss.
 extern U32 Safety_Task_Init(TASK_PARA_STD * const tParam);
 
 /// Neustart der Safetytask. Die Funktion setzt nach einer Unterbrechung der Task,
 /// z.B. waehrend des Abgleichs, die Zykluszeit zurueck.
 extern void Safety_Restart(void);
 
+#if FEATURE_SAFETY_TASK_STATISTICS
+/// Returns a consistent copy of the load and timing statistics of the safety task.
+/// \param statistics Destination of the copy.
+/// \return true on success, false if no consistent copy could be taken because
+///         the safety task updated the statistics concurrently.
+extern bool Safety_Task_GetLoadStatistics(SAFETY_TASK_STATISTICS * const statistics);
+
+/// Requests a reset of the statistics. The reset is done by the safety task in
+/// its next cycle.
+extern void Safety_Task_ResetLoadStatistics(void);
+#endif
+
 #endif
 
 #ifdef __cplusplus
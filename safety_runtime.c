@@ -34,6 +34,10 @@
 #endif
 
 #include "safety_runtime.h"
+#include "safety_checkpoint.h"
+#include "safety_register.h"
+#include "safety_event.h"
+#include "safety_trace.h"
 
 #if FEATURE_SAFETYCHECK_RUNTIME_PROGFLOW
 #ifdef FEATURE_SAFETY_RUNTIME_PROGFLOW_USE_RTC_M41T62
@@ -75,11 +79,146 @@ static U32 lastWdgTrigger = 0;
 
 #endif
 
+#if FEATURE_SAFETYCHECK_RUNTIME_TICKLESS
+/// Nominal cycle time of the safety task in ticks
+static U32 nominalTaskDelayTicks = 0;
+/// Largest interval between two calls of the cyclic STL tests in ticks
+static U32 stlMaxCallIntervalTicks = RTOS_MAX_TIMEOUT;
+/// Measurement period of the power supply monitoring in ticks
+static U32 measurementPeriodTicks = 0;
+/// Time at which the next measurement is due
+static U32 nextMeasurementTicks = 0;
+/// Time of the last execution of the runtime tests
+static U32 lastExecuteTicks = 0;
+/// Set until the time reference is taken with the first execution
+static bool firstExecute = true;
+/// Set for the execution in which a measurement cycle is due
+static bool measurementCycleDue = false;
+#if FEATURE_SAFETYCHECK_RUNTIME_PROGFLOW
+/// Time of the last RTC second event, written by the RTC callback
+static volatile U32 lastRtcSecondTicks = 0;
+#endif
+
+/// Shortens the delay until the next wake-up, if a function is due earlier.
+/// \param delay Delay until the next wake-up in ticks, updated by the function.
+/// \param currentTicks Current time in ticks.
+/// \param dueTicks Time at which the function is due.
+static void Safety_Runtime_LimitDelay(U32 * const delay, U32 const currentTicks, U32 const dueTicks);
+
+/// Takes the maximum call interval of a cyclic STL test into account.
+/// \param interval Maximum call interval of the test in ticks.
+/// \return false if the process safety time can not be met, otherwise true.
+static bool Safety_Runtime_LimitStlInterval(U32 const interval);
+#endif
+
+/// Registered table of runtime checks
+typedef struct
+{
+    SAFETY_RUNTIME_CHECK const * checks;    ///< Constant table of the checks
+    SAFETY_RUNTIME_CHECK_STATE * state;     ///< Runtime state of the checks
+    U8 count;                               ///< Number of checks in the table
+} SAFETY_RUNTIME_CHECK_TABLE;
+
+#if FEATURE_SAFETYCHECK_RUNTIME_RAM
+/// Cyclic RAM test as runtime check.
+/// \return true if the test passed, otherwise false.
+static bool Safety_Runtime_CheckRam(void);
+#endif
+
+#if FEATURE_SAFETYCHECK_RUNTIME_ROM
+/// Cyclic ROM test as runtime check.
+/// \return true if the test passed, otherwise false.
+static bool Safety_Runtime_CheckRom(void);
+#endif
+
+#if FEATURE_SAFETYCHECK_USE_STL && FEATURE_SAFETYCHECK_RUNTIME_CPU
+/// Cyclic CPU test as runtime check.
+/// \return true if the test passed, otherwise false.
+static bool Safety_Runtime_CheckCpu(void);
+#endif
+
+#if FEATURE_SAFETYCHECK_RUNTIME_POWERSUPPLY
+/// Power supply monitoring as runtime check. Limit violations are handled by the
+/// power supply monitoring itself.
+/// \return true if the monitoring ran or no measurement cycle was due, false if
+///         the monitoring is not initialized.
+static bool Safety_Runtime_CheckPowersupply(void);
+#endif
+
+#if FEATURE_SAFETYCHECK_RUNTIME_REGISTER_SHADOW
+/// Incremental check of the registered configuration register blocks as runtime check.
+/// \return true if all checked blocks match their expected value, otherwise false.
+static bool Safety_Runtime_CheckRegisterShadow(void);
+#endif
+
+/// Initializes the runtime state of a table of checks.
+/// \param state Runtime state of the checks.
+/// \param count Number of checks.
+/// \param currentTicks Current time in ticks, first due time of the checks.
+static void Safety_Runtime_InitCheckState(SAFETY_RUNTIME_CHECK_STATE * const state, U8 const count, U32 const currentTicks);
+
+/// Executes all due checks of a table. A failed check leads to a hard error
+/// with the hard error code of the check.
+/// \param checks Constant table of the checks.
+/// \param state Runtime state of the checks.
+/// \param count Number of checks.
+/// \param currentTicks Current time in ticks.
+static void Safety_Runtime_DispatchChecks(SAFETY_RUNTIME_CHECK const * const checks, SAFETY_RUNTIME_CHECK_STATE * const state,
+                                          U8 const count, U32 const currentTicks);
+
+/// Checks if a point in time is reached, also in case of tick overflow.
+/// \param currentTicks Current time in ticks.
+/// \param dueTicks Point in time to check.
+/// \return true if \p dueTicks is reached, otherwise false.
+static bool Safety_Runtime_TimeReached(U32 const currentTicks, U32 const dueTicks);
+
 // externe Variablen -------------------------------------------------------
 #if FEATURE_RTOS_AL_MPU_ENABLE
 static bool safetyMPUFault = false;
 #endif
 
+/// Internal runtime checks in the order of execution
+static SAFETY_RUNTIME_CHECK const internalChecks[] =
+    {
+#if FEATURE_SAFETYCHECK_RUNTIME_RAM
+        { "RAM", Safety_Runtime_CheckRam, 0, 0, HARD_ERR_MEM_RAM_CYCLIC },
+#endif
+#if FEATURE_SAFETYCHECK_RUNTIME_ROM
+        { "ROM", Safety_Runtime_CheckRom, 0, 0, HARD_ERR_MEM_ROM_CYCLIC },
+#endif
+#if FEATURE_SAFETYCHECK_USE_STL && FEATURE_SAFETYCHECK_RUNTIME_CPU
+        { "CPU", Safety_Runtime_CheckCpu, 0, 0, HARD_ERR_CPU_CYCLIC },
+#endif
+#if FEATURE_SAFETYCHECK_RUNTIME_POWERSUPPLY
+        { "Powersupply", Safety_Runtime_CheckPowersupply, 0, 0, HARD_ERR_SAFETY_MEASUREMENT },
+#endif
+#if FEATURE_SAFETYCHECK_RUNTIME_REGISTER
+        // SOFTQM-609, SOFTQM-648
+        { "Register", Safety_Runtime_RegisterTest, 0, 0, HARD_ERR_INTERN_CHECK_REGISTER_CYCLIC },
+#endif
+#if FEATURE_SAFETYCHECK_RUNTIME_REGISTER_SHADOW
+        { "RegisterShadow", Safety_Runtime_CheckRegisterShadow, 0, 0, HARD_ERR_INTERN_CHECK_REGISTER_CYCLIC },
+#endif
+    };
+
+/// Number of internal runtime checks
+#define NUM_INTERNAL_CHECKS     ((U8) (sizeof(internalChecks) / sizeof(internalChecks[0])))
+
+/// Runtime state of the internal checks
+static SAFETY_RUNTIME_CHECK_STATE internalCheckState[NUM_INTERNAL_CHECKS];
+
+/// Tables of checks registered by the application
+static SAFETY_RUNTIME_CHECK_TABLE checkTables[SAFETY_RUNTIME_CHECK_TABLES_MAX];
+
+/// Number of registered tables
+static U8 numCheckTables = 0;
+
+/// Set with the first execution, registration of checks is no longer possible
+static bool checksStarted = false;
+
+/// Next call of Safety_Runtime_Custom_CyclicCheck() in ticks
+static U32 nextCustomCheckTicks = 0;
+
 #if FEATURE_SAFETYCHECK_RUNTIME_PROGFLOW
 
 #ifdef FEATURE_SAFETY_RUNTIME_PROGFLOW_USE_RTC_M41T62
@@ -146,8 +285,20 @@ static void Trigger_Window_Watchdog(void)
         isTimeToTrigger = (currentTicks - lastWdgTrigger) > WATCHDOG_TRIGGER_TIME_TICKS;
         }
 
+#if FEATURE_SAFETYCHECK_RUNTIME_CHECKPOINT
+    // Watchdog nur triggern, wenn alle Checkpoints ihre Deadline eingehalten haben.
+    // Die Auswertung erfolgt in jedem Zyklus, unabhängig vom Triggerzeitpunkt.
+    if(!Safety_Checkpoint_Evaluate(currentTicks))
+        {
+        SAFETY_TRACE_INSTANT(eSAFETY_TRACE_TRACK_WATCHDOG, "Checkpoint missed", 0);
+        isTimeToTrigger = false;
+        }
+#endif
+
     if(isTimeToTrigger)
         {
+        // Wert im Trace: Ticks seit dem letzten Trigger, Lage im Fenster
+        SAFETY_TRACE_INSTANT(eSAFETY_TRACE_TRACK_WATCHDOG, "Trigger", currentTicks - lastWdgTrigger);
         lastWdgTrigger = currentTicks;
         WATCHDOG_Trigger();
         }
@@ -172,7 +323,7 @@ __attribute__((weak)) void Safety_Runtime_Custom_CyclicCheck(void)
             crcError.upperLevel = eFEHLER_KEIN_KANAL;
             crcError.intermediateLevel = eFEHLER_CALIBRATION;
             crcError.lowerLevel = eCALIBRATION_ERROR_CRC;
-            SendMsgEvent(eEVENT_ERROR_SENSOR, crcError.value);
+            Safety_Event_Send(eEVENT_ERROR_SENSOR, crcError.value);
             }
     #endif
 #endif
@@ -186,6 +337,8 @@ void Safety_Runtime_Init(SAFETY_POWERSUPPLY_CONFIG * const safetyPowerSupplyConf
 
     initSucessful = true;
 
+    Safety_Runtime_InitCheckState(internalCheckState, NUM_INTERNAL_CHECKS, RTOS_GetTime());
+    nextCustomCheckTicks = RTOS_GetTime();
 
 #if FEATURE_SAFETYCHECK_USE_STL
     if((initSucessful) && !Stl_SchedulerInit())
@@ -255,6 +408,28 @@ void Safety_Runtime_Init(SAFETY_POWERSUPPLY_CONFIG * const safetyPowerSupplyConf
 #endif
 #endif
 
+#if FEATURE_SAFETYCHECK_RUNTIME_TICKLESS
+    // Maximalen Aufrufabstand der zyklischen Tests für den ereignisgesteuerten Betrieb bestimmen
+#if FEATURE_SAFETYCHECK_RUNTIME_RAM
+    if((initSucessful) && !Safety_Runtime_LimitStlInterval(RAMTestStl_GetMaxCallIntervalTicks()))
+        {
+        initSucessful = false;
+        }
+#endif
+#if FEATURE_SAFETYCHECK_RUNTIME_ROM
+    if((initSucessful) && !Safety_Runtime_LimitStlInterval(ROMTestStl_GetMaxCallIntervalTicks()))
+        {
+        initSucessful = false;
+        }
+#endif
+#if FEATURE_SAFETYCHECK_RUNTIME_CPU
+    if((initSucessful) && !Safety_Runtime_LimitStlInterval(CPUTestStl_GetMaxCallIntervalTicks()))
+        {
+        initSucessful = false;
+        }
+#endif
+#endif // FEATURE_SAFETYCHECK_RUNTIME_TICKLESS
+
 #if FEAT_DEBUG
 #ifdef fpSafetyTask
     if((initSucessful) && !GPIOInitPin(fpSafetyTask, eOut_PP)) // Lebenspin der Positionstask
@@ -308,18 +483,43 @@ bool Safety_Runtime_Startup(TASK_PARA_STD * const param)
 
 #if FEATURE_SAFETYCHECK_RUNTIME_PROGFLOW
     U32 referenceCount;
+    U32 cycleTicks;
 #endif
 
     result = true;
 
+#if FEATURE_SAFETYCHECK_RUNTIME_TICKLESS
+    if(param->taskDelay > 0)
+        {
+        nominalTaskDelayTicks = param->taskDelay;
+        measurementPeriodTicks = SAFETY_TICKLESS_MEASUREMENT_PERIOD_MS * configTICK_RATE_HZ_MS;
+        if(measurementPeriodTicks == 0)
+            {
+            measurementPeriodTicks = nominalTaskDelayTicks;
+            }
+        }
+    else
+        {
+        result = false;
+        }
+#endif
+
 #if FEATURE_SAFETYCHECK_RUNTIME_PROGFLOW
     referenceCount = 0;
 
-    if(param->taskDelay > 0)
+#if FEATURE_SAFETYCHECK_RUNTIME_TICKLESS
+    // Im ereignisgesteuerten Betrieb wird ein Zyklus pro Messung gezählt
+    cycleTicks = measurementPeriodTicks;
+#else
+    cycleTicks = param->taskDelay;
+#endif
+
+    if(cycleTicks > 0)
         {
-        referenceCount = (RTOS_TICK_RATE + (param->taskDelay / 2)) / param->taskDelay;
+        referenceCount = (RTOS_TICK_RATE + (cycleTicks / 2)) / cycleTicks;
         }
-    else
+
+    if(referenceCount == 0)
         {
         result = false;
         }
@@ -352,10 +552,16 @@ void Safety_SecondCallback(U32 count)
 #endif
 #endif
 
+    SAFETY_TRACE_INSTANT(eSAFETY_TRACE_TRACK_RTC, "Second", count);
+
 #if FEATURE_SAFETYCHECK_RUNTIME_PROGFLOW
     // Hier wird nur das Flag gesetzt, die Auswertung des
     // Sicherheitstaskaufrufzaehlers erfolgt direkt in der Sicherheitstask!
     gulRTCSekundeAbgelaufen = TRUE;
+#if FEATURE_SAFETYCHECK_RUNTIME_TICKLESS
+    // Zeitpunkt merken, um den Weckzeitpunkt der nächsten Sekunde abzuschätzen
+    lastRtcSecondTicks = RTOS_GetTime();
+#endif
 #endif
 
 #if FEAT_DEBUG
@@ -375,18 +581,54 @@ void Safety_WDTCallback(void)
 /// \author m.neubauer \date 26.05.2016
 void Safety_Runtime_Execute(void)
     {
+    U32 const currentTicks = RTOS_GetTime();
+    U8 i;
 
-#if FEATURE_SAFETYCHECK_RUNTIME_RAM
-#if FEATURE_SAFETYCHECK_USE_STL
-    EN61508_TestResult ramResultStl;
-#endif
+    SAFETY_TRACE_BEGIN(eSAFETY_TRACE_TRACK_TASK, "Safety_Runtime_Execute");
+
+    // Ab jetzt keine Registrierung weiterer Prüfungen mehr zulassen
+    checksStarted = true;
+
+#if FEATURE_SAFETYCHECK_RUNTIME_TICKLESS
+    // Zeitbezug nach dem Start setzen
+    if(firstExecute)
+        {
+        firstExecute = false;
+        lastExecuteTicks = currentTicks;
+        nextMeasurementTicks = currentTicks;
+        }
+
+    // Messzyklus im Messintervall, damit die zyklusbasierten Timeouts der
+    // Versorgungsüberwachung und die Programmablaufkontrolle ihre Zeitbasis behalten
+    measurementCycleDue = Safety_Runtime_TimeReached(currentTicks, nextMeasurementTicks);
+    if(measurementCycleDue)
+        {
+        nextMeasurementTicks += measurementPeriodTicks;
+        if(Safety_Runtime_TimeReached(currentTicks, nextMeasurementTicks))
+            {
+            // Verspätetes Wecken, Messraster neu aufsetzen
+            nextMeasurementTicks = currentTicks + measurementPeriodTicks;
+            }
+        }
 #endif
 
 #if FEATURE_SAFETYCHECK_WATCHDOG
     // Watchdog Triggern
 #ifdef WATCHDOG_WINDOW_PERCENT
     Trigger_Window_Watchdog();
+#elif FEATURE_SAFETYCHECK_RUNTIME_CHECKPOINT
+    // Watchdog nur triggern, wenn alle Checkpoints ihre Deadline eingehalten haben
+    if(Safety_Checkpoint_Evaluate(RTOS_GetTime()))
+        {
+        SAFETY_TRACE_INSTANT(eSAFETY_TRACE_TRACK_WATCHDOG, "Trigger", 0);
+        WATCHDOG_Trigger();
+        }
+    else
+        {
+        SAFETY_TRACE_INSTANT(eSAFETY_TRACE_TRACK_WATCHDOG, "Checkpoint missed", 0);
+        }
 #else
+    SAFETY_TRACE_INSTANT(eSAFETY_TRACE_TRACK_WATCHDOG, "Trigger", 0);
     WATCHDOG_Trigger();
 #endif
 #endif /* FEATURE_SAFETYCHECK_WATCHDOG */
@@ -395,102 +637,363 @@ void Safety_Runtime_Execute(void)
     Safety_Runtime_CheckMPUFault();
 #endif
 
-#if FEATURE_SAFETYCHECK_RUNTIME_RAM
-#if FEATURE_SAFETYCHECK_USE_STL
-    ramResultStl = EN61508_TestFail;
+    // Registrierte Laufzeitprüfungen ausführen, zuerst die internen Prüfungen
+    Safety_Runtime_DispatchChecks(internalChecks, internalCheckState, NUM_INTERNAL_CHECKS, currentTicks);
+
+    // Benutzerspezifische Laufzeitprüfungen durchführen. Die Fehlerbehandlung
+    // erfolgt in der Benutzerfunktion, daher nicht Teil der Prüfungstabellen.
+    if(Safety_Runtime_TimeReached(currentTicks, nextCustomCheckTicks))
+        {
+        nextCustomCheckTicks += SAFETY_RUNTIME_CUSTOM_CHECK_PERIOD_MS * configTICK_RATE_HZ_MS;
+        if(Safety_Runtime_TimeReached(currentTicks, nextCustomCheckTicks))
+            {
+            // Verspäteter Aufruf, Raster neu aufsetzen
+            nextCustomCheckTicks = currentTicks + (SAFETY_RUNTIME_CUSTOM_CHECK_PERIOD_MS * configTICK_RATE_HZ_MS);
+            }
+
+        SAFETY_TRACE_BEGIN(eSAFETY_TRACE_TRACK_TASK, "Custom");
+        Safety_Runtime_Custom_CyclicCheck();
+        SAFETY_TRACE_END(eSAFETY_TRACE_TRACK_TASK, "Custom");
+        }
+
+    for(i = 0; i < numCheckTables; i++)
+        {
+        Safety_Runtime_DispatchChecks(checkTables[i].checks, checkTables[i].state, checkTables[i].count, currentTicks);
+        }
+
+#if FEATURE_SAFETYCHECK_RUNTIME_PROGFLOW
+    // Sekunde abgelaufen. Pruefen, ob die Aufrufzaehler der zu pruefenden Tasks
+    // den erwarteten Zaehlerstand haben.
+    if(gulRTCSekundeAbgelaufen == TRUE)
+        {
+        SAFETY_TRACE_BEGIN(eSAFETY_TRACE_TRACK_TASK, "ProgFlow");
+
+        // Flag des RTC wieder loeschen
+        gulRTCSekundeAbgelaufen = FALSE;
+
+        // Zykluszähler aller relevanten Tasks prüfen
+        if(!EN61508_ProgFlow_CheckCycleCounterAll())
+            {
+            Safety_HardError(HARD_ERR_INTERN_SAFETY_CYCLIC);
+            }
+
+        SAFETY_TRACE_END(eSAFETY_TRACE_TRACK_TASK, "ProgFlow");
+        }
+
+#if FEATURE_SAFETYCHECK_RUNTIME_TICKLESS
+    // Im ereignisgesteuerten Betrieb entspricht ein Aufruf nicht einem Zyklus. Gezählt
+    // werden nur die tatsächlich ausgeführten Messzyklen, ein ausgefallener oder
+    // verspäteter Zyklus fehlt im Vergleich mit der RTC.
+    if(measurementCycleDue)
+        {
+        EN61508_ProgFlow_IncCycleCounter(&tgSafetyProgFlow);
+        }
+#else
+    EN61508_ProgFlow_IncCycleCounter(&tgSafetyProgFlow);
+#endif
 #endif
 
+#if FEATURE_SAFETYCHECK_RUNTIME_TICKLESS
+    lastExecuteTicks = currentTicks;
+#endif
+
+    SAFETY_TRACE_END(eSAFETY_TRACE_TRACK_TASK, "Safety_Runtime_Execute");
+    }
+//------------------------------------------------------------------------------
+
+bool Safety_Runtime_RegisterChecks(SAFETY_RUNTIME_CHECK const * const checks, SAFETY_RUNTIME_CHECK_STATE * const state, U8 const count)
+    {
+    U8 i;
+
+    if(checksStarted || (checks == NULL) || (state == NULL) || (count == 0)
+            || (numCheckTables >= SAFETY_RUNTIME_CHECK_TABLES_MAX))
+        {
+        return false;
+        }
+
+    for(i = 0; i < count; i++)
+        {
+        if(checks[i].check == NULL)
+            {
+            return false;
+            }
+        }
+
+    Safety_Runtime_InitCheckState(state, count, RTOS_GetTime());
+
+    checkTables[numCheckTables].checks = checks;
+    checkTables[numCheckTables].state = state;
+    checkTables[numCheckTables].count = count;
+    numCheckTables++;
+
+    return true;
+    }
+//------------------------------------------------------------------------------
+
+/// \note Default Implementierung per Weak Linkage.
+__attribute__((weak)) void Safety_Runtime_CheckBudgetExceededHook(SAFETY_RUNTIME_CHECK const * const check, U32 const duration)
+    {
+    }
+//------------------------------------------------------------------------------
+
+static void Safety_Runtime_InitCheckState(SAFETY_RUNTIME_CHECK_STATE * const state, U8 const count, U32 const currentTicks)
+    {
+    U8 i;
+
+    for(i = 0; i < count; i++)
+        {
+        state[i].nextDueTicks = currentTicks;
+        state[i].lastDuration = 0;
+        state[i].budgetExceeded = 0;
+        }
+    }
+//------------------------------------------------------------------------------
+
+static void Safety_Runtime_DispatchChecks(SAFETY_RUNTIME_CHECK const * const checks, SAFETY_RUNTIME_CHECK_STATE * const state,
+                                          U8 const count, U32 const currentTicks)
+    {
+    U8 i;
+    U32 periodTicks;
+    U32 startTime;
+    bool result;
+
+    for(i = 0; i < count; i++)
+        {
+        periodTicks = checks[i].periodMs * configTICK_RATE_HZ_MS;
+
+        // Prüfungen mit eigener Periode nur zum Fälligkeitszeitpunkt ausführen
+        if(periodTicks != 0)
+            {
+            if(!Safety_Runtime_TimeReached(currentTicks, state[i].nextDueTicks))
+                {
+                continue;
+                }
+
+            state[i].nextDueTicks += periodTicks;
+            if(Safety_Runtime_TimeReached(currentTicks, state[i].nextDueTicks))
+                {
+                // Verspäteter Aufruf, Raster neu aufsetzen
+                state[i].nextDueTicks = currentTicks + periodTicks;
+                }
+            }
+
+        SAFETY_TRACE_BEGIN(eSAFETY_TRACE_TRACK_TASK, checks[i].name);
+        startTime = SAFETY_RUNTIME_CHECK_TIMESTAMP();
+        result = checks[i].check();
+        state[i].lastDuration = SAFETY_RUNTIME_CHECK_TIMESTAMP() - startTime;
+        SAFETY_TRACE_END(eSAFETY_TRACE_TRACK_TASK, checks[i].name);
+
+        if((checks[i].budget != 0) && (state[i].lastDuration > checks[i].budget))
+            {
+            state[i].budgetExceeded++;
+            Safety_Runtime_CheckBudgetExceededHook(&checks[i], state[i].lastDuration);
+            }
+
+        if(!result)
+            {
+            Safety_HardError(checks[i].hardErrorCode);
+            }
+        }
+    }
+//------------------------------------------------------------------------------
+
+#if FEATURE_SAFETYCHECK_RUNTIME_RAM
+static bool Safety_Runtime_CheckRam(void)
+    {
+    EN61508_TestResult ramResult;
+
+    ramResult = EN61508_TestFail;
+
 #if !EN61508_RAMTEST_USE_TIMER && EN61508_RAMTEST_FROM_SAFETY_TASK
     // RAM Test wird nicht durch Timer durchgeführt, RAM Test Funktion
     // direkt aufrufen
 #if FEATURE_SAFETYCHECK_USE_STL
-    ramResultStl = RAMTestStl_RunCyclic(RTOS_GetTime());
+    ramResult = RAMTestStl_RunCyclic(RTOS_GetTime());
 #else
     EN61508_RAMTest_Cyclic();
 #endif
-
 #endif
 
-// Zyklischen RAM Test auswerten
-#if FEATURE_SAFETYCHECK_USE_STL
-    if(ramResultStl != EN61508_TestPass)
-        {
-        Safety_HardError(HARD_ERR_MEM_RAM_CYCLIC);
-        }
-#else
-    if(EN61508_RAMTest_Cyclic_Result() != EN61508_TestPass)
-        {
-        Safety_HardError(HARD_ERR_MEM_RAM_CYCLIC);
-        }
+    // Zyklischen RAM Test auswerten
+#if !FEATURE_SAFETYCHECK_USE_STL
+    ramResult = EN61508_RAMTest_Cyclic_Result();
 #endif
 
 #if FEATURE_SAFETYCHECK_RUNTIME_RAM_STORE_STATE
-    Safety_Runtime_SafeRamTestState(currentTicks);
+    Safety_Runtime_SafeRamTestState(RTOS_GetTime());
 #endif
 
+    return ramResult == EN61508_TestPass;
+    }
+//------------------------------------------------------------------------------
 #endif // FEATURE_SAFETYCHECK_RUNTIME_RAM
 
 #if FEATURE_SAFETYCHECK_RUNTIME_ROM
-
+static bool Safety_Runtime_CheckRom(void)
+    {
 #if FEATURE_SAFETYCHECK_USE_STL
-    if(ROMTestStl_RunCyclic(RTOS_GetTime()) != EN61508_TestPass)
-        {
-        Safety_HardError(HARD_ERR_MEM_ROM_CYCLIC);
-        }
+    return ROMTestStl_RunCyclic(RTOS_GetTime()) == EN61508_TestPass;
 #else
     // Zyklischen ROM Test Programmspeicherbereich
-    if(EN61508_ROMTest_CRC32_Cyclic() != EN61508_TestPass)
-        {
-        Safety_HardError(HARD_ERR_MEM_ROM_CYCLIC);
-        }
-#endif /* FEATURE_SAFETYCHECK_USE_STL */
+    return EN61508_ROMTest_CRC32_Cyclic() == EN61508_TestPass;
+#endif
+    }
+//------------------------------------------------------------------------------
+#endif // FEATURE_SAFETYCHECK_RUNTIME_ROM
 
-#endif /* FEATURE_SAFETYCHECK_RUNTIME_ROM */
+#if FEATURE_SAFETYCHECK_USE_STL && FEATURE_SAFETYCHECK_RUNTIME_CPU
+static bool Safety_Runtime_CheckCpu(void)
+    {
+    return CPUTestStl_RunCyclic(RTOS_GetTime()) == EN61508_TestPass;
+    }
+//------------------------------------------------------------------------------
+#endif
 
-#if FEATURE_SAFETYCHECK_USE_STL
-#if FEATURE_SAFETYCHECK_RUNTIME_CPU
-    if(CPUTestStl_RunCyclic(RTOS_GetTime()) != EN61508_TestPass)
+#if FEATURE_SAFETYCHECK_RUNTIME_POWERSUPPLY
+static bool Safety_Runtime_CheckPowersupply(void)
+    {
+#if FEATURE_SAFETYCHECK_RUNTIME_TICKLESS
+    // Im ereignisgesteuerten Betrieb nur im Messzyklus messen
+    if(!measurementCycleDue)
         {
-        Safety_HardError(HARD_ERR_CPU_CYCLIC);
+        return true;
         }
 #endif
+
+    // Versorgsspannung/Stromaufnahme pruefen
+    return Safety_Powersupply_Check() != FALSE;
+    }
+//------------------------------------------------------------------------------
+#endif // FEATURE_SAFETYCHECK_RUNTIME_POWERSUPPLY
+
+#if FEATURE_SAFETYCHECK_RUNTIME_REGISTER_SHADOW
+static bool Safety_Runtime_CheckRegisterShadow(void)
+    {
+    return Safety_Register_Check(RTOS_GetTime());
+    }
+//------------------------------------------------------------------------------
+#endif // FEATURE_SAFETYCHECK_RUNTIME_REGISTER_SHADOW
+
+static bool Safety_Runtime_TimeReached(U32 const currentTicks, U32 const dueTicks)
+    {
+    // Vorzeichenbehaftete Differenz ist auch bei Überlauf des Tickzählers korrekt
+    return ((S32) (currentTicks - dueTicks)) >= 0;
+    }
+//------------------------------------------------------------------------------
+
+#if FEATURE_SAFETYCHECK_RUNTIME_TICKLESS
+U32 Safety_Runtime_GetNextWakeupTicks(U32 const currentTicks)
+    {
+    U32 delay;
+    U8 table;
+    U8 i;
+
+    // Spätestens nach einem halben Überlaufbereich, damit die Zeitdifferenzen eindeutig bleiben
+    delay = RTOS_MAX_TIMEOUT / 2u;
+
+#if FEATURE_SAFETYCHECK_WATCHDOG
+#ifdef WATCHDOG_WINDOW_PERCENT
+    // Window Watchdog: Triggerzeitpunkt in der Mitte des Fensters
+    Safety_Runtime_LimitDelay(&delay, currentTicks, lastWdgTrigger + WATCHDOG_TRIGGER_TIME_TICKS + 1u);
+#else
+    // Watchdog wird bei jedem Aufruf getriggert, spätestens nach der halben Watchdogzeit
+    Safety_Runtime_LimitDelay(&delay, currentTicks, lastExecuteTicks + ((WDOG_TIMER_MS * configTICK_RATE_HZ_MS) / 2u));
+#endif
 #endif
 
-    // Benutzerspezifische Laufzeitprüfungen durchführen
-    Safety_Runtime_Custom_CyclicCheck();
+    // Zyklische RAM/ROM/CPU Tests: Aufrufabstand aus der Process Safety Time
+    if(stlMaxCallIntervalTicks != RTOS_MAX_TIMEOUT)
+        {
+        Safety_Runtime_LimitDelay(&delay, currentTicks, lastExecuteTicks + stlMaxCallIntervalTicks);
+        }
 
-#if FEATURE_SAFETYCHECK_RUNTIME_POWERSUPPLY
-    // Versorgsspannung/Stromaufnahme pruefen
-    Safety_Powersupply_Check();
+    // Nächster Messzyklus der Versorgungsüberwachung und der Programmablaufkontrolle
+    Safety_Runtime_LimitDelay(&delay, currentTicks, nextMeasurementTicks);
+
+    // Registrierte Prüfungen mit eigener Periode
+    for(i = 0; i < NUM_INTERNAL_CHECKS; i++)
+        {
+        if(internalChecks[i].periodMs != 0)
+            {
+            Safety_Runtime_LimitDelay(&delay, currentTicks, internalCheckState[i].nextDueTicks);
+            }
+        }
+
+#if (SAFETY_RUNTIME_CUSTOM_CHECK_PERIOD_MS != 0)
+    Safety_Runtime_LimitDelay(&delay, currentTicks, nextCustomCheckTicks);
 #endif
 
-#if FEATURE_SAFETYCHECK_RUNTIME_REGISTER
-    if(!Safety_Runtime_RegisterTest()) // SOFTQM-609
+    for(table = 0; table < numCheckTables; table++)
         {
-        Safety_HardError(HARD_ERR_INTERN_CHECK_REGISTER_CYCLIC); // SOFTQM-648
+        for(i = 0; i < checkTables[table].count; i++)
+            {
+            if(checkTables[table].checks[i].periodMs != 0)
+                {
+                Safety_Runtime_LimitDelay(&delay, currentTicks, checkTables[table].state[i].nextDueTicks);
+                }
+            }
         }
-#endif // FEATURE_SAFETYCHECK_RUNTIME_REGISTER
 
 #if FEATURE_SAFETYCHECK_RUNTIME_PROGFLOW
-    // Sekunde abgelaufen. Pruefen, ob die Aufrufzaehler der zu pruefenden Tasks
-    // den erwarteten Zaehlerstand haben.
+    // Nächste Sekunde der RTC für die Programmablaufkontrolle
     if(gulRTCSekundeAbgelaufen == TRUE)
         {
-        // Flag des RTC wieder loeschen
-        gulRTCSekundeAbgelaufen = FALSE;
-
-        // Zykluszähler aller relevanten Tasks prüfen
-        if(!EN61508_ProgFlow_CheckCycleCounterAll())
+        delay = 0;
+        }
+    else if(Safety_Runtime_TimeReached(currentTicks, lastRtcSecondTicks + RTOS_TICK_RATE))
+        {
+        // Sekunde überfällig, bis zum Eintreffen im Nominalzyklus prüfen
+        if(nominalTaskDelayTicks < delay)
             {
-            Safety_HardError(HARD_ERR_INTERN_SAFETY_CYCLIC);
+            delay = nominalTaskDelayTicks;
             }
         }
-
-    EN61508_ProgFlow_IncCycleCounter(&tgSafetyProgFlow);
+    else
+        {
+        Safety_Runtime_LimitDelay(&delay, currentTicks, lastRtcSecondTicks + RTOS_TICK_RATE);
+        }
 #endif
 
+    // Mindestens einen Tick schlafen
+    if(delay == 0)
+        {
+        delay = 1;
+        }
+
+    return currentTicks + delay;
+    }
+//------------------------------------------------------------------------------
+
+static void Safety_Runtime_LimitDelay(U32 * const delay, U32 const currentTicks, U32 const dueTicks)
+    {
+    if(Safety_Runtime_TimeReached(currentTicks, dueTicks))
+        {
+        *delay = 0;
+        }
+    else if((dueTicks - currentTicks) < *delay)
+        {
+        *delay = dueTicks - currentTicks;
+        }
+    }
+//------------------------------------------------------------------------------
+
+static bool Safety_Runtime_LimitStlInterval(U32 const interval)
+    {
+    if(interval == 0)
+        {
+        // Process Safety Time kann nicht eingehalten werden
+        return false;
+        }
+
+    if(interval < stlMaxCallIntervalTicks)
+        {
+        stlMaxCallIntervalTicks = interval;
+        }
+
+    return true;
     }
 //------------------------------------------------------------------------------
+#endif // FEATURE_SAFETYCHECK_RUNTIME_TICKLESS
 
 #if FEATURE_RTOS_AL_MPU_ENABLE
 /// @author M.Neubauer @date 22.02.2024
@@ -119,6 +119,18 @@ extern "C"
 #pragma message "Konfiguration in version_def.h erforderlich."
 #endif
 
+#ifndef FEATURE_SAFETYCHECK_RUNTIME_TICKLESS
+/// \ingroup feature_flags
+/// Feature flag for the event-driven wake-up of the safety task.
+/// Instead of waking up every task delay, the safety task sleeps until the next
+/// safety function is due. This mode is deactivated by default.
+#define FEATURE_SAFETYCHECK_RUNTIME_TICKLESS    (0)
+#endif
+
+#if FEATURE_SAFETYCHECK_RUNTIME_TICKLESS && !FEATURE_SAFETYCHECK_USE_STL
+#error "Event-driven safety task requires the STL runtime tests (FEATURE_SAFETYCHECK_USE_STL)"
+#endif
+
 #if FEATURE_SAFETYCHECK_RUNTIME
 
 #include "RTC/RTC_Driver.h"
@@ -136,6 +148,40 @@ extern "C"
 #define PROCESS_SAFETY_TIME_TICKS (PROCESS_SAFETY_TIME_MS * configTICK_RATE_HZ_MS)
 #endif
 
+#if FEATURE_SAFETYCHECK_RUNTIME_TICKLESS
+/// Measurement period of the power supply monitoring in ms for the event-driven safety task.
+/// The safety task wakes up at least once per period, the program flow monitoring
+/// counts one cycle per measurement. With 0 the task delay of the safety task is used,
+/// then the task wakes up as often as without the event-driven mode.
+/// The timeouts and filters of the power supply monitoring counted in measurements
+/// scale with the period, so a period other than 0 requires SYSPWR_VCC_LOW_TIMEOUT_MS
+/// and SYSPWR_FILTER_WINDOW_MS below the process safety time to keep them
+/// independent of it. The period must not exceed one second.
+#ifndef SAFETY_TICKLESS_MEASUREMENT_PERIOD_MS
+#define SAFETY_TICKLESS_MEASUREMENT_PERIOD_MS   (0u)
+#endif
+
+#if (SAFETY_TICKLESS_MEASUREMENT_PERIOD_MS > 1000u)
+#error "SAFETY_TICKLESS_MEASUREMENT_PERIOD_MS must not exceed one second, the program flow monitoring counts measurements per second"
+#endif
+#endif
+
+/// Maximum number of check tables which can be registered by the application.
+#ifndef SAFETY_RUNTIME_CHECK_TABLES_MAX
+#define SAFETY_RUNTIME_CHECK_TABLES_MAX     (4u)
+#endif
+
+/// Call period of Safety_Runtime_Custom_CyclicCheck() in ms, 0 calls it in every cycle.
+#ifndef SAFETY_RUNTIME_CUSTOM_CHECK_PERIOD_MS
+#define SAFETY_RUNTIME_CUSTOM_CHECK_PERIOD_MS   (0u)
+#endif
+
+/// Timestamp source for the cost budget of the runtime checks.
+/// Can be replaced by a high resolution counter, e.g. the DWT cycle counter.
+#ifndef SAFETY_RUNTIME_CHECK_TIMESTAMP
+#define SAFETY_RUNTIME_CHECK_TIMESTAMP()    ((U32) RTOS_GetTime())
+#endif
+
 // externe Variablen --------------------------------------------------------
 
 // Allgemeine Definitionen --------------------------------------------------
@@ -143,6 +189,29 @@ extern "C"
 #ifndef WDOG_TIMER_MS
 #define WDOG_TIMER_MS               (500)
 #endif
+
+/// Check function of a runtime check.
+/// \return true if the check passed, false leads to a hard error.
+typedef bool (*SAFETY_RUNTIME_CHECK_FUNCTION)(void);
+
+/// Definition of a runtime check. Checks are defined in constant tables and
+/// registered with Safety_Runtime_RegisterChecks().
+typedef struct
+{
+    char const * name;                      ///< Name of the check for diagnosis
+    SAFETY_RUNTIME_CHECK_FUNCTION check;    ///< Check function
+    U32 periodMs;                           ///< Call period in ms, 0 calls the check in every cycle of the safety task
+    U32 budget;                             ///< Cost budget in units of SAFETY_RUNTIME_CHECK_TIMESTAMP(), 0 for no budget
+    U8 hardErrorCode;                       ///< Hard error code if the check fails
+} SAFETY_RUNTIME_CHECK;
+
+/// Runtime state of a runtime check, one entry per check of a table.
+typedef struct
+{
+    U32 nextDueTicks;       ///< Next call of the check in ticks
+    U32 lastDuration;       ///< Duration of the last call in units of SAFETY_RUNTIME_CHECK_TIMESTAMP()
+    U32 budgetExceeded;     ///< Number of calls exceeding the cost budget
+} SAFETY_RUNTIME_CHECK_STATE;
 // Prototypen ---------------------------------------------------------------
 /// Initialisierung der Sicherheitsfunktionen, die zur Laufzeit ausgeführt werden.
 /// Bei Verwendung eines Watchdogs, wird dieser in der Funktion direkt mit der Initialisierung gestartet.
@@ -172,8 +241,29 @@ extern void Safety_Runtime_Execute(void);
 /// Die Funktion wird in der zyklischen Task aufgerufen. Es ist darauf zu achten,
 /// das nur kurze Aktionen durchgeführt werden. Ansonsten kann es dazu kommen, das
 /// die Programmablaufüberwachung einen Fehler meldet.
+/// Die Aufrufperiode wird mit \ref SAFETY_RUNTIME_CUSTOM_CHECK_PERIOD_MS festgelegt.
+/// Die Funktion liefert kein Ergebnis, Fehler behandelt sie selbst, z.B. mit
+/// Safety_Event_Send() oder Safety_HardError(). Prüfungen mit Ergebnis werden
+/// mit Safety_Runtime_RegisterChecks() registriert.
 extern void Safety_Runtime_Custom_CyclicCheck(void);
 
+/// Registers a constant table of runtime checks. The checks are executed by the
+/// safety task after the internal checks, in the order of registration and with
+/// their own period. A failing check leads to a hard error with its hard error code.
+/// Registration is only possible before the first call of Safety_Runtime_Execute().
+/// \param checks Constant table of checks, has to stay valid.
+/// \param state Runtime state with one entry per check, has to stay valid.
+/// \param count Number of checks in the table.
+/// \return true on success, false if the table is invalid, the maximum number of
+///         tables is reached or the safety task is already running.
+extern bool Safety_Runtime_RegisterChecks(SAFETY_RUNTIME_CHECK const * const checks, SAFETY_RUNTIME_CHECK_STATE * const state, U8 const count);
+
+/// Called by the safety task if a check exceeded its cost budget.
+/// The user may overwrite it with a custom definition.
+/// \param check Check which exceeded its budget.
+/// \param duration Duration of the call in units of SAFETY_RUNTIME_CHECK_TIMESTAMP().
+extern void Safety_Runtime_CheckBudgetExceededHook(SAFETY_RUNTIME_CHECK const * const check, U32 const duration);
+
 #if FEATURE_SAFETYCHECK_RUNTIME_REGISTER
 /// Test if configuration registers of hardware drivers are equal to their redundant twins.
 /// \note This function shall be implemented by the user application,
@@ -192,6 +282,16 @@ extern void Safety_InitWatchdogTime(U32 const currentTicks);
 extern void Safety_Runtime_CheckMPUFault(void);
 #endif
 
+#if FEATURE_SAFETYCHECK_RUNTIME_TICKLESS
+/// Determines the next wake-up of the event-driven safety task. It is the earliest of
+/// the watchdog trigger time, the latest call of the cyclic RAM/ROM/CPU tests derived
+/// from the process safety time, the next measurement of the power supply monitoring
+/// and the next second event of the RTC.
+/// \param currentTicks Current time in system ticks.
+/// \return Time of the next wake-up in system ticks, at least one tick after \p currentTicks.
+extern U32 Safety_Runtime_GetNextWakeupTicks(U32 const currentTicks);
+#endif
+
 #endif
 
 #ifdef __cplusplus
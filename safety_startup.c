@@ -27,6 +27,7 @@
 #endif
 
 #include "safety_startup.h"
+#include "safety_trace.h"
 
 #if !FEATURE_SAFETYCHECK_STARTUP_RAM
 #pragma message "Startup RAM Test ist deaktiviert."
@@ -44,6 +45,13 @@
 #define HARD_ERROR_BYTE ((U8) 0x08u) ///< First byte of error code for all hard errors (cf. SOFTQM-612).
 #endif
 
+#if FEATURE_SAFETY_HARDERROR_TRAP
+/// Records a step of the hard error handling for host tests.
+#define HARDERROR_TRAP_STEP(step)   Safety_HardErrorTrap_Step(step)
+#else
+#define HARDERROR_TRAP_STEP(step)
+#endif
+
 // Allgemeine Definitionen -------------------------------------------------
 
 // externe Variablen -------------------------------------------------------
@@ -52,6 +60,11 @@ enum
 {
     RTC_REGNUM_ERROR,  ///< RTC Registernummer des letzten Fehlers.
 };
+
+#if FEATURE_SAFETY_HARDERROR_TRAP
+/// Record of the armed hard error trap of each thread, NULL if the trap is not armed.
+static _Thread_local SAFETY_HARDERROR_RECORD * hardErrorTrapRecord = NULL;
+#endif
 //------------------------------------------------------------------------------
 // Prototypen interne Funktionen -----------------------------------------------
 //------------------------------------------------------------------------------
@@ -77,6 +90,17 @@ static void Safety_CheckPermanentHardError(void);
 /// aus dem RTC gelesen und der entsprechende Hard-Error-Zustand wird eingenommen.
 static void Safety_CheckWatchdogReset(void);
 
+/// Common hard error handling of Safety_HardError() and Safety_PermanentHardError().
+/// \param hardErrorCode The hard error code.
+/// \param isPermanent \c true in case of a permanent hard error, \c false otherwise.
+static void Safety_EnterHardError(U8 const hardErrorCode, bool const isPermanent) __attribute__ ((noreturn));
+
+#if FEATURE_SAFETY_HARDERROR_TRAP
+/// Records a step of the hard error handling in the record of the armed trap.
+/// \param step Executed step.
+static void Safety_HardErrorTrap_Step(SAFETY_HARDERROR_STEP const step);
+#endif
+
 
 //------------------------------------------------------------------------------
 // Funktionsbereich externe Funktionen -----------------------------------------
@@ -91,89 +115,100 @@ __attribute__((weak)) void Safety_HardError_Custom_Action(U8 const hardErrorCode
 
 void Safety_PermanentHardError(U8 const hardErrorCode)
     {
-    // order of steps according to SOFTQM-587
+    Safety_EnterHardError(hardErrorCode, true);
+    }
 
-    // write to error log (SOFTSQM-612)
-#if FEATURE_ERROR_LOGGING
-    Safety_AppendHardErrorCode(hardErrorCode, true);
-#endif
+void Safety_HardError(U8 const hardErrorCode)
+    {
+    Safety_EnterHardError(hardErrorCode, false);
+    }
 
+#if FEATURE_SAFETY_HARDERROR_TRAP
+void Safety_HardErrorTrap_Arm(SAFETY_HARDERROR_RECORD * const record)
+    {
+    hardErrorTrapRecord = record;
 
-#if FEATURE_RTOS_AL_MPU_ENABLE
-    if(RTOS_IsRunning())
+    if(record != NULL)
         {
-        MPU_Safety_HardError(RTC_REGNUM_ERROR, hardErrorCode);
+        record->hardErrorCode = 0;
+        record->isPermanent = false;
+        record->stepCount = 0;
         }
-    else
+    }
+//------------------------------------------------------------------------------
+
+void Safety_HardErrorTrap_Disarm(void)
+    {
+    hardErrorTrapRecord = NULL;
+    }
+//------------------------------------------------------------------------------
+
+static void Safety_HardErrorTrap_Step(SAFETY_HARDERROR_STEP const step)
+    {
+    if((hardErrorTrapRecord != NULL) && (hardErrorTrapRecord->stepCount < SAFETY_HARDERROR_TRAP_STEPS_MAX))
         {
-        // disable all interrupts (SOFTQM-587)
-        System_InterruptDisable();
-    #if FEATURE_SAFETYCHECK_WATCHDOG
-        // store hard error in backup register of internal RTC (SOFTQM-655)
-        Safety_SetNonvolatileError(hardErrorCode);
-    #endif
-        //custom action, application-dependent (SOFTQM-616)
-        Safety_HardError_Custom_Action(hardErrorCode);
+        hardErrorTrapRecord->steps[hardErrorTrapRecord->stepCount] = step;
+        hardErrorTrapRecord->stepCount++;
         }
-#else
-    // disable all interrupts (SOFTQM-587)
-    System_InterruptDisable();
-#if FEATURE_SAFETYCHECK_WATCHDOG
-    // store hard error in backup register of internal RTC (SOFTQM-655)
-    Safety_SetNonvolatileError(hardErrorCode);
-#endif
-    //custom action, application-dependent (SOFTQM-616)
-    Safety_HardError_Custom_Action(hardErrorCode);
-#endif
+    }
+//------------------------------------------------------------------------------
+#endif // FEATURE_SAFETY_HARDERROR_TRAP
 
-#if FEAT_DEBUG
-    __asm("BKPT #0\n");
-    // Break into the debugger
-#endif
+static void Safety_EnterHardError(U8 const hardErrorCode, bool const isPermanent)
+    {
+#if FEATURE_SAFETY_HARDERROR_TRAP
+    SAFETY_HARDERROR_RECORD * const record = hardErrorTrapRecord;
 
-    // final step, enter endless loop (SOFTQM-619)
-    while(1)
+    if(record != NULL)
         {
-#ifdef fpERROR_LED
-        ErrorLed_Set(hardErrorCode);
-#endif
+        record->hardErrorCode = hardErrorCode;
+        record->isPermanent = isPermanent;
         }
+#endif
 
-    }
+    // Simulation: Hard-Error im Zeitverlauf, Trace vor der Endlosschleife ausgeben
+    SAFETY_TRACE_INSTANT(eSAFETY_TRACE_TRACK_HARDERROR, isPermanent ? "Permanent hard error" : "Hard error", hardErrorCode);
+    SAFETY_TRACE_FLUSH();
 
-void Safety_HardError(U8 const hardErrorCode)
-    {
     // order of steps according to SOFTQM-587
 
     // write to error log (SOFTSQM-612)
 #if FEATURE_ERROR_LOGGING
-    Safety_AppendHardErrorCode(hardErrorCode, false);
+    HARDERROR_TRAP_STEP(eSAFETY_HARDERROR_STEP_LOG);
+    Safety_AppendHardErrorCode(hardErrorCode, isPermanent);
 #endif
 
 #if FEATURE_RTOS_AL_MPU_ENABLE
     if(RTOS_IsRunning())
         {
+        HARDERROR_TRAP_STEP(eSAFETY_HARDERROR_STEP_MPU);
         MPU_Safety_HardError(RTC_REGNUM_ERROR, hardErrorCode);
         }
     else
         {
         // disable all interrupts (SOFTQM-587)
+        HARDERROR_TRAP_STEP(eSAFETY_HARDERROR_STEP_INTERRUPT_DISABLE);
         System_InterruptDisable();
     #if FEATURE_SAFETYCHECK_WATCHDOG
         // store hard error in backup register of internal RTC (SOFTQM-655)
+        HARDERROR_TRAP_STEP(eSAFETY_HARDERROR_STEP_BACKUP);
         Safety_SetNonvolatileError(hardErrorCode);
     #endif
         //custom action, application-dependent (SOFTQM-616)
+        HARDERROR_TRAP_STEP(eSAFETY_HARDERROR_STEP_CUSTOM_ACTION);
         Safety_HardError_Custom_Action(hardErrorCode);
         }
 #else
     // disable all interrupts (SOFTQM-587)
+    HARDERROR_TRAP_STEP(eSAFETY_HARDERROR_STEP_INTERRUPT_DISABLE);
     System_InterruptDisable();
 #if FEATURE_SAFETYCHECK_WATCHDOG
     // store hard error in backup register of internal RTC (SOFTQM-655)
+    HARDERROR_TRAP_STEP(eSAFETY_HARDERROR_STEP_BACKUP);
     Safety_SetNonvolatileError(hardErrorCode);
 #endif
     //custom action, application-dependent (SOFTQM-616)
+    HARDERROR_TRAP_STEP(eSAFETY_HARDERROR_STEP_CUSTOM_ACTION);
     Safety_HardError_Custom_Action(hardErrorCode);
 #endif
 
@@ -182,6 +217,15 @@ void Safety_HardError(U8 const hardErrorCode)
     // Break into the debugger
 #endif
 
+#if FEATURE_SAFETY_HARDERROR_TRAP
+    // Host-Test: zurück zum setjmp() nach Safety_HardErrorTrap_Arm(), Trap ist danach entschärft
+    if(record != NULL)
+        {
+        hardErrorTrapRecord = NULL;
+        longjmp(record->jumpBuffer, 1);
+        }
+#endif
+
     // final step, enter endless loop (SOFTQM-619)
     while(1)
         {
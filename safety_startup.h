@@ -63,21 +63,90 @@ extern "C"
 #endif
 #endif
 
+#ifndef FEATURE_SAFETY_HARDERROR_TRAP
+/// \ingroup feature_flags
+/// Feature flag for host tests only. Turns the endless loop at the end of
+/// Safety_HardError() and Safety_PermanentHardError() into a jump back to the
+/// trap armed with Safety_HardErrorTrap_Arm(), so failure paths can be tested in-process
+/// without death tests. Must never be activated in a target build.
+#define FEATURE_SAFETY_HARDERROR_TRAP   (0)
+#endif
+
 #if FEAT_RTOS
 #include "RTOS_AL/RTOS_AL.h"
 #endif
 
+#if FEATURE_SAFETY_HARDERROR_TRAP
+#include <setjmp.h>
+#endif
+
 #ifdef fpAlarm
     #pragma message "Veraltete Alarmausgangspinbezeichnung 'fpAlarm', neue Portpinbezeichnung 'fpAlarmOut'"
 #endif
 
 // Makros -------------------------------------------------------------------
 
+#if FEATURE_SAFETY_HARDERROR_TRAP
+/// Maximum number of recorded steps of the hard error handling.
+#define SAFETY_HARDERROR_TRAP_STEPS_MAX     (8u)
+
+#endif
+
 // externe Variablen --------------------------------------------------------
 
 // Allgemeine Definitionen --------------------------------------------------
 
+#if FEATURE_SAFETY_HARDERROR_TRAP
+/// Steps of the hard error handling in the order of SOFTQM-587.
+typedef enum
+{
+    eSAFETY_HARDERROR_STEP_LOG = 0,             //!< Hard error code written to the error log
+    eSAFETY_HARDERROR_STEP_MPU,                 //!< Hard error handed over to the MPU handler of the RTOS
+    eSAFETY_HARDERROR_STEP_INTERRUPT_DISABLE,   //!< Interrupts disabled
+    eSAFETY_HARDERROR_STEP_BACKUP,              //!< Hard error code written to the backup register
+    eSAFETY_HARDERROR_STEP_CUSTOM_ACTION,       //!< Safety_HardError_Custom_Action() called
+} SAFETY_HARDERROR_STEP;
+
+/// Record of a trapped hard error and jump target of the trap.
+typedef struct
+{
+    jmp_buf jumpBuffer;                                     ///< Jump target, set with setjmp() after arming the trap
+    U8 hardErrorCode;                                       ///< Code of the hard error
+    bool isPermanent;                                       ///< true for Safety_PermanentHardError()
+    U8 stepCount;                                           ///< Number of executed steps, 0 if no hard error occurred
+    SAFETY_HARDERROR_STEP steps[SAFETY_HARDERROR_TRAP_STEPS_MAX];   ///< Executed steps in call order
+} SAFETY_HARDERROR_RECORD;
+#endif
+
 // Prototypen ---------------------------------------------------------------
+#if FEATURE_SAFETY_HARDERROR_TRAP
+/// Arms the hard error trap of the calling thread. The jump target is set with
+/// setjmp() on the buffer of the record directly afterwards, in the function
+/// calling the code under test. If a hard error occurs, the hard error handling
+/// fills the record, disarms the trap and returns from setjmp() with 1. Usage in
+/// a host test:
+/// \code
+/// SAFETY_HARDERROR_RECORD record;
+/// Safety_HardErrorTrap_Arm(&record);
+/// if(setjmp(record.jumpBuffer) == 0)
+///     {
+///     CodeUnderTest();
+///     }
+/// Safety_HardErrorTrap_Disarm();
+/// // record.stepCount == 0 if no hard error occurred
+/// \endcode
+/// \note The function calling setjmp() must not return before the trap is
+///       disarmed. Local variables changed after setjmp() and read after a hard
+///       error have to be volatile.
+/// \param record Record filled by the next hard error of the calling thread,
+///               NULL disarms the trap.
+extern void Safety_HardErrorTrap_Arm(SAFETY_HARDERROR_RECORD * const record);
+
+/// Disarms the hard error trap of the calling thread. A later hard error ends in
+/// the endless loop again.
+extern void Safety_HardErrorTrap_Disarm(void);
+#endif
+
 /// Initialisierung und Ausführung von Power-On-Self-Tests.
 /// Hierzu gehören RAM-Test, ROM-Test und CPU-Test sowie die
 /// Überprüfung eines Watchdog-Resets.
@@ -0,0 +1,81 @@
+/*******************************************************************************
+ * Copyright (c) 2026 TWK-ELEKTRONIK GmbH. All rights reserved.
+ ******************************************************************************/
+
+// Gemeinsame Headerdateien einbinden --------------------------------------
+#include "config/version.h"
+
+#include "safety_temperature.h"
+
+#if FEATURE_SAFETY_TEMPERATURE_INTEGER
+// Compiler Direktiven -----------------------------------------------------
+
+// Makros ------------------------------------------------------------------
+
+/// Fractional bits of the slope.
+#define TEMPERATURE_SLOPE_SHIFT         (24u)
+
+/// Temperature difference of the calibration points in milli degrees.
+#define TEMPERATURE_CAL_SPAN_MILLIDEG   (100000)
+
+/// Temperature of the first calibration point in milli degrees.
+#define TEMPERATURE_CAL1_MILLIDEG       (30000)
+
+/// Nominal voltage difference of the calibration points in uV.
+#define TEMPERATURE_CAL_SPAN_MICROVOLT  (SAFETY_TEMPERATURE_CAL2_MICROVOLT - SAFETY_TEMPERATURE_CAL1_MICROVOLT)
+
+/// Slope in milli degrees per uV scaled with 2^TEMPERATURE_SLOPE_SHIFT.
+#define TEMPERATURE_SLOPE(spanMicrovolt) \
+    ((S32) ((((S64) TEMPERATURE_CAL_SPAN_MILLIDEG << TEMPERATURE_SLOPE_SHIFT) + ((spanMicrovolt) / 2)) / (spanMicrovolt)))
+
+// Allgemeine Definitionen -------------------------------------------------
+
+// externe Variablen -------------------------------------------------------
+
+/// Sensor voltage at the first calibration point in uV.
+static S32 calibrationMicrovolt = SAFETY_TEMPERATURE_CAL1_MICROVOLT;
+
+/// Slope of the calibrated sensor.
+static S32 calibrationSlope = TEMPERATURE_SLOPE(TEMPERATURE_CAL_SPAN_MICROVOLT);
+
+// Funktionsbereich --------------------------------------------------------
+
+bool Safety_Temperature_Calibrate(S32 const cal1Microvolt, S32 const cal2Microvolt)
+    {
+    S32 const span = cal2Microvolt - cal1Microvolt;
+
+    // Grob von der nominalen Steigung abweichende Kalibrierwerte deuten auf
+    // einen Fehler hin, zulässig ist die halbe bis doppelte Steigung
+    if((span < (TEMPERATURE_CAL_SPAN_MICROVOLT / 2)) || (span > (TEMPERATURE_CAL_SPAN_MICROVOLT * 2)))
+        {
+        return false;
+        }
+
+    calibrationMicrovolt = cal1Microvolt;
+    calibrationSlope = TEMPERATURE_SLOPE(span);
+    return true;
+    }
+//------------------------------------------------------------------------------
+
+bool Safety_Temperature_CalibrateFromDevice(void)
+    {
+    S32 const cal1 = (S32) (((U64) SAFETY_TEMPERATURE_TS_CAL1 * SAFETY_TEMPERATURE_TS_CAL_VREF_MILLIVOLT * 1000u)
+                            / SAFETY_TEMPERATURE_TS_CAL_FULL_SCALE);
+    S32 const cal2 = (S32) (((U64) SAFETY_TEMPERATURE_TS_CAL2 * SAFETY_TEMPERATURE_TS_CAL_VREF_MILLIVOLT * 1000u)
+                            / SAFETY_TEMPERATURE_TS_CAL_FULL_SCALE);
+
+    return Safety_Temperature_Calibrate(cal1, cal2);
+    }
+//------------------------------------------------------------------------------
+
+S32 Safety_Temperature_ConvertMicrovolt(S32 const microvolt)
+    {
+    S64 const delta = (S64) (microvolt - calibrationMicrovolt) * calibrationSlope;
+
+    // Gerundet, der arithmetische Shift rundet ab
+    return TEMPERATURE_CAL1_MILLIDEG
+           + (S32) ((delta + ((S64) 1 << (TEMPERATURE_SLOPE_SHIFT - 1u))) >> TEMPERATURE_SLOPE_SHIFT);
+    }
+//------------------------------------------------------------------------------
+
+#endif // FEATURE_SAFETY_TEMPERATURE_INTEGER
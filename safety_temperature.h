@@ -0,0 +1,99 @@
+/*******************************************************************************
+ * Copyright (c) 2026 TWK-ELEKTRONIK GmbH. All rights reserved.
+ ******************************************************************************/
+
+/**
+ * \defgroup safety_temperature Temperaturumrechnung
+ * \ingroup syspower_check
+ * Ganzzahlige Umrechnung der Spannung des internen Temperatursensors.
+ *
+ * Der interne Sensor ist im Datenblatt linear spezifiziert (V30 und Avg_Slope),
+ * eine Krümmung ist nicht angegeben. Die Temperatur wird deshalb linear aus
+ * der Zweipunktkalibrierung des Herstellers bei 30 °C und 130 °C bestimmt. Die
+ * Steigung wird bei der Kalibrierung einmalig als Festkommawert berechnet,
+ * jede Umrechnung besteht aus einer Multiplikation und einem Shift.
+ *
+ * Genauigkeit der Umrechnung: 1 uV Sensorspannung entspricht bei der nominalen
+ * Steigung von 2,5 mV/K 0,4 mGrad, der Rundungsfehler der Festkommasteigung
+ * bleibt im Bereich -40 °C .. 150 °C unter 1 mGrad. Die Genauigkeit des Sensors
+ * selbst bestimmt das Datenblatt.
+ * @{
+ */
+#ifndef GLOBAL_SAFETY_SAFETY_TEMPERATURE_H_
+#define GLOBAL_SAFETY_SAFETY_TEMPERATURE_H_
+
+// Gemeinsame Headerdateien einbinden ---------------------------------------
+
+// Spezielle Headerdateien einbinden ----------------------------------------
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// Compiler Direktiven ------------------------------------------------------
+
+#ifndef FEATURE_SAFETY_TEMPERATURE_INTEGER
+/// \ingroup feature_flags
+/// Feature flag activating the integer conversion of the internal temperature
+/// sensor instead of ADC_ConvertTemperature(). Deactivated by default.
+#define FEATURE_SAFETY_TEMPERATURE_INTEGER          (0)
+#endif
+
+// Makros -------------------------------------------------------------------
+
+/// Nominal sensor voltage at 30 °C in uV, V30 of the STM32G4 datasheet.
+#define SAFETY_TEMPERATURE_CAL1_MICROVOLT           (760000)
+
+/// Nominal sensor voltage at 130 °C in uV, V30 + 100 K * Avg_Slope 2.5 mV/K.
+#define SAFETY_TEMPERATURE_CAL2_MICROVOLT           (1010000)
+
+#ifndef SAFETY_TEMPERATURE_TS_CAL1
+/// Factory calibration value of the sensor at 30 °C, STM32G4 TS_CAL1.
+#define SAFETY_TEMPERATURE_TS_CAL1                  (*(U16 const volatile *) 0x1FFF75A8u)
+/// Factory calibration value of the sensor at 130 °C, STM32G4 TS_CAL2.
+#define SAFETY_TEMPERATURE_TS_CAL2                  (*(U16 const volatile *) 0x1FFF75CAu)
+#endif
+
+#ifndef SAFETY_TEMPERATURE_TS_CAL_VREF_MILLIVOLT
+/// Reference voltage of the ADC during the factory calibration in mV.
+#define SAFETY_TEMPERATURE_TS_CAL_VREF_MILLIVOLT    (3000u)
+#endif
+
+#ifndef SAFETY_TEMPERATURE_TS_CAL_FULL_SCALE
+/// Full scale value of the ADC during the factory calibration.
+#define SAFETY_TEMPERATURE_TS_CAL_FULL_SCALE        (4095u)
+#endif
+
+// externe Variablen --------------------------------------------------------
+
+// Allgemeine Definitionen --------------------------------------------------
+
+// Prototypen ---------------------------------------------------------------
+
+/// Sets the two point calibration of the sensor. Without calibration the
+/// nominal sensor is used.
+/// \param cal1Microvolt Sensor voltage at 30 °C in uV.
+/// \param cal2Microvolt Sensor voltage at 130 °C in uV.
+/// \return true on success, false if the calibration values are implausible.
+extern bool Safety_Temperature_Calibrate(S32 const cal1Microvolt, S32 const cal2Microvolt);
+
+/// Sets the two point calibration from the factory calibration values
+/// \ref SAFETY_TEMPERATURE_TS_CAL1 and \ref SAFETY_TEMPERATURE_TS_CAL2.
+/// \return true on success, false if the calibration values are implausible.
+extern bool Safety_Temperature_CalibrateFromDevice(void);
+
+/// Converts a sensor voltage into a temperature. The result is not limited,
+/// an implausible voltage gives a temperature outside the error limits.
+/// \param microvolt Sensor voltage in uV.
+/// \return Temperature in milli degrees.
+extern S32 Safety_Temperature_ConvertMicrovolt(S32 const microvolt);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GLOBAL_SAFETY_SAFETY_TEMPERATURE_H_ */
+/**
+ * @}
+ */
@@ -0,0 +1,317 @@
+/*******************************************************************************
+ * Copyright (c) 2026 TWK-ELEKTRONIK GmbH. All rights reserved.
+ ******************************************************************************/
+
+// Gemeinsame Headerdateien einbinden --------------------------------------
+#include "config/version.h"
+
+#include "RTOS_AL/RTOS_AL.h"
+
+#include "safety_trace.h"
+
+#if FEATURE_SAFETY_TRACE
+// Compiler Direktiven -----------------------------------------------------
+
+// Makros ------------------------------------------------------------------
+
+/// Maximum size of an event: fixed fields, 20 digits per number and the name,
+/// each character of the name escaped with up to two characters.
+#define TRACE_EVENT_SIZE_MAX    (160u + (2u * SAFETY_TRACE_NAME_LENGTH_MAX))
+
+#if SAFETY_TRACE_BUFFER_SIZE < (2u * TRACE_EVENT_SIZE_MAX)
+#error "SAFETY_TRACE_BUFFER_SIZE must hold at least two events"
+#endif
+
+#ifndef SAFETY_TRACE_TIMESTAMP_US
+/// Timestamp of the trace events in microseconds. Can be defined by the
+/// simulation for a time resolution below one tick.
+#define SAFETY_TRACE_TIMESTAMP_US()     Safety_Trace_TicksToUs(RTOS_GetTime())
+/// Timestamps are derived from the ticks.
+#define TRACE_TIMESTAMP_FROM_TICKS      (1)
+#else
+#define TRACE_TIMESTAMP_FROM_TICKS      (0)
+#endif
+
+// Allgemeine Definitionen -------------------------------------------------
+
+/// Names of the tracks, in the order of @ref SAFETY_TRACE_TRACK.
+static char const * const trackName[eSAFETY_TRACE_TRACK_COUNT] =
+    {
+    "",
+    "Safety task",
+    "Watchdog",
+    "RTC",
+    "Events",
+    "Hard error"
+    };
+
+/// Categories of the events per track, in the order of @ref SAFETY_TRACE_TRACK.
+static char const * const trackCategory[eSAFETY_TRACE_TRACK_COUNT] =
+    {
+    "",
+    "task",
+    "watchdog",
+    "rtc",
+    "event",
+    "harderror"
+    };
+
+// externe Variablen -------------------------------------------------------
+
+/// Output buffer.
+static char traceBuffer[SAFETY_TRACE_BUFFER_SIZE];
+
+/// Number of bytes in the output buffer.
+static U32 traceFill = 0;
+
+/// Output function, NULL while no trace is open.
+static SAFETY_TRACE_SINK traceSink = NULL;
+
+/// Context of the output function.
+static void * traceContext = NULL;
+
+/// Set until the first event is written, events are separated by a comma.
+static bool traceFirstEvent = true;
+
+#if TRACE_TIMESTAMP_FROM_TICKS
+/// Last ticks for the extension of the tick counter to 64 bits.
+static U32 traceLastTicks = 0;
+
+/// Overflows of the tick counter since the start of the trace.
+static U32 traceTickOverflows = 0;
+#endif
+
+// Funktionsbereich --------------------------------------------------------
+
+#if TRACE_TIMESTAMP_FROM_TICKS
+/// Converts ticks into microseconds, overflows of the tick counter are counted.
+/// \param ticks Current ticks.
+/// \return Time since tick 0 in microseconds.
+static U64 Safety_Trace_TicksToUs(U32 const ticks);
+#endif
+
+/// Writes the header of an event up to the timestamp.
+/// \param track Track of the event.
+/// \param name Name of the event.
+/// \param phase Phase of the event ('B', 'E', 'i', 'M').
+static void Safety_Trace_PutEventStart(SAFETY_TRACE_TRACK const track, char const * const name, char const phase);
+
+/// Appends a string without escaping.
+/// \param text Terminated string.
+static void Safety_Trace_PutText(char const * text);
+
+/// Appends a name as JSON string content, truncated to @ref SAFETY_TRACE_NAME_LENGTH_MAX.
+/// \param name Terminated string, NULL is written as an empty string.
+static void Safety_Trace_PutName(char const * name);
+
+/// Appends a decimal number.
+/// \param value Number.
+static void Safety_Trace_PutNumber(U64 value);
+
+/// Writes the metadata naming the process and the tracks.
+static void Safety_Trace_PutMetadata(void);
+
+bool Safety_Trace_Open(SAFETY_TRACE_SINK const sink, void * const context)
+    {
+    if((sink == NULL) || (traceSink != NULL))
+        {
+        return false;
+        }
+
+    traceSink = sink;
+    traceContext = context;
+    traceFill = 0;
+    traceFirstEvent = true;
+#if TRACE_TIMESTAMP_FROM_TICKS
+    traceLastTicks = RTOS_GetTime();
+    traceTickOverflows = 0;
+#endif
+
+    Safety_Trace_PutText("[");
+    Safety_Trace_PutMetadata();
+    return true;
+    }
+//------------------------------------------------------------------------------
+
+void Safety_Trace_Close(void)
+    {
+    if(traceSink == NULL)
+        {
+        return;
+        }
+
+    Safety_Trace_PutText("\n]\n");
+    Safety_Trace_Flush();
+    traceSink = NULL;
+    traceContext = NULL;
+    }
+//------------------------------------------------------------------------------
+
+void Safety_Trace_Flush(void)
+    {
+    if((traceSink != NULL) && (traceFill > 0u))
+        {
+        traceSink(traceBuffer, traceFill, traceContext);
+        }
+    traceFill = 0;
+    }
+//------------------------------------------------------------------------------
+
+void Safety_Trace_Begin(SAFETY_TRACE_TRACK const track, char const * const name)
+    {
+    if(traceSink == NULL)
+        {
+        return;
+        }
+
+    Safety_Trace_PutEventStart(track, name, 'B');
+    Safety_Trace_PutText("}");
+    }
+//------------------------------------------------------------------------------
+
+void Safety_Trace_End(SAFETY_TRACE_TRACK const track, char const * const name)
+    {
+    if(traceSink == NULL)
+        {
+        return;
+        }
+
+    Safety_Trace_PutEventStart(track, name, 'E');
+    Safety_Trace_PutText("}");
+    }
+//------------------------------------------------------------------------------
+
+void Safety_Trace_Instant(SAFETY_TRACE_TRACK const track, char const * const name, U32 const value)
+    {
+    if(traceSink == NULL)
+        {
+        return;
+        }
+
+    Safety_Trace_PutEventStart(track, name, 'i');
+    Safety_Trace_PutText(",\"s\":\"t\",\"args\":{\"value\":");
+    Safety_Trace_PutNumber(value);
+    Safety_Trace_PutText("}}");
+    }
+//------------------------------------------------------------------------------
+
+#if TRACE_TIMESTAMP_FROM_TICKS
+static U64 Safety_Trace_TicksToUs(U32 const ticks)
+    {
+    if(ticks < traceLastTicks)
+        {
+        traceTickOverflows++;
+        }
+    traceLastTicks = ticks;
+
+    return ((((U64) traceTickOverflows << 32) | ticks) * 1000u) / configTICK_RATE_HZ_MS;
+    }
+//------------------------------------------------------------------------------
+#endif
+
+static void Safety_Trace_PutEventStart(SAFETY_TRACE_TRACK const track, char const * const name, char const phase)
+    {
+    char phaseText[2];
+    U32 const trackIndex = ((U32) track < (U32) eSAFETY_TRACE_TRACK_COUNT) ? (U32) track : 0u;
+
+    // Platz für ein vollständiges Ereignis, Puffer nur blockweise ausgeben
+    if((traceFill + TRACE_EVENT_SIZE_MAX) > SAFETY_TRACE_BUFFER_SIZE)
+        {
+        Safety_Trace_Flush();
+        }
+
+    phaseText[0] = phase;
+    phaseText[1] = '\0';
+
+    Safety_Trace_PutText(traceFirstEvent ? "\n{\"name\":\"" : ",\n{\"name\":\"");
+    traceFirstEvent = false;
+    Safety_Trace_PutName(name);
+    Safety_Trace_PutText("\",\"cat\":\"");
+    Safety_Trace_PutText(trackCategory[trackIndex]);
+    Safety_Trace_PutText("\",\"ph\":\"");
+    Safety_Trace_PutText(phaseText);
+    Safety_Trace_PutText("\",\"pid\":1,\"tid\":");
+    Safety_Trace_PutNumber(trackIndex);
+
+    if(phase != 'M')
+        {
+        Safety_Trace_PutText(",\"ts\":");
+        Safety_Trace_PutNumber(SAFETY_TRACE_TIMESTAMP_US());
+        }
+    }
+//------------------------------------------------------------------------------
+
+static void Safety_Trace_PutText(char const * text)
+    {
+    while((*text != '\0') && (traceFill < SAFETY_TRACE_BUFFER_SIZE))
+        {
+        traceBuffer[traceFill++] = *text++;
+        }
+    }
+//------------------------------------------------------------------------------
+
+static void Safety_Trace_PutName(char const * name)
+    {
+    U32 length = 0;
+    char c;
+
+    if(name == NULL)
+        {
+        return;
+        }
+
+    while((name[length] != '\0') && (length < SAFETY_TRACE_NAME_LENGTH_MAX))
+        {
+        c = name[length++];
+
+        if((c == '"') || (c == '\\'))
+            {
+            traceBuffer[traceFill++] = '\\';
+            }
+        else if((U8) c < 0x20u)
+            {
+            // Steuerzeichen haben in Namen keine Bedeutung
+            c = ' ';
+            }
+        traceBuffer[traceFill++] = c;
+        }
+    }
+//------------------------------------------------------------------------------
+
+static void Safety_Trace_PutNumber(U64 value)
+    {
+    char digits[21];
+    U8 count = 0;
+
+    do
+        {
+        digits[count++] = (char) ('0' + (value % 10u));
+        value /= 10u;
+        }
+    while(value != 0u);
+
+    while(count > 0u)
+        {
+        traceBuffer[traceFill++] = digits[--count];
+        }
+    }
+//------------------------------------------------------------------------------
+
+static void Safety_Trace_PutMetadata(void)
+    {
+    U32 track;
+
+    Safety_Trace_PutEventStart((SAFETY_TRACE_TRACK) 0, "process_name", 'M');
+    Safety_Trace_PutText(",\"args\":{\"name\":\"Safety\"}}");
+
+    for(track = (U32) eSAFETY_TRACE_TRACK_TASK; track < (U32) eSAFETY_TRACE_TRACK_COUNT; track++)
+        {
+        Safety_Trace_PutEventStart((SAFETY_TRACE_TRACK) track, "thread_name", 'M');
+        Safety_Trace_PutText(",\"args\":{\"name\":\"");
+        Safety_Trace_PutText(trackName[track]);
+        Safety_Trace_PutText("\"}}");
+        }
+    }
+//------------------------------------------------------------------------------
+
+#endif // FEATURE_SAFETY_TRACE
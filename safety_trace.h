@@ -0,0 +1,147 @@
+/*******************************************************************************
+ * Copyright (c) 2026 TWK-ELEKTRONIK GmbH. All rights reserved.
+ ******************************************************************************/
+
+/**
+ * \defgroup safety_trace Zeitverlauf der Sicherheitsfunktionen
+ * \ingroup safety_utils
+ * Aufzeichnung des Zeitverlaufs der Sicherheitsfunktionen in der Simulation.
+ *
+ * Mit @ref FEATURE_SAFETY_TRACE melden die Sicherheitsfunktionen ihren Ablauf
+ * als Trace-Ereignisse:
+ *
+ *  | Spur        | Ereignisse                                                        |
+ *  |:------------|:------------------------------------------------------------------|
+ *  | Safety task | Safety_Runtime_Execute(), Laufzeitprüfungen, Programmablauf, STL-Abschnitte (Dauer) |
+ *  | Watchdog    | Trigger, zurückgehaltener Trigger                                 |
+ *  | RTC         | Sekunden-Callback                                                 |
+ *  | Events      | Ereignisse und Fehlerereignisse der Sicherheitstask               |
+ *  | Hard error  | Hard-Error und permanenter Hard-Error mit Fehlercode              |
+ *
+ * Die Ereignisse werden im JSON-Format von Chrome-Trace/Perfetto
+ * (JSON Array Format) in einen Puffer geschrieben und blockweise an eine
+ * Ausgabefunktion der Simulation übergeben, z.B. fwrite() in eine Datei. Die
+ * Datei lässt sich direkt in ui.perfetto.dev oder chrome://tracing öffnen. Das
+ * Format erlaubt eine fehlende schließende Klammer, ein Trace, der mit einem
+ * Hard-Error endet, ist damit ohne Safety_Trace_Close() gültig.
+ *
+ * Zeitstempel sind die virtuellen Ticks der Simulation (RTOS_GetTime()) in
+ * Mikrosekunden. Eine Simulation mit feinerer Zeitauflösung definiert
+ * @ref SAFETY_TRACE_TIMESTAMP_US.
+ *
+ * Nur für Simulation und Host-Builds. Die Funktionen sind nicht reentrant,
+ * alle Kontexte (Sicherheitstask, RTC-Callback) müssen nacheinander laufen.
+ * @{
+ */
+#ifndef GLOBAL_SAFETY_SAFETY_TRACE_H_
+#define GLOBAL_SAFETY_SAFETY_TRACE_H_
+
+// Gemeinsame Headerdateien einbinden ---------------------------------------
+
+// Spezielle Headerdateien einbinden ----------------------------------------
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// Compiler Direktiven ------------------------------------------------------
+
+#ifndef FEATURE_SAFETY_TRACE
+/// \ingroup feature_flags
+/// Feature flag for simulation and host builds only: the safety functions emit
+/// trace events in the Chrome trace / Perfetto JSON format. Deactivated by default.
+#define FEATURE_SAFETY_TRACE            (0)
+#endif
+
+// Makros -------------------------------------------------------------------
+
+#ifndef SAFETY_TRACE_BUFFER_SIZE
+/// Size of the output buffer in bytes, written to the sink when full.
+#define SAFETY_TRACE_BUFFER_SIZE        (8192u)
+#endif
+
+#ifndef SAFETY_TRACE_NAME_LENGTH_MAX
+/// Maximum length of an event name, longer names are truncated.
+#define SAFETY_TRACE_NAME_LENGTH_MAX    (48u)
+#endif
+
+#if FEATURE_SAFETY_TRACE
+/// Begins a duration event on a track.
+#define SAFETY_TRACE_BEGIN(track, name)             Safety_Trace_Begin((track), (name))
+/// Ends the last duration event on a track.
+#define SAFETY_TRACE_END(track, name)               Safety_Trace_End((track), (name))
+/// Emits an instant event with a value on a track.
+#define SAFETY_TRACE_INSTANT(track, name, value)    Safety_Trace_Instant((track), (name), (value))
+/// Writes the buffered events to the sink.
+#define SAFETY_TRACE_FLUSH()                        Safety_Trace_Flush()
+#else
+#define SAFETY_TRACE_BEGIN(track, name)             ((void) 0)
+#define SAFETY_TRACE_END(track, name)               ((void) 0)
+#define SAFETY_TRACE_INSTANT(track, name, value)    ((void) 0)
+#define SAFETY_TRACE_FLUSH()                        ((void) 0)
+#endif
+
+// externe Variablen --------------------------------------------------------
+
+// Allgemeine Definitionen --------------------------------------------------
+
+/// Tracks of the timeline, the value is the thread id in the trace.
+typedef enum
+{
+    eSAFETY_TRACE_TRACK_TASK = 1,       //!< Safety task, duration events
+    eSAFETY_TRACE_TRACK_WATCHDOG,       //!< Watchdog trigger
+    eSAFETY_TRACE_TRACK_RTC,            //!< RTC second callback
+    eSAFETY_TRACE_TRACK_EVENT,          //!< Events of the safety task
+    eSAFETY_TRACE_TRACK_HARDERROR,      //!< Hard errors
+    eSAFETY_TRACE_TRACK_COUNT,          //!< Number of tracks + 1
+} SAFETY_TRACE_TRACK;
+
+/// Output function of the trace, e.g. writing to a file.
+/// \param data Trace data, not terminated.
+/// \param length Length of the data in bytes.
+/// \param context Context passed to Safety_Trace_Open().
+typedef void (*SAFETY_TRACE_SINK)(char const * data, U32 length, void * context);
+
+// Prototypen ---------------------------------------------------------------
+
+#if FEATURE_SAFETY_TRACE
+
+/// Starts a trace. Events before the start are discarded.
+/// \param sink Output function.
+/// \param context Context of the output function.
+/// \return true on success, false if the sink is NULL or a trace is already open.
+extern bool Safety_Trace_Open(SAFETY_TRACE_SINK const sink, void * const context);
+
+/// Completes the trace, writes all buffered events and the closing bracket.
+extern void Safety_Trace_Close(void);
+
+/// Writes all buffered events to the sink, e.g. before the simulation stops.
+extern void Safety_Trace_Flush(void);
+
+/// Begins a duration event. Use @ref SAFETY_TRACE_BEGIN.
+/// \param track Track of the event.
+/// \param name Name of the event, NULL for an unnamed event.
+extern void Safety_Trace_Begin(SAFETY_TRACE_TRACK const track, char const * const name);
+
+/// Ends the last duration event of a track. Use @ref SAFETY_TRACE_END.
+/// \param track Track of the event.
+/// \param name Name of the event, NULL for an unnamed event.
+extern void Safety_Trace_End(SAFETY_TRACE_TRACK const track, char const * const name);
+
+/// Emits an instant event. Use @ref SAFETY_TRACE_INSTANT.
+/// \param track Track of the event.
+/// \param name Name of the event, NULL for an unnamed event.
+/// \param value Value shown as argument of the event, e.g. an event number or error code.
+extern void Safety_Trace_Instant(SAFETY_TRACE_TRACK const track, char const * const name, U32 const value);
+
+#endif // FEATURE_SAFETY_TRACE
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GLOBAL_SAFETY_SAFETY_TRACE_H_ */
+/**
+ * @}
+ */
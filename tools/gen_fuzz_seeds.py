@@ -0,0 +1,117 @@
+#!/usr/bin/env python3
+# Copyright (c) 2026 TWK-ELEKTRONIK GmbH. All rights reserved.
+"""Generator des Saatkorpus von tools/safety_fuzz.c.
+
+Erzeugt je Szenario eine Eingabe im Format der Fuzz-Harness:
+
+    Byte 0-1   Konfigurationsbits (Little Endian), Bit n aktiviert das n-te
+               Element von SAFETY_POWERSUPPLY_CONFIG
+    Byte 2     Startzeit, Bits 24-31 der Systemticks
+    je Zyklus  Ticks seit dem vorherigen Zyklus, Steuerbyte und die
+               Rohwerte (16 Bit, Little Endian) in der Reihenfolge der Abfrage
+
+Die Kanalperioden sind 0 und der ADC ist bereit, damit liest jeder Zyklus alle
+aktiven Kanaele: Strom, Vcc, externer ADC, TMP144. Der externe ADC liefert in
+jedem Zyklus Werte, sonst endet der Lauf nach WAIT_EXTERNAL_ADC_STARTUP_MS mit
+einem Hard-Error. Der Rohwert 0xFFFF ist ein Fehler des internen ADC. Die
+Mutationen des Fuzzers gehen von diesen Eingaben aus.
+
+Die Nennwerte liegen innerhalb der Grenzen der Platinenkonfiguration des
+Host-Builds (VOLTAGE_VCC_FACTOR, CURRENT_FACTOR, POWER_LIMIT_MAX_WATT und
+Spannungsteiler des externen ADC) und sind fuer andere Platinen anzupassen.
+
+Aufruf:
+    python3 tools/gen_fuzz_seeds.py [--output tools/safety_fuzz_seeds]
+"""
+
+import argparse
+import os
+import struct
+
+CONFIG_SUPPLY_VOLTAGE = 1 << 0
+CONFIG_EXT_ADC_CHANNEL1 = 1 << 6
+CONFIG_CURRENT = 1 << 9
+CONFIG_TEMPERATURE_SENSOR = 1 << 10
+
+CONTROL_ADC_READY = 0x01
+CONTROL_EXT_ADC = 0x02
+CONTROL_TMP144 = 0x04
+
+ADC_VOLT_PER_LSB = 3.6 / 65534.0
+TMP144_DEG_PER_LSB = 0.01
+EXT_ADC_FULL_SCALE = 8.0
+RAW_ADC_FAILURE = 0xFFFF
+
+CYCLE_TICKS = 10
+VCC_NOMINAL = 1.42
+VCC_DROPOUT = 0.5
+CURRENT_NOMINAL = 0.005
+EXT_ADC_NOMINAL = 2.0
+
+
+def adc(voltage):
+    """Rohwert des internen ADC bei der Spannung am Pin in V."""
+    return int(round(voltage / ADC_VOLT_PER_LSB))
+
+
+def ext_adc(value):
+    """Rohwert des externen ADC beim normierten Wert des Kanals."""
+    return int(round(value * 65535.0 / EXT_ADC_FULL_SCALE))
+
+
+def tmp144(temperature):
+    """Rohwert des TMP144 bei der Temperatur in Grad."""
+    return int(round(temperature / TMP144_DEG_PER_LSB)) & 0xFFFF
+
+
+def seed(config, cycles, start=0):
+    """Eingabe aus der Konfiguration und den Zyklen (Ticks, Steuerbyte, Rohwerte)."""
+    data = struct.pack('<HB', config, start)
+    for ticks, control, raws in cycles:
+        data += struct.pack('<BB', ticks, control)
+        data += b''.join(struct.pack('<H', raw) for raw in raws)
+    return data
+
+
+def vcc_cycles(count, voltage=VCC_NOMINAL, control=CONTROL_ADC_READY | CONTROL_EXT_ADC):
+    return [(CYCLE_TICKS, control, [adc(voltage)])] * count
+
+
+def scenarios():
+    vcc = CONFIG_SUPPLY_VOLTAGE
+    ready = CONTROL_ADC_READY | CONTROL_EXT_ADC
+    return {
+        'seed-vcc-nominal': seed(vcc, vcc_cycles(100)),
+        'seed-vcc-dropout': seed(vcc, vcc_cycles(30) + vcc_cycles(20, VCC_DROPOUT) + vcc_cycles(30)),
+        'seed-vcc-adc-failure': seed(vcc, vcc_cycles(30) + [(CYCLE_TICKS, ready, [RAW_ADC_FAILURE])]),
+        # Ohne Bereitschaftssignal startet der ADC nach SYSPWR_STARTUP_DELAY_MS (20 ms)
+        'seed-vcc-startup-delay': seed(vcc, [(CYCLE_TICKS, CONTROL_EXT_ADC, [])] + vcc_cycles(50, control=CONTROL_EXT_ADC)),
+        'seed-vcc-late-start': seed(vcc, vcc_cycles(50), start=0xFF),
+        'seed-current': seed(vcc | CONFIG_CURRENT,
+                             [(CYCLE_TICKS, ready, [adc(CURRENT_NOMINAL), adc(VCC_NOMINAL)])] * 100),
+        # TMP144 liefert zunaechst Werte und faellt dann aus
+        'seed-tmp144': seed(vcc | CONFIG_TEMPERATURE_SENSOR,
+                            [(CYCLE_TICKS, ready | CONTROL_TMP144, [adc(VCC_NOMINAL), tmp144(25.0)])] * 50
+                            + vcc_cycles(50)),
+        'seed-ext-adc': seed(vcc | CONFIG_EXT_ADC_CHANNEL1,
+                             [(CYCLE_TICKS, ready, [adc(VCC_NOMINAL), ext_adc(EXT_ADC_NOMINAL)])] * 100),
+        # Externer ADC liefert nach der Startphase keine Werte mehr
+        'seed-ext-adc-missing': seed(vcc, vcc_cycles(10) + vcc_cycles(20, control=CONTROL_ADC_READY)),
+    }
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--output', default=os.path.join(os.path.dirname(os.path.abspath(__file__)), 'safety_fuzz_seeds'),
+                        help='Verzeichnis des Saatkorpus')
+    args = parser.parse_args()
+
+    os.makedirs(args.output, exist_ok=True)
+    for name, data in sorted(scenarios().items()):
+        with open(os.path.join(args.output, name), 'wb') as file:
+            file.write(data)
+        print('%s: %d bytes' % (name, len(data)))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,531 @@
+/*******************************************************************************
+ * Copyright (c) 2026 TWK-ELEKTRONIK GmbH. All rights reserved.
+ ******************************************************************************/
+
+/*
+ * POSIX-Backend des RTOS_AL für Host-Builds, siehe rtos_al_posix.h.
+ *
+ * Übersetzen zusammen mit den Modulen und den Konfigurations-Defines des
+ * Geräts, z.B.:
+ *
+ *     gcc -O2 -pthread <GLOBAL_DEFINES> -I<LibCert> -I. tools/rtos_al_posix.c ...
+ */
+
+// Headerdateien einbinden -----------------------------------------------------
+#define _GNU_SOURCE
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "config/version.h"
+
+#include "RTOS_AL/RTOS_AL.h"
+
+#include "rtos_al_posix.h"
+
+// Allgemeine Definitionen -----------------------------------------------------
+
+/// Nanoseconds per second.
+#define NS_PER_SECOND       (1000000000ull)
+
+/// Parameters of a task thread.
+typedef struct
+{
+    RTOS_TASK_FUNCTION function;    ///< Task function
+    void * parameter;               ///< Parameter of the task function
+} RTOS_POSIX_TASK;
+
+/// Task of the RTOS_AL mapped to its thread.
+typedef struct
+{
+    RTOS_TASK const * handle;       ///< Task object of the RTOS_AL
+    pthread_t thread;               ///< Thread of the task
+} RTOS_POSIX_TASK_ENTRY;
+
+/// Mutex of the RTOS_AL mapped to a pthread mutex.
+typedef struct
+{
+    RTOS_MUTEX const * handle;                  ///< Mutex object of the RTOS_AL
+    pthread_mutex_t mutex;                      ///< pthread mutex
+    RTOS_POSIX_MUTEX_STATISTICS statistics;     ///< Statistics, updated while the mutex is held
+} RTOS_POSIX_MUTEX;
+
+// externe Variablen -----------------------------------------------------------
+
+/// Start of the time base.
+static struct timespec timeOrigin;
+
+/// Initializes the time base once.
+static pthread_once_t timeOriginOnce = PTHREAD_ONCE_INIT;
+
+/// Protects the scheduler start and the creation of objects.
+static pthread_mutex_t registryLock = PTHREAD_MUTEX_INITIALIZER;
+
+/// Signals the scheduler start to the waiting tasks.
+static pthread_cond_t startCondition = PTHREAD_COND_INITIALIZER;
+
+/// Set by RtosPosix_Start().
+static bool schedulerRunning = false;
+
+/// Cleared as soon as a task fell back to the default policy.
+static bool realtime = true;
+
+/// Created tasks.
+static RTOS_POSIX_TASK_ENTRY tasks[RTOS_POSIX_TASKS_MAX];
+
+/// Number of created tasks, published after the entry is complete.
+static U32 numTasks = 0;
+
+/// Created mutexes.
+static RTOS_POSIX_MUTEX mutexes[RTOS_POSIX_MUTEXES_MAX];
+
+/// Number of created mutexes, published after the entry is complete.
+static U32 numMutexes = 0;
+
+// Funktionsbereich ------------------------------------------------------------
+
+/// Captures the start of the time base.
+static void RtosPosix_InitTimeOrigin(void);
+
+/// Ticks since the start of the time base, without overflow.
+/// \return Ticks.
+static U64 RtosPosix_GetTicks(void);
+
+/// Creates a thread running a task function after the scheduler start.
+/// \param name Name of the thread, truncated to 15 characters.
+/// \param function Task function.
+/// \param priority Priority of the task.
+/// \param parameter Parameter of the task function.
+/// \param thread Returns the created thread.
+/// \return true on success, otherwise false.
+static bool RtosPosix_CreateThread(char const * const name, RTOS_TASK_FUNCTION const function, U8 const priority,
+                                   void * const parameter, pthread_t * const thread);
+
+/// Thread function, waits for the scheduler start and runs the task.
+/// \param parameter Allocated @ref RTOS_POSIX_TASK.
+/// \return NULL, tasks do not return.
+static void * RtosPosix_Thread(void * parameter);
+
+/// Finds the entry of a task.
+/// \param handle Task object of the RTOS_AL.
+/// \return Entry, NULL if the task was not created.
+static RTOS_POSIX_TASK_ENTRY * RtosPosix_FindTask(RTOS_TASK const * const handle);
+
+/// Finds the entry of a mutex.
+/// \param handle Mutex object of the RTOS_AL.
+/// \return Entry, NULL if the mutex was not created.
+static RTOS_POSIX_MUTEX * RtosPosix_FindMutex(RTOS_MUTEX const * const handle);
+
+/// Task function of a load generator.
+/// \param parameter @ref RTOS_POSIX_LOAD.
+static void RtosPosix_LoadTask(void * parameter);
+
+RTOS_TIME RTOS_GetTime(void)
+    {
+    return (RTOS_TIME) RtosPosix_GetTicks();
+    }
+//------------------------------------------------------------------------------
+
+void RTOS_DelayUntil(RTOS_TIME * const previousWakeTime, U32 const timeIncrement)
+    {
+    U64 const now = RtosPosix_GetTicks();
+    RTOS_TIME const wakeTime = *previousWakeTime + timeIncrement;
+    // Weckzeitpunkt relativ zur aktuellen Zeit, auch über den Überlauf der Ticks
+    S64 const wakeTicks = (S64) now + (S32) (wakeTime - (RTOS_TIME) now);
+    U64 wakeNs;
+    struct timespec wakeup;
+
+    *previousWakeTime = wakeTime;
+
+    if(wakeTicks <= (S64) now)
+        {
+        return;
+        }
+
+    wakeNs = ((U64) wakeTicks * NS_PER_SECOND) / RTOS_TICK_RATE;
+    wakeup.tv_sec = timeOrigin.tv_sec + (time_t) (wakeNs / NS_PER_SECOND);
+    wakeup.tv_nsec = timeOrigin.tv_nsec + (long) (wakeNs % NS_PER_SECOND);
+    if(wakeup.tv_nsec >= (long) NS_PER_SECOND)
+        {
+        wakeup.tv_sec++;
+        wakeup.tv_nsec -= (long) NS_PER_SECOND;
+        }
+
+    while(clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wakeup, NULL) == EINTR)
+        {
+        }
+    }
+//------------------------------------------------------------------------------
+
+bool RTOS_TaskCreate(RTOS_TASK * const task, char const * const name, RTOS_TASK_FUNCTION const function,
+                     U8 const priority, void * const parameter)
+    {
+    RTOS_POSIX_TASK_ENTRY * entry;
+    bool result;
+
+    if((task == NULL) || (function == NULL))
+        {
+        return false;
+        }
+
+    pthread_mutex_lock(&registryLock);
+
+    // Ein Taskobjekt gehört wie im RTOS zu genau einer Task
+    result = (RtosPosix_FindTask(task) == NULL) && (numTasks < RTOS_POSIX_TASKS_MAX);
+    if(result)
+        {
+        entry = &tasks[numTasks];
+        entry->handle = task;
+        result = RtosPosix_CreateThread(name, function, priority, parameter, &entry->thread);
+        if(result)
+            {
+            __atomic_store_n(&numTasks, numTasks + 1u, __ATOMIC_RELEASE);
+            }
+        }
+
+    pthread_mutex_unlock(&registryLock);
+    return result;
+    }
+//------------------------------------------------------------------------------
+
+bool RTOS_IsRunning(void)
+    {
+    return __atomic_load_n(&schedulerRunning, __ATOMIC_ACQUIRE);
+    }
+//------------------------------------------------------------------------------
+
+bool RTOS_MutexCreate(RTOS_MUTEX * const mutex)
+    {
+    pthread_mutexattr_t attributes;
+    RTOS_POSIX_MUTEX * entry;
+    bool result;
+
+    if(mutex == NULL)
+        {
+        return false;
+        }
+
+    pthread_mutex_lock(&registryLock);
+
+    result = (RtosPosix_FindMutex(mutex) != NULL);
+    if(!result && (numMutexes < RTOS_POSIX_MUTEXES_MAX))
+        {
+        entry = &mutexes[numMutexes];
+        memset(entry, 0, sizeof(*entry));
+        entry->handle = mutex;
+
+        // Prioritätsvererbung wie bei den Mutexen des RTOS
+        pthread_mutexattr_init(&attributes);
+        pthread_mutexattr_setprotocol(&attributes, PTHREAD_PRIO_INHERIT);
+        result = (pthread_mutex_init(&entry->mutex, &attributes) == 0);
+        pthread_mutexattr_destroy(&attributes);
+
+        if(result)
+            {
+            __atomic_store_n(&numMutexes, numMutexes + 1u, __ATOMIC_RELEASE);
+            }
+        }
+
+    pthread_mutex_unlock(&registryLock);
+    return result;
+    }
+//------------------------------------------------------------------------------
+
+bool RTOS_MutexTake(RTOS_MUTEX * const mutex, U32 const timeout)
+    {
+    RTOS_POSIX_MUTEX * const entry = RtosPosix_FindMutex(mutex);
+    struct timespec deadline;
+    U64 waitStart;
+    U64 waitNs;
+    int error;
+
+    if(entry == NULL)
+        {
+        return false;
+        }
+
+    if(pthread_mutex_trylock(&entry->mutex) == 0)
+        {
+        entry->statistics.takes++;
+        return true;
+        }
+
+    waitStart = RtosPosix_GetTimeNs();
+
+    if(timeout == 0u)
+        {
+        error = EBUSY;
+        }
+    else if(timeout == RTOS_MAX_TIMEOUT)
+        {
+        error = pthread_mutex_lock(&entry->mutex);
+        }
+    else
+        {
+        // pthread_mutex_timedlock() erwartet CLOCK_REALTIME
+        clock_gettime(CLOCK_REALTIME, &deadline);
+        waitNs = ((U64) timeout * NS_PER_SECOND) / RTOS_TICK_RATE;
+        deadline.tv_sec += (time_t) (waitNs / NS_PER_SECOND);
+        deadline.tv_nsec += (long) (waitNs % NS_PER_SECOND);
+        if(deadline.tv_nsec >= (long) NS_PER_SECOND)
+            {
+            deadline.tv_sec++;
+            deadline.tv_nsec -= (long) NS_PER_SECOND;
+            }
+        error = pthread_mutex_timedlock(&entry->mutex, &deadline);
+        }
+
+    if(error != 0)
+        {
+        __atomic_fetch_add(&entry->statistics.timeouts, 1u, __ATOMIC_RELAXED);
+        return false;
+        }
+
+    waitNs = RtosPosix_GetTimeNs() - waitStart;
+    entry->statistics.takes++;
+    entry->statistics.contended++;
+    entry->statistics.waitNsTotal += waitNs;
+    if(waitNs > entry->statistics.waitNsMax)
+        {
+        entry->statistics.waitNsMax = waitNs;
+        }
+    return true;
+    }
+//------------------------------------------------------------------------------
+
+bool RTOS_MutexGive(RTOS_MUTEX * const mutex)
+    {
+    RTOS_POSIX_MUTEX * const entry = RtosPosix_FindMutex(mutex);
+
+    return (entry != NULL) && (pthread_mutex_unlock(&entry->mutex) == 0);
+    }
+//------------------------------------------------------------------------------
+
+void RtosPosix_Start(void)
+    {
+    pthread_once(&timeOriginOnce, RtosPosix_InitTimeOrigin);
+
+    pthread_mutex_lock(&registryLock);
+    __atomic_store_n(&schedulerRunning, true, __ATOMIC_RELEASE);
+    pthread_cond_broadcast(&startCondition);
+    pthread_mutex_unlock(&registryLock);
+    }
+//------------------------------------------------------------------------------
+
+bool RtosPosix_IsRealtime(void)
+    {
+    return __atomic_load_n(&realtime, __ATOMIC_RELAXED);
+    }
+//------------------------------------------------------------------------------
+
+bool RtosPosix_CreateLoad(RTOS_POSIX_LOAD * const load, char const * const name, U8 const priority)
+    {
+    pthread_t thread;
+
+    if((load == NULL) || (load->period == 0u))
+        {
+        return false;
+        }
+
+    load->cycles = 0;
+    return RtosPosix_CreateThread(name, RtosPosix_LoadTask, priority, load, &thread);
+    }
+//------------------------------------------------------------------------------
+
+bool RtosPosix_GetTaskThread(RTOS_TASK const * const task, pthread_t * const thread)
+    {
+    RTOS_POSIX_TASK_ENTRY * const entry = RtosPosix_FindTask(task);
+
+    if((entry == NULL) || (thread == NULL))
+        {
+        return false;
+        }
+
+    *thread = entry->thread;
+    return true;
+    }
+//------------------------------------------------------------------------------
+
+bool RtosPosix_GetMutexStatistics(RTOS_MUTEX const * const mutex, RTOS_POSIX_MUTEX_STATISTICS * const statistics)
+    {
+    RTOS_POSIX_MUTEX * const entry = RtosPosix_FindMutex(mutex);
+
+    if((entry == NULL) || (statistics == NULL))
+        {
+        return false;
+        }
+
+    // Die Zähler werden unter dem Mutex geändert, die Kopie ist damit konsistent
+    pthread_mutex_lock(&entry->mutex);
+    *statistics = entry->statistics;
+    pthread_mutex_unlock(&entry->mutex);
+    statistics->timeouts = __atomic_load_n(&entry->statistics.timeouts, __ATOMIC_RELAXED);
+    return true;
+    }
+//------------------------------------------------------------------------------
+
+U64 RtosPosix_GetTimeNs(void)
+    {
+    struct timespec now;
+
+    pthread_once(&timeOriginOnce, RtosPosix_InitTimeOrigin);
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((U64) (now.tv_sec - timeOrigin.tv_sec) * NS_PER_SECOND) + (U64) now.tv_nsec - (U64) timeOrigin.tv_nsec;
+    }
+//------------------------------------------------------------------------------
+
+static void RtosPosix_InitTimeOrigin(void)
+    {
+    clock_gettime(CLOCK_MONOTONIC, &timeOrigin);
+    }
+//------------------------------------------------------------------------------
+
+static U64 RtosPosix_GetTicks(void)
+    {
+    return (RtosPosix_GetTimeNs() * RTOS_TICK_RATE) / NS_PER_SECOND;
+    }
+//------------------------------------------------------------------------------
+
+static bool RtosPosix_CreateThread(char const * const name, RTOS_TASK_FUNCTION const function, U8 const priority,
+                                   void * const parameter, pthread_t * const thread)
+    {
+    RTOS_POSIX_TASK * task;
+    pthread_attr_t attributes;
+    struct sched_param schedParam;
+    char threadName[16];
+    int error;
+
+    task = malloc(sizeof(*task));
+    if(task == NULL)
+        {
+        return false;
+        }
+    task->function = function;
+    task->parameter = parameter;
+
+    pthread_once(&timeOriginOnce, RtosPosix_InitTimeOrigin);
+
+    // Priorität des RTOS auf SCHED_FIFO abbilden, höhere Zahl ist höhere Priorität
+    memset(&schedParam, 0, sizeof(schedParam));
+    schedParam.sched_priority = sched_get_priority_min(SCHED_FIFO) + priority;
+    if(schedParam.sched_priority > sched_get_priority_max(SCHED_FIFO))
+        {
+        schedParam.sched_priority = sched_get_priority_max(SCHED_FIFO);
+        }
+
+    pthread_attr_init(&attributes);
+    pthread_attr_setdetachstate(&attributes, PTHREAD_CREATE_DETACHED);
+    pthread_attr_setinheritsched(&attributes, PTHREAD_EXPLICIT_SCHED);
+    pthread_attr_setschedpolicy(&attributes, SCHED_FIFO);
+    pthread_attr_setschedparam(&attributes, &schedParam);
+
+    error = pthread_create(thread, &attributes, RtosPosix_Thread, task);
+    if(error == EPERM)
+        {
+        // Ohne Berechtigung für Echtzeitprioritäten mit der Standard-Policy
+        __atomic_store_n(&realtime, false, __ATOMIC_RELAXED);
+        pthread_attr_setinheritsched(&attributes, PTHREAD_INHERIT_SCHED);
+        error = pthread_create(thread, &attributes, RtosPosix_Thread, task);
+        }
+    pthread_attr_destroy(&attributes);
+
+    if(error != 0)
+        {
+        free(task);
+        return false;
+        }
+
+    if(name != NULL)
+        {
+        strncpy(threadName, name, sizeof(threadName) - 1u);
+        threadName[sizeof(threadName) - 1u] = '\0';
+        (void) pthread_setname_np(*thread, threadName);
+        }
+    return true;
+    }
+//------------------------------------------------------------------------------
+
+static void * RtosPosix_Thread(void * parameter)
+    {
+    RTOS_POSIX_TASK const task = *(RTOS_POSIX_TASK const *) parameter;
+
+    free(parameter);
+
+    pthread_mutex_lock(&registryLock);
+    while(!schedulerRunning)
+        {
+        pthread_cond_wait(&startCondition, &registryLock);
+        }
+    pthread_mutex_unlock(&registryLock);
+
+    task.function(task.parameter);
+    return NULL;
+    }
+//------------------------------------------------------------------------------
+
+static RTOS_POSIX_TASK_ENTRY * RtosPosix_FindTask(RTOS_TASK const * const handle)
+    {
+    U32 const count = __atomic_load_n(&numTasks, __ATOMIC_ACQUIRE);
+    U32 i;
+
+    for(i = 0; i < count; i++)
+        {
+        if(tasks[i].handle == handle)
+            {
+            return &tasks[i];
+            }
+        }
+
+    return NULL;
+    }
+//------------------------------------------------------------------------------
+
+static RTOS_POSIX_MUTEX * RtosPosix_FindMutex(RTOS_MUTEX const * const handle)
+    {
+    U32 const count = __atomic_load_n(&numMutexes, __ATOMIC_ACQUIRE);
+    U32 i;
+
+    for(i = 0; i < count; i++)
+        {
+        if(mutexes[i].handle == handle)
+            {
+            return &mutexes[i];
+            }
+        }
+
+    return NULL;
+    }
+//------------------------------------------------------------------------------
+
+static void RtosPosix_LoadTask(void * parameter)
+    {
+    RTOS_POSIX_LOAD * const load = (RTOS_POSIX_LOAD *) parameter;
+    RTOS_TIME lastWakeTime = RTOS_GetTime();
+    U64 busyEnd;
+
+    for(;;)
+        {
+        if(load->mutex != NULL)
+            {
+            (void) RTOS_MutexTake(load->mutex, RTOS_MAX_TIMEOUT);
+            }
+
+        busyEnd = RtosPosix_GetTimeNs() + ((U64) load->busyUs * 1000u);
+        while(RtosPosix_GetTimeNs() < busyEnd)
+            {
+            }
+
+        if(load->mutex != NULL)
+            {
+            (void) RTOS_MutexGive(load->mutex);
+            }
+
+        __atomic_store_n(&load->cycles, load->cycles + 1u, __ATOMIC_RELAXED);
+        RTOS_DelayUntil(&lastWakeTime, load->period);
+        }
+    }
+//------------------------------------------------------------------------------
@@ -0,0 +1,130 @@
+/*******************************************************************************
+ * Copyright (c) 2026 TWK-ELEKTRONIK GmbH. All rights reserved.
+ ******************************************************************************/
+
+/**
+ * \defgroup rtos_al_posix POSIX-Backend des RTOS_AL
+ * \ingroup safety_utils
+ * Echte Nebenläufigkeit der Sicherheitsfunktionen auf dem Host.
+ *
+ * rtos_al_posix.c implementiert die vom Modul genutzten Funktionen des RTOS_AL
+ * mit POSIX-Threads: RTOS_TaskCreate(), RTOS_DelayUntil(), RTOS_GetTime(),
+ * RTOS_MutexCreate(), RTOS_MutexTake(), RTOS_MutexGive() und RTOS_IsRunning().
+ * Damit laufen Safety_Task(), die Programmablaufzählung und Lastgeneratoren
+ * der Applikation gleichzeitig unter Linux, z.B. für Messungen von
+ * Mutex-Konflikten, Jitter und Scheduling unter Last (tools/safety_contention.c).
+ *
+ *  (#) Zeit: RTOS_GetTime() liefert die Ticks seit dem ersten Aufruf aus
+ *      CLOCK_MONOTONIC mit @c RTOS_TICK_RATE Ticks pro Sekunde.
+ *      RTOS_DelayUntil() schläft absolut bis zum Weckzeitpunkt, ein
+ *      verpasster Weckzeitpunkt kehrt sofort zurück, wie im RTOS.
+ *
+ *  (#) Tasks: Jede Task ist ein Thread. Wie im RTOS laufen die Tasks erst nach
+ *      dem Start des Schedulers (RtosPosix_Start()). Die Prioritäten werden auf
+ *      SCHED_FIFO abgebildet (höhere Zahl, höhere Priorität). Ohne
+ *      Berechtigung (CAP_SYS_NICE oder RLIMIT_RTPRIO) laufen alle Tasks mit der
+ *      Standard-Policy, RtosPosix_IsRealtime() meldet das.
+ *
+ *  (#) Mutexe: pthread-Mutexe mit Prioritätsvererbung wie die Mutexe des RTOS.
+ *      Pro Mutex werden Zugriffe, Konflikte und Wartezeiten gezählt.
+ *
+ * Die Objekte RTOS_TASK und RTOS_MUTEX des RTOS_AL bleiben unverändert, Task
+ * und Mutex werden über ihre Adresse zugeordnet. RtosPosix_GetTaskThread()
+ * liefert den Thread einer Task. Nur für Host-Builds, statt des
+ * RTOS_AL gelinkt.
+ * @{
+ */
+#ifndef TOOLS_RTOS_AL_POSIX_H_
+#define TOOLS_RTOS_AL_POSIX_H_
+
+// Gemeinsame Headerdateien einbinden ---------------------------------------
+#include <pthread.h>
+
+// Spezielle Headerdateien einbinden ----------------------------------------
+#include "RTOS_AL/RTOS_AL.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// Compiler Direktiven ------------------------------------------------------
+
+// Makros -------------------------------------------------------------------
+
+#ifndef RTOS_POSIX_TASKS_MAX
+/// Maximum number of tasks created with RTOS_TaskCreate().
+#define RTOS_POSIX_TASKS_MAX        (16u)
+#endif
+
+#ifndef RTOS_POSIX_MUTEXES_MAX
+/// Maximum number of mutexes created with RTOS_MutexCreate().
+#define RTOS_POSIX_MUTEXES_MAX      (16u)
+#endif
+
+// externe Variablen --------------------------------------------------------
+
+// Allgemeine Definitionen --------------------------------------------------
+
+/// Contention statistics of a mutex.
+typedef struct
+{
+    U32 takes;          ///< Successful RTOS_MutexTake() calls
+    U32 contended;      ///< Takes that found the mutex locked and had to wait
+    U32 timeouts;       ///< Takes that returned without the mutex
+    U64 waitNsTotal;    ///< Sum of the waiting times of the contended takes in ns
+    U64 waitNsMax;      ///< Longest waiting time of a take in ns
+} RTOS_POSIX_MUTEX_STATISTICS;
+
+/// Periodic load generator, e.g. a 1 kHz application task.
+typedef struct
+{
+    U32 period;             ///< Period in ticks
+    U32 busyUs;             ///< Busy time per period in µs
+    RTOS_MUTEX * mutex;     ///< Mutex held during the busy time, NULL for none
+    volatile U32 cycles;    ///< Completed periods, counted by the load task
+} RTOS_POSIX_LOAD;
+
+// Prototypen ---------------------------------------------------------------
+
+/// Starts the scheduler: all created tasks begin to run and RTOS_IsRunning()
+/// returns true. Tasks created afterwards run immediately.
+extern void RtosPosix_Start(void);
+
+/// Time since the start of the time base in ns, the base of RTOS_GetTime().
+/// \return Time in ns.
+extern U64 RtosPosix_GetTimeNs(void);
+
+/// Reports whether the tasks run with SCHED_FIFO priorities.
+/// \return true if all tasks got their real-time priority, false if at least
+///         one task fell back to the default policy.
+extern bool RtosPosix_IsRealtime(void);
+
+/// Creates a load generator task. It busy-waits @c busyUs per period, holding
+/// the mutex if one is given.
+/// \param load Configuration, must stay valid while the task runs.
+/// \param name Name of the task.
+/// \param priority Priority as for RTOS_TaskCreate().
+/// \return true on success, false if the thread could not be created.
+extern bool RtosPosix_CreateLoad(RTOS_POSIX_LOAD * const load, char const * const name, U8 const priority);
+
+/// Returns the thread of a task, e.g. to check its scheduling parameters.
+/// \param task Task object passed to RTOS_TaskCreate().
+/// \param thread Returns the thread of the task.
+/// \return true on success, false if the task is unknown.
+extern bool RtosPosix_GetTaskThread(RTOS_TASK const * const task, pthread_t * const thread);
+
+/// Returns the contention statistics of a mutex.
+/// \param mutex Mutex created with RTOS_MutexCreate().
+/// \param statistics Destination of the statistics.
+/// \return true on success, false if the mutex is unknown.
+extern bool RtosPosix_GetMutexStatistics(RTOS_MUTEX const * const mutex, RTOS_POSIX_MUTEX_STATISTICS * const statistics);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TOOLS_RTOS_AL_POSIX_H_ */
+/**
+ * @}
+ */
@@ -0,0 +1,1407 @@
+/*******************************************************************************
+ * Copyright (c) 2026 TWK-ELEKTRONIK GmbH. All rights reserved.
+ ******************************************************************************/
+
+/*
+ * Mikro-Benchmarks der zeitkritischen Pfade der Sicherheitsfunktionen auf dem
+ * Host, mit Vergleich gegen eine eingecheckte Baseline.
+ *
+ * Gemessen wird der unveränderte Code des Moduls, nur die Treiber sind hier
+ * ersetzt:
+ *
+ *  (#) powersupply_check: Ein Zyklus von Safety_Powersupply_ContextCheck() mit
+ *      Messwerten im Nennbereich.
+ *  (#) window_watchdog: Trigger_Window_Watchdog() mit fälligem und nicht
+ *      fälligem Trigger.
+ *  (#) stl_ram_cyclic, stl_rom_cyclic, stl_cpu_cyclic: Ein Aufruf der
+ *      zyklischen STL-Tests einer Instanz mit der Host-Emulation der STL
+ *      (HostStl.c).
+ *  (#) hard_error: Safety_HardError() bis zur Endlosschleife, abgefangen mit
+ *      Safety_HardErrorTrap_Arm(), mit leerem Fehlerspeicher, mit demselben und
+ *      mit einem anderen neuesten Eintrag.
+ *
+ * Jeder Benchmark läuft in den Konfigurationen "all" (alle übersetzten Kanäle
+ * bzw. Bereiche aktiv) und "minimal". Pro Aufruf werden die ausgeführten
+ * Instruktionen (perf_event unter Linux, exclude_kernel), die Zyklen des Time
+ * Stamp Counters (rdtsc auf x86) und die Zeit (CLOCK_MONOTONIC) gezählt.
+ * Ergebnis ist jeweils das Minimum über die Wiederholungen, das ist am
+ * wenigsten vom Host abhängig.
+ *
+ * Die Baseline (Standard tools/safety_benchmark.baseline) enthält die
+ * Toolchain, die Übersetzungsoptionen (BENCHMARK_BUILD_FLAGS) und eine Zeile
+ * pro Benchmark und Konfiguration:
+ *
+ *     toolchain <Compiler> <Architektur>
+ *     build <Übersetzungsoptionen>
+ *     <Benchmark> <Konfiguration> <Instruktionen pro Aufruf | -> <Zyklen pro Aufruf | ->
+ *
+ * Instruktionen und Zyklen werden nur bei gleicher Toolchain und gleichen
+ * Übersetzungsoptionen verglichen, Zyklen nur mit --cycles-tolerance, da sie
+ * von Takt und Last des Hosts abhängen. Die Zeit wird nur ausgegeben. Eine
+ * Überschreitung der Toleranz ist eine Regression, das Programm endet dann
+ * mit 1. --update schreibt die Baseline neu, z.B. nach einer beabsichtigten
+ * Änderung oder für eine andere Toolchain. Ohne Baseline werden die Ergebnisse
+ * nur ausgegeben.
+ *
+ * Die Baseline ist nicht eingecheckt. Sie wird mit den Standardoptionen des
+ * Makefiles (BENCHMARK_CFLAGS) auf einem Host mit perf_event erzeugt, damit
+ * sie die Instruktionen enthält:
+ *
+ *     make benchmark BENCHMARK_ARGS=--update
+ *
+ * Das Ziel benchmark des Makefiles übersetzt und startet das Programm wie das
+ * Ziel unittest, mit BENCHMARK_CFLAGS als Übersetzungsoptionen. Von Hand mit
+ * den Konfigurations-Defines des Geräts (GLOBAL_DEFINES), als 32-Bit-Programm,
+ * da die STL-Wrapper Adressen als U32 ablegen:
+ *
+ *     gcc -m32 -O2 -no-pie -DBENCHMARK_BUILD_FLAGS="-m32 -O2 -no-pie" \
+ *         <GLOBAL_DEFINES> -DFEATURE_SAFETYCHECK_HOST_STL=1 \
+ *         -DFEATURE_SAFETY_HARDERROR_TRAP=1 -I<LibCert> -I. \
+ *         tools/safety_benchmark.c safety_startup.c safety_powersupply.c \
+ *         safety_filter.c safety_temperature.c safety_checkpoint.c \
+ *         STM32_Safety_STL_API/SafetyStl.c STM32_Safety_STL_API/HostStl.c \
+ *         STM32_Safety_STL_API/RAMTestStl.c STM32_Safety_STL_API/ROMTestStl.c \
+ *         STM32_Safety_STL_API/CPUTestStl.c STM32_Safety_STL_API/FaultInjectionStl.c \
+ *         <Host-Build von DataProcess_Averaging> \
+ *         -Wl,--defsym,__RAM_TESTREGION1_START=0x20000000 \
+ *         -Wl,--defsym,__RAM_TESTREGION1_SIZE=0x800 \
+ *         -Wl,--defsym,__RAM_TESTREGION2_START=0x20000800 \
+ *         -Wl,--defsym,__RAM_TESTREGION2_SIZE=0x400 \
+ *         -Wl,--defsym,__RAM_TESTREGION3_START=0x20000C00 \
+ *         -Wl,--defsym,__RAM_TESTREGION3_SIZE=0x400 \
+ *         -Wl,--defsym,__SRAM_RAMTEST_BACKUP_START=0x20010000 \
+ *         -Wl,--defsym,__SRAM_RAMTEST_BACKUP_SIZE=0x100 \
+ *         -Wl,--defsym,__FLASH_TESTREGION_START=0x08000000 \
+ *         -Wl,--defsym,__FLASH_TESTREGION_SIZE=0x1FE0 \
+ *         -Wl,--defsym,__FLASH_TEST_STL_CRC_START=0x08001FE0 \
+ *         -o safety_benchmark
+ *
+ * Die Adressen müssen zu BENCHMARK_RAM_ADDRESS und BENCHMARK_FLASH_ADDRESS
+ * passen. Die Baseline gilt für die Defines und Optimierung, mit denen sie
+ * erzeugt wurde.
+ *
+ * Aufruf:
+ *     safety_benchmark [--baseline file] [--update] [--filter text]
+ *                      [--iterations n] [--repetitions n]
+ *                      [--instructions-tolerance %] [--cycles-tolerance %]
+ */
+
+// Headerdateien einbinden -----------------------------------------------------
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef __linux__
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+
+#if defined(__i386__) || defined(__x86_64__)
+#include <x86intrin.h>
+#endif
+
+// Modul direkt einbinden, Trigger_Window_Watchdog() ist static
+#include "safety_runtime.c"
+
+#include "ADC/ADC_Driver.h"
+#include "ErrorLogging/error_logging.h"
+
+#include "STM32_Safety_STL_API/HostStl.h"
+
+#ifndef WATCHDOG_WINDOW_PERCENT
+#error "safety_benchmark measures Trigger_Window_Watchdog(), WATCHDOG_WINDOW_PERCENT must be defined"
+#endif
+
+#if !FEATURE_SAFETY_HARDERROR_TRAP
+#error "safety_benchmark returns from the hard error path, FEATURE_SAFETY_HARDERROR_TRAP must be 1"
+#endif
+
+#if !FEATURE_SAFETYCHECK_HOST_STL
+#error "safety_benchmark runs the STL wrappers on the host, FEATURE_SAFETYCHECK_HOST_STL must be 1"
+#endif
+
+#if FEATURE_SAFETY_RECORD_REPLAY
+#error "safety_benchmark supplies the measurements itself, FEATURE_SAFETY_RECORD_REPLAY must be 0"
+#endif
+
+// Allgemeine Definitionen -----------------------------------------------------
+
+#ifndef BENCHMARK_BUILD_FLAGS
+/// Compiler options of this build, stored in the baseline. Set by the Makefile
+/// from BENCHMARK_CFLAGS.
+#define BENCHMARK_BUILD_FLAGS           unspecified
+#endif
+
+/// Converts the expanded macro argument to a string.
+#define BENCHMARK_STRING(x)             BENCHMARK_STRING_(x)
+
+/// Helper of @ref BENCHMARK_STRING.
+#define BENCHMARK_STRING_(x)            #x
+
+/// Default path of the baseline, relative to the module directory.
+#define BENCHMARK_BASELINE_DEFAULT      "tools/safety_benchmark.baseline"
+
+/// Maximum length of a line of the baseline.
+#define BENCHMARK_LINE_MAX              (256u)
+
+/// Maximum length of the toolchain description and of the compiler options.
+#define BENCHMARK_TOOLCHAIN_MAX         (128u)
+
+/// Target address of the emulated RAM, start of __RAM_TESTREGION1_START.
+#define BENCHMARK_RAM_ADDRESS           (0x20000000u)
+
+/// Size of the emulated RAM in bytes.
+#define BENCHMARK_RAM_SIZE              (0x1000u)
+
+/// Size of a RAM region of the configuration "all" in bytes.
+#define BENCHMARK_RAM_REGION_SIZE       (0x200u)
+
+/// Target address of the emulated flash, FLASH_BASE.
+#define BENCHMARK_FLASH_ADDRESS         (0x08000000u)
+
+/// Size of the emulated flash in bytes, including the CRC area at its end.
+#define BENCHMARK_FLASH_SIZE            (0x2000u)
+
+/// Size of the tested flash in bytes, up to the CRC area (one CRC per section).
+#define BENCHMARK_FLASH_TESTED_SIZE     (BENCHMARK_FLASH_SIZE - ((BENCHMARK_FLASH_SIZE / STL_FLASH_SECTION_SIZE) * sizeof(U32)))
+
+/// Process safety time of the cyclic STL tests in ticks, never reached by the benchmarks.
+#define BENCHMARK_STL_PST_TICKS         (RTOS_MAX_TIMEOUT / 2u)
+
+/// Nominal supply voltage in V.
+#define BENCHMARK_SUPPLY_VOLTAGE        (24.0f)
+
+/// Nominal current in A.
+#define BENCHMARK_CURRENT               (0.1f)
+
+/// Nominal voltage of the internal voltages at the pin in V.
+#define BENCHMARK_INTERNAL_VOLTAGE      (1.0f)
+
+/// Nominal normalized value of the external ADC.
+#define BENCHMARK_EXT_ADC_VALUE         (2.44f)
+
+/// Nominal temperature in °C.
+#define BENCHMARK_TEMPERATURE           (25.0f)
+
+/// Number of entries of the emulated error log.
+#define BENCHMARK_ERROR_LOG_ENTRIES     (16u)
+
+/// Value of a count without counter.
+#define BENCHMARK_NO_COUNT              (-1.0)
+
+/// Benchmark of a hot path in one configuration.
+typedef struct
+{
+    char const * name;          ///< Name of the hot path
+    char const * configuration; ///< Name of the configuration
+    bool (*setup)(void);        ///< Prepares the state, false if the configuration cannot run
+    void (*run)(void);          ///< One call of the hot path
+} BENCHMARK;
+
+/// Result of a benchmark, per call of the hot path.
+typedef struct
+{
+    double instructions;        ///< Retired instructions, @ref BENCHMARK_NO_COUNT without counter
+    double cycles;              ///< Cycles of the time stamp counter, @ref BENCHMARK_NO_COUNT without counter
+    double ns;                  ///< Wall time in ns, not stored in the baseline
+} BENCHMARK_RESULT;
+
+/// Entry of the baseline.
+typedef struct
+{
+    char name[32];              ///< Name of the hot path
+    char configuration[32];     ///< Name of the configuration
+    BENCHMARK_RESULT result;    ///< Stored result
+} BENCHMARK_BASELINE_ENTRY;
+
+/// Options of the command line.
+typedef struct
+{
+    char const * baselinePath;      ///< Path of the baseline
+    char const * filter;            ///< Only benchmarks whose name contains the text, NULL for all
+    bool update;                    ///< Write the baseline instead of comparing
+    U32 iterations;                 ///< Calls of the hot path per repetition
+    U32 repetitions;                ///< Repetitions, the minimum counts
+    double instructionsTolerance;   ///< Allowed increase of the instructions in %
+    double cyclesTolerance;         ///< Allowed increase of the cycles in %, 0 only reports
+} BENCHMARK_OPTIONS;
+
+// externe Variablen -----------------------------------------------------------
+
+/// Virtual time of RTOS_GetTime().
+static RTOS_TIME benchmarkTicks = 0;
+
+/// Instance of the power supply monitor.
+static SAFETY_POWERSUPPLY_CONTEXT benchmarkPowersupply;
+
+/// Channel configuration of the power supply monitor.
+static SAFETY_POWERSUPPLY_CONFIG benchmarkPowersupplyConfig;
+
+/// Emulated RAM.
+static U32 benchmarkRam[BENCHMARK_RAM_SIZE / sizeof(U32)];
+
+/// Emulated flash.
+static U8 benchmarkFlash[BENCHMARK_FLASH_SIZE];
+
+/// RAM regions of the configuration "minimal": one section.
+static EN61508_MEM_REGION const benchmarkRamRegionsMinimal[] =
+    {
+        { (U8 *) (uintptr_t) BENCHMARK_RAM_ADDRESS, HOSTSTL_RAM_SECTION_SIZE },
+    };
+
+/// RAM regions of the configuration "all": the maximum number of regions.
+static EN61508_MEM_REGION benchmarkRamRegionsAll[RAMTEST_REGIONS_MAX];
+
+/// Flash regions of the configuration "minimal": one section.
+static EN61508_MEM_REGION const benchmarkFlashRegionsMinimal[] =
+    {
+        { (U8 *) (uintptr_t) BENCHMARK_FLASH_ADDRESS, STL_FLASH_SECTION_SIZE },
+    };
+
+/// Flash regions of the configuration "all": the flash up to the CRC area.
+static EN61508_MEM_REGION const benchmarkFlashRegionsAll[] =
+    {
+        { (U8 *) (uintptr_t) BENCHMARK_FLASH_ADDRESS, BENCHMARK_FLASH_TESTED_SIZE },
+    };
+
+/// Instance of the RAM tests.
+static RAM_TEST_CONTEXT benchmarkRamTest;
+
+/// Instance of the ROM tests.
+static ROM_TEST_CONTEXT benchmarkRomTest;
+
+/// Instance of the CPU tests.
+static CPU_TEST_CONTEXT benchmarkCpuTest;
+
+/// Result of the last call of a cyclic STL test.
+static EN61508_TestResult benchmarkStlResult = EN61508_TestPass;
+
+/// Ticks added per call of Trigger_Window_Watchdog().
+static U32 benchmarkWatchdogStep = 0;
+
+/// Number of calls of WATCHDOG_Trigger().
+static U32 benchmarkWatchdogTriggers = 0;
+
+/// Emulated error log, ring buffer of the newest entries.
+static U32 benchmarkErrorLog[BENCHMARK_ERROR_LOG_ENTRIES][LOGDATA_NUM_ERRORS];
+
+/// Number of entries of the emulated error log.
+static U32 benchmarkErrorLogCount = 0;
+
+/// Hard error codes used alternately by the hard error benchmark.
+static U8 const benchmarkHardErrorCodes[] = { HARD_ERR_INTERN_CHECK_REGISTER_CYCLIC, HARD_ERR_POWER_EXCEEDED };
+
+/// Index of the next hard error code.
+static U32 benchmarkHardErrorIndex = 0;
+
+/// Empties the error log before each hard error.
+static bool benchmarkHardErrorClearLog = false;
+
+/// Alternates the hard error codes, so each hard error is a new entry.
+static bool benchmarkHardErrorAlternate = false;
+
+/// Record of the hard error trap.
+static SAFETY_HARDERROR_RECORD benchmarkHardErrorRecord;
+
+#ifdef __linux__
+/// File descriptor of the instruction counter, negative without counter.
+static int instructionCounter = -1;
+#endif
+
+// Treiber und Betriebssystem des Hosts ----------------------------------------
+
+RTOS_TIME RTOS_GetTime(void)
+    {
+    return benchmarkTicks;
+    }
+
+bool RTOS_MutexCreate(RTOS_MUTEX * mutex)
+    {
+    (void) mutex;
+    return true;
+    }
+
+eADC_RESULT ADC_InitSingleChannel(U32 pin)
+    {
+    (void) pin;
+    return eADC_TRUE;
+    }
+
+eADC_RESULT ADC_SampleSingleChannel(U32 pin, float * value)
+    {
+    *value = BENCHMARK_INTERNAL_VOLTAGE;
+#ifdef fpADCIN_VCC
+    if(pin == fpADCIN_VCC)
+        {
+        *value = BENCHMARK_SUPPLY_VOLTAGE / VOLTAGE_VCC_FACTOR;
+        }
+#endif
+#ifdef fpADCIN_ICC
+    if(pin == fpADCIN_ICC)
+        {
+        *value = BENCHMARK_CURRENT / CURRENT_FACTOR;
+        }
+#endif
+    return eADC_TRUE;
+    }
+
+void ADC_TemperatureSensorEnable(void)
+    {
+    }
+
+void ADC_TemperatureSensorDisable(void)
+    {
+    }
+
+#ifdef TMP144_UART_CHANNEL
+bool TMP144_TemperatureValuePeek(float * value)
+    {
+    *value = BENCHMARK_TEMPERATURE;
+    return true;
+    }
+#endif
+
+#if ((MAX116XX_FEAT_4CHANNEL_ADC) || (MAX116XX_FEAT_12CHANNEL_ADC))
+/// Fills the monitored channels of the external ADC with the nominal value.
+/// \param values Values of all external ADCs.
+static void Benchmark_FillExternalAdc(MAX116XX_ADC_VALUES * const values)
+    {
+    SAFETY_POWERSUPPLY_EXT_ADC_CHANNEL const * channel;
+    U8 i;
+
+    for(i = 0; i < benchmarkPowersupply.externalAdcChannelCount; i++)
+        {
+        channel = &benchmarkPowersupply.externalAdcChannels[i];
+        values[channel->adc].f32Data[channel->channel] = BENCHMARK_EXT_ADC_VALUE;
+        }
+    }
+//------------------------------------------------------------------------------
+
+#if !FEATURE_SAFETY_POWERSUPPLY_EXTERNAL_ADC_FRAMES
+bool MAX116XX_AdcValuesPeek(MAX116XX_ADC_VALUES * list)
+    {
+    Benchmark_FillExternalAdc(list);
+    return true;
+    }
+#endif
+#endif
+
+bool SendMsgEvent(U32 event, U32 value)
+    {
+    (void) event;
+    (void) value;
+    return true;
+    }
+
+bool SendErrorMsgEvent(U32 event, U8 upper, U8 intermediate, U8 lower)
+    {
+    (void) event;
+    (void) upper;
+    (void) intermediate;
+    (void) lower;
+    return true;
+    }
+
+void WATCHDOG_Trigger(void)
+    {
+    benchmarkWatchdogTriggers++;
+    }
+
+void System_InterruptDisable(void)
+    {
+    }
+
+void RTCDrv_SetNonVolatileMemory(U32 reg, U32 value)
+    {
+    (void) reg;
+    (void) value;
+    }
+
+U32 ErrorLog_CountStoredErrors(void)
+    {
+    return benchmarkErrorLogCount;
+    }
+
+bool ErrorLog_Read(U32 * data, U32 index, U32 size)
+    {
+    // index 1 ist der neueste Eintrag
+    if((index == 0u) || (index > benchmarkErrorLogCount) || (index > BENCHMARK_ERROR_LOG_ENTRIES)
+       || (size > sizeof(benchmarkErrorLog[0])))
+        {
+        return false;
+        }
+
+    memcpy(data, benchmarkErrorLog[(benchmarkErrorLogCount - index) % BENCHMARK_ERROR_LOG_ENTRIES], size);
+    return true;
+    }
+
+void ErrorLog_Append(U32 * data, U32 size)
+    {
+    memcpy(benchmarkErrorLog[benchmarkErrorLogCount % BENCHMARK_ERROR_LOG_ENTRIES], data, size);
+    benchmarkErrorLogCount++;
+    }
+
+void ErrorLog_AppendHardError(U32 * data, U32 size)
+    {
+    ErrorLog_Append(data, size);
+    }
+
+// Anlauf und Zyklus der Sicherheitstask, von den Benchmarks nicht aufgerufen
+
+HARD_ERROR_READ_STATUS ErrorLog_ReadHardError(U32 * data, U32 size)
+    {
+    (void) data;
+    (void) size;
+    return HARD_ERROR_READ_NONE;
+    }
+
+void RTCDrv_Enable(void)
+    {
+    }
+
+U32 RTCDrv_GetNonVolatileMemory(U32 reg, U32 * value)
+    {
+    (void) reg;
+    *value = 0;
+    return 0;
+    }
+
+ESYSTEM_RESET_SOURCE System_GetResetSource(void)
+    {
+    return (ESYSTEM_RESET_SOURCE) 0;
+    }
+
+bool M41T62_Init(T_M41T62 * instance, U32 channel, U32 address, void (*callback)(U32))
+    {
+    (void) instance;
+    (void) channel;
+    (void) address;
+    (void) callback;
+    return true;
+    }
+
+bool EN61508_ProgFlow_Init(EN61508_PROGRAMMFLOW * progFlow, U32 reference, U32 tolerance, RTOS_MUTEX * mutex)
+    {
+    (void) progFlow;
+    (void) reference;
+    (void) tolerance;
+    (void) mutex;
+    return true;
+    }
+
+bool EN61508_ProgFlow_Add(EN61508_PROGRAMMFLOW * progFlow)
+    {
+    (void) progFlow;
+    return true;
+    }
+
+bool EN61508_ProgFlow_CheckCycleCounterAll(void)
+    {
+    return true;
+    }
+
+void EN61508_ProgFlow_IncCycleCounter(EN61508_PROGRAMMFLOW * progFlow)
+    {
+    (void) progFlow;
+    }
+
+bool Safety_Runtime_RegisterTest(void)
+    {
+    return true;
+    }
+
+// Funktionsbereich ------------------------------------------------------------
+
+/// Sets up the power supply monitor with all compiled channels.
+/// \return true on success.
+static bool Benchmark_PowersupplySetupAll(void)
+    {
+    memset(&benchmarkPowersupplyConfig, 0, sizeof(benchmarkPowersupplyConfig));
+#ifdef fpADCIN_VCC
+    benchmarkPowersupplyConfig.supplyVoltageIsActive = 1;
+#endif
+#ifdef fpADCIN_VCC1
+    benchmarkPowersupplyConfig.voltage1IsActive = 1;
+#endif
+#ifdef fpADCIN_VCC2
+    benchmarkPowersupplyConfig.voltage2IsActive = 1;
+#endif
+#ifdef fpADCIN_VCC3
+    benchmarkPowersupplyConfig.voltage3IsActive = 1;
+#endif
+#ifdef fpADCIN_VCC4
+    benchmarkPowersupplyConfig.voltage4IsActive = 1;
+#endif
+#ifdef fpADCIN_VCC5
+    benchmarkPowersupplyConfig.voltage5IsActive = 1;
+#endif
+#if ((MAX116XX_FEAT_4CHANNEL_ADC) || (MAX116XX_FEAT_12CHANNEL_ADC))
+    benchmarkPowersupplyConfig.voltageExternalAdcChannel1IsActive = 1;
+    benchmarkPowersupplyConfig.voltageExternalAdcChannel2IsActive = 1;
+    benchmarkPowersupplyConfig.voltageExternalAdcChannel3IsActive = 1;
+#endif
+#ifdef fpADCIN_ICC
+    benchmarkPowersupplyConfig.currentIsActive = 1;
+#endif
+#ifdef TMP144_UART_CHANNEL
+    benchmarkPowersupplyConfig.temperatureSensorIsActive = 1;
+#endif
+#ifdef fpADCIN_TEMPERATURE
+    benchmarkPowersupplyConfig.temperatureAdcIsActive = 1;
+#endif
+
+    if(!Safety_Powersupply_ContextInit(&benchmarkPowersupply, &benchmarkPowersupplyConfig))
+        {
+        return false;
+        }
+
+    Safety_Powersupply_ContextSignalSourceReady(&benchmarkPowersupply, eSAFETY_POWERSUPPLY_SOURCE_ADC);
+    return true;
+    }
+//------------------------------------------------------------------------------
+
+/// Sets up the power supply monitor with the supply voltage only.
+/// \return true on success.
+static bool Benchmark_PowersupplySetupMinimal(void)
+    {
+    memset(&benchmarkPowersupplyConfig, 0, sizeof(benchmarkPowersupplyConfig));
+    benchmarkPowersupplyConfig.supplyVoltageIsActive = 1;
+
+    if(!Safety_Powersupply_ContextInit(&benchmarkPowersupply, &benchmarkPowersupplyConfig))
+        {
+        return false;
+        }
+
+    Safety_Powersupply_ContextSignalSourceReady(&benchmarkPowersupply, eSAFETY_POWERSUPPLY_SOURCE_ADC);
+    return true;
+    }
+//------------------------------------------------------------------------------
+
+/// One cycle of the power supply monitor, one tick after the previous one.
+static void Benchmark_PowersupplyRun(void)
+    {
+    benchmarkTicks++;
+
+#if ((MAX116XX_FEAT_4CHANNEL_ADC) || (MAX116XX_FEAT_12CHANNEL_ADC)) && FEATURE_SAFETY_POWERSUPPLY_EXTERNAL_ADC_FRAMES
+    // Der Task des externen ADC veröffentlicht vor jedem Zyklus
+    Benchmark_FillExternalAdc(Safety_Powersupply_GetExternalAdcFrameBuffer());
+    Safety_Powersupply_PublishExternalAdcFrame();
+#endif
+
+    (void) Safety_Powersupply_ContextCheck(&benchmarkPowersupply);
+    }
+//------------------------------------------------------------------------------
+
+/// Sets up the window watchdog so that every call triggers.
+/// \return true.
+static bool Benchmark_WatchdogSetupDue(void)
+    {
+    benchmarkWatchdogStep = WATCHDOG_TRIGGER_TIME_TICKS + 1u;
+    Safety_InitWatchdogTime(benchmarkTicks);
+    return true;
+    }
+//------------------------------------------------------------------------------
+
+/// Sets up the window watchdog so that no call triggers.
+/// \return true.
+static bool Benchmark_WatchdogSetupNotDue(void)
+    {
+    benchmarkWatchdogStep = 0;
+    Safety_InitWatchdogTime(benchmarkTicks);
+    return true;
+    }
+//------------------------------------------------------------------------------
+
+/// One call of the window watchdog.
+static void Benchmark_WatchdogRun(void)
+    {
+    benchmarkTicks += benchmarkWatchdogStep;
+    Trigger_Window_Watchdog();
+    }
+//------------------------------------------------------------------------------
+
+/// Maps the emulated RAM and flash and starts the STL scheduler.
+/// \return true on success.
+static bool Benchmark_StlSetup(void)
+    {
+    U32 i;
+
+    HostStl_Reset();
+    for(i = 0; i < (sizeof(benchmarkRam) / sizeof(benchmarkRam[0])); i++)
+        {
+        benchmarkRam[i] = i * 0x01010101u;
+        }
+    for(i = 0; i < sizeof(benchmarkFlash); i++)
+        {
+        benchmarkFlash[i] = (U8) (i * 7u);
+        }
+
+    benchmarkStlResult = EN61508_TestPass;
+    return HostStl_AttachRam(BENCHMARK_RAM_ADDRESS, benchmarkRam, sizeof(benchmarkRam))
+           && HostStl_AttachFlash(BENCHMARK_FLASH_ADDRESS, benchmarkFlash, sizeof(benchmarkFlash))
+           && HostStl_UpdateFlashCrc()
+           && Stl_SchedulerInit();
+    }
+//------------------------------------------------------------------------------
+
+/// Sets up the cyclic RAM test over one section, one section per call.
+/// \return true on success.
+static bool Benchmark_RamSetupMinimal(void)
+    {
+    return Benchmark_StlSetup()
+           && RAMTestStl_ContextInit(&benchmarkRamTest, benchmarkRamRegionsMinimal, 1u)
+           && RAMTestStl_ContextSetupTestCyclic(&benchmarkRamTest, BENCHMARK_STL_PST_TICKS, RAMTEST_NUM_SECTIONS_ATOMIC_MIN);
+    }
+//------------------------------------------------------------------------------
+
+/// Sets up the cyclic RAM test over the maximum number of regions, all
+/// sections in one call.
+/// \return true on success.
+static bool Benchmark_RamSetupAll(void)
+    {
+    U32 i;
+
+    for(i = 0; i < RAMTEST_REGIONS_MAX; i++)
+        {
+        benchmarkRamRegionsAll[i].start = (U8 *) (uintptr_t) (BENCHMARK_RAM_ADDRESS + (i * BENCHMARK_RAM_REGION_SIZE));
+        benchmarkRamRegionsAll[i].length = BENCHMARK_RAM_REGION_SIZE;
+        }
+
+    return Benchmark_StlSetup()
+           && RAMTestStl_ContextInit(&benchmarkRamTest, benchmarkRamRegionsAll, RAMTEST_REGIONS_MAX)
+           && RAMTestStl_ContextSetupTestCyclic(&benchmarkRamTest, BENCHMARK_STL_PST_TICKS, RAMTEST_NUM_SECTIONS_ATOMIC_MAX);
+    }
+//------------------------------------------------------------------------------
+
+/// One call of the cyclic RAM test.
+static void Benchmark_RamRun(void)
+    {
+    benchmarkTicks++;
+    if(RAMTestStl_ContextRunCyclic(&benchmarkRamTest, benchmarkTicks) != EN61508_TestPass)
+        {
+        benchmarkStlResult = EN61508_TestFail;
+        }
+    }
+//------------------------------------------------------------------------------
+
+/// Sets up the cyclic ROM test over one section, one section per call.
+/// \return true on success.
+static bool Benchmark_RomSetupMinimal(void)
+    {
+    return Benchmark_StlSetup()
+           && ROMTestStl_ContextInit(&benchmarkRomTest, benchmarkFlashRegionsMinimal, 1u)
+           && ROMTestStl_ContextSetupTestCyclic(&benchmarkRomTest, BENCHMARK_STL_PST_TICKS, ROMTEST_NUM_SECTIONS_ATOMIC_MIN);
+    }
+//------------------------------------------------------------------------------
+
+/// Sets up the cyclic ROM test over the whole flash, all sections in one call.
+/// \return true on success.
+static bool Benchmark_RomSetupAll(void)
+    {
+    return Benchmark_StlSetup()
+           && ROMTestStl_ContextInit(&benchmarkRomTest, benchmarkFlashRegionsAll, 1u)
+           && ROMTestStl_ContextSetupTestCyclic(&benchmarkRomTest, BENCHMARK_STL_PST_TICKS, ROMTEST_NUM_SECTIONS_ATOMIC_MAX);
+    }
+//------------------------------------------------------------------------------
+
+/// One call of the cyclic ROM test.
+static void Benchmark_RomRun(void)
+    {
+    benchmarkTicks++;
+    if(ROMTestStl_ContextRunCyclic(&benchmarkRomTest, benchmarkTicks) != EN61508_TestPass)
+        {
+        benchmarkStlResult = EN61508_TestFail;
+        }
+    }
+//------------------------------------------------------------------------------
+
+/// Sets up the cyclic CPU test with all tests of the default activation.
+/// \return true on success.
+static bool Benchmark_CpuSetupAll(void)
+    {
+    return Benchmark_StlSetup()
+           && CPUTestStl_ContextInit(&benchmarkCpuTest)
+           && CPUTestStl_ContextSetupTestCyclic(&benchmarkCpuTest, BENCHMARK_STL_PST_TICKS);
+    }
+//------------------------------------------------------------------------------
+
+/// Sets up the cyclic CPU test with the first test only.
+/// \return true on success.
+static bool Benchmark_CpuSetupMinimal(void)
+    {
+    U32 i;
+
+    if(!Benchmark_StlSetup() || !CPUTestStl_ContextInit(&benchmarkCpuTest))
+        {
+        return false;
+        }
+
+    for(i = 1; i < STL_CPU_TM_MAX; i++)
+        {
+        benchmarkCpuTest.cpuTest[i].tmEnable = STL_TEST_DISABLE;
+        }
+
+    return CPUTestStl_ContextSetupTestCyclic(&benchmarkCpuTest, BENCHMARK_STL_PST_TICKS);
+    }
+//------------------------------------------------------------------------------
+
+/// One call of the cyclic CPU test.
+static void Benchmark_CpuRun(void)
+    {
+    benchmarkTicks++;
+    if(CPUTestStl_ContextRunCyclic(&benchmarkCpuTest, benchmarkTicks) != EN61508_TestPass)
+        {
+        benchmarkStlResult = EN61508_TestFail;
+        }
+    }
+//------------------------------------------------------------------------------
+
+/// Sets up the hard error path with an empty error log before each hard error.
+/// \return true.
+static bool Benchmark_HardErrorSetupEmptyLog(void)
+    {
+    benchmarkErrorLogCount = 0;
+    benchmarkHardErrorClearLog = true;
+    benchmarkHardErrorAlternate = false;
+    return true;
+    }
+//------------------------------------------------------------------------------
+
+/// Sets up the hard error path with the same code as the newest entry, the
+/// hard error is not logged again.
+/// \return true.
+static bool Benchmark_HardErrorSetupRepeated(void)
+    {
+    benchmarkErrorLogCount = 0;
+    benchmarkHardErrorClearLog = false;
+    benchmarkHardErrorAlternate = false;
+    return true;
+    }
+//------------------------------------------------------------------------------
+
+/// Sets up the hard error path with alternating codes, each hard error is a
+/// new entry.
+/// \return true.
+static bool Benchmark_HardErrorSetupNewEntry(void)
+    {
+    benchmarkErrorLogCount = 0;
+    benchmarkHardErrorClearLog = false;
+    benchmarkHardErrorAlternate = true;
+    return true;
+    }
+//------------------------------------------------------------------------------
+
+/// One hard error, from Safety_HardError() back to the trap.
+static void Benchmark_HardErrorRun(void)
+    {
+    // volatile: gelesen nach setjmp()
+    U8 volatile hardErrorCode;
+
+    if(benchmarkHardErrorClearLog)
+        {
+        benchmarkErrorLogCount = 0;
+        }
+
+    hardErrorCode = benchmarkHardErrorCodes[0];
+    if(benchmarkHardErrorAlternate)
+        {
+        hardErrorCode = benchmarkHardErrorCodes[benchmarkHardErrorIndex % (sizeof(benchmarkHardErrorCodes) / sizeof(benchmarkHardErrorCodes[0]))];
+        benchmarkHardErrorIndex++;
+        }
+
+    Safety_HardErrorTrap_Arm(&benchmarkHardErrorRecord);
+    if(setjmp(benchmarkHardErrorRecord.jumpBuffer) == 0)
+        {
+        Safety_HardError(hardErrorCode);
+        }
+    Safety_HardErrorTrap_Disarm();
+    }
+//------------------------------------------------------------------------------
+
+/// Benchmarks in the order of the output and of the baseline.
+static BENCHMARK const benchmarks[] =
+    {
+        { "powersupply_check", "all", Benchmark_PowersupplySetupAll, Benchmark_PowersupplyRun },
+        { "powersupply_check", "minimal", Benchmark_PowersupplySetupMinimal, Benchmark_PowersupplyRun },
+        { "window_watchdog", "due", Benchmark_WatchdogSetupDue, Benchmark_WatchdogRun },
+        { "window_watchdog", "not_due", Benchmark_WatchdogSetupNotDue, Benchmark_WatchdogRun },
+        { "stl_ram_cyclic", "all", Benchmark_RamSetupAll, Benchmark_RamRun },
+        { "stl_ram_cyclic", "minimal", Benchmark_RamSetupMinimal, Benchmark_RamRun },
+        { "stl_rom_cyclic", "all", Benchmark_RomSetupAll, Benchmark_RomRun },
+        { "stl_rom_cyclic", "minimal", Benchmark_RomSetupMinimal, Benchmark_RomRun },
+        { "stl_cpu_cyclic", "all", Benchmark_CpuSetupAll, Benchmark_CpuRun },
+        { "stl_cpu_cyclic", "minimal", Benchmark_CpuSetupMinimal, Benchmark_CpuRun },
+        { "hard_error", "empty_log", Benchmark_HardErrorSetupEmptyLog, Benchmark_HardErrorRun },
+        { "hard_error", "repeated", Benchmark_HardErrorSetupRepeated, Benchmark_HardErrorRun },
+        { "hard_error", "new_entry", Benchmark_HardErrorSetupNewEntry, Benchmark_HardErrorRun },
+    };
+
+/// Number of benchmarks.
+#define NUM_BENCHMARKS  (sizeof(benchmarks) / sizeof(benchmarks[0]))
+
+/// Opens the instruction counter of the process.
+/// \return true if instructions are counted.
+static bool Benchmark_OpenInstructionCounter(void)
+    {
+#ifdef __linux__
+    struct perf_event_attr attr;
+
+    memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+
+    instructionCounter = (int) syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+    return instructionCounter >= 0;
+#else
+    return false;
+#endif
+    }
+//------------------------------------------------------------------------------
+
+/// Resets and starts the instruction counter.
+static void Benchmark_StartInstructionCounter(void)
+    {
+#ifdef __linux__
+    if(instructionCounter >= 0)
+        {
+        (void) ioctl(instructionCounter, PERF_EVENT_IOC_RESET, 0);
+        (void) ioctl(instructionCounter, PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+    }
+//------------------------------------------------------------------------------
+
+/// Stops the instruction counter.
+/// \return Counted instructions, @ref BENCHMARK_NO_COUNT without counter.
+static double Benchmark_StopInstructionCounter(void)
+    {
+#ifdef __linux__
+    U64 count;
+
+    if(instructionCounter >= 0)
+        {
+        (void) ioctl(instructionCounter, PERF_EVENT_IOC_DISABLE, 0);
+        if(read(instructionCounter, &count, sizeof(count)) == (ssize_t) sizeof(count))
+            {
+            return (double) count;
+            }
+        }
+#endif
+    return BENCHMARK_NO_COUNT;
+    }
+//------------------------------------------------------------------------------
+
+/// Reads the time stamp counter.
+/// \return Cycles of the time stamp counter, @ref BENCHMARK_NO_COUNT without counter.
+static double Benchmark_GetCycles(void)
+    {
+#if defined(__i386__) || defined(__x86_64__)
+    return (double) __rdtsc();
+#else
+    return BENCHMARK_NO_COUNT;
+#endif
+    }
+//------------------------------------------------------------------------------
+
+/// Time of CLOCK_MONOTONIC in ns.
+/// \return Time in ns.
+static U64 Benchmark_GetTimeNs(void)
+    {
+    struct timespec now;
+
+    (void) clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((U64) now.tv_sec * 1000000000u) + (U64) now.tv_nsec;
+    }
+//------------------------------------------------------------------------------
+
+/// Runs a benchmark.
+/// \param benchmark Benchmark.
+/// \param options Iterations and repetitions.
+/// \param result Minimum per call over the repetitions.
+/// \return false if the setup failed or the hot path reported an error.
+static bool Benchmark_Run(BENCHMARK const * const benchmark, BENCHMARK_OPTIONS const * const options,
+                          BENCHMARK_RESULT * const result)
+    {
+    SAFETY_HARDERROR_RECORD record;
+    double instructions;
+    double startCycles;
+    double cycles;
+    double ns;
+    U64 startNs;
+    U32 repetition;
+    U32 i;
+
+    if(!benchmark->setup())
+        {
+        fprintf(stderr, "%s %s: setup failed\n", benchmark->name, benchmark->configuration);
+        return false;
+        }
+
+    // Ein Hard-Error außerhalb des Hard-Error-Benchmarks ist ein Fehler der Konfiguration
+    if(benchmark->run != Benchmark_HardErrorRun)
+        {
+        Safety_HardErrorTrap_Arm(&record);
+        if(setjmp(record.jumpBuffer) != 0)
+            {
+            fprintf(stderr, "%s %s: unexpected hard error 0x%02X\n", benchmark->name, benchmark->configuration,
+                    record.hardErrorCode);
+            return false;
+            }
+        }
+
+    // Aufwärmen: Caches, Sprungvorhersage und der erste Durchlauf der Tests
+    for(i = 0; i < options->iterations; i++)
+        {
+        benchmark->run();
+        }
+
+    result->instructions = BENCHMARK_NO_COUNT;
+    result->cycles = BENCHMARK_NO_COUNT;
+    result->ns = 0.0;
+    for(repetition = 0; repetition < options->repetitions; repetition++)
+        {
+        startNs = Benchmark_GetTimeNs();
+        startCycles = Benchmark_GetCycles();
+        Benchmark_StartInstructionCounter();
+        for(i = 0; i < options->iterations; i++)
+            {
+            benchmark->run();
+            }
+        instructions = Benchmark_StopInstructionCounter();
+        cycles = Benchmark_GetCycles();
+        ns = (double) (Benchmark_GetTimeNs() - startNs) / (double) options->iterations;
+
+        if(instructions != BENCHMARK_NO_COUNT)
+            {
+            instructions /= (double) options->iterations;
+            if((result->instructions == BENCHMARK_NO_COUNT) || (instructions < result->instructions))
+                {
+                result->instructions = instructions;
+                }
+            }
+        if(cycles != BENCHMARK_NO_COUNT)
+            {
+            cycles = (cycles - startCycles) / (double) options->iterations;
+            if((result->cycles == BENCHMARK_NO_COUNT) || (cycles < result->cycles))
+                {
+                result->cycles = cycles;
+                }
+            }
+        if((repetition == 0u) || (ns < result->ns))
+            {
+            result->ns = ns;
+            }
+        }
+
+    if(benchmark->run != Benchmark_HardErrorRun)
+        {
+        Safety_HardErrorTrap_Disarm();
+        }
+
+    if(benchmarkStlResult != EN61508_TestPass)
+        {
+        fprintf(stderr, "%s %s: STL test failed\n", benchmark->name, benchmark->configuration);
+        return false;
+        }
+
+    return true;
+    }
+//------------------------------------------------------------------------------
+
+/// Describes the toolchain of this build, instruction counts are only
+/// comparable within the same toolchain.
+/// \param toolchain Destination.
+/// \param size Size of the destination.
+static void Benchmark_GetToolchain(char * const toolchain, size_t const size)
+    {
+    char const * compiler = "unknown";
+    char const * architecture = "unknown";
+
+#if defined(__clang__)
+    compiler = "clang";
+#elif defined(__GNUC__)
+    compiler = "gcc";
+#endif
+
+#if defined(__x86_64__)
+    architecture = "x86_64";
+#elif defined(__i386__)
+    architecture = "i386";
+#elif defined(__aarch64__)
+    architecture = "aarch64";
+#elif defined(__arm__)
+    architecture = "arm";
+#endif
+
+#ifdef __VERSION__
+    snprintf(toolchain, size, "%s %s %s", compiler, __VERSION__, architecture);
+#else
+    snprintf(toolchain, size, "%s %s", compiler, architecture);
+#endif
+    }
+//------------------------------------------------------------------------------
+
+/// Converts a count of the baseline.
+/// \param text Count or "-".
+/// \return Count, @ref BENCHMARK_NO_COUNT for "-".
+static double Benchmark_ParseCount(char const * const text)
+    {
+    if(strcmp(text, "-") == 0)
+        {
+        return BENCHMARK_NO_COUNT;
+        }
+
+    return strtod(text, NULL);
+    }
+//------------------------------------------------------------------------------
+
+/// Formats a count for the baseline and the report.
+/// \param text Destination.
+/// \param size Size of the destination.
+/// \param count Count, @ref BENCHMARK_NO_COUNT is written as "-".
+/// \return text.
+static char const * Benchmark_FormatCount(char * const text, size_t const size, double const count)
+    {
+    if(count == BENCHMARK_NO_COUNT)
+        {
+        snprintf(text, size, "-");
+        }
+    else
+        {
+        snprintf(text, size, "%.1f", count);
+        }
+
+    return text;
+    }
+//------------------------------------------------------------------------------
+
+/// Reads the baseline.
+/// \param path Path of the baseline.
+/// \param toolchain Toolchain of the baseline, empty if not stored.
+/// \param build Compiler options of the baseline, empty if not stored.
+/// \param entries Entries, one per benchmark in the order of @ref benchmarks.
+/// \param found Per benchmark, true if the baseline contains it.
+/// \return false if the file cannot be read.
+static bool Benchmark_ReadBaseline(char const * const path, char * const toolchain, char * const build,
+                                   BENCHMARK_BASELINE_ENTRY * const entries, bool * const found)
+    {
+    BENCHMARK_BASELINE_ENTRY entry;
+    char line[BENCHMARK_LINE_MAX];
+    char instructions[32];
+    char cycles[32];
+    FILE * file;
+    size_t length;
+    U32 i;
+
+    file = fopen(path, "r");
+    if(file == NULL)
+        {
+        return false;
+        }
+
+    toolchain[0] = '\0';
+    build[0] = '\0';
+    memset(found, 0, NUM_BENCHMARKS * sizeof(found[0]));
+    while(fgets(line, sizeof(line), file) != NULL)
+        {
+        length = strcspn(line, "\r\n");
+        line[length] = '\0';
+
+        if((line[0] == '#') || (length == 0u))
+            {
+            continue;
+            }
+
+        if(strncmp(line, "toolchain ", 10) == 0)
+            {
+            snprintf(toolchain, BENCHMARK_TOOLCHAIN_MAX, "%.*s", (int) (BENCHMARK_TOOLCHAIN_MAX - 1u), &line[10]);
+            continue;
+            }
+
+        if(strncmp(line, "build ", 6) == 0)
+            {
+            snprintf(build, BENCHMARK_TOOLCHAIN_MAX, "%.*s", (int) (BENCHMARK_TOOLCHAIN_MAX - 1u), &line[6]);
+            continue;
+            }
+
+        if(sscanf(line, "%31s %31s %31s %31s", entry.name, entry.configuration, instructions, cycles) != 4)
+            {
+            fprintf(stderr, "%s: ignored line \"%s\"\n", path, line);
+            continue;
+            }
+
+        entry.result.instructions = Benchmark_ParseCount(instructions);
+        entry.result.cycles = Benchmark_ParseCount(cycles);
+        entry.result.ns = 0.0;
+
+        for(i = 0; i < NUM_BENCHMARKS; i++)
+            {
+            if((strcmp(entry.name, benchmarks[i].name) == 0)
+               && (strcmp(entry.configuration, benchmarks[i].configuration) == 0))
+                {
+                entries[i] = entry;
+                found[i] = true;
+                }
+            }
+        }
+
+    fclose(file);
+    return true;
+    }
+//------------------------------------------------------------------------------
+
+/// Writes the baseline.
+/// \param path Path of the baseline.
+/// \param toolchain Toolchain of this build.
+/// \param build Compiler options of this build.
+/// \param results Results, one per benchmark in the order of @ref benchmarks.
+/// \param valid Per benchmark, true if it ran.
+/// \return false if the file cannot be written.
+static bool Benchmark_WriteBaseline(char const * const path, char const * const toolchain, char const * const build,
+                                    BENCHMARK_RESULT const * const results, bool const * const valid)
+    {
+    char instructions[32];
+    char cycles[32];
+    FILE * file;
+    U32 i;
+
+    file = fopen(path, "w");
+    if(file == NULL)
+        {
+        return false;
+        }
+
+    fprintf(file, "# Baseline of tools/safety_benchmark.c, written with --update\n");
+    fprintf(file, "# <benchmark> <configuration> <instructions per call | -> <cycles per call | ->\n");
+    fprintf(file, "toolchain %s\n", toolchain);
+    fprintf(file, "build %s\n", build);
+    for(i = 0; i < NUM_BENCHMARKS; i++)
+        {
+        if(!valid[i])
+            {
+            continue;
+            }
+
+        fprintf(file, "%s %s %s %s\n", benchmarks[i].name, benchmarks[i].configuration,
+                Benchmark_FormatCount(instructions, sizeof(instructions), results[i].instructions),
+                Benchmark_FormatCount(cycles, sizeof(cycles), results[i].cycles));
+        }
+
+    return fclose(file) == 0;
+    }
+//------------------------------------------------------------------------------
+
+/// Change of a value against the baseline in %.
+/// \param value Measured value.
+/// \param baseline Value of the baseline.
+/// \return Change in %, 0 for a baseline of 0.
+static double Benchmark_Change(double const value, double const baseline)
+    {
+    if(baseline <= 0.0)
+        {
+        return 0.0;
+        }
+
+    return ((value - baseline) * 100.0) / baseline;
+    }
+//------------------------------------------------------------------------------
+
+/// Checks a count against the baseline.
+/// \param value Measured count.
+/// \param baseline Count of the baseline.
+/// \param compare true if the counts of the baseline are comparable with this build.
+/// \param tolerance Allowed increase in %.
+/// \param change Returns the change in %, 0 if not compared.
+/// \return true if the count exceeds the tolerance.
+static bool Benchmark_CheckCount(double const value, double const baseline, bool const compare,
+                                 double const tolerance, double * const change)
+    {
+    *change = 0.0;
+    if((value == BENCHMARK_NO_COUNT) || (baseline == BENCHMARK_NO_COUNT))
+        {
+        return false;
+        }
+
+    *change = Benchmark_Change(value, baseline);
+    return compare && (*change > tolerance);
+    }
+//------------------------------------------------------------------------------
+
+int main(int argc, char * argv[])
+    {
+    BENCHMARK_OPTIONS options = { BENCHMARK_BASELINE_DEFAULT, NULL, false, 20000u, 5u, 3.0, 0.0 };
+    BENCHMARK_BASELINE_ENTRY baseline[NUM_BENCHMARKS];
+    BENCHMARK_RESULT results[NUM_BENCHMARKS];
+    bool inBaseline[NUM_BENCHMARKS];
+    bool valid[NUM_BENCHMARKS];
+    char toolchain[BENCHMARK_TOOLCHAIN_MAX];
+    char baselineToolchain[BENCHMARK_TOOLCHAIN_MAX];
+    char baselineBuild[BENCHMARK_TOOLCHAIN_MAX];
+    char const * const build = BENCHMARK_STRING(BENCHMARK_BUILD_FLAGS);
+    char instructions[32];
+    char cycles[32];
+    bool haveBaseline;
+    bool compareCounts;
+    bool regression = false;
+    bool failed = false;
+    double instructionsChange;
+    double cyclesChange;
+    char const * verdict;
+    U32 i;
+    int arg;
+
+    for(arg = 1; arg < argc; arg++)
+        {
+        if(strcmp(argv[arg], "--update") == 0)
+            {
+            options.update = true;
+            }
+        else if((arg + 1) >= argc)
+            {
+            fprintf(stderr, "usage: %s [--baseline file] [--update] [--filter text] [--iterations n] "
+                    "[--repetitions n] [--instructions-tolerance %%] [--cycles-tolerance %%]\n", argv[0]);
+            return 2;
+            }
+        else if(strcmp(argv[arg], "--baseline") == 0)
+            {
+            options.baselinePath = argv[++arg];
+            }
+        else if(strcmp(argv[arg], "--filter") == 0)
+            {
+            options.filter = argv[++arg];
+            }
+        else if(strcmp(argv[arg], "--iterations") == 0)
+            {
+            options.iterations = (U32) strtoul(argv[++arg], NULL, 0);
+            }
+        else if(strcmp(argv[arg], "--repetitions") == 0)
+            {
+            options.repetitions = (U32) strtoul(argv[++arg], NULL, 0);
+            }
+        else if(strcmp(argv[arg], "--instructions-tolerance") == 0)
+            {
+            options.instructionsTolerance = strtod(argv[++arg], NULL);
+            }
+        else if(strcmp(argv[arg], "--cycles-tolerance") == 0)
+            {
+            options.cyclesTolerance = strtod(argv[++arg], NULL);
+            }
+        else
+            {
+            fprintf(stderr, "unknown option %s\n", argv[arg]);
+            return 2;
+            }
+        }
+
+    if((options.iterations == 0u) || (options.repetitions == 0u))
+        {
+        fprintf(stderr, "iterations and repetitions must not be 0\n");
+        return 2;
+        }
+
+    Benchmark_GetToolchain(toolchain, sizeof(toolchain));
+    haveBaseline = Benchmark_ReadBaseline(options.baselinePath, baselineToolchain, baselineBuild, baseline, inBaseline);
+    if(!haveBaseline)
+        {
+        memset(inBaseline, 0, sizeof(inBaseline));
+        if(!options.update)
+            {
+            fprintf(stderr, "no baseline %s, results are only reported\n", options.baselinePath);
+            }
+        }
+
+    // Zählerstände hängen von Compiler und Optionen ab
+    compareCounts = haveBaseline && (strcmp(toolchain, baselineToolchain) == 0) && (strcmp(build, baselineBuild) == 0);
+    if(haveBaseline && !compareCounts && !options.update)
+        {
+        fprintf(stderr, "baseline of toolchain \"%s\" build \"%s\", this build \"%s\" build \"%s\": "
+                "counts are only reported\n", baselineToolchain, baselineBuild, toolchain, build);
+        }
+
+    if(!Benchmark_OpenInstructionCounter())
+        {
+        fprintf(stderr, "no instruction counter (perf_event), counting cycles only\n");
+        }
+
+    printf("%-18s %-10s %14s %9s %12s %9s %10s\n", "benchmark", "config", "instructions", "change", "cycles", "change",
+           "ns");
+    for(i = 0; i < NUM_BENCHMARKS; i++)
+        {
+        valid[i] = false;
+        if((options.filter != NULL) && (strstr(benchmarks[i].name, options.filter) == NULL))
+            {
+            // Beim Aktualisieren bleiben die Werte der nicht gemessenen Benchmarks erhalten
+            if(inBaseline[i])
+                {
+                results[i] = baseline[i].result;
+                valid[i] = true;
+                }
+            continue;
+            }
+
+        if(!Benchmark_Run(&benchmarks[i], &options, &results[i]))
+            {
+            failed = true;
+            continue;
+            }
+        valid[i] = true;
+
+        instructionsChange = 0.0;
+        cyclesChange = 0.0;
+        verdict = "new";
+        if(inBaseline[i])
+            {
+            verdict = "ok";
+            if(Benchmark_CheckCount(results[i].instructions, baseline[i].result.instructions, compareCounts,
+                                    options.instructionsTolerance, &instructionsChange))
+                {
+                verdict = "REGRESSION";
+                }
+            if(Benchmark_CheckCount(results[i].cycles, baseline[i].result.cycles,
+                                    compareCounts && (options.cyclesTolerance > 0.0), options.cyclesTolerance,
+                                    &cyclesChange))
+                {
+                verdict = "REGRESSION";
+                }
+            if(strcmp(verdict, "REGRESSION") == 0)
+                {
+                regression = true;
+                }
+            }
+
+        printf("%-18s %-10s %14s %+8.1f%% %12s %+8.1f%% %10.1f %s\n", benchmarks[i].name, benchmarks[i].configuration,
+               Benchmark_FormatCount(instructions, sizeof(instructions), results[i].instructions), instructionsChange,
+               Benchmark_FormatCount(cycles, sizeof(cycles), results[i].cycles), cyclesChange, results[i].ns, verdict);
+        }
+
+    if(options.update)
+        {
+        if(failed)
+            {
+            fprintf(stderr, "baseline not written, a benchmark failed\n");
+            return 2;
+            }
+        if(!Benchmark_WriteBaseline(options.baselinePath, toolchain, build, results, valid))
+            {
+            fprintf(stderr, "cannot write %s\n", options.baselinePath);
+            return 2;
+            }
+        printf("baseline %s written\n", options.baselinePath);
+        return 0;
+        }
+
+    if(failed)
+        {
+        return 2;
+        }
+
+    return regression ? 1 : 0;
+    }
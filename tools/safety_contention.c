@@ -0,0 +1,286 @@
+/*******************************************************************************
+ * Copyright (c) 2026 TWK-ELEKTRONIK GmbH. All rights reserved.
+ ******************************************************************************/
+
+/*
+ * Messung von Jitter und Mutex-Konflikten der Sicherheitstask unter Last.
+ *
+ * Läuft mit dem POSIX-Backend des RTOS_AL (rtos_al_posix.h) echt nebenläufig
+ * unter Linux. Eine periodische Sicherheitstask zählt wie die
+ * Programmablaufüberwachung unter einem Mutex, daneben laufen Lastgeneratoren
+ * wie die 1-kHz-Tasks der Applikation, optional mit demselben Mutex.
+ *
+ * Ausgabe nach Ablauf der Messdauer:
+ *
+ *     safety cycles, Weckabweichung (Maximum, Mittelwert, Histogramm in µs)
+ *     mutex takes, Konflikte, Wartezeit (Maximum, Mittelwert)
+ *     load cycles pro Lastgenerator
+ *
+ * Echtzeitprioritäten (SCHED_FIFO) erfordern CAP_SYS_NICE oder RLIMIT_RTPRIO,
+ * sonst laufen alle Tasks mit der Standard-Policy und der Jitter enthält das
+ * Scheduling des Hosts.
+ *
+ * Übersetzen:
+ *
+ *     gcc -O2 -pthread <GLOBAL_DEFINES> -I<LibCert> -I. \
+ *         tools/safety_contention.c tools/rtos_al_posix.c -o safety_contention
+ *
+ * Für Messungen mit der unveränderten Safety_Task() werden statt der
+ * nachgebildeten Sicherheitstask safety_rtos.c, safety_runtime.c und die
+ * Programmablaufüberwachung mit diesem Backend gelinkt.
+ *
+ * Aufruf:
+ *     safety_contention [--duration s] [--safety-period ticks] [--safety-busy us]
+ *                       [--safety-priority n] [--loads n] [--load-period ticks]
+ *                       [--load-busy us] [--load-priority n] [--shared-mutex]
+ */
+
+// Headerdateien einbinden -----------------------------------------------------
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "config/version.h"
+
+#include "RTOS_AL/RTOS_AL.h"
+
+#include "rtos_al_posix.h"
+
+// Allgemeine Definitionen -----------------------------------------------------
+
+/// Maximum number of load generators.
+#define CONTENTION_LOADS_MAX        (8u)
+
+/// Number of buckets of the jitter histogram.
+#define CONTENTION_JITTER_BUCKETS   (6u)
+
+/// Upper limits of the buckets of the jitter histogram in µs, the last bucket counts all larger values.
+static U32 const jitterBucketLimitUs[CONTENTION_JITTER_BUCKETS - 1u] = { 10u, 50u, 100u, 500u, 1000u };
+
+/// Configuration of the emulated safety task.
+typedef struct
+{
+    U32 period;         ///< Period in ticks, as TASK_PARA_STD::taskDelay
+    U32 busyUs;         ///< Busy time per cycle in µs
+} CONTENTION_SAFETY;
+
+/// Measurements of the emulated safety task.
+typedef struct
+{
+    U32 cycles;                                     ///< Completed cycles
+    U64 jitterNsTotal;                              ///< Sum of the wake-up deviations in ns
+    U64 jitterNsMax;                                ///< Largest wake-up deviation in ns
+    U32 jitterHistogram[CONTENTION_JITTER_BUCKETS]; ///< Histogram of the wake-up deviation
+} CONTENTION_RESULT;
+
+// externe Variablen -----------------------------------------------------------
+
+/// Mutex of the program flow counting.
+static RTOS_MUTEX progFlowMutex;
+
+/// Program flow counter, incremented under the mutex.
+static U32 progFlowCounter = 0;
+
+/// Task object of the safety task.
+static RTOS_TASK safetyTask;
+
+/// Configuration of the safety task.
+static CONTENTION_SAFETY safetyConfig = { 2u, 50u };
+
+/// Measurements of the safety task, written under the program flow mutex.
+static CONTENTION_RESULT safetyResult;
+
+/// Load generators.
+static RTOS_POSIX_LOAD loads[CONTENTION_LOADS_MAX];
+
+// Funktionsbereich ------------------------------------------------------------
+
+/// Busy-waits for a time.
+/// \param busyUs Time in µs.
+static void Contention_Busy(U32 const busyUs)
+    {
+    U64 const busyEnd = RtosPosix_GetTimeNs() + ((U64) busyUs * 1000u);
+
+    while(RtosPosix_GetTimeNs() < busyEnd)
+        {
+        }
+    }
+//------------------------------------------------------------------------------
+
+/// Emulated safety task: wakes up periodically, measures the deviation from the
+/// wake-up time and counts the program flow under the mutex.
+/// \param parameter @ref CONTENTION_SAFETY.
+static void Contention_SafetyTask(void * parameter)
+    {
+    CONTENTION_SAFETY const * const config = (CONTENTION_SAFETY const *) parameter;
+    RTOS_TIME lastWakeTime = RTOS_GetTime();
+    U64 wakeTimeNs;
+    U64 jitterNs;
+    U32 bucket;
+
+    for(;;)
+        {
+        RTOS_DelayUntil(&lastWakeTime, config->period);
+
+        // Abweichung vom Weckzeitpunkt, lastWakeTime ist das Ziel von RTOS_DelayUntil()
+        wakeTimeNs = ((U64) lastWakeTime * 1000000000u) / RTOS_TICK_RATE;
+        jitterNs = RtosPosix_GetTimeNs() - wakeTimeNs;
+
+        // Messwerte unter dem Mutex, main() liest sie ebenso
+        (void) RTOS_MutexTake(&progFlowMutex, RTOS_MAX_TIMEOUT);
+        progFlowCounter++;
+
+        for(bucket = 0; bucket < (CONTENTION_JITTER_BUCKETS - 1u); bucket++)
+            {
+            if(jitterNs < ((U64) jitterBucketLimitUs[bucket] * 1000u))
+                {
+                break;
+                }
+            }
+        safetyResult.jitterHistogram[bucket]++;
+        safetyResult.jitterNsTotal += jitterNs;
+        if(jitterNs > safetyResult.jitterNsMax)
+            {
+            safetyResult.jitterNsMax = jitterNs;
+            }
+        safetyResult.cycles++;
+
+        Contention_Busy(config->busyUs);
+        (void) RTOS_MutexGive(&progFlowMutex);
+        }
+    }
+//------------------------------------------------------------------------------
+
+int main(int argc, char * argv[])
+    {
+    CONTENTION_RESULT result;
+    RTOS_POSIX_MUTEX_STATISTICS mutexStatistics;
+    char loadName[16];
+    U32 progFlow;
+    U32 durationS = 5u;
+    U32 safetyPriority = 10u;
+    U32 numLoads = 2u;
+    U32 loadPeriod = 1u;
+    U32 loadBusyUs = 200u;
+    U32 loadPriority = 5u;
+    bool sharedMutex = false;
+    U32 i;
+    int arg;
+
+    for(arg = 1; arg < argc; arg++)
+        {
+        if(strcmp(argv[arg], "--shared-mutex") == 0)
+            {
+            sharedMutex = true;
+            }
+        else if((arg + 1) >= argc)
+            {
+            fprintf(stderr, "usage: %s [--duration s] [--safety-period ticks] [--safety-busy us] "
+                    "[--safety-priority n] [--loads n] [--load-period ticks] [--load-busy us] "
+                    "[--load-priority n] [--shared-mutex]\n", argv[0]);
+            return 1;
+            }
+        else if(strcmp(argv[arg], "--duration") == 0)
+            {
+            durationS = (U32) strtoul(argv[++arg], NULL, 0);
+            }
+        else if(strcmp(argv[arg], "--safety-period") == 0)
+            {
+            safetyConfig.period = (U32) strtoul(argv[++arg], NULL, 0);
+            }
+        else if(strcmp(argv[arg], "--safety-busy") == 0)
+            {
+            safetyConfig.busyUs = (U32) strtoul(argv[++arg], NULL, 0);
+            }
+        else if(strcmp(argv[arg], "--safety-priority") == 0)
+            {
+            safetyPriority = (U32) strtoul(argv[++arg], NULL, 0);
+            }
+        else if(strcmp(argv[arg], "--loads") == 0)
+            {
+            numLoads = (U32) strtoul(argv[++arg], NULL, 0);
+            }
+        else if(strcmp(argv[arg], "--load-period") == 0)
+            {
+            loadPeriod = (U32) strtoul(argv[++arg], NULL, 0);
+            }
+        else if(strcmp(argv[arg], "--load-busy") == 0)
+            {
+            loadBusyUs = (U32) strtoul(argv[++arg], NULL, 0);
+            }
+        else if(strcmp(argv[arg], "--load-priority") == 0)
+            {
+            loadPriority = (U32) strtoul(argv[++arg], NULL, 0);
+            }
+        else
+            {
+            fprintf(stderr, "unknown option %s\n", argv[arg]);
+            return 1;
+            }
+        }
+
+    if((numLoads > CONTENTION_LOADS_MAX) || (safetyConfig.period == 0u) || (loadPeriod == 0u))
+        {
+        fprintf(stderr, "at most %u loads, periods must not be 0\n", CONTENTION_LOADS_MAX);
+        return 1;
+        }
+
+    if(!RTOS_MutexCreate(&progFlowMutex)
+       || !RTOS_TaskCreate(&safetyTask, "Safety", Contention_SafetyTask, (U8) safetyPriority, &safetyConfig))
+        {
+        fprintf(stderr, "creation of the safety task failed\n");
+        return 1;
+        }
+
+    for(i = 0; i < numLoads; i++)
+        {
+        loads[i].period = loadPeriod;
+        loads[i].busyUs = loadBusyUs;
+        loads[i].mutex = sharedMutex ? &progFlowMutex : NULL;
+        snprintf(loadName, sizeof(loadName), "Load%u", (unsigned) i);
+        if(!RtosPosix_CreateLoad(&loads[i], loadName, (U8) loadPriority))
+            {
+            fprintf(stderr, "creation of load %u failed\n", (unsigned) i);
+            return 1;
+            }
+        }
+
+    RtosPosix_Start();
+    sleep(durationS);
+
+    // Zyklus der Sicherheitstask abschließen lassen, dann eine konsistente Kopie nehmen
+    (void) RTOS_MutexTake(&progFlowMutex, RTOS_MAX_TIMEOUT);
+    result = safetyResult;
+    progFlow = progFlowCounter;
+    (void) RTOS_MutexGive(&progFlowMutex);
+    (void) RtosPosix_GetMutexStatistics(&progFlowMutex, &mutexStatistics);
+
+    printf("scheduling      %s\n", RtosPosix_IsRealtime() ? "SCHED_FIFO" : "default policy (no real-time permission)");
+    printf("safety cycles   %u, program flow %u\n", (unsigned) result.cycles, (unsigned) progFlow);
+    printf("wake-up jitter  max %.1f us, mean %.1f us\n", (double) result.jitterNsMax / 1000.0,
+           (result.cycles != 0u) ? ((double) result.jitterNsTotal / 1000.0) / (double) result.cycles : 0.0);
+    for(i = 0; i < CONTENTION_JITTER_BUCKETS; i++)
+        {
+        if(i < (CONTENTION_JITTER_BUCKETS - 1u))
+            {
+            printf("  < %4u us      %u\n", (unsigned) jitterBucketLimitUs[i], (unsigned) result.jitterHistogram[i]);
+            }
+        else
+            {
+            printf("  >= %3u us      %u\n", (unsigned) jitterBucketLimitUs[i - 1u], (unsigned) result.jitterHistogram[i]);
+            }
+        }
+    printf("mutex           %u takes, %u contended, %u timeouts, wait max %.1f us, mean %.1f us\n",
+           (unsigned) mutexStatistics.takes, (unsigned) mutexStatistics.contended, (unsigned) mutexStatistics.timeouts,
+           (double) mutexStatistics.waitNsMax / 1000.0,
+           (mutexStatistics.contended != 0u)
+               ? ((double) mutexStatistics.waitNsTotal / 1000.0) / (double) mutexStatistics.contended : 0.0);
+    for(i = 0; i < numLoads; i++)
+        {
+        printf("load %u cycles   %u\n", (unsigned) i, (unsigned) __atomic_load_n(&loads[i].cycles, __ATOMIC_RELAXED));
+        }
+
+    // Die Tasks laufen endlos, der Prozess endet mit main()
+    return 0;
+    }
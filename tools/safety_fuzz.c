@@ -0,0 +1,1049 @@
+/*******************************************************************************
+ * Copyright (c) 2026 TWK-ELEKTRONIK GmbH. All rights reserved.
+ ******************************************************************************/
+
+/*
+ * Fuzzing der Mess- und Grenzwertlogik der Versorgungsspannungsüberwachung.
+ *
+ * Das unveränderte Safety_Powersupply_ContextCheck() wird mit Messwerten aus
+ * der Eingabe des Fuzzers betrieben, die Treiber sind hier ersetzt. Nach jedem
+ * Zyklus und bei jedem Ereignis und Hard-Error werden die Invarianten der
+ * Überwachung geprüft, eine Verletzung beendet den Lauf mit abort():
+ *
+ *  (#) Statusbits werden nur gesetzt, nie gelöscht (sysPowerStat,
+ *      sysTemperatureStat, Bereitschaft der Quellen, Fehlerbits des externen
+ *      ADC).
+ *  (#) Kein Ereignis ohne Zustandswechsel: Jedes Fehler- oder Warnereignis
+ *      gehört zu genau einem Statusbit, das im selben Zyklus gesetzt wurde.
+ *  (#) Hard-Errors nur mit Grund: Grenzwert-Hard-Errors nur mit neu gesetztem
+ *      Fehlerbit und Messwert jenseits des Grenzwerts, Mess-Hard-Errors nur,
+ *      wenn ein Treiber im selben Zyklus keinen Wert geliefert hat.
+ *  (#) Kein verpasster Hard-Error: Nach einem vollständigen Zyklus liegt kein
+ *      Messwert jenseits eines Fehlergrenzwerts.
+ *
+ * Die Datei bindet safety_powersupply.c direkt ein, damit Grenzwerte, Statusbits
+ * und Kontext des Moduls ohne zusätzliche Schnittstelle geprüft werden können.
+ *
+ * Aufbau der Eingabe:
+ *
+ *     Byte 0..1   Konfiguration, Bit n aktiviert das n-te Feld von
+ *                 SAFETY_POWERSUPPLY_CONFIG (Little Endian)
+ *     Byte 2      Startzeit in Ticks << 24, für den Überlauf des Tickzählers
+ *     je Zyklus   1 Byte vergangene Ticks, 1 Byte Steuerung (FUZZ_CONTROL_...),
+ *                 danach 2 Bytes pro Messwert in der Reihenfolge der Abfragen
+ *
+ * Ein Messwert 0xFFFF ist ein Fehler des internen ADC. Der Lauf endet mit dem
+ * ersten Hard-Error, wie das Gerät, oder am Ende der Eingabe.
+ *
+ * Übersetzen mit den Konfigurations-Defines des Geräts (GLOBAL_DEFINES):
+ *
+ *   libFuzzer:
+ *     clang -O2 -g -fsanitize=fuzzer,address,undefined <GLOBAL_DEFINES> -I<LibCert> -I. \
+ *         tools/safety_fuzz.c safety_filter.c safety_temperature.c \
+ *         <Host-Build von DataProcess_Averaging> -o safety_fuzz
+ *     safety_fuzz -max_len=4096 corpus/
+ *
+ *   AFL++ und Wiedergabe gefundener Eingaben (eigenes main()):
+ *     afl-clang-fast -O2 -DSAFETY_FUZZ_STANDALONE=1 <wie oben> -o safety_fuzz
+ *     afl-fuzz -i tools/safety_fuzz_seeds -o findings -- ./safety_fuzz @@
+ *     safety_fuzz crash-... [weitere Eingaben]
+ *
+ *   gcc ohne Fuzzer (eigenes main() mit einfachem Mutationsmodus):
+ *     gcc -O2 -g -fsanitize=address,undefined -DSAFETY_FUZZ_STANDALONE=1 <GLOBAL_DEFINES> \
+ *         -I<LibCert> -I. tools/safety_fuzz.c safety_filter.c safety_temperature.c \
+ *         <Host-Build von DataProcess_Averaging> -lm -o safety_fuzz
+ *     safety_fuzz tools/safety_fuzz_seeds/seed-*
+ *     safety_fuzz --mutate 1000000 --seed 1 tools/safety_fuzz_seeds/seed-*
+ *
+ * Der Saatkorpus tools/safety_fuzz_seeds erzeugt tools/gen_fuzz_seeds.py. Im
+ * Mutationsmodus ändert das eigenständige Programm die Eingaben reihum mit
+ * zufälligen Bit-, Byte- und ADC-Fehler-Mutationen. Eine Eingabe, die eine
+ * Invariante verletzt, wird vor dem Abbruch als crash-<seed>-<lauf> gespeichert.
+ * Sanitizer-Befunde werden mit demselben --seed reproduziert.
+ *
+ * Das eigenständige Programm gibt die Anzahl der Zyklen und den Durchsatz aus.
+ */
+
+// Headerdateien einbinden -----------------------------------------------------
+#include <setjmp.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// Modul direkt einbinden, damit Grenzwerte, Statusbits und Kontext sichtbar sind
+#include "safety_powersupply.c"
+
+#if FEATURE_SAFETY_RECORD_REPLAY
+#error "safety_fuzz supplies the measurements itself, FEATURE_SAFETY_RECORD_REPLAY must be 0"
+#endif
+
+#if FEATURE_SAFETY_EVENT_QUEUE
+#error "safety_fuzz checks the events at SendErrorMsgEvent(), FEATURE_SAFETY_EVENT_QUEUE must be 0"
+#endif
+
+// Allgemeine Definitionen -----------------------------------------------------
+
+#ifndef SAFETY_FUZZ_STANDALONE
+/// Builds an own main() for AFL++, for the reproduction of inputs and for the
+/// mutation mode without fuzzer, without it the harness is linked with libFuzzer.
+#define SAFETY_FUZZ_STANDALONE      (0)
+#endif
+
+/// Size of the input header: configuration and start time.
+#define FUZZ_HEADER_SIZE            (3u)
+
+/// Raw value reported as failure of the internal ADC.
+#define FUZZ_RAW_ADC_FAILURE        (0xFFFFu)
+
+/// Voltage of one step of the raw value at the pin of the internal ADC in V.
+/// The range exceeds the reference voltage slightly.
+#define FUZZ_ADC_VOLT_PER_LSB       (3.6f / 65534.0f)
+
+/// Normalized value of the external ADC at the largest raw value. A multiple
+/// of the measuring range, so that the limits are reached with every divider.
+#define FUZZ_EXT_ADC_FULL_SCALE     (8.0f)
+
+/// Temperature of one step of the raw value of the TMP144 in °C (signed raw value).
+#define FUZZ_TMP144_DEG_PER_LSB     (0.01f)
+
+/// Maximum number of mutations of an input in the mutation mode of the standalone program.
+#define FUZZ_MUTATIONS_MAX          (8u)
+
+/// Control bits of a cycle.
+typedef enum
+{
+    FUZZ_CONTROL_ADC_READY = 0x01,      //!< Signal the readiness of the internal ADC before the cycle
+    FUZZ_CONTROL_EXT_ADC = 0x02,        //!< The external ADC provides new values in this cycle
+    FUZZ_CONTROL_TMP144 = 0x04,         //!< The TMP144 provides a new value in this cycle
+} FUZZ_CONTROL;
+
+/// Status bits of the monitor that must not be cleared. Only U32 members,
+/// the invariants check them word by word.
+typedef struct
+{
+    U32 sysPowerStat;                                           ///< System power voltage status
+#if defined(fpADCIN_TEMPERATURE) || defined(TMP144_UART_CHANNEL)
+    U32 sysTemperatureStat;                                     ///< System temperature status
+#endif
+    U32 sourceReady;                                            ///< Ready sources
+#if ((MAX116XX_FEAT_4CHANNEL_ADC) || (MAX116XX_FEAT_12CHANNEL_ADC))
+    U32 externalAdcActive[SAFETY_POWERSUPPLY_EXT_ADC_STAT_WORDS];       ///< Monitored channels of the external ADC
+    U32 externalAdcErrorLow[SAFETY_POWERSUPPLY_EXT_ADC_STAT_WORDS];     ///< Channels of the external ADC with too low voltage
+    U32 externalAdcErrorHigh[SAFETY_POWERSUPPLY_EXT_ADC_STAT_WORDS];    ///< Channels of the external ADC with too high voltage
+#endif
+} FUZZ_STATUS;
+
+/// Number of words of @ref FUZZ_STATUS.
+#define FUZZ_STATUS_WORDS           (sizeof(FUZZ_STATUS) / sizeof(U32))
+
+/// Word of a member of @ref FUZZ_STATUS.
+#define FUZZ_STATUS_WORD(member)    (offsetof(FUZZ_STATUS, member) / sizeof(U32))
+
+/// State of a run over one input.
+typedef struct
+{
+    U8 const * data;            ///< Input of the fuzzer
+    size_t size;                ///< Size of the input
+    size_t position;            ///< Next unread byte
+    RTOS_TIME ticks;            ///< Virtual time
+    U8 control;                 ///< Control bits of the current cycle, @ref FUZZ_CONTROL
+    bool driverFailed;          ///< A driver provided no value in the current cycle
+    F32 temperature;            ///< Last value of the TMP144 in °C
+    U32 cycles;                 ///< Completed cycles
+    U32 status[FUZZ_STATUS_WORDS];      ///< Status at the start of the cycle
+    U32 reported[FUZZ_STATUS_WORDS];    ///< Status bits reported with an event in the current cycle
+} FUZZ_RUN;
+
+// externe Variablen -----------------------------------------------------------
+
+/// Run over the current input.
+static FUZZ_RUN fuzz;
+
+/// Monitor under test.
+static SAFETY_POWERSUPPLY_CONTEXT fuzzContext;
+
+/// Channel configuration of the monitor.
+static SAFETY_POWERSUPPLY_CONFIG fuzzConfig;
+
+/// Return point of a hard error.
+static jmp_buf fuzzHardErrorReturn;
+
+/// Completed cycles of all runs, for the throughput of the standalone program.
+static U64 fuzzCyclesTotal = 0;
+
+#if SAFETY_FUZZ_STANDALONE
+/// File for the current input if it violates an invariant, empty for none.
+static char fuzzCrashFile[64];
+#endif
+
+// Funktionsbereich Invarianten ------------------------------------------------
+
+/// Reports a violated invariant and aborts, so that the fuzzer keeps the input.
+/// \param text Description of the violation.
+static void Fuzz_Violation(char const * const text) __attribute__ ((noreturn));
+
+static void Fuzz_Violation(char const * const text)
+    {
+#if SAFETY_FUZZ_STANDALONE
+    FILE * file;
+#endif
+
+    fprintf(stderr, "invariant violated in cycle %u at %u ticks: %s\n", (unsigned) fuzz.cycles, (unsigned) fuzz.ticks, text);
+
+#if SAFETY_FUZZ_STANDALONE
+    // Mutierte Eingaben existieren nur im Speicher
+    if(fuzzCrashFile[0] != '\0')
+        {
+        file = fopen(fuzzCrashFile, "wb");
+        if(file != NULL)
+            {
+            (void) fwrite(fuzz.data, 1u, fuzz.size, file);
+            fclose(file);
+            fprintf(stderr, "input saved as %s\n", fuzzCrashFile);
+            }
+        }
+#endif
+    abort();
+    }
+//------------------------------------------------------------------------------
+
+/// Copies the status bits of the monitor.
+/// \param status Destination, @ref FUZZ_STATUS_WORDS words.
+static void Fuzz_GetStatus(U32 * const status)
+    {
+    FUZZ_STATUS current;
+
+    memset(&current, 0, sizeof(current));
+    current.sysPowerStat = fuzzContext.sysPowerStat;
+#if defined(fpADCIN_TEMPERATURE) || defined(TMP144_UART_CHANNEL)
+    current.sysTemperatureStat = (U32) fuzzContext.sysTemperatureStat;
+#endif
+    current.sourceReady = fuzzContext.sourceReady;
+#if ((MAX116XX_FEAT_4CHANNEL_ADC) || (MAX116XX_FEAT_12CHANNEL_ADC))
+    memcpy(current.externalAdcActive, fuzzContext.externalAdcActive, sizeof(current.externalAdcActive));
+    memcpy(current.externalAdcErrorLow, fuzzContext.externalAdcErrorLow, sizeof(current.externalAdcErrorLow));
+    memcpy(current.externalAdcErrorHigh, fuzzContext.externalAdcErrorHigh, sizeof(current.externalAdcErrorHigh));
+#endif
+
+    memcpy(status, &current, sizeof(current));
+    }
+//------------------------------------------------------------------------------
+
+/// Checks that no status bit of the start of the cycle was cleared.
+/// \param status Current status, @ref FUZZ_STATUS_WORDS words.
+static void Fuzz_CheckMonotonic(U32 const * const status)
+    {
+    U32 i;
+
+    for(i = 0; i < FUZZ_STATUS_WORDS; i++)
+        {
+        if((status[i] & fuzz.status[i]) != fuzz.status[i])
+            {
+            Fuzz_Violation("status bit cleared");
+            }
+        }
+    }
+//------------------------------------------------------------------------------
+
+/// Returns the status bit that belongs to an error or warning event.
+/// \param event Event.
+/// \param upper Upper level error byte, the channel.
+/// \param intermediate Intermediate level error byte, the error.
+/// \param lower Lower level error byte.
+/// \param word Return of the word of @ref FUZZ_STATUS.
+/// \param mask Return of the bit.
+/// \return false if no status bit belongs to the event.
+static bool Fuzz_EventStatusBit(U32 const event, U8 const upper, U8 const intermediate, U8 const lower,
+                                U32 * const word, U32 * const mask)
+    {
+    *word = FUZZ_STATUS_WORD(sysPowerStat);
+    *mask = 0u;
+
+    if((event == eEVENT_VCC_CHECK_ERROR) && (upper == eERROR_SUPPLY_VOLTAGE))
+        {
+        if(intermediate == eERROR_VOLTAGE_EXCEEDED_MIN)
+            {
+            *mask = eSYSPWR_STAT_ERROR_VCC_LOW;
+            }
+        else if(intermediate == eERROR_VOLTAGE_VCC_DROPOUT)
+            {
+            *mask = eSYSPWR_STAT_ERROR_VCC_DROPOUT;
+            }
+        }
+    else if((event == eEVENT_VCC_CHECK_WARNING) && (upper == eERROR_SUPPLY_VOLTAGE))
+        {
+        if(intermediate == eERROR_VOLTAGE_EXCEEDED_MIN)
+            {
+            *mask = eSYSPWR_STAT_WARNING_VCC_LOW;
+            }
+        else if(intermediate == eERROR_VOLTAGE_EXCEEDED_MAX)
+            {
+            *mask = eSYSPWR_STAT_WARNING_VCC_HIGH;
+            }
+        }
+    else if((event == eEVENT_VCC_CHECK_ERROR) && (intermediate == eERROR_VOLTAGE_EXCEEDED_MIN)
+            && (upper >= eERROR_INTERNAL_VOLTAGE_1) && (upper <= eERROR_INTERNAL_VOLTAGE_5))
+        {
+        // Die Fehlerbits VCC1_LOW bis VCC5_LOW liegen im Abstand von zwei Bits
+        *mask = (U32) eSYSPWR_STAT_ERROR_VCC1_LOW << (2u * (U32) (upper - eERROR_INTERNAL_VOLTAGE_1));
+        }
+#if ((MAX116XX_FEAT_4CHANNEL_ADC) || (MAX116XX_FEAT_12CHANNEL_ADC))
+    else if((event == eEVENT_VCC_CHECK_ERROR) && (intermediate == eERROR_VOLTAGE_EXCEEDED_MIN)
+            && (upper >= eERROR_EXTERNAL_ADC_VOLTAGE_1) && (upper <= eERROR_EXTERNAL_ADC_VOLTAGE_N))
+        {
+        U32 const index = (upper == eERROR_EXTERNAL_ADC_VOLTAGE_N) ? lower : (U32) (upper - eERROR_EXTERNAL_ADC_VOLTAGE_1);
+
+        // Die ersten drei Kanäle melden sich nur über das obere Fehlerbyte
+        if(((upper == eERROR_EXTERNAL_ADC_VOLTAGE_N) && (index < 3u))
+                || ((upper != eERROR_EXTERNAL_ADC_VOLTAGE_N) && (lower != ERROR_BYTE_LOWER_LEVEL_FILL_ZERO))
+                || (index >= SAFETY_POWERSUPPLY_EXT_ADC_CHANNELS_MAX))
+            {
+            return false;
+            }
+
+        *word = FUZZ_STATUS_WORD(externalAdcErrorLow) + EXT_ADC_STAT_WORD(index);
+        *mask = EXT_ADC_STAT_BIT(index);
+        return true;
+        }
+#endif
+    else if((event == eEVENT_POWER_CHECK) && (upper == eERROR_SUPPLY_POWER) && (intermediate == eERROR_POWER_EXCEEDED_MAX))
+        {
+        *mask = eSYSPWR_STAT_WARNING_POWER_HIGH;
+        }
+#if defined(fpADCIN_TEMPERATURE) || defined(TMP144_UART_CHANNEL)
+    else if((event == eEVENT_TEMPERATURE) && (upper == eERROR_SYSTEM_TEMPERATURE))
+        {
+        *word = FUZZ_STATUS_WORD(sysTemperatureStat);
+        if(intermediate == eERROR_TEMPERATURE_EXCEEDED_MIN)
+            {
+            *mask = eSYSTMP_STAT_WARNING_TMP_LOW;
+            }
+        else if(intermediate == eERROR_TEMPERATURE_EXCEEDED_MAX)
+            {
+            *mask = eSYSTMP_STAT_WARNING_TMP_HIGH;
+            }
+        }
+#endif
+
+    return (*mask != 0u) && (lower == ERROR_BYTE_LOWER_LEVEL_FILL_ZERO);
+    }
+//------------------------------------------------------------------------------
+
+/// Checks that an event reports a status bit set in the current cycle, each
+/// bit only once.
+/// \param event Event.
+/// \param upper Upper level error byte.
+/// \param intermediate Intermediate level error byte.
+/// \param lower Lower level error byte.
+static void Fuzz_CheckEvent(U32 const event, U8 const upper, U8 const intermediate, U8 const lower)
+    {
+    U32 status[FUZZ_STATUS_WORDS];
+    U32 word;
+    U32 mask;
+
+    if(!Fuzz_EventStatusBit(event, upper, intermediate, lower, &word, &mask))
+        {
+        Fuzz_Violation("event without status bit");
+        }
+
+    Fuzz_GetStatus(status);
+    if(((status[word] & mask) == 0u) || ((fuzz.status[word] & mask) != 0u))
+        {
+        Fuzz_Violation("event without state change");
+        }
+    if((fuzz.reported[word] & mask) != 0u)
+        {
+        Fuzz_Violation("event reported twice");
+        }
+
+    fuzz.reported[word] |= mask;
+    }
+//------------------------------------------------------------------------------
+
+/// Checks a voltage hard error: at least one upper error bit was set in the
+/// current cycle and every new upper error bit has its voltage above the limit.
+/// \param status Current status, @ref FUZZ_STATUS_WORDS words.
+/// \return true if the hard error is justified.
+static bool Fuzz_VoltageExceeded(U32 const * const status)
+    {
+    U32 const newPowerStat = status[FUZZ_STATUS_WORD(sysPowerStat)] & ~fuzz.status[FUZZ_STATUS_WORD(sysPowerStat)];
+    bool exceeded = false;
+#if ((MAX116XX_FEAT_4CHANNEL_ADC) || (MAX116XX_FEAT_12CHANNEL_ADC))
+    U32 newErrorHigh;
+    U8 i;
+#endif
+
+#ifdef fpADCIN_VCC
+    if((newPowerStat & eSYSPWR_STAT_ERROR_VCC_HIGH) != 0u)
+        {
+        if((U32) fuzzContext.lPowerVoltage <= fuzzContext.vccLimitMaxMillivolt)
+            {
+            return false;
+            }
+        exceeded = true;
+        }
+#endif
+#ifdef fpADCIN_VCC1
+    if((newPowerStat & eSYSPWR_STAT_ERROR_VCC1_HIGH) != 0u)
+        {
+        if(!((U32) fuzzContext.lPowerVoltage1 > VOLTAGE_1_LIMIT_MAX_MILLIVOLT))
+            {
+            return false;
+            }
+        exceeded = true;
+        }
+#endif
+#ifdef fpADCIN_VCC2
+    if((newPowerStat & eSYSPWR_STAT_ERROR_VCC2_HIGH) != 0u)
+        {
+        if(!((U32) fuzzContext.lPowerVoltage2 > VOLTAGE_2_LIMIT_MAX_MILLIVOLT))
+            {
+            return false;
+            }
+        exceeded = true;
+        }
+#endif
+#ifdef fpADCIN_VCC3
+    if((newPowerStat & eSYSPWR_STAT_ERROR_VCC3_HIGH) != 0u)
+        {
+        if(!((U32) fuzzContext.lPowerVoltage3 > VOLTAGE_3_LIMIT_MAX_MILLIVOLT))
+            {
+            return false;
+            }
+        exceeded = true;
+        }
+#endif
+#ifdef fpADCIN_VCC4
+    if((newPowerStat & eSYSPWR_STAT_ERROR_VCC4_HIGH) != 0u)
+        {
+        if(!((U32) fuzzContext.lPowerVoltage4 > VOLTAGE_4_LIMIT_MAX_MILLIVOLT))
+            {
+            return false;
+            }
+        exceeded = true;
+        }
+#endif
+#ifdef fpADCIN_VCC5
+    if((newPowerStat & eSYSPWR_STAT_ERROR_VCC5_HIGH) != 0u)
+        {
+        if(!((U32) fuzzContext.lPowerVoltage5 > VOLTAGE_5_LIMIT_MAX_MILLIVOLT))
+            {
+            return false;
+            }
+        exceeded = true;
+        }
+#endif
+#if ((MAX116XX_FEAT_4CHANNEL_ADC) || (MAX116XX_FEAT_12CHANNEL_ADC))
+    for(i = 0; i < fuzzContext.externalAdcChannelCount; i++)
+        {
+        newErrorHigh = status[FUZZ_STATUS_WORD(externalAdcErrorHigh) + EXT_ADC_STAT_WORD(i)]
+                       & ~fuzz.status[FUZZ_STATUS_WORD(externalAdcErrorHigh) + EXT_ADC_STAT_WORD(i)];
+        if((newErrorHigh & EXT_ADC_STAT_BIT(i)) != 0u)
+            {
+            if(!(fuzzContext.externalAdcState[i].voltage > fuzzContext.externalAdcChannels[i].limitMaxVolt))
+                {
+                return false;
+                }
+            exceeded = true;
+            }
+        }
+#endif
+
+    return exceeded;
+    }
+//------------------------------------------------------------------------------
+
+/// Checks the reason of a hard error.
+/// \param hardErrorCode Code of the hard error.
+/// \param isPermanent true for a permanent hard error.
+static void Fuzz_CheckHardError(U8 const hardErrorCode, bool const isPermanent)
+    {
+    U32 status[FUZZ_STATUS_WORDS];
+#ifdef TMP144_UART_CHANNEL
+    U32 const newTemperatureStat = (U32) fuzzContext.sysTemperatureStat & ~fuzz.status[FUZZ_STATUS_WORD(sysTemperatureStat)];
+    F32 temperatureValue;
+    S32 temperatureMillidegree;
+#endif
+
+    Fuzz_GetStatus(status);
+    Fuzz_CheckMonotonic(status);
+
+    switch(hardErrorCode)
+        {
+        case HARD_ERR_SAFETY_MEASUREMENT:
+            if(!fuzz.driverFailed)
+                {
+                Fuzz_Violation("measurement hard error without driver failure");
+                }
+            break;
+
+        case HARD_ERR_VOLTAGE_EXCEEDED:
+            if(!isPermanent || !Fuzz_VoltageExceeded(status))
+                {
+                Fuzz_Violation("voltage hard error within the limits");
+                }
+            break;
+
+#if defined(fpADCIN_ICC) && defined(fpADCIN_VCC)
+        case HARD_ERR_POWER_EXCEEDED:
+            if(!isPermanent || ((status[FUZZ_STATUS_WORD(sysPowerStat)] & ~fuzz.status[FUZZ_STATUS_WORD(sysPowerStat)]
+                                 & eSYSPWR_STAT_ERROR_POWER_HIGH) == 0u)
+                    || !(fuzzContext.ulPower > POWER_LIMIT_MAX_MILLIWATT))
+                {
+                Fuzz_Violation("power hard error within the limit");
+                }
+            break;
+#endif
+
+#ifdef TMP144_UART_CHANNEL
+        case HARD_ERR_TEMPERATURE_EXCEEDED:
+            // Rundung wie im Modul, systemTemperature ist erst nach den Prüfungen aktualisiert
+            temperatureValue = fuzz.temperature * DECIMAL_FIXPOINT;
+            temperatureMillidegree = (S32) ((temperatureValue < 0.0f) ? (temperatureValue - 0.5f) : (temperatureValue + 0.5f));
+            if(!isPermanent
+                    || !(((newTemperatureStat & eSYSTMP_STAT_ERROR_TMP_LOW) && (temperatureMillidegree < TEMPERATURE_ERROR_MIN_MILLIDEG))
+                         || ((newTemperatureStat & eSYSTMP_STAT_ERROR_TMP_HIGH) && (temperatureMillidegree > TEMPERATURE_ERROR_MAX_MILLIDEG))))
+                {
+                Fuzz_Violation("temperature hard error within the limits");
+                }
+            break;
+#endif
+
+        default:
+            Fuzz_Violation("unexpected hard error");
+            break;
+        }
+    }
+//------------------------------------------------------------------------------
+
+/// Checks after a completed cycle that no measured value is beyond an error
+/// limit, the monitor must have entered the hard error state before.
+static void Fuzz_CheckLimits(void)
+    {
+#if ((MAX116XX_FEAT_4CHANNEL_ADC) || (MAX116XX_FEAT_12CHANNEL_ADC))
+    U8 i;
+#endif
+
+#if defined(fpADCIN_VCC) && !SYSPWR_VCC_FILTER_MEDIAN
+    // Mit dem Medianfilter vergleicht das Modul bei einem Einbruch den Medianausgang
+    if((U32) fuzzContext.lPowerVoltage > fuzzContext.vccLimitMaxMillivolt)
+        {
+        Fuzz_Violation("supply voltage above the limit without hard error");
+        }
+#endif
+#ifdef fpADCIN_VCC1
+    if((U32) fuzzContext.lPowerVoltage1 > VOLTAGE_1_LIMIT_MAX_MILLIVOLT)
+        {
+        Fuzz_Violation("voltage 1 above the limit without hard error");
+        }
+#endif
+#ifdef fpADCIN_VCC2
+    if((U32) fuzzContext.lPowerVoltage2 > VOLTAGE_2_LIMIT_MAX_MILLIVOLT)
+        {
+        Fuzz_Violation("voltage 2 above the limit without hard error");
+        }
+#endif
+#ifdef fpADCIN_VCC3
+    if((U32) fuzzContext.lPowerVoltage3 > VOLTAGE_3_LIMIT_MAX_MILLIVOLT)
+        {
+        Fuzz_Violation("voltage 3 above the limit without hard error");
+        }
+#endif
+#ifdef fpADCIN_VCC4
+    if((U32) fuzzContext.lPowerVoltage4 > VOLTAGE_4_LIMIT_MAX_MILLIVOLT)
+        {
+        Fuzz_Violation("voltage 4 above the limit without hard error");
+        }
+#endif
+#ifdef fpADCIN_VCC5
+    if((U32) fuzzContext.lPowerVoltage5 > VOLTAGE_5_LIMIT_MAX_MILLIVOLT)
+        {
+        Fuzz_Violation("voltage 5 above the limit without hard error");
+        }
+#endif
+#if defined(fpADCIN_ICC) && defined(fpADCIN_VCC)
+    if(fuzzContext.ulPower > POWER_LIMIT_MAX_MILLIWATT)
+        {
+        Fuzz_Violation("power above the limit without hard error");
+        }
+#endif
+#ifdef TMP144_UART_CHANNEL
+    if((fuzzContext.systemTemperature < TEMPERATURE_ERROR_MIN_MILLIDEG)
+            || (fuzzContext.systemTemperature > TEMPERATURE_ERROR_MAX_MILLIDEG))
+        {
+        Fuzz_Violation("temperature beyond the limits without hard error");
+        }
+#endif
+#if ((MAX116XX_FEAT_4CHANNEL_ADC) || (MAX116XX_FEAT_12CHANNEL_ADC))
+    for(i = 0; i < fuzzContext.externalAdcChannelCount; i++)
+        {
+        if(((fuzzContext.externalAdcActive[EXT_ADC_STAT_WORD(i)] & EXT_ADC_STAT_BIT(i)) != 0u)
+                && (fuzzContext.externalAdcState[i].voltage > fuzzContext.externalAdcChannels[i].limitMaxVolt))
+            {
+            Fuzz_Violation("external adc voltage above the limit without hard error");
+            }
+        }
+#endif
+    }
+//------------------------------------------------------------------------------
+
+// Funktionsbereich Ersatzfunktionen -------------------------------------------
+
+/// Reads the next raw measurement from the input, 0 at the end of the input.
+/// \return Raw value.
+static U16 Fuzz_ReadRaw(void)
+    {
+    U16 raw;
+
+    if((fuzz.size - fuzz.position) < 2u)
+        {
+        fuzz.position = fuzz.size;
+        return 0u;
+        }
+
+    raw = (U16) (fuzz.data[fuzz.position] | ((U16) fuzz.data[fuzz.position + 1u] << 8));
+    fuzz.position += 2u;
+    return raw;
+    }
+//------------------------------------------------------------------------------
+
+#if ((MAX116XX_FEAT_4CHANNEL_ADC) || (MAX116XX_FEAT_12CHANNEL_ADC))
+/// Fills the values of the monitored channels of the external ADC from the input.
+/// \param values Values of all external ADCs.
+static void Fuzz_FillExternalAdc(MAX116XX_ADC_VALUES * const values)
+    {
+    SAFETY_POWERSUPPLY_EXT_ADC_CHANNEL const * channel;
+    U8 i;
+
+    for(i = 0; i < fuzzContext.externalAdcChannelCount; i++)
+        {
+        if((fuzzContext.externalAdcActive[EXT_ADC_STAT_WORD(i)] & EXT_ADC_STAT_BIT(i)) != 0u)
+            {
+            channel = &fuzzContext.externalAdcChannels[i];
+            values[channel->adc].f32Data[channel->channel] = ((F32) Fuzz_ReadRaw() * FUZZ_EXT_ADC_FULL_SCALE) / 65535.0f;
+            }
+        }
+    }
+//------------------------------------------------------------------------------
+#endif
+
+RTOS_TIME RTOS_GetTime(void)
+    {
+    return fuzz.ticks;
+    }
+
+eADC_RESULT ADC_InitSingleChannel(U32 pin)
+    {
+    (void) pin;
+    return eADC_TRUE;
+    }
+
+eADC_RESULT ADC_SampleSingleChannel(U32 pin, float * value)
+    {
+    U16 const raw = Fuzz_ReadRaw();
+
+    (void) pin;
+    if(raw == FUZZ_RAW_ADC_FAILURE)
+        {
+        fuzz.driverFailed = true;
+        return eADC_FALSE;
+        }
+
+    *value = (F32) raw * FUZZ_ADC_VOLT_PER_LSB;
+    return eADC_TRUE;
+    }
+
+void ADC_TemperatureSensorEnable(void)
+    {
+    }
+
+void ADC_TemperatureSensorDisable(void)
+    {
+    }
+
+#ifdef TMP144_UART_CHANNEL
+bool TMP144_TemperatureValuePeek(float * value)
+    {
+    if((fuzz.control & FUZZ_CONTROL_TMP144) == 0u)
+        {
+        fuzz.driverFailed = true;
+        return false;
+        }
+
+    fuzz.temperature = (F32) (S16) Fuzz_ReadRaw() * FUZZ_TMP144_DEG_PER_LSB;
+    *value = fuzz.temperature;
+    return true;
+    }
+#endif
+
+#if ((MAX116XX_FEAT_4CHANNEL_ADC) || (MAX116XX_FEAT_12CHANNEL_ADC)) && !FEATURE_SAFETY_POWERSUPPLY_EXTERNAL_ADC_FRAMES
+bool MAX116XX_AdcValuesPeek(MAX116XX_ADC_VALUES * list)
+    {
+    if((fuzz.control & FUZZ_CONTROL_EXT_ADC) == 0u)
+        {
+        fuzz.driverFailed = true;
+        return false;
+        }
+
+    Fuzz_FillExternalAdc(list);
+    return true;
+    }
+#endif
+
+bool SendMsgEvent(U32 event, U32 value)
+    {
+    // Die Überwachung sendet nur Fehler- und Warnereignisse
+    (void) event;
+    (void) value;
+    Fuzz_Violation("event without state change");
+    }
+
+bool SendErrorMsgEvent(U32 event, U8 upper, U8 intermediate, U8 lower)
+    {
+    Fuzz_CheckEvent(event, upper, intermediate, lower);
+    return true;
+    }
+
+/// Checks a hard error and ends the run, as the device stops the monitoring.
+/// \param hardErrorCode Code of the hard error.
+/// \param isPermanent true for a permanent hard error.
+static void Fuzz_HardError(U8 const hardErrorCode, bool const isPermanent) __attribute__ ((noreturn));
+
+static void Fuzz_HardError(U8 const hardErrorCode, bool const isPermanent)
+    {
+    Fuzz_CheckHardError(hardErrorCode, isPermanent);
+    longjmp(fuzzHardErrorReturn, 1);
+    }
+
+void Safety_HardError(U8 const hardErrorCode)
+    {
+    Fuzz_HardError(hardErrorCode, false);
+    }
+
+void Safety_PermanentHardError(U8 const hardErrorCode)
+    {
+    Fuzz_HardError(hardErrorCode, true);
+    }
+
+// Funktionsbereich ------------------------------------------------------------
+
+/// Sets the channel configuration from the configuration bits of the input.
+/// \param bits Bit n activates the n-th member of @ref SAFETY_POWERSUPPLY_CONFIG.
+static void Fuzz_Configure(U16 const bits)
+    {
+    memset(&fuzzConfig, 0, sizeof(fuzzConfig));
+    fuzzConfig.supplyVoltageIsActive = (bits >> 0) & 1u;
+    fuzzConfig.voltage1IsActive = (bits >> 1) & 1u;
+    fuzzConfig.voltage2IsActive = (bits >> 2) & 1u;
+    fuzzConfig.voltage3IsActive = (bits >> 3) & 1u;
+    fuzzConfig.voltage4IsActive = (bits >> 4) & 1u;
+    fuzzConfig.voltage5IsActive = (bits >> 5) & 1u;
+    fuzzConfig.voltageExternalAdcChannel1IsActive = (bits >> 6) & 1u;
+    fuzzConfig.voltageExternalAdcChannel2IsActive = (bits >> 7) & 1u;
+    fuzzConfig.voltageExternalAdcChannel3IsActive = (bits >> 8) & 1u;
+    fuzzConfig.currentIsActive = (bits >> 9) & 1u;
+    fuzzConfig.temperatureSensorIsActive = (bits >> 10) & 1u;
+    fuzzConfig.temperatureAdcIsActive = (bits >> 11) & 1u;
+    }
+//------------------------------------------------------------------------------
+
+/// Runs the monitor over one input of the fuzzer.
+/// \param data Input.
+/// \param size Size of the input.
+/// \return 0, violations abort.
+int LLVMFuzzerTestOneInput(uint8_t const * data, size_t size)
+    {
+    U32 status[FUZZ_STATUS_WORDS];
+
+    if(size < FUZZ_HEADER_SIZE)
+        {
+        return 0;
+        }
+
+    memset(&fuzz, 0, sizeof(fuzz));
+    memset(&fuzzContext, 0, sizeof(fuzzContext));
+    fuzz.data = data;
+    fuzz.size = size;
+    fuzz.position = FUZZ_HEADER_SIZE;
+    fuzz.ticks = (RTOS_TIME) ((U32) data[2] << 24);
+    Fuzz_Configure((U16) (data[0] | ((U16) data[1] << 8)));
+
+#if ((MAX116XX_FEAT_4CHANNEL_ADC) || (MAX116XX_FEAT_12CHANNEL_ADC)) && FEATURE_SAFETY_POWERSUPPLY_EXTERNAL_ADC_FRAMES
+    // Doppelpuffer des Moduls, sonst gelten die Frames des vorherigen Laufs
+    memset(externalAdcFrames, 0, sizeof(externalAdcFrames));
+    externalAdcFrameSequence = 0u;
+#endif
+
+    // Konfigurationen, die das Gerät nicht startet, sind kein Befund
+    if(!Safety_Powersupply_ContextInit(&fuzzContext, &fuzzConfig))
+        {
+        return 0;
+        }
+
+    while((fuzz.size - fuzz.position) >= 2u)
+        {
+        fuzz.ticks += fuzz.data[fuzz.position];
+        fuzz.control = fuzz.data[fuzz.position + 1u];
+        fuzz.position += 2u;
+        fuzz.driverFailed = false;
+
+        if((fuzz.control & FUZZ_CONTROL_ADC_READY) != 0u)
+            {
+            Safety_Powersupply_ContextSignalSourceReady(&fuzzContext, eSAFETY_POWERSUPPLY_SOURCE_ADC);
+            }
+
+#if ((MAX116XX_FEAT_4CHANNEL_ADC) || (MAX116XX_FEAT_12CHANNEL_ADC)) && FEATURE_SAFETY_POWERSUPPLY_EXTERNAL_ADC_FRAMES
+        // Der Task des externen ADC veröffentlicht vor dem Zyklus, ohne Frame fehlen die Werte
+        if((fuzz.control & FUZZ_CONTROL_EXT_ADC) != 0u)
+            {
+            Fuzz_FillExternalAdc(Safety_Powersupply_GetExternalAdcFrameBuffer());
+            Safety_Powersupply_PublishExternalAdcFrame();
+            }
+        else if(externalAdcFrameSequence == 0u)
+            {
+            fuzz.driverFailed = true;
+            }
+#endif
+
+        Fuzz_GetStatus(fuzz.status);
+        memset(fuzz.reported, 0, sizeof(fuzz.reported));
+
+        if(setjmp(fuzzHardErrorReturn) != 0)
+            {
+            // Hard-Error geprüft, das Gerät beendet die Überwachung
+            fuzzCyclesTotal += fuzz.cycles + 1u;
+            return 0;
+            }
+
+        (void) Safety_Powersupply_ContextCheck(&fuzzContext);
+
+        Fuzz_GetStatus(status);
+        Fuzz_CheckMonotonic(status);
+        Fuzz_CheckLimits();
+        fuzz.cycles++;
+        }
+
+    fuzzCyclesTotal += fuzz.cycles;
+    return 0;
+    }
+//------------------------------------------------------------------------------
+
+#if SAFETY_FUZZ_STANDALONE
+/// Reads an input from a file.
+/// \param file Open file.
+/// \param data Returns the allocated input.
+/// \param size Returns the size of the input.
+/// \return false if the file could not be read.
+static bool Fuzz_ReadFile(FILE * const file, U8 ** const data, size_t * const size)
+    {
+    U8 * buffer = NULL;
+    size_t capacity = 0;
+    U8 * grown;
+
+    *size = 0;
+
+    // Eingaben beliebiger Länge, z.B. lange Aufzeichnungen für Durchsatzmessungen
+    for(;;)
+        {
+        if(*size == capacity)
+            {
+            grown = realloc(buffer, (capacity != 0u) ? (capacity * 2u) : 65536u);
+            if(grown == NULL)
+                {
+                free(buffer);
+                return false;
+                }
+            buffer = grown;
+            capacity = (capacity != 0u) ? (capacity * 2u) : 65536u;
+            }
+
+        *size += fread(&buffer[*size], 1u, capacity - *size, file);
+        if(ferror(file))
+            {
+            free(buffer);
+            return false;
+            }
+        if(feof(file))
+            {
+            break;
+            }
+        }
+
+    *data = buffer;
+    return true;
+    }
+//------------------------------------------------------------------------------
+
+/// Pseudo random number generator of the mutation mode (xorshift32).
+/// \param state State, not 0.
+/// \return Next random number.
+static U32 Fuzz_Random(U32 * const state)
+    {
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return *state;
+    }
+//------------------------------------------------------------------------------
+
+/// Runs mutations of the inputs, the inputs in turn.
+/// \param inputs Inputs.
+/// \param sizes Sizes of the inputs.
+/// \param count Number of inputs.
+/// \param runs Number of runs.
+/// \param seed Start value of the random numbers.
+/// \return false if no memory is available.
+static bool Fuzz_RunMutations(U8 * const * const inputs, size_t const * const sizes, int const count,
+                              U32 const runs, U32 const seed)
+    {
+    U32 state = (seed != 0u) ? seed : 1u;
+    size_t capacity = 0;
+    U8 * buffer;
+    size_t size;
+    size_t position;
+    U32 mutations;
+    U32 run;
+    U32 i;
+    int input;
+
+    for(input = 0; input < count; input++)
+        {
+        capacity = (sizes[input] > capacity) ? sizes[input] : capacity;
+        }
+
+    buffer = malloc((capacity != 0u) ? capacity : 1u);
+    if(buffer == NULL)
+        {
+        return false;
+        }
+
+    for(run = 0; run < runs; run++)
+        {
+        input = (int) (run % (U32) count);
+        size = sizes[input];
+        memcpy(buffer, inputs[input], size);
+
+        mutations = (size != 0u) ? (1u + (Fuzz_Random(&state) % FUZZ_MUTATIONS_MAX)) : 0u;
+        for(i = 0; i < mutations; i++)
+            {
+            position = Fuzz_Random(&state) % size;
+            switch(Fuzz_Random(&state) % 4u)
+                {
+                case 0:
+                    buffer[position] ^= (U8) (1u << (Fuzz_Random(&state) % 8u));
+                    break;
+
+                case 1:
+                    buffer[position] = (U8) Fuzz_Random(&state);
+                    break;
+
+                case 2:
+                    // Fehler des internen ADC, falls an der Stelle ein Messwert gelesen wird
+                    buffer[position] = 0xFFu;
+                    buffer[(position + 1u) % size] = 0xFFu;
+                    break;
+
+                default:
+                    buffer[position] = 0x00u;
+                    break;
+                }
+            }
+
+        (void) snprintf(fuzzCrashFile, sizeof(fuzzCrashFile), "crash-%u-%u", (unsigned) seed, (unsigned) run);
+        (void) LLVMFuzzerTestOneInput(buffer, size);
+        }
+
+    fuzzCrashFile[0] = '\0';
+    free(buffer);
+    return true;
+    }
+//------------------------------------------------------------------------------
+
+int main(int argc, char * argv[])
+    {
+    struct timespec startTime;
+    struct timespec endTime;
+    double seconds;
+    FILE * file;
+    U8 ** inputs;
+    size_t * sizes;
+    U32 runs = 0;
+    U32 seed = 1;
+    int first = 1;
+    int count;
+    int i;
+
+    while(((first + 1) < argc) && (strncmp(argv[first], "--", 2) == 0))
+        {
+        if(strcmp(argv[first], "--mutate") == 0)
+            {
+            runs = (U32) strtoul(argv[first + 1], NULL, 0);
+            }
+        else if(strcmp(argv[first], "--seed") == 0)
+            {
+            seed = (U32) strtoul(argv[first + 1], NULL, 0);
+            }
+        else
+            {
+            fprintf(stderr, "unknown option %s\n", argv[first]);
+            return 1;
+            }
+        first += 2;
+        }
+
+    // Ohne Dateien eine Eingabe von stdin
+    count = (first < argc) ? (argc - first) : 1;
+    inputs = calloc((size_t) count, sizeof(*inputs));
+    sizes = calloc((size_t) count, sizeof(*sizes));
+    if((inputs == NULL) || (sizes == NULL))
+        {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+        }
+
+    for(i = 0; i < count; i++)
+        {
+        file = (first < argc) ? fopen(argv[first + i], "rb") : stdin;
+        if((file == NULL) || !Fuzz_ReadFile(file, &inputs[i], &sizes[i]))
+            {
+            fprintf(stderr, "cannot read %s\n", (first < argc) ? argv[first + i] : "stdin");
+            return 1;
+            }
+        if(file != stdin)
+            {
+            fclose(file);
+            }
+        }
+
+    clock_gettime(CLOCK_MONOTONIC, &startTime);
+
+    for(i = 0; i < count; i++)
+        {
+        (void) LLVMFuzzerTestOneInput(inputs[i], sizes[i]);
+        }
+
+    if((runs > 0u) && !Fuzz_RunMutations(inputs, sizes, count, runs, seed))
+        {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+        }
+
+    clock_gettime(CLOCK_MONOTONIC, &endTime);
+    seconds = (double) (endTime.tv_sec - startTime.tv_sec) + ((double) (endTime.tv_nsec - startTime.tv_nsec) / 1e9);
+
+    fprintf(stderr, "%d inputs, %u mutations, %llu cycles in %.3f s, %.2f million cycles/s\n", count, (unsigned) runs,
+            (unsigned long long) fuzzCyclesTotal, seconds, (seconds > 0.0) ? ((double) fuzzCyclesTotal / seconds) / 1e6 : 0.0);
+
+    for(i = 0; i < count; i++)
+        {
+        free(inputs[i]);
+        }
+    free(inputs);
+    free(sizes);
+    return 0;
+    }
+//------------------------------------------------------------------------------
+#endif
@@ -0,0 +1,250 @@
+/*******************************************************************************
+ * Copyright (c) 2026 TWK-ELEKTRONIK GmbH. All rights reserved.
+ ******************************************************************************/
+
+/*
+ * Wiedergabe einer Aufzeichnung der Versorgungsspannungsüberwachung auf dem Host.
+ *
+ * Die Aufzeichnung (Safety_Record_Export(), siehe safety_record.h) wird in den
+ * Speicher eingeblendet und Zyklus für Zyklus durch das unveränderte
+ * Safety_Powersupply_Check() geführt. Die Zeit läuft virtuell mit den Ticks der
+ * Aufzeichnung, eine Woche Feldaufzeichnung ist damit in Sekunden ausgewertet.
+ *
+ * Ausgabe, eine Zeile pro Ereignis:
+ *
+ *     <ticks> EVENT <event> <value>
+ *     <ticks> ERROR <event> <upper> <intermediate> <lower>
+ *     <ticks> TEMPERATURE <milligrad> <status>
+ *     <ticks> HARDERROR <code> [permanent]
+ *
+ * Übersetzen mit den Konfigurations-Defines des Geräts (GLOBAL_DEFINES), damit
+ * Kanäle, Grenzwerte und Filter der Firmware entsprechen:
+ *
+ *     gcc -O2 -DFEATURE_SAFETY_RECORD_REPLAY=1 <GLOBAL_DEFINES> -I<LibCert> -I. \
+ *         tools/safety_replay.c safety_powersupply.c safety_record.c safety_filter.c \
+ *         safety_temperature.c <Host-Build von DataProcess_Averaging> -o safety_replay
+ *
+ * Die Treiberfunktionen der Hardware sind hier schwach definiert. Die Messwerte
+ * liefert im Wiedergabebetrieb ausschließlich die Aufzeichnung.
+ *
+ * Aufruf:
+ *     safety_replay [--continue] aufzeichnung.bin
+ *
+ * Ohne --continue endet die Wiedergabe mit dem ersten Hard-Error, wie das Gerät.
+ */
+
+// Headerdateien einbinden -----------------------------------------------------
+#include <fcntl.h>
+#include <setjmp.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "config/version.h"
+
+#include "RTOS_AL/RTOS_AL.h"
+#include "ADC/ADC_Driver.h"
+#include "EventSystem/Event.h"
+#include "Devices_ADC_MAX116XX/MAX116XX.h"
+
+#include "safety_startup.h"
+#include "safety_powersupply.h"
+#include "safety_record.h"
+
+#if !FEATURE_SAFETY_RECORD_REPLAY
+#error "safety_replay requires FEATURE_SAFETY_RECORD_REPLAY=1"
+#endif
+
+// externe Variablen -----------------------------------------------------------
+
+/// Virtual time, ticks of the replayed cycle.
+static RTOS_TIME replayTicks = 0;
+
+/// Return point of a hard error within the current cycle.
+static jmp_buf hardErrorReturn;
+
+/// Set while a cycle is replayed and a hard error can return to the loop.
+static bool hardErrorArmed = false;
+
+/// Number of reported hard errors.
+static U32 hardErrorCount = 0;
+
+// Funktionsbereich Ersatzfunktionen -------------------------------------------
+
+RTOS_TIME RTOS_GetTime(void)
+    {
+    return replayTicks;
+    }
+
+TWK_WEAK eADC_RESULT ADC_InitSingleChannel(U32 pin)
+    {
+    (void) pin;
+    return eADC_TRUE;
+    }
+
+TWK_WEAK void ADC_TemperatureSensorEnable(void)
+    {
+    }
+
+TWK_WEAK void ADC_TemperatureSensorDisable(void)
+    {
+    }
+
+bool SendMsgEvent(U32 event, U32 value)
+    {
+    printf("%u EVENT %u %u\n", (unsigned) replayTicks, (unsigned) event, (unsigned) value);
+    return true;
+    }
+
+bool SendErrorMsgEvent(U32 event, U8 upper, U8 intermediate, U8 lower)
+    {
+    printf("%u ERROR %u %u %u %u\n", (unsigned) replayTicks, (unsigned) event, upper, intermediate, lower);
+    return true;
+    }
+
+void Safety_TemperatureChangedHook(float temperature, SYSTEM_TEMPERATURE_STATUS const temperatureState)
+    {
+    printf("%u TEMPERATURE %d %d\n", (unsigned) replayTicks, (int) temperature, (int) temperatureState);
+    }
+
+/// Reports a hard error and returns to the replay loop.
+/// \param hardErrorCode Code of the hard error.
+/// \param isPermanent true for a permanent hard error.
+static void Replay_HardError(U8 const hardErrorCode, bool const isPermanent) __attribute__ ((noreturn));
+
+static void Replay_HardError(U8 const hardErrorCode, bool const isPermanent)
+    {
+    printf("%u HARDERROR %u%s\n", (unsigned) replayTicks, hardErrorCode, isPermanent ? " permanent" : "");
+    hardErrorCount++;
+
+    if(!hardErrorArmed)
+        {
+        // Hard-Error während der Initialisierung
+        _exit(2);
+        }
+
+    longjmp(hardErrorReturn, 1);
+    }
+
+void Safety_HardError(U8 const hardErrorCode)
+    {
+    Replay_HardError(hardErrorCode, false);
+    }
+
+void Safety_PermanentHardError(U8 const hardErrorCode)
+    {
+    Replay_HardError(hardErrorCode, true);
+    }
+
+// Funktionsbereich ------------------------------------------------------------
+
+int main(int argc, char * argv[])
+    {
+    static SAFETY_RECORD_HEADER header;
+    char const * path = NULL;
+    bool continueAfterHardError = false;
+    struct timespec startTime;
+    struct timespec endTime;
+    struct stat fileStat;
+    U8 const * data;
+    U32 firstTicks = 0;
+    U32 cycles = 0;
+    U32 ticks;
+    int file;
+    int i;
+
+    for(i = 1; i < argc; i++)
+        {
+        if(strcmp(argv[i], "--continue") == 0)
+            {
+            continueAfterHardError = true;
+            }
+        else
+            {
+            path = argv[i];
+            }
+        }
+
+    if(path == NULL)
+        {
+        fprintf(stderr, "usage: %s [--continue] recording.bin\n", argv[0]);
+        return 1;
+        }
+
+    file = open(path, O_RDONLY);
+    if((file < 0) || (fstat(file, &fileStat) != 0) || (fileStat.st_size == 0))
+        {
+        fprintf(stderr, "cannot open %s\n", path);
+        return 1;
+        }
+
+    data = mmap(NULL, (size_t) fileStat.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+    if(data == MAP_FAILED)
+        {
+        fprintf(stderr, "cannot map %s\n", path);
+        return 1;
+        }
+
+    if(!Safety_Record_ReplayStart(data, (U32) fileStat.st_size, &header))
+        {
+        fprintf(stderr, "%s is no recording of version %u\n", path, SAFETY_RECORD_VERSION);
+        return 1;
+        }
+
+    if(header.ticksPerMs != (U8) configTICK_RATE_HZ_MS)
+        {
+        fprintf(stderr, "warning: recorded with %u ticks/ms, replay uses %u ticks/ms\n",
+                header.ticksPerMs, (unsigned) configTICK_RATE_HZ_MS);
+        }
+    if(header.droppedCycles > 0u)
+        {
+        fprintf(stderr, "note: %u cycles were overwritten before the recording, the filters start cold\n",
+                (unsigned) header.droppedCycles);
+        }
+
+    clock_gettime(CLOCK_MONOTONIC, &startTime);
+
+    replayTicks = header.startTicks;
+    if(!Safety_Powersuply_Init(&header.config))
+        {
+        fprintf(stderr, "initialization of the power supply monitoring failed\n");
+        return 1;
+        }
+
+    while(Safety_Record_ReplayNextCycle(&ticks))
+        {
+        if(cycles == 0u)
+            {
+            firstTicks = ticks;
+            }
+        replayTicks = ticks;
+        cycles++;
+
+        if(setjmp(hardErrorReturn) == 0)
+            {
+            hardErrorArmed = true;
+            (void) Safety_Powersupply_Check();
+            }
+        else if(!continueAfterHardError)
+            {
+            break;
+            }
+        hardErrorArmed = false;
+        }
+
+    clock_gettime(CLOCK_MONOTONIC, &endTime);
+
+    fprintf(stderr, "%u cycles, %.1f s recorded, replayed in %.3f s, %u hard errors, %u mismatches\n",
+            (unsigned) cycles,
+            (double) (U32) (replayTicks - firstTicks) / ((double) ((header.ticksPerMs != 0u) ? header.ticksPerMs : 1u) * 1000.0),
+            (double) (endTime.tv_sec - startTime.tv_sec) + ((double) (endTime.tv_nsec - startTime.tv_nsec) / 1e9),
+            (unsigned) hardErrorCount, (unsigned) Safety_Record_ReplayGetMismatches());
+
+    munmap((void *) data, (size_t) fileStat.st_size);
+    close(file);
+
+    return (Safety_Record_ReplayGetMismatches() != 0u) ? 3 : 0;
+    }